@@ -0,0 +1,39 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+/* Atomic operations on integers shared between threads. Without thread
+   support they are plain arithmetic. */
+
+#ifdef GT_THREADS_ENABLED
+/* Adds <V> to the integer <PTR> points to and returns its previous value. */
+#define gt_atomic_fetch_add(PTR, V) \
+        __sync_fetch_and_add(PTR, V)
+/* Subtracts <V> from the integer <PTR> points to and returns its previous
+   value. */
+#define gt_atomic_fetch_sub(PTR, V) \
+        __sync_fetch_and_sub(PTR, V)
+#else
+#define gt_atomic_fetch_add(PTR, V) \
+        ((*(PTR) += (V)) - (V))
+#define gt_atomic_fetch_sub(PTR, V) \
+        ((*(PTR) -= (V)) + (V))
+#endif
+
+#endif
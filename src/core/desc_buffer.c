@@ -109,6 +109,33 @@ void gt_desc_buffer_finish(GtDescBuffer *db)
   db->finished = true;
 }
 
+void gt_desc_buffer_move_finished(GtDescBuffer *dest, GtDescBuffer *src)
+{
+  GtUword numoffinished, idx, startpos;
+  gt_assert(dest && src && dest != src);
+
+  numoffinished = gt_queue_size(src->startqueue);
+  if (!src->finished && numoffinished > 0)
+    numoffinished--;
+  for (idx = 0; idx < numoffinished; idx++) {
+    const char *desc;
+    startpos = (GtUword) gt_queue_get(src->startqueue);
+    for (desc = src->buf + startpos; *desc != '\0'; desc++)
+      gt_desc_buffer_append_char(dest, *desc);
+    gt_desc_buffer_finish(dest);
+  }
+  if (gt_queue_size(src->startqueue) > 0) {
+    /* keep the unfinished description at the start of the buffer */
+    startpos = (GtUword) gt_queue_get(src->startqueue);
+    gt_assert(startpos <= src->length);
+    memmove(src->buf, src->buf + startpos,
+            (src->length - startpos) * sizeof (char));
+    src->length -= startpos;
+    gt_queue_add(src->startqueue, (void*) 0);
+  } else
+    src->length = 0;
+}
+
 GtUword gt_desc_buffer_length(const GtDescBuffer *db)
 {
   return db ? db->length : 0;
@@ -243,5 +270,31 @@ int gt_desc_buffer_unit_test(GtError *err)
   gt_ensure(gt_desc_buffer_length(s) == 12);
   gt_desc_buffer_delete(s);
 
+  if (!had_err) {
+    GtDescBuffer *t;
+    s = gt_desc_buffer_new();
+    t = gt_desc_buffer_new();
+    for (j = 0; j < 3; j++) {
+      for (i = 0; i < strlen(strs[j]); i++) {
+        gt_desc_buffer_append_char(s, strs[j][i]);
+      }
+      if (j < 2)
+        gt_desc_buffer_finish(s);
+    }
+    gt_desc_buffer_move_finished(t, s);
+    gt_ensure(gt_desc_buffer_length(t) == 8);
+    gt_ensure(gt_desc_buffer_length(s) == 3);
+    gt_desc_buffer_finish(s);
+    gt_desc_buffer_move_finished(t, s);
+    gt_ensure(gt_desc_buffer_length(s) == 0);
+    for (j = 0; !had_err && j < 3; j++) {
+      ret = gt_desc_buffer_get_next(t);
+      gt_ensure(strcmp(ret, strs[j]) == 0);
+    }
+    gt_ensure(gt_desc_buffer_max_length(t) == 4);
+    gt_desc_buffer_delete(s);
+    gt_desc_buffer_delete(t);
+  }
+
   return had_err;
 }
@@ -36,6 +36,11 @@ const char*   gt_desc_buffer_get_next(GtDescBuffer *db);
 /* Append character <c> to <db>. */
 void          gt_desc_buffer_append_char(GtDescBuffer *db, char c);
 void          gt_desc_buffer_finish(GtDescBuffer *db);
+/* Append all finished descriptions not read so far from <src> to <dest> and
+   remove them from <src>. A description which is not finished yet remains in
+   <src>. */
+void          gt_desc_buffer_move_finished(GtDescBuffer *dest,
+                                           GtDescBuffer *src);
 /* Reset <db> to length 0. */
 void          gt_desc_buffer_reset(GtDescBuffer *db);
 /* Returns the maximum length of any description passed through <db>. */
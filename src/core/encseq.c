@@ -57,6 +57,7 @@
 #include "core/sequence_buffer_fasta.h"
 #include "core/sequence_buffer_plain.h"
 #include "core/str.h"
+#include "core/thread_api.h"
 #include "core/timer_api.h"
 #include "core/types_api.h"
 #include "core/undef_api.h"
@@ -982,6 +983,7 @@ static int flushssptab2file(const char *indexname,
 
 static int fillssptabmapspecstartptr(GtEncseq *encseq,
                                      const char *indexname,
+                                     unsigned int placement,
                                      GtError *err)
 {
   bool haserr = false;
@@ -1004,9 +1006,9 @@ static int fillssptabmapspecstartptr(GtEncseq *encseq,
   ssptransferinfo.numofdbsequences = encseq->numofdbsequences;
   ssptransferinfo.satsep = encseq->satsep;
   ssptransferinfo.ssptabptr = &encseq->ssptab;
-  if (gt_mapspec_read(assignssptabmapspecification, &ssptransferinfo,
-                      gt_str_get(tmpfilename),
-                      sizessptab, &encseq->ssptabmappedptr, err) != 0) {
+  if (gt_mapspec_read_placed(assignssptabmapspecification, &ssptransferinfo,
+                             gt_str_get(tmpfilename), sizessptab, placement,
+                             &encseq->ssptabmappedptr, err) != 0) {
     haserr = true;
   }
   if (!haserr)
@@ -1162,6 +1164,7 @@ static int flushoistab2file(const char *indexname, GtEncseq *encseq,
 
 static int filloistabmapspecstartptr(GtEncseq *encseq,
                                      const char *indexname,
+                                     unsigned int placement,
                                      GtError *err)
 {
   bool haserr = false;
@@ -1174,9 +1177,9 @@ static int filloistabmapspecstartptr(GtEncseq *encseq,
 
   sizeoistab = (GtUword) gt_encseq_size_of_exceptiontablemap(encseq);
 
-  if (gt_mapspec_read(assignoistabmapspecification, encseq,
-                      gt_str_get(tmpfilename),
-                      sizeoistab, &encseq->oistabmappedptr, err) != 0) {
+  if (gt_mapspec_read_placed(assignoistabmapspecification, encseq,
+                             gt_str_get(tmpfilename), sizeoistab, placement,
+                             &encseq->oistabmappedptr, err) != 0) {
     haserr = true;
   }
   if (!haserr) {
@@ -1635,6 +1638,7 @@ int gt_encseq_equallength_write_twobitencoding_to_file(const char *indexname,
 
 static int fillencseqmapspecstartptr(GtEncseq *encseq,
                                      const char *indexname,
+                                     unsigned int placement,
                                      GtLogger *logger,
                                      GtError *err)
 {
@@ -1646,12 +1650,13 @@ static int fillencseqmapspecstartptr(GtEncseq *encseq,
   gt_error_check(err);
   tmpfilename = gt_str_new_cstr(indexname);
   gt_str_append_cstr(tmpfilename, GT_ENCSEQFILESUFFIX);
-  if (gt_mapspec_read(gt_encseq_assign_mapspec,
-                      encseq,
-                      gt_str_get(tmpfilename),
-                      encseq->sizeofrep,
-                      &encseq->mappedptr,
-                      err) != 0) {
+  if (gt_mapspec_read_placed(gt_encseq_assign_mapspec,
+                             encseq,
+                             gt_str_get(tmpfilename),
+                             encseq->sizeofrep,
+                             placement,
+                             &encseq->mappedptr,
+                             err) != 0) {
     haserr = true;
   }
   if (!haserr) {
@@ -4628,6 +4633,8 @@ static GtEncseq *files2encodedsequence(const GtStrArray *filenametab,
                            true);
     }
     gt_sequence_buffer_set_symbolmap(fb, gt_alphabet_symbolmap(alphabet));
+    if (gt_jobs > 1U)
+      gt_sequence_buffer_enable_prefetch(fb);
     if (encodedseqfunctab[(int) sat].fillposition.function(encseq,
                                                            ssptaboutinfo,
                                                            fb, err) != 0)
@@ -4652,6 +4659,7 @@ static GtEncseq* gt_encseq_new_from_index(const char *indexname,
                                           bool withssptab,
                                           bool withoistab,
                                           bool withmd5tab,
+                                          unsigned int placement,
                                           GtLogger *logger,
                                           GtError *err)
 {
@@ -4715,7 +4723,8 @@ static GtEncseq* gt_encseq_new_from_index(const char *indexname,
     ALLASSIGNAPPENDFUNC(gt_encseq_metadata_accesstype(emd), encseq->satsep);
     encseq->getexceptionmapping =
       encodedseqfunctab[(int) sat].getexceptionmapping.function;
-    if (fillencseqmapspecstartptr(encseq, indexname, logger, err) != 0)
+    if (fillencseqmapspecstartptr(encseq, indexname, placement, logger,
+                                  err) != 0)
       haserr = true;
   }
   if (!haserr) {
@@ -4739,6 +4748,8 @@ static GtEncseq* gt_encseq_new_from_index(const char *indexname,
     encseq->destablength = (GtUword) numofbytes;
     if (encseq->destab == NULL)
       haserr = true;
+    else
+      encseq->destab = gt_fa_mmap_place(encseq->destab, placement);
   }
   if (!haserr && withsdstab) {
     gt_assert(encseq != NULL);
@@ -4751,6 +4762,8 @@ static GtEncseq* gt_encseq_new_from_index(const char *indexname,
                                           err);
       if (encseq->sdstab == NULL)
         haserr = true;
+      else
+        encseq->sdstab = gt_fa_mmap_place(encseq->sdstab, placement);
     }
     else
       encseq->sdstab = NULL;
@@ -4760,14 +4773,16 @@ static GtEncseq* gt_encseq_new_from_index(const char *indexname,
       encseq->sat != GT_ACCESS_TYPE_EQUALLENGTH) {
     gt_assert(encseq != NULL);
     if (encseq->numofdbsequences > 1UL) {
-      if (!haserr && fillssptabmapspecstartptr(encseq, indexname, err) != 0)
+      if (!haserr && fillssptabmapspecstartptr(encseq, indexname, placement,
+                                               err) != 0)
         haserr = true;
     }
   }
   if (!haserr && withoistab) {
     gt_assert(encseq != NULL);
     encseq->has_exceptiontable = true;
-    if (!haserr && filloistabmapspecstartptr(encseq, indexname, err) != 0)
+    if (!haserr && filloistabmapspecstartptr(encseq, indexname, placement,
+                                             err) != 0)
       haserr = true;
   }
   if (!haserr && withmd5tab) {
@@ -5516,6 +5531,8 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
     if (descqueue != NULL)
       gt_sequence_buffer_set_desc_buffer(fb, descqueue);
     gt_sequence_buffer_set_chardisttab(fb, characterdistribution);
+    if (gt_jobs > 1U)
+      gt_sequence_buffer_enable_prefetch(fb);
     distspecialrangelength = gt_disc_distri_new();
     distwildcardrangelength = gt_disc_distri_new();
     originaldistribution = gt_calloc((size_t) UCHAR_MAX,
@@ -8520,6 +8537,7 @@ struct GtEncseqLoader {
        md5tab,
        mirrored,
        autodiscover;
+  unsigned int placement;
   GtLogger *logger;
 };
 
@@ -8549,6 +8567,12 @@ GtEncseqLoader* gt_encseq_loader_new_from_options(GtEncseqOptions *opts,
     gt_encseq_loader_require_md5_support(el);
   if (gt_encseq_options_mirrored_value(opts))
     gt_encseq_loader_mirror(el);
+  if (gt_encseq_options_prefault_value(opts))
+    gt_encseq_loader_enable_prefault(el);
+  if (gt_encseq_options_hugepages_value(opts))
+    gt_encseq_loader_enable_hugepages(el);
+  if (gt_encseq_options_interleave_value(opts))
+    gt_encseq_loader_enable_numa_interleave(el);
   return el;
 }
 
@@ -8724,6 +8748,42 @@ void gt_encseq_loader_do_not_mirror(GtEncseqLoader *el)
   el->mirrored = false;
 }
 
+void gt_encseq_loader_enable_prefault(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->placement |= GT_FA_PLACE_PREFAULT;
+}
+
+void gt_encseq_loader_disable_prefault(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->placement &= ~GT_FA_PLACE_PREFAULT;
+}
+
+void gt_encseq_loader_enable_hugepages(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->placement |= GT_FA_PLACE_HUGEPAGES;
+}
+
+void gt_encseq_loader_disable_hugepages(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->placement &= ~GT_FA_PLACE_HUGEPAGES;
+}
+
+void gt_encseq_loader_enable_numa_interleave(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->placement |= GT_FA_PLACE_INTERLEAVE;
+}
+
+void gt_encseq_loader_disable_numa_interleave(GtEncseqLoader *el)
+{
+  gt_assert(el);
+  el->placement &= ~GT_FA_PLACE_INTERLEAVE;
+}
+
 GtEncseq* gt_encseq_loader_load(GtEncseqLoader *el, const char *indexname,
                                 GtError *err)
 {
@@ -8749,9 +8809,9 @@ GtEncseq* gt_encseq_loader_load(GtEncseqLoader *el, const char *indexname,
       el->md5tab = true;
   }
   gt_log_log("loading encseq %s with des: %d, sds: %d, ssp: %d, ois: %d, "
-             "md5: %d, mirr: %d",
+             "md5: %d, mirr: %d, placement: %u",
              indexname, el->destab, el->sdstab, el->ssptab, el->oistab,
-             el->md5tab, el->mirrored);
+             el->md5tab, el->mirrored, el->placement);
 
   encseq = gt_encseq_new_from_index(indexname,
                                     el->destab,
@@ -8759,6 +8819,7 @@ GtEncseq* gt_encseq_loader_load(GtEncseqLoader *el, const char *indexname,
                                     el->ssptab,
                                     el->oistab,
                                     el->md5tab,
+                                    el->placement,
                                     el->logger,
                                     err);
   if (encseq && el->mirrored) {
@@ -441,6 +441,27 @@ void              gt_encseq_loader_mirror(GtEncseqLoader *el);
 /* Disables loading of a sequence using <el> with mirroring enabled right from
    the start. */
 void              gt_encseq_loader_do_not_mirror(GtEncseqLoader *el);
+/* Enables reading the whole index into the page cache and faulting in all
+   pages of the mapped tables right after loading with <el>, instead of
+   paying for the page faults later during random access. Disabled by
+   default. */
+void              gt_encseq_loader_enable_prefault(GtEncseqLoader *el);
+/* Disables prefaulting of the tables loaded by <el>. */
+void              gt_encseq_loader_disable_prefault(GtEncseqLoader *el);
+/* Enables copying the tables loaded by <el> into anonymous memory backed by
+   transparent huge pages, reducing TLB misses during random access. The copy
+   is not shared between processes mapping the same index. Disabled by
+   default. */
+void              gt_encseq_loader_enable_hugepages(GtEncseqLoader *el);
+/* Disables copying the tables loaded by <el> into huge pages. */
+void              gt_encseq_loader_disable_hugepages(GtEncseqLoader *el);
+/* Enables copying the tables loaded by <el> into anonymous memory which is
+   interleaved page-wise across all NUMA nodes, so that threads running on
+   different nodes see the same average access latency. Ignored on systems
+   without NUMA support. Disabled by default. */
+void              gt_encseq_loader_enable_numa_interleave(GtEncseqLoader *el);
+/* Disables interleaving the tables loaded by <el> across NUMA nodes. */
+void              gt_encseq_loader_disable_numa_interleave(GtEncseqLoader *el);
 /* Attempts to map the index files as specified by <indexname> using the options
    set in <el> using this interface. Returns a <GtEncseq> instance
    on success, or <NULL> on error. If an error occurred, <err> is set
@@ -50,6 +50,9 @@ struct GtEncseqOptions {
            *optionprotein,
            *optionsmap,
            *optionmirrored,
+           *optionprefault,
+           *optionhugepages,
+           *optioninterleave,
            *optionclip_desc;
   GtStrArray *db;
   bool des,
@@ -62,6 +65,9 @@ struct GtEncseqOptions {
        protein,
        plain,
        mirrored,
+       prefault,
+       hugepages,
+       interleave,
        withdb,
        withindexname,
        clip_desc;
@@ -84,6 +90,9 @@ static GtEncseqOptions* gt_encseq_options_new(void)
   oi->protein = false;
   oi->plain = false;
   oi->mirrored = false;
+  oi->prefault = false;
+  oi->hugepages = false;
+  oi->interleave = false;
   oi->optiondb = NULL;
   oi->optionindexname = NULL;
   oi->optionsat = NULL;
@@ -98,6 +107,9 @@ static GtEncseqOptions* gt_encseq_options_new(void)
   oi->optionprotein = NULL;
   oi->optionsmap = NULL;
   oi->optionmirrored = NULL;
+  oi->optionprefault = NULL;
+  oi->optionhugepages = NULL;
+  oi->optioninterleave = NULL;
   oi->withdb = false;
   oi->withindexname = false;
   return oi;
@@ -281,6 +293,27 @@ gt_encseq_options_register_generic(GtOptionParser *op,
                                             &oi->mirrored,
                                             false);
     gt_option_parser_add_option(op, oi->optionmirrored);
+
+    oi->optionprefault = gt_option_new_bool("prefault", "read the whole index "
+                                            "into memory right after mapping "
+                                            "it",
+                                            &oi->prefault,
+                                            false);
+    gt_option_parser_add_option(op, oi->optionprefault);
+
+    oi->optionhugepages = gt_option_new_bool("hugepages", "copy the index "
+                                             "into memory backed by huge "
+                                             "pages",
+                                             &oi->hugepages,
+                                             false);
+    gt_option_parser_add_option(op, oi->optionhugepages);
+
+    oi->optioninterleave = gt_option_new_bool("interleave", "copy the index "
+                                              "into memory interleaved across "
+                                              "all NUMA nodes",
+                                              &oi->interleave,
+                                              false);
+    gt_option_parser_add_option(op, oi->optioninterleave);
   }
 
   /* only add -lossless if not present already (e.g. suffixerator) */
@@ -359,6 +392,9 @@ GT_ENCSEQ_OPTS_GETTER_DEF(indexname, GtStr*);
 GT_ENCSEQ_OPTS_GETTER_DEF(lossless, bool);
 GT_ENCSEQ_OPTS_GETTER_DEF(md5, bool);
 GT_ENCSEQ_OPTS_GETTER_DEF(mirrored, bool);
+GT_ENCSEQ_OPTS_GETTER_DEF(prefault, bool);
+GT_ENCSEQ_OPTS_GETTER_DEF(hugepages, bool);
+GT_ENCSEQ_OPTS_GETTER_DEF(interleave, bool);
 GT_ENCSEQ_OPTS_GETTER_DEF(plain, bool);
 GT_ENCSEQ_OPTS_GETTER_DEF(protein, bool);
 GT_ENCSEQ_OPTS_GETTER_DEF(sat, GtStr*);
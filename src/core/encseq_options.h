@@ -71,6 +71,9 @@ GT_ENCSEQ_OPTS_GETTER_DECL(dna, bool);
 GT_ENCSEQ_OPTS_GETTER_DECL(lossless, bool);
 GT_ENCSEQ_OPTS_GETTER_DECL(md5, bool);
 GT_ENCSEQ_OPTS_GETTER_DECL(mirrored, bool);
+GT_ENCSEQ_OPTS_GETTER_DECL(prefault, bool);
+GT_ENCSEQ_OPTS_GETTER_DECL(hugepages, bool);
+GT_ENCSEQ_OPTS_GETTER_DECL(interleave, bool);
 GT_ENCSEQ_OPTS_GETTER_DECL(plain, bool);
 GT_ENCSEQ_OPTS_GETTER_DECL(protein, bool);
 GT_ENCSEQ_OPTS_GETTER_DECL(sat, GtStr*);
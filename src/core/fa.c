@@ -17,10 +17,15 @@
 
 #ifndef _WIN32
 #include <sys/mman.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #else
 #include <windows.h>
 #endif
 #include <fcntl.h>
+#include <limits.h>
+#include <string.h>
 #include <unistd.h>
 #include "core/compat.h"
 #include "core/dynalloc.h"
@@ -687,6 +692,98 @@ void gt_fa_xmunmap(void *addr)
   gt_mutex_unlock(fa->mmap_mutex);
 }
 
+#ifndef _WIN32
+static void fa_prefault(void *addr, size_t len)
+{
+  volatile const char *ptr;
+  size_t pagesize = (size_t) sysconf(_SC_PAGESIZE), idx;
+  char sum = 0;
+
+#ifdef MADV_WILLNEED
+  (void) madvise(addr, len, MADV_WILLNEED);
+#endif
+#ifdef MADV_POPULATE_READ
+  if (madvise(addr, len, MADV_POPULATE_READ) == 0)
+    return;
+#endif
+  /* touch one byte per page to fault in the whole map */
+  ptr = (volatile const char *) addr;
+  for (idx = 0; idx < len; idx += pagesize)
+    sum += ptr[idx];
+  (void) sum;
+}
+
+/* returns an anonymous copy of the <len> bytes at <addr>, or NULL */
+static void* fa_anonymous_copy(const void *addr, size_t len,
+                               unsigned int flags)
+{
+  void *copy;
+#ifdef MAP_ANONYMOUS
+  copy = mmap(NULL, len, PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (copy == MAP_FAILED)
+    return NULL;
+#else
+  return NULL;
+#endif
+#ifdef MADV_HUGEPAGE
+  if (flags & GT_FA_PLACE_HUGEPAGES)
+    (void) madvise(copy, len, MADV_HUGEPAGE);
+#endif
+#if defined(__linux__) && defined(SYS_mbind)
+  if (flags & GT_FA_PLACE_INTERLEAVE) {
+    /* MPOL_INTERLEAVE over all nodes, the kernel restricts the node mask to
+       the nodes we are allowed to use; fails harmlessly without NUMA */
+    unsigned long nodemask = ~0UL;
+    (void) syscall(SYS_mbind, copy, (unsigned long) len, 3 /* interleave */,
+                   &nodemask, (unsigned long) (sizeof nodemask * CHAR_BIT),
+                   0U);
+  }
+#endif
+  /* the pages are allocated here, according to the policies set above */
+  memcpy(copy, addr, len);
+  (void) mprotect(copy, len, PROT_READ);
+  return copy;
+}
+#endif
+
+void* gt_fa_mmap_place(void *addr, unsigned int flags)
+{
+#ifndef _WIN32
+  FAMapInfo *mapinfo, *copyinfo;
+  void *copy = NULL;
+  gt_assert(fa);
+  if (!addr || !flags) return addr;
+  gt_mutex_lock(fa->mmap_mutex);
+  mapinfo = gt_hashmap_get(fa->memory_maps, addr);
+  gt_mutex_unlock(fa->mmap_mutex);
+  gt_assert(mapinfo);
+  if (mapinfo->len == 0)
+    return addr;
+  if (flags & (GT_FA_PLACE_HUGEPAGES | GT_FA_PLACE_INTERLEAVE)) {
+#ifdef MADV_SEQUENTIAL
+    (void) madvise(addr, mapinfo->len, MADV_SEQUENTIAL);
+#endif
+    copy = fa_anonymous_copy(addr, mapinfo->len, flags);
+  }
+  if (copy == NULL) {
+    /* keep the file map, but read it completely now */
+    fa_prefault(addr, mapinfo->len);
+    return addr;
+  }
+  copyinfo = gt_malloc(sizeof *copyinfo);
+  *copyinfo = *mapinfo;
+  gt_xmunmap(addr, mapinfo->len);
+  gt_mutex_lock(fa->mmap_mutex);
+  gt_hashmap_remove(fa->memory_maps, addr);
+  gt_hashmap_add(fa->memory_maps, copy, copyinfo);
+  gt_mutex_unlock(fa->mmap_mutex);
+  return copy;
+#else
+  return addr;
+#endif
+}
+
 void* gt_fa_mmap_read_with_suffix_func(const char *path, const char *suffix,
                                        size_t *len, const char *src_file,
                                        int src_line, GtError *err)
@@ -156,6 +156,19 @@ void*   gt_fa_mmap_generic_fd_func(int fd, const char *filename, size_t len,
                                    bool hard_fail, const char *src_file,
                                    int src_line, GtError *err);
 
+/* placement hints for <gt_fa_mmap_place()> */
+#define GT_FA_PLACE_PREFAULT   1U
+#define GT_FA_PLACE_HUGEPAGES  2U
+#define GT_FA_PLACE_INTERLEAVE 4U
+/* Applies the placement hints <flags> to the read-only memory map starting at
+   <addr>. With <GT_FA_PLACE_PREFAULT> the whole map is read ahead and faulted
+   in. With <GT_FA_PLACE_HUGEPAGES> or <GT_FA_PLACE_INTERLEAVE> the content is
+   copied into anonymous memory backed by huge pages and/or interleaved across
+   all NUMA nodes, and the file map is released. Returns the start of the map
+   to be used from now on, which must be freed with <gt_fa_xmunmap()>. Hints
+   not supported by the platform are ignored. */
+void*   gt_fa_mmap_place(void *addr, unsigned int flags);
+
 #define gt_fa_mmap_read_with_suffix(path, suffix, len, err)\
         gt_fa_mmap_read_with_suffix_func(path, suffix, len,__FILE__, __LINE__, \
                                       err)
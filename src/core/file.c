@@ -18,12 +18,47 @@
 #include <stdio.h>
 #include <string.h>
 #include "core/cstr_api.h"
+#include "core/ensure.h"
 #include "core/fa.h"
 #include "core/ma.h"
+#include "core/minmax.h"
+#include "core/str.h"
+#include "core/thread.h"
 #include "core/xansi_api.h"
 #include "core/xbzlib.h"
 #include "core/xzlib.h"
 
+/* initial size of the read buffer, grows for longer lines */
+#define GT_FILE_READBUFSIZE ((size_t) 1 << 18)
+
+#ifdef GT_THREADS_ENABLED
+/* number of blocks of <GT_FILE_READBUFSIZE> bytes the read-ahead thread can
+   decompress ahead of the reader */
+#define GT_FILE_READAHEAD_BLOCKS 4
+
+/* number of decompressed bytes read directly before the read-ahead thread is
+   started, so that no thread is created for small files */
+#define GT_FILE_READAHEAD_MINBYTES (GT_FILE_READAHEAD_BLOCKS \
+                                    * GT_FILE_READBUFSIZE)
+
+/* The blocks form a ring buffer: <numoffilled> blocks starting at <readblock>
+   have been filled by the read-ahead thread, <readoffset> bytes of the block
+   at <readblock> have already been consumed. A block of length 0 marks the end
+   of the file. */
+typedef struct {
+  char *blocks[GT_FILE_READAHEAD_BLOCKS];
+  size_t lengths[GT_FILE_READAHEAD_BLOCKS],
+         readoffset;
+  GtUword readblock,
+          writeblock,
+          numoffilled;
+  GtThread *thread;
+  GtMutex *mutex;
+  GtThreadCond *cond;
+  bool stop;
+} GtFileReadahead;
+#endif
+
 struct GtFile {
   GtFileMode mode;
   GtUword reference_count;
@@ -37,8 +72,24 @@ struct GtFile {
        unget_char;
   bool is_stdin,
        unget_used;
+  /* files opened for reading are read blockwise into <readbuf>, the bytes
+     from <readpos> to <readlen> - 1 have not been consumed yet */
+  bool buffered;
+  char *readbuf;
+  size_t readbufsize,
+         readpos,
+         readlen;
+#ifdef GT_THREADS_ENABLED
+  GtFileReadahead *readahead;
+  size_t directbytes;
+#endif
 };
 
+static bool file_mode_is_read_only(const char *mode)
+{
+  return mode[0] == 'r' && strchr(mode, '+') == NULL;
+}
+
 GtFileMode gt_file_mode_determine(const char *path)
 {
   size_t path_length;
@@ -107,6 +158,7 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
   file = gt_calloc(1, sizeof (GtFile));
   file->mode = file_mode;
   file->reference_count = 0;
+  file->buffered = file_mode_is_read_only(mode);
   if (path) {
     switch (file_mode) {
       case GT_FILE_MODE_UNCOMPRESSED:
@@ -130,7 +182,7 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
           return NULL;
         }
         file->orig_path = gt_cstr_dup(path);
-        file->orig_mode = gt_cstr_dup(path);
+        file->orig_mode = gt_cstr_dup(mode);
         break;
       default: gt_assert(0);
     }
@@ -151,6 +203,7 @@ GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
   file = gt_calloc(1, sizeof (GtFile));
   file->mode = file_mode;
   file->reference_count = 0;
+  file->buffered = file_mode_is_read_only(mode);
   if (path) {
     switch (file_mode) {
       case GT_FILE_MODE_UNCOMPRESSED:
@@ -162,7 +215,7 @@ GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
       case GT_FILE_MODE_BZIP2:
         file->fileptr.bzfile = gt_fa_xbzopen(path, mode);
         file->orig_path = gt_cstr_dup(path);
-        file->orig_mode = gt_cstr_dup(path);
+        file->orig_mode = gt_cstr_dup(mode);
         break;
       default: gt_assert(0);
     }
@@ -198,14 +251,189 @@ GtFileMode gt_file_mode(const GtFile *file)
   return file->mode;
 }
 
+/* read up to <nbytes> directly from the underlying file handle */
+static size_t file_read_raw(GtFile *file, void *buf, size_t nbytes)
+{
+  switch (file->mode) {
+    case GT_FILE_MODE_UNCOMPRESSED:
+      return gt_xfread(buf, 1, nbytes, file->fileptr.file);
+    case GT_FILE_MODE_GZIP:
+      return (size_t) gt_xgzread(file->fileptr.gzfile, buf,
+                                 (unsigned int) nbytes);
+    case GT_FILE_MODE_BZIP2:
+      return (size_t) gt_xbzread(file->fileptr.bzfile, buf,
+                                 (unsigned int) nbytes);
+    default: gt_assert(0);
+  }
+  return 0;
+}
+
+#ifdef GT_THREADS_ENABLED
+static void* file_readahead_thread(void *data)
+{
+  GtFile *file = (GtFile*) data;
+  GtFileReadahead *ra = file->readahead;
+  bool eof = false;
+
+  while (!eof) {
+    GtUword writeblock;
+
+    gt_mutex_lock(ra->mutex);
+    while (ra->numoffilled == (GtUword) GT_FILE_READAHEAD_BLOCKS && !ra->stop)
+      gt_thread_cond_wait(ra->cond, ra->mutex);
+    if (ra->stop) {
+      gt_mutex_unlock(ra->mutex);
+      break;
+    }
+    writeblock = ra->writeblock;
+    gt_mutex_unlock(ra->mutex);
+    /* the block at <writeblock> is not accessed by the reader */
+    ra->lengths[writeblock] = file_read_raw(file, ra->blocks[writeblock],
+                                            GT_FILE_READBUFSIZE);
+    eof = ra->lengths[writeblock] == 0;
+    gt_mutex_lock(ra->mutex);
+    ra->writeblock = (writeblock + 1) % GT_FILE_READAHEAD_BLOCKS;
+    ra->numoffilled++;
+    gt_thread_cond_broadcast(ra->cond);
+    gt_mutex_unlock(ra->mutex);
+  }
+  return NULL;
+}
+
+static void file_readahead_start(GtFile *file)
+{
+  GtFileReadahead *ra;
+  GtUword idx;
+
+  ra = gt_calloc((size_t) 1, sizeof *ra);
+  for (idx = 0; idx < (GtUword) GT_FILE_READAHEAD_BLOCKS; idx++)
+    ra->blocks[idx] = gt_malloc(GT_FILE_READBUFSIZE);
+  ra->mutex = gt_mutex_new();
+  ra->cond = gt_thread_cond_new();
+  file->readahead = ra;
+  ra->thread = gt_thread_new(file_readahead_thread, file, NULL);
+}
+
+static void file_readahead_delete(GtFile *file)
+{
+  GtFileReadahead *ra = file->readahead;
+  GtUword idx;
+
+  if (ra == NULL)
+    return;
+  if (ra->thread != NULL) {
+    gt_mutex_lock(ra->mutex);
+    ra->stop = true;
+    gt_thread_cond_broadcast(ra->cond);
+    gt_mutex_unlock(ra->mutex);
+    gt_thread_join(ra->thread);
+    gt_thread_delete(ra->thread);
+  }
+  for (idx = 0; idx < (GtUword) GT_FILE_READAHEAD_BLOCKS; idx++)
+    gt_free(ra->blocks[idx]);
+  gt_mutex_delete(ra->mutex);
+  gt_thread_cond_delete(ra->cond);
+  gt_free(ra);
+  file->readahead = NULL;
+}
+
+/* copy up to <nbytes> bytes decompressed by the read-ahead thread to <buf> */
+static size_t file_readahead_read(GtFileReadahead *ra, char *buf,
+                                  size_t nbytes)
+{
+  size_t copied = 0;
+
+  while (copied < nbytes) {
+    size_t available, len;
+    char *block;
+
+    gt_mutex_lock(ra->mutex);
+    while (ra->numoffilled == 0)
+      gt_thread_cond_wait(ra->cond, ra->mutex);
+    gt_mutex_unlock(ra->mutex);
+    block = ra->blocks[ra->readblock];
+    available = ra->lengths[ra->readblock] - ra->readoffset;
+    if (ra->lengths[ra->readblock] == 0) /* end of file, keep the marker */
+      break;
+    len = MIN(available, nbytes - copied);
+    memcpy(buf + copied, block + ra->readoffset, len);
+    copied += len;
+    ra->readoffset += len;
+    if (ra->readoffset == ra->lengths[ra->readblock]) {
+      gt_mutex_lock(ra->mutex);
+      ra->readblock = (ra->readblock + 1) % GT_FILE_READAHEAD_BLOCKS;
+      ra->readoffset = 0;
+      ra->numoffilled--;
+      gt_thread_cond_broadcast(ra->cond);
+      gt_mutex_unlock(ra->mutex);
+    }
+  }
+  return copied;
+}
+#endif
+
+static size_t file_read_block(GtFile *file, char *buf, size_t nbytes)
+{
+#ifdef GT_THREADS_ENABLED
+  if (file->readahead == NULL && gt_jobs > 1U &&
+      file->mode != GT_FILE_MODE_UNCOMPRESSED &&
+      file->directbytes >= GT_FILE_READAHEAD_MINBYTES) {
+    /* decompress in a separate thread while the reader is parsing */
+    file_readahead_start(file);
+  }
+  if (file->readahead != NULL && file->readahead->thread != NULL)
+    return file_readahead_read(file->readahead, buf, nbytes);
+  nbytes = file_read_raw(file, buf, nbytes);
+  file->directbytes += nbytes;
+  return nbytes;
+#else
+  return file_read_raw(file, buf, nbytes);
+#endif
+}
+
+/* Append the next block of the file to the unconsumed part of the read
+   buffer, which is moved to the start of the buffer. Returns the number of
+   bytes appended, 0 at the end of the file. */
+static size_t file_fill_buffer(GtFile *file)
+{
+  size_t nbytes;
+  gt_assert(file->buffered);
+  if (file->readbuf == NULL) {
+    file->readbufsize = GT_FILE_READBUFSIZE;
+    file->readbuf = gt_malloc(file->readbufsize);
+  }
+  if (file->readpos > 0) {
+    memmove(file->readbuf, file->readbuf + file->readpos,
+            file->readlen - file->readpos);
+    file->readlen -= file->readpos;
+    file->readpos = 0;
+  }
+  if (file->readbufsize - file->readlen < GT_FILE_READBUFSIZE) {
+    file->readbufsize = MAX(2 * file->readbufsize,
+                            file->readlen + GT_FILE_READBUFSIZE);
+    file->readbuf = gt_realloc(file->readbuf, file->readbufsize);
+  }
+  nbytes = file_read_block(file, file->readbuf + file->readlen,
+                           GT_FILE_READBUFSIZE);
+  file->readlen += nbytes;
+  return nbytes;
+}
+
 int gt_file_xfgetc(GtFile *file)
 {
   int c = -1;
   if (file) {
-    if (file->unget_used) {
+    if (file->readpos < file->readlen)
+      c = (int) (unsigned char) file->readbuf[file->readpos++];
+    else if (file->unget_used) {
       c = file->unget_char;
       file->unget_used = false;
     }
+    else if (file->buffered) {
+      c = file_fill_buffer(file) > 0
+            ? (int) (unsigned char) file->readbuf[file->readpos++]
+            : EOF;
+    }
     else {
       switch (file->mode) {
         case GT_FILE_MODE_UNCOMPRESSED:
@@ -229,14 +457,88 @@ int gt_file_xfgetc(GtFile *file)
 void gt_file_unget_char(GtFile *file, char c)
 {
   if (file) {
-    gt_assert(!file->unget_used); /* only one char can be unget at a time */
-    file->unget_char = c;
-    file->unget_used = true;
+    if (file->buffered && file->readpos > 0)
+      file->readbuf[--file->readpos] = c;
+    else {
+      gt_assert(!file->unget_used); /* only one char can be unget at a time */
+      file->unget_char = c;
+      file->unget_used = true;
+    }
   }
   else
     gt_xungetc(c, stdin);
 }
 
+int gt_file_xread_line(GtFile *file, const char **line, size_t *length)
+{
+  char *newline = NULL;
+  size_t searched = 0, linestart;
+  int rval = 0;
+
+  gt_assert(file && line && length);
+  if (!file->buffered) {
+    /* collect the line character by character in the otherwise unused read
+       buffer */
+    int cc;
+    file->readlen = 0;
+    while ((cc = gt_file_xfgetc(file)) != '\n') {
+      if (cc == EOF) {
+        rval = EOF;
+        break;
+      }
+      if (file->readlen == file->readbufsize) {
+        file->readbufsize = MAX(2 * file->readbufsize, (size_t) BUFSIZ);
+        file->readbuf = gt_realloc(file->readbuf, file->readbufsize);
+      }
+      file->readbuf[file->readlen++] = (char) cc;
+    }
+    *line = file->readbuf;
+    *length = file->readlen;
+    if (rval == 0 && *length > 0 && file->readbuf[*length - 1] == '\r')
+      (*length)--;
+    file->readlen = 0;
+    return rval;
+  }
+  if (file->unget_used) {
+    /* can only happen before the buffer has been filled for the first time */
+    gt_assert(file->readpos == file->readlen);
+    (void) file_fill_buffer(file);
+    if (file->readlen == file->readbufsize) {
+      file->readbufsize++;
+      file->readbuf = gt_realloc(file->readbuf, file->readbufsize);
+    }
+    memmove(file->readbuf + 1, file->readbuf, file->readlen);
+    file->readbuf[0] = file->unget_char;
+    file->readlen++;
+    file->unget_used = false;
+  }
+  for (;;) {
+    newline = memchr(file->readbuf + file->readpos + searched, '\n',
+                     file->readlen - file->readpos - searched);
+    if (newline != NULL)
+      break;
+    searched = file->readlen - file->readpos;
+    if (file_fill_buffer(file) == 0) {
+      rval = EOF;
+      break;
+    }
+  }
+  linestart = file->readpos;
+  *line = file->readbuf + linestart;
+  if (newline != NULL) {
+    *length = (size_t) (newline - *line);
+    file->readpos = linestart + *length + 1;
+    /* Windows newline "\r\n" */
+    if (*length > 0 && (*line)[*length - 1] == '\r')
+      (*length)--;
+  }
+  else {
+    *length = file->readlen - linestart;
+    file->readpos = file->readlen;
+  }
+  return rval;
+}
+
 static int vgzprintf(gzFile file, const char *format, va_list va, int buflen)
 {
   int len;
@@ -365,6 +667,35 @@ int gt_file_xread(GtFile *file, void *buf, size_t nbytes)
 {
   int rval = -1;
   if (file) {
+    if (file->buffered) {
+      size_t copied = 0;
+      if (file->unget_used && nbytes > 0) {
+        *(char*) buf = file->unget_char;
+        file->unget_used = false;
+        copied++;
+      }
+      while (copied < nbytes) {
+        size_t len;
+        if (file->readpos == file->readlen) {
+          if (nbytes - copied >= GT_FILE_READBUFSIZE) {
+            /* large reads bypass the read buffer */
+            if ((len = file_read_block(file, (char*) buf + copied,
+                                       nbytes - copied)) == 0) {
+              break;
+            }
+            copied += len;
+            continue;
+          }
+          if (file_fill_buffer(file) == 0)
+            break;
+        }
+        len = MIN(file->readlen - file->readpos, nbytes - copied);
+        memcpy((char*) buf + copied, file->readbuf + file->readpos, len);
+        file->readpos += len;
+        copied += len;
+      }
+      return (int) copied;
+    }
     switch (file->mode) {
       case GT_FILE_MODE_UNCOMPRESSED:
         rval = gt_xfread(buf, 1, nbytes, file->fileptr.file);
@@ -406,6 +737,12 @@ void gt_file_xwrite(GtFile *file, void *buf, size_t nbytes)
 void gt_file_xrewind(GtFile *file)
 {
   gt_assert(file);
+#ifdef GT_THREADS_ENABLED
+  file_readahead_delete(file);
+  file->directbytes = 0;
+#endif
+  file->readpos = file->readlen = 0;
+  file->unget_used = false;
   switch (file->mode) {
     case GT_FILE_MODE_UNCOMPRESSED:
       rewind(file->fileptr.file);
@@ -414,7 +751,10 @@ void gt_file_xrewind(GtFile *file)
       gt_xgzrewind(file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
-      gt_xbzrewind(&file->fileptr.bzfile, file->orig_path, file->orig_mode);
+      /* simulate a rewind with close/open, which keeps the handle known to
+         the file allocator */
+      gt_fa_xbzclose(file->fileptr.bzfile);
+      file->fileptr.bzfile = gt_fa_xbzopen(file->orig_path, file->orig_mode);
       break;
     default: gt_assert(0);
   }
@@ -423,6 +763,10 @@ void gt_file_xrewind(GtFile *file)
 void gt_file_delete_without_handle(GtFile *file)
 {
   if (!file) return;
+#ifdef GT_THREADS_ENABLED
+  file_readahead_delete(file);
+#endif
+  gt_free(file->readbuf);
   gt_free(file->orig_path);
   gt_free(file->orig_mode);
   gt_free(file);
@@ -435,6 +779,10 @@ void gt_file_delete(GtFile *file)
     file->reference_count--;
     return;
   }
+#ifdef GT_THREADS_ENABLED
+  /* stop reading ahead before the handle is closed */
+  file_readahead_delete(file);
+#endif
   switch (file->mode) {
     case GT_FILE_MODE_UNCOMPRESSED:
         if (!file->is_stdin)
@@ -450,3 +798,96 @@ void gt_file_delete(GtFile *file)
   }
   gt_file_delete_without_handle(file);
 }
+
+static int file_unit_test_mode(GtFileMode file_mode, const GtStr *content,
+                               GtError *err)
+{
+  const char *cstr = gt_str_get(content), *line;
+  size_t contentlen = (size_t) gt_str_length(content), pos = 0, length;
+  GtStr *tmpfilename;
+  GtFile *file;
+  FILE *tmpfp;
+  char *buf;
+  int had_err = 0, rval, cc;
+
+  gt_error_check(err);
+  tmpfilename = gt_str_new();
+  tmpfp = gt_xtmpfp(tmpfilename);
+  gt_fa_xfclose(tmpfp);
+  file = gt_file_xopen_file_mode(file_mode, gt_str_get(tmpfilename), "wb");
+  gt_file_xwrite(file, (void*) cstr, contentlen);
+  gt_file_delete(file);
+
+  /* read line by line */
+  file = gt_file_xopen_file_mode(file_mode, gt_str_get(tmpfilename), "rb");
+  do {
+    const char *newline = memchr(cstr + pos, '\n', contentlen - pos);
+    size_t expected = newline != NULL ? (size_t) (newline - (cstr + pos))
+                                      : contentlen - pos;
+    rval = gt_file_xread_line(file, &line, &length);
+    gt_ensure(rval == (newline != NULL ? 0 : EOF));
+    if (newline != NULL && expected > 0 && cstr[pos + expected - 1] == '\r') {
+      gt_ensure(length == expected - 1);
+    }
+    else {
+      gt_ensure(length == expected);
+    }
+    gt_ensure(memcmp(line, cstr + pos, length) == 0);
+    pos += expected + 1;
+  } while (!had_err && rval != EOF);
+  gt_file_delete(file);
+
+  /* mix character and block reads */
+  if (!had_err) {
+    file = gt_file_xopen_file_mode(file_mode, gt_str_get(tmpfilename), "rb");
+    buf = gt_malloc(contentlen + 1);
+    cc = gt_file_xfgetc(file);
+    gt_ensure(cc == (int) (unsigned char) cstr[0]);
+    gt_file_unget_char(file, (char) cc);
+    gt_ensure(gt_file_xread(file, buf, 3) == 3);
+    gt_ensure(gt_file_xfgetc(file) == (int) (unsigned char) cstr[3]);
+    gt_ensure(gt_file_xread(file, buf + 4, contentlen + 1)
+              == (int) contentlen - 4);
+    buf[3] = cstr[3];
+    gt_ensure(memcmp(buf, cstr, contentlen) == 0);
+    gt_ensure(gt_file_xfgetc(file) == EOF);
+    gt_file_xrewind(file);
+    gt_ensure(gt_file_xfgetc(file) == (int) (unsigned char) cstr[0]);
+    gt_free(buf);
+    gt_file_delete(file);
+  }
+
+  gt_xremove(gt_str_get(tmpfilename));
+  gt_str_delete(tmpfilename);
+  return had_err;
+}
+
+int gt_file_unit_test(GtError *err)
+{
+  GtStr *content;
+  GtUword i, j;
+  int had_err = 0;
+
+  gt_error_check(err);
+  content = gt_str_new();
+  for (i = 0; i < 5000UL; i++) {
+    for (j = 0; j < i % 97; j++)
+      gt_str_append_char(content, (char) ('a' + (i + j) % 26));
+    gt_str_append_cstr(content, i % 7 == 0 ? "\r\n" : "\n");
+    if (i % 11 == 0)
+      gt_str_append_cstr(content, "\r\t\n\n");
+  }
+  /* a line longer than the read buffer, which also makes the file large
+     enough to be read ahead */
+  for (j = 0; j < (GtUword) (6 * GT_FILE_READBUFSIZE); j++)
+    gt_str_append_char(content, (char) (0x80 + j % 128));
+  gt_str_append_cstr(content, "\nlast line without newline");
+
+  had_err = file_unit_test_mode(GT_FILE_MODE_UNCOMPRESSED, content, err);
+  if (!had_err)
+    had_err = file_unit_test_mode(GT_FILE_MODE_GZIP, content, err);
+  if (!had_err)
+    had_err = file_unit_test_mode(GT_FILE_MODE_BZIP2, content, err);
+  gt_str_delete(content);
+  return had_err;
+}
@@ -63,4 +63,19 @@ GtFileMode  gt_file_mode(const GtFile *file);
    Can only be used once at a time. */
 void        gt_file_unget_char(GtFile *file, char c);
 
+/* Reads the next line from <file>. Afterwards <*line> points to the line
+   (without the terminating newline or Windows newline) and <*length> is set to
+   its length. The line is not <\0>-terminated and is only valid until the next
+   read operation on <file>. Returns 0 if a line was read and <EOF> at the end
+   of <file>, in which case the characters after the last newline are returned
+   in <line> (<*length> is 0 if there are none).
+   Files opened for reading are read blockwise, so that the lines are found
+   with memchr(3) directly in the internal buffer. Once the first megabyte of
+   a compressed file has been read, the rest is decompressed in a separate
+   thread if more than one thread is available. */
+int         gt_file_xread_line(GtFile *file, const char **line,
+                               size_t *length);
+
+int         gt_file_unit_test(GtError *err);
+
 #endif
@@ -36,8 +36,9 @@
 #include "core/spacepeak.h"
 #include "core/splitter.h"
 #include "core/symbol.h"
+#include "core/thread_pool.h"
 #include "core/versionfunc.h"
-#include "core/warning_api.h"
+#include "core/warning.h"
 #include "core/xansi_api.h"
 #include "core/yarandom.h"
 
@@ -115,6 +116,8 @@ void gt_lib_init(void)
   if (showtime) gt_showtime_enable();
   gt_symbol_init();
   gt_class_alloc_lock_init();
+  gt_thread_pool_init();
+  gt_warning_init();
   gt_ya_rand_init(0);
 #ifdef HAVE_MYSQL
   mysql_library_init(0, NULL, NULL);
@@ -141,6 +144,8 @@ int gt_lib_clean(void)
     gt_spacepeak_show_space_peak(stdout);
     gt_ma_disable_global_spacepeak();
   }
+  gt_thread_pool_clean();
+  gt_warning_clean();
   fa_fptr_rval = gt_fa_check_fptr_leak();
   fa_mmap_rval = gt_fa_check_mmap_leak();
   gt_fa_clean();
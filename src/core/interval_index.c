@@ -0,0 +1,176 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include "core/array.h"
+#include "core/assert_api.h"
+#include "core/ensure.h"
+#include "core/interval_index.h"
+#include "core/ma.h"
+#include "core/mathsupport.h"
+#include "core/minmax.h"
+#include "core/msort_api.h"
+
+static int interval_index_entry_cmp(const void *a, const void *b)
+{
+  const GtIntervalIndexEntry *ea = a, *eb = b;
+  if (ea->start < eb->start)
+    return -1;
+  return ea->start > eb->start ? 1 : 0;
+}
+
+unsigned int gt_interval_index_build(GtIntervalIndexEntry *entries,
+                                     GtUword numofentries)
+{
+  GtIntervalIndexEntry *a = entries;
+  GtUword i, last_i = 0, last = 0, n = numofentries;
+  unsigned int k;
+
+  if (n == 0)
+    return 0;
+  gt_msort(entries, numofentries, sizeof (GtIntervalIndexEntry),
+           interval_index_entry_cmp);
+  /* compute the <max> values bottom-up */
+  for (i = 0; i < n; i += 2) {
+    last_i = i;
+    a[i].max = last = a[i].end;
+  }
+  for (k = 1; ((GtUword) 1 << k) <= n; k++) {
+    GtUword x = (GtUword) 1 << (k - 1),
+            i0 = (x << 1) - 1,
+            step = x << 2;
+    for (i = i0; i < n; i += step) {
+      GtUword el = a[i - x].max,
+              er = i + x < n ? a[i + x].max : last;
+      a[i].max = MAX(a[i].end, MAX(el, er));
+    }
+    /* the rightmost node of level k, which may be missing */
+    last_i = (last_i >> k & 1) ? last_i - x : last_i + x;
+    if (last_i < n && a[last_i].max > last)
+      last = a[last_i].max;
+  }
+  return k - 1;
+}
+
+/* The implicit tree is traversed in order with an explicit stack, subtrees of
+   height at most 3 are scanned linearly. */
+void gt_interval_index_find_all_overlapping(const GtIntervalIndexEntry
+                                            *entries,
+                                            GtUword numofentries,
+                                            unsigned int max_level,
+                                            GtUword start, GtUword end,
+                                            GtIntervalIndexFunc func,
+                                            void *data)
+{
+  struct {
+    GtUword x;
+    unsigned int k;
+    bool left_done;
+  } stack[64];
+  const GtIntervalIndexEntry *a = entries;
+  GtUword n = numofentries;
+  unsigned int t = 0;
+
+  gt_assert(func);
+  if (n == 0)
+    return;
+  stack[t].x = ((GtUword) 1 << max_level) - 1;
+  stack[t].k = max_level;
+  stack[t++].left_done = false;
+  while (t > 0) {
+    GtUword x = stack[--t].x;
+    unsigned int k = stack[t].k;
+    if (k <= 3U) {
+      GtUword i, i0 = x >> k << k,
+              i1 = MIN(i0 + ((GtUword) 1 << (k + 1)) - 1, n);
+      for (i = i0; i < i1 && a[i].start <= end; i++) {
+        if (start <= a[i].end)
+          func(a + i, data);
+      }
+    }
+    else if (!stack[t].left_done) {
+      GtUword y = x - ((GtUword) 1 << (k - 1));
+      stack[t++].left_done = true;
+      if (y >= n || a[y].max >= start) {
+        stack[t].x = y;
+        stack[t].k = k - 1;
+        stack[t++].left_done = false;
+      }
+    }
+    else if (x < n && a[x].start <= end) {
+      if (start <= a[x].end)
+        func(a + x, data);
+      stack[t].x = x + ((GtUword) 1 << (k - 1));
+      stack[t].k = k - 1;
+      stack[t++].left_done = false;
+    }
+  }
+}
+
+static void collect_value(const GtIntervalIndexEntry *entry, void *data)
+{
+  GtUword value = entry->value;
+  gt_array_add((GtArray*) data, value);
+}
+
+int gt_interval_index_unit_test(GtError *err)
+{
+  GtIntervalIndexEntry *entries;
+  GtArray *found;
+  GtUword i, j, n, q, start, end, numofoverlaps, prevstart;
+  unsigned int max_level;
+  int had_err = 0;
+  gt_error_check(err);
+
+  found = gt_array_new(sizeof (GtUword));
+  for (n = 0; !had_err && n < 600; n += 1 + n / 4) {
+    entries = gt_malloc(sizeof (GtIntervalIndexEntry) * MAX(n, 1));
+    for (i = 0; i < n; i++) {
+      entries[i].start = gt_rand_max(10000);
+      entries[i].end = entries[i].start + gt_rand_max(i % 7 ? 100 : 3000);
+      entries[i].value = i;
+    }
+    max_level = gt_interval_index_build(entries, n);
+    for (i = 1; !had_err && i < n; i++)
+      gt_ensure(entries[i-1].start <= entries[i].start);
+    for (q = 0; !had_err && q < 100; q++) {
+      start = gt_rand_max(11000);
+      end = start + gt_rand_max(q % 2 ? 10 : 1000);
+      gt_array_reset(found);
+      gt_interval_index_find_all_overlapping(entries, n, max_level, start, end,
+                                             collect_value, found);
+      /* compare with linear search, results must come in start order */
+      numofoverlaps = 0;
+      prevstart = 0;
+      for (i = 0, j = 0; !had_err && i < n; i++) {
+        if (entries[i].start <= end && start <= entries[i].end) {
+          numofoverlaps++;
+          gt_ensure(j < gt_array_size(found));
+          if (!had_err) {
+            gt_ensure(*(GtUword*) gt_array_get(found, j) == entries[i].value);
+            gt_ensure(prevstart <= entries[i].start);
+            prevstart = entries[i].start;
+            j++;
+          }
+        }
+      }
+      gt_ensure(numofoverlaps == gt_array_size(found));
+    }
+    gt_free(entries);
+  }
+  gt_array_delete(found);
+  return had_err;
+}
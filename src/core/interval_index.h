@@ -0,0 +1,61 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef INTERVAL_INDEX_H
+#define INTERVAL_INDEX_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* An entry of a static interval index. The entries of an interval index are
+   stored in an array sorted by <start> which is laid out as an implicit
+   augmented interval tree: the entry at index i is a node on level k if the
+   k lowest bits of i are set and bit k is not, its children are the entries
+   at i - 2^(k-1) and i + 2^(k-1), and <max> is the maximum <end> in its
+   subtree. <value> is not interpreted by the index. The entry consists of
+   <GtUword>s only, so that an index can be mapped from a file as is. */
+typedef struct {
+  GtUword start,
+          end,
+          max,
+          value;
+} GtIntervalIndexEntry;
+
+/* Called for each entry of an interval index overlapping a query range. */
+typedef void (*GtIntervalIndexFunc)(const GtIntervalIndexEntry *entry,
+                                    void *data);
+
+/* Sort the <numofentries> <entries> stably by start position and compute
+   their <max> values. Returns the level of the root of the implicit tree,
+   which has to be passed to <gt_interval_index_find_all_overlapping()>. */
+unsigned int gt_interval_index_build(GtIntervalIndexEntry *entries,
+                                     GtUword numofentries);
+
+/* Call <func> with <data> for each of the <numofentries> <entries> (built
+   with root level <max_level>) whose interval overlaps the closed interval
+   from <start> to <end>, in order of their start positions. */
+void         gt_interval_index_find_all_overlapping(const GtIntervalIndexEntry
+                                                    *entries,
+                                                    GtUword numofentries,
+                                                    unsigned int max_level,
+                                                    GtUword start, GtUword end,
+                                                    GtIntervalIndexFunc func,
+                                                    void *data);
+
+int          gt_interval_index_unit_test(GtError *err);
+
+#endif
@@ -254,6 +254,15 @@ int  gt_mapspec_read_header(GtMapspecSetupFunc setup, void *data,
 int  gt_mapspec_read(GtMapspecSetupFunc setup, void *data,
                      const char *filename, GtUword expectedsize,
                      void **mapped, GtError *err)
+{
+  return gt_mapspec_read_placed(setup, data, filename, expectedsize, 0,
+                                mapped, err);
+}
+
+int  gt_mapspec_read_placed(GtMapspecSetupFunc setup, void *data,
+                            const char *filename, GtUword expectedsize,
+                            unsigned int placement, void **mapped,
+                            GtError *err)
 {
   void *mapptr;
   uint64_t expectedaccordingtomapspec;
@@ -273,6 +282,10 @@ int  gt_mapspec_read(GtMapspecSetupFunc setup, void *data,
   {
     had_err = -1;
   }
+  else
+  {
+    mapptr = gt_fa_mmap_place(mapptr, placement);
+  }
   *mapped = mapptr;
   if (!had_err)
   {
@@ -168,6 +168,13 @@ int  gt_mapspec_read(GtMapspecSetupFunc setup, void *data,
                      const char *filename, GtUword expectedsize,
                      void **mapped, GtError *err);
 
+/* Like <gt_mapspec_read()>, but applies the placement hints <placement> (see
+   <gt_fa_mmap_place()>) to the mapped file before the pointers are filled. */
+int  gt_mapspec_read_placed(GtMapspecSetupFunc setup, void *data,
+                            const char *filename, GtUword expectedsize,
+                            unsigned int placement, void **mapped,
+                            GtError *err);
+
 /* Runs <setup> to build the map specification using <data> if given, then maps
    the file specified by <filename> with the expected size <expectedsize> and
    fills the pointers in the map specification with their corresponding values.
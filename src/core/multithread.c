@@ -14,43 +14,38 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
-#include "core/array_api.h"
 #include "core/multithread_api.h"
+#include "core/thread_pool.h"
 #include "core/unused_api.h"
 
 #ifdef GT_THREADS_ENABLED
 
+typedef struct {
+  GtThreadFunc function;
+  void *data;
+} GtMultithreadInfo;
+
+static void multithread_task(GT_UNUSED unsigned int workerid, void *data)
+{
+  GtMultithreadInfo *info = (GtMultithreadInfo*) data;
+  (void) info->function(info->data);
+}
+
 int gt_multithread(GtThreadFunc function, void *data, GtError *err)
 {
-  GtArray *threads;
-  GtThread *thread;
-  unsigned int i, j;
+  GtThreadPool *pool;
+  GtMultithreadInfo info;
 
   gt_error_check(err);
   gt_assert(function);
 
-  threads = gt_array_new(sizeof (GtThread*));
-
-  /* start all other threads and store them */
-  for (i = 1; i < gt_jobs; i++) {
-    if (!(thread = gt_thread_new(function, data, err))) {
-      for (j = 0; j < gt_array_size(threads); j++)
-        gt_thread_delete(*(GtThread**) gt_array_get(threads, j));
-      gt_array_delete(threads);
-      return -1;
-    }
-    gt_array_add(threads, thread);
-  }
-
-  function(data); /* execute function in main thread, too */
-
-  /* wait until all other threads are finished */
-  for (i = 0; i < gt_array_size(threads); i++) {
-    thread = *(GtThread**) gt_array_get(threads, i);
-    gt_thread_join(thread);
-    gt_thread_delete(thread);
-  }
-  gt_array_delete(threads);
+  /* the threads of the process-wide pool are reused between calls, the
+     calling thread executes <function> as one of the workers */
+  if (!(pool = gt_thread_pool_get(err)))
+    return -1;
+  info.function = function;
+  info.data = data;
+  gt_thread_pool_run(pool, (GtUword) gt_jobs, multithread_task, &info);
 
   return 0;
 }
@@ -22,9 +22,10 @@
 
 /* Multithread module */
 
-/* Execute <function> (with <data> passed to it) in <gt_jobs> many parallel
-   threads, if threading is enabled. Otherwise <function> is executed <gt_jobs>
-   many times sequentially. <gt_jobs> is a global <unsigned int> variable. */
+/* Execute <function> (with <data> passed to it) <gt_jobs> many times in
+   parallel on the threads of the process-wide thread pool, if threading is
+   enabled. Otherwise <function> is executed <gt_jobs> many times sequentially.
+   <gt_jobs> is a global <unsigned int> variable. */
 int       gt_multithread(GtThreadFunc function, void *data, GtError *err);
 
 #endif
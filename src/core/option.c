@@ -1938,6 +1938,22 @@ void gt_option_imply_either_3(GtOption *o, const GtOption *io1,
   gt_array_add(o->implications, option_array);
 }
 
+void gt_option_imply_either_4(GtOption *o, const GtOption *io1,
+                              const GtOption *io2, const GtOption *io3,
+                              const GtOption *io4)
+{
+  GtArray *option_array;
+  gt_assert(o && io1 && io2 && io3 && io4);
+  if (!o->implications)
+    o->implications = gt_array_new(sizeof (GtArray*));
+  option_array = gt_array_new(sizeof (GtOption*));
+  gt_array_add(option_array, io1);
+  gt_array_add(option_array, io2);
+  gt_array_add(option_array, io3);
+  gt_array_add(option_array, io4);
+  gt_array_add(o->implications, option_array);
+}
+
 void gt_option_exclude(GtOption *o_a, GtOption *o_b)
 {
   gt_assert(o_a && o_b);
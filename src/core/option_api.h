@@ -359,6 +359,13 @@ void            gt_option_imply_either_3(GtOption *option_a,
                                          const GtOption *option_b,
                                          const GtOption *option_c,
                                          const GtOption *option_d);
+/* Make <option_a> imply either <option_b>, <option_c>, <option_d> or
+   <option_e> */
+void            gt_option_imply_either_4(GtOption *option_a,
+                                         const GtOption *option_b,
+                                         const GtOption *option_c,
+                                         const GtOption *option_d,
+                                         const GtOption *option_e);
 /* Set that the options <option_a> and <option_b> exclude each other. */
 void            gt_option_exclude(GtOption *option_a, GtOption *option_b);
 /* Hide the default value of <option> in <-help> output. */
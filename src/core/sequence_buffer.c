@@ -26,9 +26,46 @@
 #include "core/sequence_buffer_fastq.h"
 #include "core/sequence_buffer_gb.h"
 #include "core/sequence_buffer_inline.h"
+#include "core/thread.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 
+#ifdef GT_THREADS_ENABLED
+/* number of blocks of <OUTBUFSIZE> characters the prefetching thread can
+   run ahead of the reader */
+#define GT_SEQUENCE_BUFFER_PREFETCH_SLOTS 32
+
+typedef struct {
+  unsigned char outbuf[OUTBUFSIZE],
+                outbuforig[OUTBUFSIZE];
+  GtUword nextfree,
+          filenum;
+  GtDescBuffer *descs; /* descriptions finished while filling this block */
+  int retval;
+  bool last;
+} GtSequenceBufferSlot;
+
+/* The slots form a ring buffer: <numoffilled> slots starting at <readslot>
+   are filled by the prefetching thread, the slot at <readslot> is being read
+   if <holding> is true. */
+struct GtSequenceBufferPrefetch {
+  GtSequenceBufferSlot *slots;
+  GtUword readslot,
+          writeslot,
+          numoffilled,
+          readfilenum;
+  GtDescBuffer *readerdescs, /* the description buffer set by the user */
+               *parserdescs; /* descriptions being parsed */
+  GtError *err;
+  GtThread *thread;
+  GtMutex *mutex;
+  GtThreadCond *cond;
+  bool holding,
+       complete,
+       stop;
+};
+#endif
+
 GtSequenceBuffer*
 gt_sequence_buffer_create(const GtSequenceBufferClass *sic)
 {
@@ -37,9 +74,174 @@ gt_sequence_buffer_create(const GtSequenceBufferClass *sic)
   si = gt_calloc(1, sic->size);
   si->c_class = sic;
   si->pvt = gt_calloc(1, sizeof (GtSequenceBufferMembers));
+  si->pvt->outbuf = si->pvt->outbufspace;
+  si->pvt->outbuforig = si->pvt->outbuforigspace;
   return si;
 }
 
+#ifdef GT_THREADS_ENABLED
+static void* sequence_buffer_prefetch_thread(void *data)
+{
+  GtSequenceBuffer *sb = (GtSequenceBuffer*) data;
+  GtSequenceBufferMembers *pvt = sb->pvt;
+  GtSequenceBufferPrefetch *pf = pvt->prefetch;
+  bool last = false;
+
+  while (!last) {
+    GtSequenceBufferSlot *slot;
+
+    gt_mutex_lock(pf->mutex);
+    while (pf->numoffilled == (GtUword) GT_SEQUENCE_BUFFER_PREFETCH_SLOTS
+           && !pf->stop) {
+      gt_thread_cond_wait(pf->cond, pf->mutex);
+    }
+    if (pf->stop) {
+      gt_mutex_unlock(pf->mutex);
+      break;
+    }
+    gt_mutex_unlock(pf->mutex);
+    /* the slot at <writeslot> is not accessed by the reader */
+    slot = pf->slots + pf->writeslot;
+    pvt->outbuf = slot->outbuf;
+    pvt->outbuforig = slot->outbuforig;
+    slot->retval = sb->c_class->advance(sb, pf->err);
+    slot->nextfree = slot->retval == 0 ? pvt->nextfree : 0;
+    slot->filenum = sb->c_class->get_file_index(sb);
+    if (pf->parserdescs != NULL)
+      gt_desc_buffer_move_finished(slot->descs, pf->parserdescs);
+    last = slot->retval != 0 || pvt->complete || pvt->nextfree == 0;
+    slot->last = last;
+    gt_mutex_lock(pf->mutex);
+    pf->writeslot = (pf->writeslot + 1) % GT_SEQUENCE_BUFFER_PREFETCH_SLOTS;
+    pf->numoffilled++;
+    gt_thread_cond_broadcast(pf->cond);
+    gt_mutex_unlock(pf->mutex);
+  }
+  return NULL;
+}
+
+static int sequence_buffer_prefetch_start(GtSequenceBuffer *sb, GtError *err)
+{
+  GtSequenceBufferMembers *pvt = sb->pvt;
+  GtSequenceBufferPrefetch *pf;
+  GtUword idx;
+
+  pf = gt_calloc((size_t) 1, sizeof *pf);
+  pf->slots = gt_calloc((size_t) GT_SEQUENCE_BUFFER_PREFETCH_SLOTS,
+                        sizeof *pf->slots);
+  for (idx = 0; idx < (GtUword) GT_SEQUENCE_BUFFER_PREFETCH_SLOTS; idx++)
+    pf->slots[idx].descs = gt_desc_buffer_new();
+  if (pvt->descptr != NULL) {
+    /* the parser collects descriptions in a buffer of its own, they are
+       handed over to the reader together with the blocks */
+    pf->readerdescs = pvt->descptr;
+    pf->parserdescs = gt_desc_buffer_new();
+    pvt->descptr = pf->parserdescs;
+  }
+  pf->err = gt_error_new();
+  pf->mutex = gt_mutex_new();
+  pf->cond = gt_thread_cond_new();
+  pvt->prefetch = pf;
+  if (!(pf->thread = gt_thread_new(sequence_buffer_prefetch_thread, sb,
+                                   err))) {
+    return -1;
+  }
+  return 0;
+}
+
+static void sequence_buffer_prefetch_delete(GtSequenceBuffer *sb)
+{
+  GtSequenceBufferPrefetch *pf = sb->pvt->prefetch;
+  GtUword idx;
+
+  if (pf->thread != NULL) {
+    gt_mutex_lock(pf->mutex);
+    pf->stop = true;
+    gt_thread_cond_broadcast(pf->cond);
+    gt_mutex_unlock(pf->mutex);
+    gt_thread_join(pf->thread);
+    gt_thread_delete(pf->thread);
+  }
+  for (idx = 0; idx < (GtUword) GT_SEQUENCE_BUFFER_PREFETCH_SLOTS; idx++)
+    gt_desc_buffer_delete(pf->slots[idx].descs);
+  gt_free(pf->slots);
+  if (pf->readerdescs != NULL)
+    sb->pvt->descptr = pf->readerdescs;
+  gt_desc_buffer_delete(pf->parserdescs);
+  gt_error_delete(pf->err);
+  gt_mutex_delete(pf->mutex);
+  gt_thread_cond_delete(pf->cond);
+  gt_free(pf);
+  sb->pvt->prefetch = NULL;
+}
+
+/* make the next block filled by the prefetching thread available for
+   reading */
+static int sequence_buffer_prefetch_fill(GtSequenceBuffer *sb, GtError *err)
+{
+  GtSequenceBufferMembers *pvt = sb->pvt;
+  GtSequenceBufferPrefetch *pf;
+  GtSequenceBufferSlot *slot;
+
+  if (pvt->prefetch == NULL && sequence_buffer_prefetch_start(sb, err) != 0)
+    return -1;
+  pf = pvt->prefetch;
+  if (pf->complete)
+    return 0;
+  if (pf->readerdescs != NULL && pvt->nextread > 0)
+    gt_desc_buffer_reset(pf->readerdescs);
+  gt_mutex_lock(pf->mutex);
+  if (pf->holding) {
+    pf->readslot = (pf->readslot + 1) % GT_SEQUENCE_BUFFER_PREFETCH_SLOTS;
+    pf->numoffilled--;
+    pf->holding = false;
+    gt_thread_cond_broadcast(pf->cond);
+  }
+  while (pf->numoffilled == 0)
+    gt_thread_cond_wait(pf->cond, pf->mutex);
+  pf->holding = true;
+  gt_mutex_unlock(pf->mutex);
+  slot = pf->slots + pf->readslot;
+  pf->readfilenum = slot->filenum;
+  pf->complete = slot->last;
+  if (slot->retval != 0) {
+    gt_error_set(err, "%s", gt_error_get(pf->err));
+    return -1;
+  }
+  if (pf->readerdescs != NULL)
+    gt_desc_buffer_move_finished(pf->readerdescs, slot->descs);
+  pvt->readbuf = slot->outbuf;
+  pvt->readbuforig = slot->outbuforig;
+  pvt->readfree = slot->nextfree;
+  pvt->nextread = 0;
+  return pvt->readfree == 0 ? 0 : 1;
+}
+#endif
+
+/* make the next block of characters available for reading, returns 1 if
+   there are characters to read, 0 if all files are exhausted and -1 on
+   error */
+static int sequence_buffer_fill(GtSequenceBuffer *sb, GtError *err)
+{
+  GtSequenceBufferMembers *pvt = sb->pvt;
+#ifdef GT_THREADS_ENABLED
+  if (pvt->prefetch_enabled)
+    return sequence_buffer_prefetch_fill(sb, err);
+#endif
+  if (pvt->complete)
+    return 0;
+  if (pvt->descptr && pvt->nextread > 0)
+    gt_desc_buffer_reset(pvt->descptr);
+  gt_assert(sb->c_class && sb->c_class->advance);
+  if (sb->c_class->advance(sb, err) != 0)
+    return -1;
+  pvt->readbuf = pvt->outbuf;
+  pvt->readbuforig = pvt->outbuforig;
+  pvt->readfree = pvt->nextfree;
+  pvt->nextread = 0;
+  return pvt->readfree == 0 ? 0 : 1;
+}
+
 void gt_sequence_buffer_delete(GtSequenceBuffer *si)
 {
   if (!si) return;
@@ -48,6 +250,10 @@ void gt_sequence_buffer_delete(GtSequenceBuffer *si)
     return;
   }
   gt_assert(si->c_class && si->c_class->free);
+#ifdef GT_THREADS_ENABLED
+  if (si->pvt->prefetch != NULL)
+    sequence_buffer_prefetch_delete(si);
+#endif
   si->c_class->free(si);
   gt_free(si->pvt);
   gt_free(si);
@@ -105,6 +311,10 @@ GtSequenceBuffer* gt_sequence_buffer_new_guess_type(const GtStrArray *seqs,
 GtUword gt_sequence_buffer_get_file_index(GtSequenceBuffer *si)
 {
   gt_assert(si && si->c_class && si->c_class->get_file_index);
+#ifdef GT_THREADS_ENABLED
+  if (si->pvt->prefetch != NULL)
+    return si->pvt->prefetch->readfilenum;
+#endif
   return si->c_class->get_file_index(si);
 }
 
@@ -134,6 +344,14 @@ void gt_sequence_buffer_set_filelengthtab(GtSequenceBuffer *si,
   si->pvt->filelengthtab = flv;
 }
 
+void gt_sequence_buffer_enable_prefetch(GtSequenceBuffer *si)
+{
+  gt_assert(si && si->pvt && si->pvt->readbuf == NULL);
+#ifdef GT_THREADS_ENABLED
+  si->pvt->prefetch_enabled = true;
+#endif
+}
+
 void gt_sequence_buffer_set_chardisttab(GtSequenceBuffer *si,
                                         GtUword *chardisttab)
 {
@@ -159,25 +377,15 @@ int gt_sequence_buffer_next(GtSequenceBuffer *sb, GtUchar *val,
 {
   GtSequenceBufferMembers *pvt;
   pvt = sb->pvt;
-  if (pvt->nextread >= pvt->nextfree)
+  if (pvt->nextread >= pvt->readfree)
   {
-    if (pvt->complete)
-    {
-      return 0;
-    }
-    if (pvt->descptr && pvt->nextread > 0)
-      gt_desc_buffer_reset(pvt->descptr);
-    if (gt_sequence_buffer_advance(sb, err) != 0)
+    int retval = sequence_buffer_fill(sb, err);
+    if (retval <= 0)
     {
-      return -1;
-    }
-    pvt->nextread = 0;
-    if (pvt->nextfree == 0)
-    {
-      return 0;
+      return retval;
     }
   }
-  *val = pvt->outbuf[pvt->nextread++];
+  *val = pvt->readbuf[pvt->nextread++];
   return 1;
 }
 
@@ -187,26 +395,16 @@ int gt_sequence_buffer_next_with_original(GtSequenceBuffer *sb,
 {
   GtSequenceBufferMembers *pvt;
   pvt = sb->pvt;
-  if (pvt->nextread >= pvt->nextfree)
+  if (pvt->nextread >= pvt->readfree)
   {
-    if (pvt->complete)
-    {
-      return 0;
-    }
-    if (pvt->descptr && pvt->nextread > 0)
-      gt_desc_buffer_reset(pvt->descptr);
-    if (gt_sequence_buffer_advance(sb, err) != 0)
-    {
-      return -1;
-    }
-    pvt->nextread = 0;
-    if (pvt->nextfree == 0)
+    int retval = sequence_buffer_fill(sb, err);
+    if (retval <= 0)
     {
-      return 0;
+      return retval;
     }
   }
-  *val = pvt->outbuf[pvt->nextread];
-  *orig = pvt->outbuforig[pvt->nextread];
+  *val = pvt->readbuf[pvt->nextread];
+  *orig = pvt->readbuforig[pvt->nextread];
   pvt->nextread++;
   return 1;
 }
@@ -256,5 +454,61 @@ int gt_sequence_buffer_unit_test(GtError *err)
   }
   gt_str_array_delete(testfiles);
 
+  /* reading with and without prefetching yields the same characters and
+     descriptions */
+  if (!had_err) {
+    GtSequenceBuffer *sbs[2];
+    GtDescBuffer *dbs[2];
+    int retvals[2];
+    GtUchar vals[2];
+    char origs[2];
+
+    testfiles = gt_str_array_new();
+    tmpfilename = gt_str_new();
+    tmpfp = gt_xtmpfp(tmpfilename);
+    for (i = 0; i < 500UL; i++) {
+      GtUword j, len = (i % 50UL == 0) ? 3 * OUTBUFSIZE + i : 1 + i % 97UL;
+      fprintf(tmpfp, ">seq" GT_WU " description %s\n", i,
+              i % 2 == 0 ? "even" : "odd");
+      for (j = 0; j < len; j++)
+        gt_xfputc("acgtn"[(i + j * j) % 5UL], tmpfp);
+      gt_xfputc('\n', tmpfp);
+    }
+    gt_fa_xfclose(tmpfp);
+    gt_str_array_add(testfiles, tmpfilename);
+    gt_str_array_add(testfiles, tmpfilename);
+    for (i = 0; i < 2UL; i++) {
+      sbs[i] = gt_sequence_buffer_new_guess_type(testfiles, err);
+      gt_assert(sbs[i] != NULL);
+      dbs[i] = gt_desc_buffer_new();
+      gt_sequence_buffer_set_desc_buffer(sbs[i], dbs[i]);
+    }
+    gt_sequence_buffer_enable_prefetch(sbs[1]);
+    do {
+      for (i = 0; i < 2UL; i++)
+        retvals[i] = gt_sequence_buffer_next_with_original(sbs[i], vals + i,
+                                                           origs + i, err);
+      gt_ensure(retvals[0] == retvals[1]);
+      if (!had_err && retvals[0] > 0) {
+        /* the original character is undefined for separators */
+        gt_ensure(vals[0] == vals[1] &&
+                  (vals[0] == (GtUchar) SEPARATOR || origs[0] == origs[1]));
+        if (!had_err && vals[0] == (GtUchar) SEPARATOR) {
+          const char *desc = gt_desc_buffer_get_next(dbs[0]);
+          gt_ensure(strcmp(desc, gt_desc_buffer_get_next(dbs[1])) == 0);
+        }
+      }
+    } while (!had_err && retvals[0] > 0);
+    gt_ensure(gt_desc_buffer_max_length(dbs[0])
+                == gt_desc_buffer_max_length(dbs[1]));
+    for (i = 0; i < 2UL; i++) {
+      gt_sequence_buffer_delete(sbs[i]);
+      gt_desc_buffer_delete(dbs[i]);
+    }
+    gt_xremove(gt_str_get(tmpfilename));
+    gt_str_delete(tmpfilename);
+    gt_str_array_delete(testfiles);
+  }
+
   return had_err;
 }
@@ -80,6 +80,13 @@ void          gt_sequence_buffer_set_filelengthtab(GtSequenceBuffer*,
 void          gt_sequence_buffer_set_desc_buffer(GtSequenceBuffer *si,
                                                  GtDescBuffer *db);
 
+/* Makes <si> parse its input files in a separate thread which runs ahead of
+   the reading functions by a bounded number of blocks, so that decompressing
+   and parsing the input overlaps with the processing of the characters read.
+   All other settings must be made before. Must be called before the first
+   character is read. Has no effect if threads are not enabled. */
+void          gt_sequence_buffer_enable_prefetch(GtSequenceBuffer *si);
+
 /* Assigns an array which counts the occurrences of each alphabet character in
    the read sequence. It must have at least as many elements as the number of
    characters in the expected alphabet.
@@ -37,6 +37,7 @@ struct GtSequenceBufferClass {
 };
 
 typedef struct GtSequenceBufferMembers GtSequenceBufferMembers;
+typedef struct GtSequenceBufferPrefetch GtSequenceBufferPrefetch;
 
 struct GtSequenceBuffer {
   const GtSequenceBufferClass *c_class;
@@ -56,15 +57,26 @@ struct GtSequenceBufferMembers {
                 currentfillpos,
                 currentinpos,
                 nextread,
-                nextfree;
+                nextfree,
+                readfree;
   uint64_t lastspeciallength;
   GtUint64 counter;
   const GtStrArray *filenametab;
+  /* the <advance> function fills <outbuf> and <outbuforig> with <nextfree>
+     characters, which are then read from <readbuf> and <readbuforig> up to
+     <readfree>. Both point to the same block unless the input is prefetched
+     by a separate thread. */
   unsigned char ungetchar,
                 inbuf[INBUFSIZE],
-                outbuf[OUTBUFSIZE],
-                outbuforig[OUTBUFSIZE];
+                outbufspace[OUTBUFSIZE],
+                outbuforigspace[OUTBUFSIZE],
+                *outbuf,
+                *outbuforig;
+  const unsigned char *readbuf,
+                      *readbuforig;
   const unsigned char *symbolmap;
+  bool prefetch_enabled;
+  GtSequenceBufferPrefetch *prefetch;
 };
 
 GtSequenceBuffer* gt_sequence_buffer_create(const GtSequenceBufferClass*);
@@ -18,9 +18,11 @@
 #include <math.h>
 #include <string.h>
 #include "core/assert_api.h"
+#include "core/atomic.h"
 #include "core/cstr_api.h"
 #include "core/dynalloc.h"
 #include "core/ensure.h"
+#include "core/file.h"
 #include "core/ma.h"
 #include "core/str.h"
 #include "core/unused_api.h"
@@ -247,7 +249,8 @@ GtStr* gt_str_clone(const GtStr *s)
 GtStr* gt_str_ref(GtStr *s)
 {
   if (!s) return NULL;
-  s->reference_count++; /* increase the reference counter */
+  /* strings like sequence IDs are shared by nodes in different threads */
+  (void) gt_atomic_fetch_add(&s->reference_count, 1U);
   return s;
 }
 
@@ -255,7 +258,8 @@ GtStr* gt_str_ref(GtStr *s)
    following:
    gt_str_read_next_line uses gt_xfgetc while
    gt_str_read_next_line_generic uses gt_file_xfgetc
-   Also gt_str_read_next_line_generic does not assert <fpin> != NULL
+   Also gt_str_read_next_line_generic does not assert <fpin> != NULL and reads
+   whole lines with gt_file_xread_line if <fpin> is given.
 */
 
 int gt_str_read_next_line(GtStr *s, FILE *fpin)
@@ -322,6 +326,22 @@ int gt_str_read_next_line_generic(GtStr *s, GtFile *fpin)
   int cc;
   char c;
   gt_assert(s);
+  if (fpin != NULL) {
+    const char *line;
+    size_t length;
+    cc = gt_file_xread_line(fpin, &line, &length);
+    if ((s->length + length + 1) * sizeof (char) > s->allocated) {
+      s->cstr = gt_dynalloc(s->cstr, &s->allocated,
+                            (s->length + length + 1) * sizeof (char));
+    }
+    if (length > 0) {
+      memcpy(s->cstr + s->length, line, length);
+      s->length += length;
+    }
+    if (cc != EOF)
+      s->cstr[s->length] = '\0';
+    return cc;
+  }
   for (;;) {
     cc = gt_file_xfgetc(fpin);
     if (cc == EOF)
@@ -465,10 +485,10 @@ int gt_str_unit_test(GtError *err)
 void gt_str_delete(GtStr *s)
 {
   if (!s) return;           /* return without action if 's' is NULL */
-  if (s->reference_count) { /* there are multiple references to this string */
-    s->reference_count--;   /* decrement the reference counter */
-    return;                 /* return without freeing the object */
-  }
+  /* there are multiple references to this string -> decrement the
+     reference counter and return without freeing the object */
+  if (gt_atomic_fetch_sub(&s->reference_count, 1U) > 0)
+    return;
   gt_free(s->cstr);         /* free the stored the C string */
   gt_free(s);               /* free the actual string object */
 }
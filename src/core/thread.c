@@ -19,7 +19,7 @@
 #include "core/array_api.h"
 #include "core/compat.h"
 #include "core/ma_api.h"
-#include "core/thread_api.h"
+#include "core/thread.h"
 #include "core/unused_api.h"
 
 unsigned int gt_jobs = 1;
@@ -146,6 +146,83 @@ void gt_mutex_unlock_func(GtMutex *mutex)
   gt_assert(!rval);
 }
 
+GtThreadCond* gt_thread_cond_new(void)
+{
+  GtThreadCond *cond;
+  GT_UNUSED int rval;
+  cond = thread_xmalloc(sizeof (pthread_cond_t), __FILE__, __LINE__);
+  /* initialize condition variable with default attributes */
+  rval = pthread_cond_init((pthread_cond_t*) cond, NULL);
+  gt_assert(!rval);
+  return cond;
+}
+
+void gt_thread_cond_delete(GtThreadCond *cond)
+{
+  GT_UNUSED int rval;
+  if (!cond) return;
+  rval = pthread_cond_destroy((pthread_cond_t*) cond);
+  gt_assert(!rval);
+  free(cond);
+}
+
+void gt_thread_cond_wait_func(GtThreadCond *cond, GtMutex *mutex)
+{
+  GT_UNUSED int rval;
+  gt_assert(cond && mutex);
+  rval = pthread_cond_wait((pthread_cond_t*) cond, (pthread_mutex_t*) mutex);
+  gt_assert(!rval);
+}
+
+void gt_thread_cond_signal_func(GtThreadCond *cond)
+{
+  GT_UNUSED int rval;
+  gt_assert(cond);
+  rval = pthread_cond_signal((pthread_cond_t*) cond);
+  gt_assert(!rval);
+}
+
+void gt_thread_cond_broadcast_func(GtThreadCond *cond)
+{
+  GT_UNUSED int rval;
+  gt_assert(cond);
+  rval = pthread_cond_broadcast((pthread_cond_t*) cond);
+  gt_assert(!rval);
+}
+
+GtThreadKey* gt_thread_key_new(void)
+{
+  GtThreadKey *key;
+  GT_UNUSED int rval;
+  key = thread_xmalloc(sizeof (pthread_key_t), __FILE__, __LINE__);
+  rval = pthread_key_create((pthread_key_t*) key, NULL);
+  gt_assert(!rval);
+  return key;
+}
+
+void gt_thread_key_delete(GtThreadKey *key)
+{
+  GT_UNUSED int rval;
+  if (!key) return;
+  rval = pthread_key_delete(*(pthread_key_t*) key);
+  gt_assert(!rval);
+  free(key);
+}
+
+void gt_thread_key_set(GtThreadKey *key, void *value)
+{
+  GT_UNUSED int rval;
+  gt_assert(key);
+  rval = pthread_setspecific(*(pthread_key_t*) key, value);
+  gt_assert(!rval);
+}
+
+void* gt_thread_key_get(const GtThreadKey *key)
+{
+  gt_assert(key);
+  return pthread_getspecific(*(const pthread_key_t*) key);
+}
+
 #else
 
 GtThread* gt_thread_new(GtThreadFunc function, void *data,
@@ -179,6 +256,41 @@ void gt_mutex_delete(GT_UNUSED GtMutex *mutex)
   return;
 }
 
+GtThreadCond* gt_thread_cond_new(void)
+{
+  return NULL;
+}
+
+void gt_thread_cond_delete(GT_UNUSED GtThreadCond *cond)
+{
+  return;
+}
+
+/* without threads, the value of a key is simply stored in the key */
+GtThreadKey* gt_thread_key_new(void)
+{
+  void **key = gt_malloc(sizeof *key);
+  *key = NULL;
+  return (GtThreadKey*) key;
+}
+
+void gt_thread_key_delete(GtThreadKey *key)
+{
+  gt_free(key);
+}
+
+void gt_thread_key_set(GtThreadKey *key, void *value)
+{
+  gt_assert(key);
+  *(void**) key = value;
+}
+
+void* gt_thread_key_get(const GtThreadKey *key)
+{
+  gt_assert(key);
+  return *(void* const*) key;
+}
+
 #endif
 
 void gt_thread_delete(GtThread *thread)
@@ -0,0 +1,77 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef THREAD_H
+#define THREAD_H
+
+#include "core/thread_api.h"
+
+/* The <GtThreadCond> class represents a condition variable, which is always
+   used together with a <GtMutex> protecting the condition. */
+typedef struct GtThreadCond GtThreadCond;
+
+/* The <GtThreadKey> class represents a key for a value which is local to each
+   thread (initially <NULL> for every thread). */
+typedef struct GtThreadKey GtThreadKey;
+
+/* Return a new <GtThreadCond*> object. */
+GtThreadCond* gt_thread_cond_new(void);
+/* Delete the given <cond>. */
+void          gt_thread_cond_delete(GtThreadCond *cond);
+
+#ifdef GT_THREADS_ENABLED
+/* Atomically unlock <mutex> and wait until <cond> is signaled, lock <mutex>
+   again before returning. As wakeups may be spurious, the condition has to be
+   rechecked after returning. */
+#define       gt_thread_cond_wait(cond, mutex) \
+              gt_thread_cond_wait_func(cond, mutex)
+void          gt_thread_cond_wait_func(GtThreadCond *cond, GtMutex *mutex);
+#else
+#define       gt_thread_cond_wait(cond, mutex) \
+              ((void) 0)
+#endif
+
+#ifdef GT_THREADS_ENABLED
+/* Wake up one of the threads waiting for <cond>. */
+#define       gt_thread_cond_signal(cond) \
+              gt_thread_cond_signal_func(cond)
+void          gt_thread_cond_signal_func(GtThreadCond *cond);
+#else
+#define       gt_thread_cond_signal(cond) \
+              ((void) 0)
+#endif
+
+#ifdef GT_THREADS_ENABLED
+/* Wake up all threads waiting for <cond>. */
+#define       gt_thread_cond_broadcast(cond) \
+              gt_thread_cond_broadcast_func(cond)
+void          gt_thread_cond_broadcast_func(GtThreadCond *cond);
+#else
+#define       gt_thread_cond_broadcast(cond) \
+              ((void) 0)
+#endif
+
+/* Return a new <GtThreadKey*> object. */
+GtThreadKey*  gt_thread_key_new(void);
+/* Delete the given <key>. */
+void          gt_thread_key_delete(GtThreadKey *key);
+/* Set the value of <key> for the calling thread to <value>. */
+void          gt_thread_key_set(GtThreadKey *key, void *value);
+/* Return the value of <key> for the calling thread. */
+void*         gt_thread_key_get(const GtThreadKey *key);
+
+#endif
@@ -0,0 +1,670 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/array.h"
+#include "core/assert_api.h"
+#include "core/ensure.h"
+#include "core/ma_api.h"
+#include "core/minmax.h"
+#include "core/thread.h"
+#include "core/thread_pool.h"
+#include "core/unused_api.h"
+
+typedef struct
+{
+  GtThreadPoolTaskFunc func;
+  void *data;
+  GtThreadPoolGroup *group;
+} GtThreadPoolTask;
+
+typedef struct
+{
+  GtUword start, end, grainsize;
+  GtThreadPoolRangeFunc func;
+  void *data;
+  GtThreadPoolGroup *group;
+} GtThreadPoolRange;
+
+/* the pools handed out by <gt_thread_pool_get()>, at most one per number of
+   workers; they are never deleted before <gt_thread_pool_clean()>, so a pool
+   stays valid for threads still using it after <gt_jobs> has changed */
+static GtArray *global_pools = NULL;
+static GtMutex *global_pool_mutex = NULL;
+
+#ifdef GT_THREADS_ENABLED
+
+/* tasks are stored in a ring buffer, the elements with (virtual) indices
+   <top> to <bottom> - 1 are present */
+typedef struct
+{
+  GtThreadPoolTask *space;
+  GtUword top, bottom, allocated;
+  GtMutex *mutex;
+} GtThreadPoolDeque;
+
+typedef struct
+{
+  GtThreadPool *pool;
+  unsigned int id;
+  GtThreadPoolDeque deque;
+  GtThread *thread; /* NULL for worker 0, which is the driving thread */
+} GtThreadPoolWorker;
+
+struct GtThreadPool
+{
+  unsigned int numofworkers;
+  GtThreadPoolWorker *workers;
+  GtThreadKey *worker_key;
+  /* <mutex> protects <pending>, <shutdown>, <driven> and the task counters of
+     all groups, <cond> is signaled if one of them changes */
+  GtMutex *mutex;
+  GtThreadCond *cond;
+  GtUword pending;
+  bool shutdown,
+       driven;
+};
+
+struct GtThreadPoolGroup
+{
+  GtThreadPool *pool;
+  GtUword outstanding;
+  bool is_driver,
+       runs_inline; /* the pool is driven by another outside thread */
+};
+
+static void thread_pool_deque_push(GtThreadPoolDeque *deque,
+                                   const GtThreadPoolTask *task)
+{
+  gt_mutex_lock(deque->mutex);
+  if (deque->bottom - deque->top == deque->allocated) {
+    GtUword idx, newallocated = deque->allocated * 2 + 16;
+    GtThreadPoolTask *newspace = gt_malloc(sizeof *newspace * newallocated);
+    for (idx = deque->top; idx < deque->bottom; idx++) {
+      newspace[idx - deque->top] = deque->space[idx % deque->allocated];
+    }
+    gt_free(deque->space);
+    deque->space = newspace;
+    deque->bottom -= deque->top;
+    deque->top = 0;
+    deque->allocated = newallocated;
+  }
+  deque->space[deque->bottom++ % deque->allocated] = *task;
+  gt_mutex_unlock(deque->mutex);
+}
+
+/* the owner of <deque> takes the most recently pushed task */
+static bool thread_pool_deque_pop(GtThreadPoolDeque *deque,
+                                  GtThreadPoolTask *task)
+{
+  bool found = false;
+  gt_mutex_lock(deque->mutex);
+  if (deque->bottom > deque->top) {
+    *task = deque->space[--deque->bottom % deque->allocated];
+    found = true;
+  }
+  gt_mutex_unlock(deque->mutex);
+  return found;
+}
+
+/* thieves take the oldest task, which usually is the largest one */
+static bool thread_pool_deque_steal(GtThreadPoolDeque *deque,
+                                    GtThreadPoolTask *task)
+{
+  bool found = false;
+  gt_mutex_lock(deque->mutex);
+  if (deque->bottom > deque->top) {
+    *task = deque->space[deque->top++ % deque->allocated];
+    found = true;
+  }
+  gt_mutex_unlock(deque->mutex);
+  return found;
+}
+
+static bool thread_pool_find_task(GtThreadPool *pool,
+                                  GtThreadPoolWorker *worker,
+                                  GtThreadPoolTask *task)
+{
+  bool found = thread_pool_deque_pop(&worker->deque, task);
+  unsigned int idx;
+
+  for (idx = 1U; !found && idx < pool->numofworkers; idx++) {
+    GtThreadPoolWorker *victim
+      = pool->workers + (worker->id + idx) % pool->numofworkers;
+    found = thread_pool_deque_steal(&victim->deque, task);
+  }
+  if (found) {
+    gt_mutex_lock(pool->mutex);
+    gt_assert(pool->pending > 0);
+    pool->pending--;
+    gt_mutex_unlock(pool->mutex);
+  }
+  return found;
+}
+
+static void thread_pool_execute(GtThreadPool *pool,
+                                GtThreadPoolWorker *worker,
+                                const GtThreadPoolTask *task)
+{
+  task->func(worker->id, task->data);
+  gt_mutex_lock(pool->mutex);
+  gt_assert(task->group->outstanding > 0);
+  if (--task->group->outstanding == 0) {
+    gt_thread_cond_broadcast(pool->cond);
+  }
+  gt_mutex_unlock(pool->mutex);
+}
+
+static void* thread_pool_worker_main(void *data)
+{
+  GtThreadPoolWorker *worker = (GtThreadPoolWorker*) data;
+  GtThreadPool *pool = worker->pool;
+  GtThreadPoolTask task;
+  bool shutdown = false;
+
+  gt_thread_key_set(pool->worker_key, worker);
+  while (!shutdown) {
+    if (thread_pool_find_task(pool, worker, &task)) {
+      thread_pool_execute(pool, worker, &task);
+    } else {
+      gt_mutex_lock(pool->mutex);
+      while (pool->pending == 0 && !pool->shutdown) {
+        gt_thread_cond_wait(pool->cond, pool->mutex);
+      }
+      shutdown = pool->shutdown;
+      gt_mutex_unlock(pool->mutex);
+    }
+  }
+  return NULL;
+}
+
+static void thread_pool_stop(GtThreadPool *pool, unsigned int numofthreads)
+{
+  unsigned int idx;
+
+  gt_mutex_lock(pool->mutex);
+  pool->shutdown = true;
+  gt_thread_cond_broadcast(pool->cond);
+  gt_mutex_unlock(pool->mutex);
+  for (idx = 1U; idx <= numofthreads; idx++) {
+    gt_thread_join(pool->workers[idx].thread);
+    gt_thread_delete(pool->workers[idx].thread);
+  }
+  for (idx = 0; idx < pool->numofworkers; idx++) {
+    gt_free(pool->workers[idx].deque.space);
+    gt_mutex_delete(pool->workers[idx].deque.mutex);
+  }
+  gt_thread_key_delete(pool->worker_key);
+  gt_mutex_delete(pool->mutex);
+  gt_thread_cond_delete(pool->cond);
+  gt_free(pool->workers);
+  gt_free(pool);
+}
+
+GtThreadPool* gt_thread_pool_new(unsigned int numofworkers, GtError *err)
+{
+  GtThreadPool *pool;
+  unsigned int idx;
+
+  gt_error_check(err);
+  gt_assert(numofworkers > 0);
+  pool = gt_malloc(sizeof *pool);
+  pool->numofworkers = numofworkers;
+  pool->workers = gt_calloc((size_t) numofworkers, sizeof *pool->workers);
+  pool->pending = 0;
+  pool->shutdown = false;
+  pool->driven = false;
+  pool->worker_key = gt_thread_key_new();
+  pool->mutex = gt_mutex_new();
+  pool->cond = gt_thread_cond_new();
+  for (idx = 0; idx < numofworkers; idx++) {
+    pool->workers[idx].pool = pool;
+    pool->workers[idx].id = idx;
+    pool->workers[idx].deque.mutex = gt_mutex_new();
+  }
+  for (idx = 1U; idx < numofworkers; idx++) {
+    pool->workers[idx].thread = gt_thread_new(thread_pool_worker_main,
+                                              pool->workers + idx, err);
+    if (pool->workers[idx].thread == NULL) {
+      thread_pool_stop(pool, idx - 1);
+      return NULL;
+    }
+  }
+  return pool;
+}
+
+void gt_thread_pool_delete(GtThreadPool *pool)
+{
+  if (!pool) return;
+  thread_pool_stop(pool, pool->numofworkers - 1);
+}
+
+GtThreadPoolGroup* gt_thread_pool_group_new(GtThreadPool *pool)
+{
+  GtThreadPoolGroup *group;
+
+  gt_assert(pool);
+  group = gt_malloc(sizeof *group);
+  group->pool = pool;
+  group->outstanding = 0;
+  group->is_driver = false;
+  group->runs_inline = false;
+  if (gt_thread_key_get(pool->worker_key) == NULL) {
+    /* the calling thread is not yet part of the pool, so it becomes the
+       driving thread unless another outside thread already drives the pool.
+       Blocking until the pool is released could deadlock if the driving
+       thread waits for the caller, hence the tasks are run inline then. */
+    gt_mutex_lock(pool->mutex);
+    if (pool->driven) {
+      group->runs_inline = true;
+    } else {
+      pool->driven = true;
+      group->is_driver = true;
+    }
+    gt_mutex_unlock(pool->mutex);
+    if (group->is_driver) {
+      gt_thread_key_set(pool->worker_key, pool->workers);
+    }
+  }
+  return group;
+}
+
+void gt_thread_pool_group_submit(GtThreadPoolGroup *group,
+                                 GtThreadPoolTaskFunc func, void *data)
+{
+  GtThreadPool *pool;
+  GtThreadPoolWorker *worker;
+  GtThreadPoolTask task;
+
+  gt_assert(group && func);
+  if (group->runs_inline) {
+    func(0, data);
+    return;
+  }
+  pool = group->pool;
+  worker = gt_thread_key_get(pool->worker_key);
+  gt_assert(worker != NULL);
+  task.func = func;
+  task.data = data;
+  task.group = group;
+  /* count the task before it becomes visible to thieves, waiting threads
+     then never miss it */
+  gt_mutex_lock(pool->mutex);
+  group->outstanding++;
+  pool->pending++;
+  gt_mutex_unlock(pool->mutex);
+  thread_pool_deque_push(&worker->deque, &task);
+  gt_thread_cond_signal(pool->cond);
+}
+
+void gt_thread_pool_group_wait(GtThreadPoolGroup *group)
+{
+  GtThreadPool *pool;
+  GtThreadPoolWorker *worker;
+  GtThreadPoolTask task;
+
+  gt_assert(group);
+  if (group->runs_inline) {
+    return;
+  }
+  pool = group->pool;
+  worker = gt_thread_key_get(pool->worker_key);
+  gt_assert(worker != NULL);
+  while (true) {
+    bool done;
+    gt_mutex_lock(pool->mutex);
+    done = group->outstanding == 0 ? true : false;
+    gt_mutex_unlock(pool->mutex);
+    if (done) {
+      break;
+    }
+    if (thread_pool_find_task(pool, worker, &task)) {
+      thread_pool_execute(pool, worker, &task);
+    } else {
+      gt_mutex_lock(pool->mutex);
+      while (group->outstanding > 0 && pool->pending == 0) {
+        gt_thread_cond_wait(pool->cond, pool->mutex);
+      }
+      gt_mutex_unlock(pool->mutex);
+    }
+  }
+}
+
+void gt_thread_pool_group_delete(GtThreadPoolGroup *group)
+{
+  if (!group) return;
+  gt_thread_pool_group_wait(group);
+  if (group->is_driver) {
+    gt_mutex_lock(group->pool->mutex);
+    group->pool->driven = false;
+    gt_mutex_unlock(group->pool->mutex);
+    gt_thread_key_set(group->pool->worker_key, NULL);
+  }
+  gt_free(group);
+}
+
+#else
+
+struct GtThreadPool
+{
+  unsigned int numofworkers;
+};
+
+struct GtThreadPoolGroup
+{
+  GtThreadPool *pool;
+};
+
+GtThreadPool* gt_thread_pool_new(GT_UNUSED unsigned int numofworkers,
+                                 GT_UNUSED GtError *err)
+{
+  GtThreadPool *pool;
+  gt_error_check(err);
+  gt_assert(numofworkers > 0);
+  pool = gt_malloc(sizeof *pool);
+  pool->numofworkers = 1U;
+  return pool;
+}
+
+void gt_thread_pool_delete(GtThreadPool *pool)
+{
+  gt_free(pool);
+}
+
+GtThreadPoolGroup* gt_thread_pool_group_new(GtThreadPool *pool)
+{
+  GtThreadPoolGroup *group;
+  gt_assert(pool);
+  group = gt_malloc(sizeof *group);
+  group->pool = pool;
+  return group;
+}
+
+void gt_thread_pool_group_submit(GT_UNUSED GtThreadPoolGroup *group,
+                                 GtThreadPoolTaskFunc func, void *data)
+{
+  gt_assert(group && func);
+  func(0, data);
+}
+
+void gt_thread_pool_group_wait(GT_UNUSED GtThreadPoolGroup *group)
+{
+  gt_assert(group);
+}
+
+void gt_thread_pool_group_delete(GtThreadPoolGroup *group)
+{
+  gt_free(group);
+}
+
+#endif
+
+unsigned int gt_thread_pool_size(const GtThreadPool *pool)
+{
+  gt_assert(pool);
+  return pool->numofworkers;
+}
+
+void gt_thread_pool_init(void)
+{
+  if (!global_pool_mutex)
+    global_pool_mutex = gt_mutex_new();
+}
+
+void gt_thread_pool_clean(void)
+{
+  GtUword idx;
+
+  for (idx = 0; global_pools != NULL && idx < gt_array_size(global_pools);
+       idx++) {
+    gt_thread_pool_delete(*(GtThreadPool**) gt_array_get(global_pools, idx));
+  }
+  gt_array_delete(global_pools);
+  global_pools = NULL;
+  gt_mutex_delete(global_pool_mutex);
+  global_pool_mutex = NULL;
+}
+
+GtThreadPool* gt_thread_pool_get(GtError *err)
+{
+  GtThreadPool *pool = NULL;
+  unsigned int numofworkers;
+  GtUword idx;
+
+  gt_error_check(err);
+  gt_assert(global_pool_mutex != NULL);
+#ifdef GT_THREADS_ENABLED
+  numofworkers = MAX(gt_jobs, 1U);
+#else
+  numofworkers = 1U;
+#endif
+  gt_mutex_lock(global_pool_mutex);
+  if (global_pools == NULL) {
+    global_pools = gt_array_new(sizeof (GtThreadPool*));
+  }
+  for (idx = 0; pool == NULL && idx < gt_array_size(global_pools); idx++) {
+    GtThreadPool *candidate = *(GtThreadPool**) gt_array_get(global_pools,
+                                                             idx);
+    if (candidate->numofworkers == numofworkers) {
+      pool = candidate;
+    }
+  }
+  if (pool == NULL && (pool = gt_thread_pool_new(numofworkers, err))) {
+    gt_array_add(global_pools, pool);
+  }
+  gt_mutex_unlock(global_pool_mutex);
+  return pool;
+}
+
+void gt_thread_pool_run(GtThreadPool *pool, GtUword numoftasks,
+                        GtThreadPoolTaskFunc func, void *data)
+{
+  GtThreadPoolGroup *group = gt_thread_pool_group_new(pool);
+  GtUword idx;
+
+  for (idx = 0; idx < numoftasks; idx++) {
+    gt_thread_pool_group_submit(group, func, data);
+  }
+  gt_thread_pool_group_delete(group);
+}
+
+static void thread_pool_range_task(unsigned int workerid, void *data)
+{
+  GtThreadPoolRange *range = (GtThreadPoolRange*) data;
+
+  /* keep the lower half and offer the upper half to other workers */
+  while (range->end - range->start > range->grainsize) {
+    GtThreadPoolRange *upper = gt_malloc(sizeof *upper);
+    *upper = *range;
+    upper->start = range->start + (range->end - range->start)/2;
+    range->end = upper->start;
+    gt_thread_pool_group_submit(range->group, thread_pool_range_task, upper);
+  }
+  range->func(range->start, range->end, workerid, range->data);
+  gt_free(range);
+}
+
+void gt_thread_pool_parallel_for(GtThreadPool *pool,
+                                 GtUword start,
+                                 GtUword end,
+                                 GtUword grainsize,
+                                 GtThreadPoolRangeFunc func,
+                                 void *data)
+{
+  GtThreadPoolRange *range;
+  GtThreadPoolGroup *group;
+
+  gt_assert(pool && func && start <= end);
+  if (start == end) {
+    return;
+  }
+  if (grainsize == 0) {
+    /* leave room for stealing: about eight subranges per worker */
+    grainsize = pool->numofworkers == 1U
+                  ? end - start
+                  : MAX((end - start)/(8 * pool->numofworkers), (GtUword) 1);
+  }
+  group = gt_thread_pool_group_new(pool);
+  range = gt_malloc(sizeof *range);
+  range->start = start;
+  range->end = end;
+  range->grainsize = grainsize;
+  range->func = func;
+  range->data = data;
+  range->group = group;
+  gt_thread_pool_group_submit(group, thread_pool_range_task, range);
+  gt_thread_pool_group_delete(group);
+}
+
+#define GT_THREAD_POOL_TEST_SIZE 100000UL
+
+typedef struct
+{
+  unsigned char *visited;
+  GtUword *sums;
+} GtThreadPoolTestInfo;
+
+static void thread_pool_test_range(GtUword start, GtUword end,
+                                   unsigned int workerid, void *data)
+{
+  GtThreadPoolTestInfo *info = (GtThreadPoolTestInfo*) data;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++) {
+    info->visited[idx]++;
+    info->sums[workerid] += idx;
+  }
+}
+
+typedef struct
+{
+  GtThreadPoolGroup *group;
+  GtUword value, result;
+} GtThreadPoolTestFib;
+
+static void thread_pool_test_fib(GT_UNUSED unsigned int workerid, void *data)
+{
+  GtThreadPoolTestFib *fib = (GtThreadPoolTestFib*) data;
+
+  if (fib->value < 2UL) {
+    fib->result = fib->value;
+  } else {
+    GtThreadPoolTestFib left, right;
+    GtThreadPoolGroup *group = gt_thread_pool_group_new(fib->group->pool);
+    left.group = right.group = group;
+    left.value = fib->value - 1;
+    right.value = fib->value - 2;
+    gt_thread_pool_group_submit(group, thread_pool_test_fib, &left);
+    gt_thread_pool_group_submit(group, thread_pool_test_fib, &right);
+    gt_thread_pool_group_delete(group);
+    fib->result = left.result + right.result;
+  }
+}
+
+#ifdef GT_THREADS_ENABLED
+typedef struct
+{
+  GtThreadPool *pool;
+  GtThreadPoolTestInfo info;
+  GtError *err;
+  int had_err;
+} GtThreadPoolTestOutside;
+
+static void* thread_pool_test_outside_main(void *data)
+{
+  GtThreadPoolTestOutside *outside = (GtThreadPoolTestOutside*) data;
+
+  gt_thread_pool_parallel_for(outside->pool, 0, GT_THREAD_POOL_TEST_SIZE, 0,
+                              thread_pool_test_range, &outside->info);
+  return NULL;
+}
+
+/* a task which waits for a thread outside the pool using the pool, this
+   must not block while the pool is driven */
+static void thread_pool_test_outside_task(GT_UNUSED unsigned int workerid,
+                                          void *data)
+{
+  GtThreadPoolTestOutside *outside = (GtThreadPoolTestOutside*) data;
+  GtThread *thread = gt_thread_new(thread_pool_test_outside_main, outside,
+                                   outside->err);
+
+  if (thread == NULL) {
+    outside->had_err = -1;
+  } else {
+    gt_thread_join(thread);
+    gt_thread_delete(thread);
+  }
+}
+#endif
+
+int gt_thread_pool_unit_test(GtError *err)
+{
+  GtThreadPool *pool;
+  GtThreadPoolTestInfo info;
+  GtThreadPoolTestFib fib;
+  GtThreadPoolGroup *group;
+  GtUword idx, sum = 0;
+  int had_err = 0;
+
+  gt_error_check(err);
+  if (!(pool = gt_thread_pool_new(4U, err))) {
+    return -1;
+  }
+  info.visited = gt_calloc((size_t) GT_THREAD_POOL_TEST_SIZE,
+                           sizeof *info.visited);
+  info.sums = gt_calloc((size_t) gt_thread_pool_size(pool), sizeof *info.sums);
+  gt_thread_pool_parallel_for(pool, 0, GT_THREAD_POOL_TEST_SIZE, 0,
+                              thread_pool_test_range, &info);
+  for (idx = 0; !had_err && idx < GT_THREAD_POOL_TEST_SIZE; idx++) {
+    gt_ensure(info.visited[idx] == 1);
+  }
+  for (idx = 0; idx < (GtUword) gt_thread_pool_size(pool); idx++) {
+    sum += info.sums[idx];
+  }
+  gt_ensure(sum == GT_THREAD_POOL_TEST_SIZE * (GT_THREAD_POOL_TEST_SIZE - 1)
+                   / 2);
+  gt_free(info.visited);
+  gt_free(info.sums);
+
+  if (!had_err) {
+    group = gt_thread_pool_group_new(pool);
+    fib.group = group;
+    fib.value = 20UL;
+    gt_thread_pool_group_submit(group, thread_pool_test_fib, &fib);
+    gt_thread_pool_group_delete(group);
+    gt_ensure(fib.result == 6765UL);
+  }
+#ifdef GT_THREADS_ENABLED
+  if (!had_err) {
+    GtThreadPoolTestOutside outside;
+    outside.pool = pool;
+    outside.err = err;
+    outside.had_err = 0;
+    outside.info.visited = gt_calloc((size_t) GT_THREAD_POOL_TEST_SIZE,
+                                     sizeof *outside.info.visited);
+    outside.info.sums = gt_calloc((size_t) gt_thread_pool_size(pool),
+                                  sizeof *outside.info.sums);
+    gt_thread_pool_run(pool, 1UL, thread_pool_test_outside_task, &outside);
+    had_err = outside.had_err;
+    for (idx = 0; !had_err && idx < GT_THREAD_POOL_TEST_SIZE; idx++) {
+      gt_ensure(outside.info.visited[idx] == 1);
+    }
+    gt_free(outside.info.visited);
+    gt_free(outside.info.sums);
+  }
+#endif
+  gt_thread_pool_delete(pool);
+  return had_err;
+}
@@ -0,0 +1,110 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "core/error_api.h"
+#include "core/thread_api.h"
+#include "core/types_api.h"
+
+/* The <GtThreadPool> class implements a set of persistent worker threads
+   which execute tasks. Every worker owns a double-ended task queue: it pushes
+   and pops tasks at the bottom of its own queue and steals from the top of
+   the queues of other workers when it runs out of work. The thread which
+   drives the pool (i.e. which creates a <GtThreadPoolGroup> from outside the
+   pool) takes part in the computation as worker 0 while it waits. Only one
+   outside thread can drive a pool at a time. Groups created by other outside
+   threads while the pool is driven do not wait for the pool, their tasks are
+   executed directly by the creating thread with worker id 0. The same holds
+   for all tasks if threading is disabled. */
+typedef struct GtThreadPool GtThreadPool;
+
+/* A <GtThreadPoolGroup> collects tasks submitted to a <GtThreadPool> such that
+   one can wait for their completion (fork-join). Tasks can submit further
+   tasks to the group they belong to. */
+typedef struct GtThreadPoolGroup GtThreadPoolGroup;
+
+/* A task executed by worker <workerid> (in the range 0 to
+   <gt_thread_pool_size()> - 1) of a pool. Each worker is a single thread, so
+   two threads never execute tasks of the same group with the same <workerid>
+   at the same time.
+   But a task which waits for a group (see <gt_thread_pool_group_wait()>)
+   executes other tasks nested on the same worker while waiting. Hence
+   <workerid> can only be used to index per-thread resources which are not
+   in use during such a wait. */
+typedef void (*GtThreadPoolTaskFunc)(unsigned int workerid, void *data);
+
+/* A task processing the index range from <start> to <end> - 1. */
+typedef void (*GtThreadPoolRangeFunc)(GtUword start, GtUword end,
+                                      unsigned int workerid, void *data);
+
+/* Initialize the process-wide thread pool (called by <gt_lib_init()>). */
+void               gt_thread_pool_init(void);
+/* Shut down the process-wide thread pool (called by <gt_lib_clean()>). */
+void               gt_thread_pool_clean(void);
+
+/* Return the process-wide thread pool with <gt_jobs> workers. The pool is
+   started on first use. If <gt_jobs> changes, a further pool is started and
+   the previous one is kept, so pools returned earlier stay valid until
+   <gt_thread_pool_clean()>. Returns NULL and sets <err> if the worker threads
+   could not be created. */
+GtThreadPool*      gt_thread_pool_get(GtError *err);
+
+/* Return a new <GtThreadPool> with <numofworkers> workers (including the
+   driving thread, i.e. <numofworkers> - 1 threads are created). Returns NULL
+   and sets <err> if a thread could not be created. */
+GtThreadPool*      gt_thread_pool_new(unsigned int numofworkers, GtError *err);
+/* Return the number of workers of <pool>. */
+unsigned int       gt_thread_pool_size(const GtThreadPool *pool);
+/* Stop and join all threads of <pool> and free it. The <pool> must be idle. */
+void               gt_thread_pool_delete(GtThreadPool *pool);
+
+/* Return a new group of tasks for <pool>. */
+GtThreadPoolGroup* gt_thread_pool_group_new(GtThreadPool *pool);
+/* Schedule <func> with <data> as a task of <group>. */
+void               gt_thread_pool_group_submit(GtThreadPoolGroup *group,
+                                               GtThreadPoolTaskFunc func,
+                                               void *data);
+/* Wait until all tasks of <group> have been completed. The calling thread
+   executes pending tasks while waiting. */
+void               gt_thread_pool_group_wait(GtThreadPoolGroup *group);
+/* Wait for <group> and delete it. */
+void               gt_thread_pool_group_delete(GtThreadPoolGroup *group);
+
+/* Execute <func> <numoftasks> many times on <pool> (each call receiving
+   <data>) and wait for the completion of all calls. */
+void               gt_thread_pool_run(GtThreadPool *pool,
+                                      GtUword numoftasks,
+                                      GtThreadPoolTaskFunc func,
+                                      void *data);
+
+/* Process the index range from <start> to <end> - 1 in parallel on <pool> by
+   calling <func> for disjoint subranges covering it. Ranges are split in
+   halves on demand until they contain at most <grainsize> indices, so that
+   idle workers can steal the unprocessed upper halves of skewed ranges. If
+   <grainsize> is 0, a suitable value depending on the size of <pool> is
+   used. Returns after all subranges have been processed. */
+void               gt_thread_pool_parallel_for(GtThreadPool *pool,
+                                               GtUword start,
+                                               GtUword end,
+                                               GtUword grainsize,
+                                               GtThreadPoolRangeFunc func,
+                                               void *data);
+
+int                gt_thread_pool_unit_test(GtError *err);
+
+#endif
@@ -18,18 +18,48 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include "core/assert_api.h"
+#include "core/thread.h"
 #include "core/unused_api.h"
-#include "core/warning_api.h"
+#include "core/warning.h"
 
 static GtWarningHandler warning_handler = gt_warning_default_handler;
 static void *warning_data = NULL;
+/* the <GtStrArray> collecting the warnings of a thread, if any */
+static GtThreadKey *collect_key = NULL;
+
+void gt_warning_init(void)
+{
+  if (!collect_key)
+    collect_key = gt_thread_key_new();
+}
+
+void gt_warning_clean(void)
+{
+  gt_thread_key_delete(collect_key);
+  collect_key = NULL;
+}
+
+void gt_warning_collect(GtStrArray *messages)
+{
+  gt_assert(collect_key);
+  gt_thread_key_set(collect_key, messages);
+}
 
 void gt_warning(const char *format, ...)
 {
   va_list ap;
+  GtStrArray *messages;
   if (warning_handler) {
     va_start(ap, format);
-    warning_handler(warning_data, format, ap);
+    messages = collect_key ? gt_thread_key_get(collect_key) : NULL;
+    if (messages) {
+      char message[BUFSIZ];
+      (void) vsnprintf(message, sizeof (message), format, ap);
+      gt_str_array_add_cstr(messages, message);
+    }
+    else
+      warning_handler(warning_data, format, ap);
     va_end(ap);
   }
 }
@@ -0,0 +1,37 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef WARNING_H
+#define WARNING_H
+
+#include "core/str_array_api.h"
+#include "core/warning_api.h"
+
+/* Initialize the warning module (called by <gt_lib_init()>). */
+void gt_warning_init(void);
+/* Clean up the warning module (called by <gt_lib_clean()>). */
+void gt_warning_clean(void);
+
+/* Let subsequent <gt_warning()> calls of the calling thread append their
+   formatted messages to <messages> instead of passing them to the handler,
+   or pass them to the handler again if <messages> is NULL. This allows to
+   issue the warnings of concurrently executed tasks in a deterministic order
+   afterwards, e.g. with <gt_warning("%s", message)>. Warnings are only
+   collected if a handler is set. */
+void gt_warning_collect(GtStrArray *messages);
+
+#endif
@@ -50,6 +50,9 @@
 #include "extended/rdb_sqlite_api.h"
 #include "extended/rdb_visitor_rep.h"
 
+/* number of features inserted per transaction during a bulk load */
+#define GT_GFFLIKE_BULK_BATCH_SIZE  65536
+
 struct GtAnnoDBGFFlike {
   const GtAnnoDBSchema parent_instance;
   GtRDB *db;
@@ -61,6 +64,11 @@ typedef struct {
   GtAnnoDBGFFlike *annodb;
 } GFFlikeSetupVisitor;
 
+typedef struct {
+  const GtRDBVisitor parent_instance;
+  bool create;
+} GFFlikeIndexVisitor;
+
 typedef struct {
   const GtFeatureIndex parent_instance;
   GtHashmap *node_to_parent_array,
@@ -78,10 +86,15 @@ typedef struct {
   GtRDB *db;
   GtMutex *dblock;
   bool transaction_lock;
+  GtRDBStmt *bulk_begin,
+            *bulk_commit;
+  GtUword bulk_uncommitted;
+  bool bulk_load;
 } GtFeatureIndexGFFlike;
 
 const GtAnnoDBSchemaClass* gt_anno_db_gfflike_class(void);
 static const GtRDBVisitorClass* gfflike_setup_visitor_class(void);
+static const GtRDBVisitorClass* gfflike_index_visitor_class(void);
 static const GtFeatureIndexClass* feature_index_gfflike_class(void);
 
 #define anno_db_gfflike_cast(V)\
@@ -90,6 +103,9 @@ static const GtFeatureIndexClass* feature_index_gfflike_class(void);
 #define gfflike_setup_visitor_cast(V)\
         gt_rdb_visitor_cast(gfflike_setup_visitor_class(), V)
 
+#define gfflike_index_visitor_cast(V)\
+        gt_rdb_visitor_cast(gfflike_index_visitor_class(), V)
+
 #define feature_index_gfflike_cast(V)\
         gt_feature_index_cast(feature_index_gfflike_class(), V)
 
@@ -299,6 +315,44 @@ static int anno_db_gfflike_create_indexes_sqlite(GtRDBSqlite *db, GtError *err)
   return 0;
 }
 
+/* Indexes on the large tables which are dropped during a bulk load and
+   rebuilt afterwards. The name indexes on the small tables are kept, as they
+   are needed for the lookups done while inserting. */
+static const char *gfflike_deferred_indexes[][2] = {
+  { "feature_all",     "features"   },
+  { "feature_seqid",   "features"   },
+  { "attribs_value",   "attributes" },
+  { "attribs_key",     "attributes" },
+  { "attribs_feature", "attributes" },
+  { "parent_id",       "parents"    }
+};
+
+#define GT_GFFLIKE_NOF_DEFERRED_INDEXES \
+        (sizeof (gfflike_deferred_indexes) \
+         / sizeof (gfflike_deferred_indexes[0]))
+
+static int anno_db_gfflike_drop_indexes_sqlite(GtRDBSqlite *db, GtError *err)
+{
+  int had_err = 0;
+  GtUword i;
+  GtStr *query;
+  GtRDBStmt *stmt;
+  gt_assert(db);
+
+  query = gt_str_new();
+  for (i = 0; !had_err && i < GT_GFFLIKE_NOF_DEFERRED_INDEXES; i++) {
+    gt_str_reset(query);
+    gt_str_append_cstr(query, "DROP INDEX IF EXISTS ");
+    gt_str_append_cstr(query, gfflike_deferred_indexes[i][0]);
+    stmt = gt_rdb_prepare((GtRDB*) db, gt_str_get(query), 0, err);
+    if (!stmt || gt_rdb_stmt_exec(stmt, err) < 0)
+      had_err = -1;
+    gt_rdb_stmt_delete(stmt);
+  }
+  gt_str_delete(query);
+  return had_err;
+}
+
 static int anno_db_gfflike_validate_mysql(GtRDBMySQL *db, GtError *err,
                                           bool *check)
 {
@@ -546,6 +600,37 @@ static int anno_db_gfflike_create_indexes_mysql(GtRDBMySQL *db, GtError *err)
   return 0;
 }
 
+static int anno_db_gfflike_drop_indexes_mysql(GtRDBMySQL *db, GtError *err)
+{
+  int had_err = 0;
+  GtUword i;
+  GtCstrTable *cst;
+  GtStr *query;
+  GtRDBStmt *stmt;
+  gt_assert(db);
+
+  if (!(cst = gt_rdb_get_indexes((GtRDB*) db, err))) {
+    return -1;
+  }
+  query = gt_str_new();
+  for (i = 0; !had_err && i < GT_GFFLIKE_NOF_DEFERRED_INDEXES; i++) {
+    if (!gt_cstr_table_get(cst, gfflike_deferred_indexes[i][0]))
+      continue;
+    gt_str_reset(query);
+    gt_str_append_cstr(query, "DROP INDEX ");
+    gt_str_append_cstr(query, gfflike_deferred_indexes[i][0]);
+    gt_str_append_cstr(query, " ON ");
+    gt_str_append_cstr(query, gfflike_deferred_indexes[i][1]);
+    stmt = gt_rdb_prepare((GtRDB*) db, gt_str_get(query), 0, err);
+    if (!stmt || gt_rdb_stmt_exec(stmt, err) < 0)
+      had_err = -1;
+    gt_rdb_stmt_delete(stmt);
+  }
+  gt_str_delete(query);
+  gt_cstr_table_delete(cst);
+  return had_err;
+}
+
 int anno_db_gfflike_init_sqlite(GT_UNUSED GtRDBVisitor *rdbv, GtRDBSqlite *db,
                                 GtError *err)
 {
@@ -623,6 +708,24 @@ int anno_db_gfflike_init_mysql(GT_UNUSED GtRDBVisitor *rdbv, GtRDBMySQL *db,
   return had_err;
 }
 
+static int anno_db_gfflike_indexes_sqlite(GtRDBVisitor *rdbv, GtRDBSqlite *db,
+                                          GtError *err)
+{
+  GFFlikeIndexVisitor *iv = gfflike_index_visitor_cast(rdbv);
+  if (iv->create)
+    return anno_db_gfflike_create_indexes_sqlite(db, err);
+  return anno_db_gfflike_drop_indexes_sqlite(db, err);
+}
+
+static int anno_db_gfflike_indexes_mysql(GtRDBVisitor *rdbv, GtRDBMySQL *db,
+                                         GtError *err)
+{
+  GFFlikeIndexVisitor *iv = gfflike_index_visitor_cast(rdbv);
+  if (iv->create)
+    return anno_db_gfflike_create_indexes_mysql(db, err);
+  return anno_db_gfflike_drop_indexes_mysql(db, err);
+}
+
 void anno_db_gfflike_free(GtAnnoDBSchema *s)
 {
   GtAnnoDBGFFlike *adg = anno_db_gfflike_cast(s);
@@ -653,6 +756,7 @@ int gt_feature_index_gfflike_add_region_node(GtFeatureIndex *gfi,
   gt_assert(fi && rn);
   seqid = gt_str_get(gt_genome_node_get_seqid((GtGenomeNode*) rn));
   rng = gt_genome_node_get_range((GtGenomeNode*) rn);
+  gt_mutex_lock(fi->dblock);
   gt_rdb_stmt_reset(fi->stmts[GT_PSTMT_SEQUENCEREGION_INSERT], err);
   gt_rdb_stmt_bind_string(fi->stmts[GT_PSTMT_SEQUENCEREGION_INSERT],
                           0, seqid, err);
@@ -662,6 +766,7 @@ int gt_feature_index_gfflike_add_region_node(GtFeatureIndex *gfi,
                        2, (int) rng.end, err);
   had_err = (gt_rdb_stmt_exec(fi->stmts[GT_PSTMT_SEQUENCEREGION_INSERT], err)
                               >= 0 ? 0 : -1);
+  gt_mutex_unlock(fi->dblock);
   return had_err;
 }
 
@@ -791,8 +896,6 @@ static int insert_single_node(GtFeatureIndexGFFlike *fi,
     return had_err;
   }
 
-  gt_mutex_lock(fi->dblock);
-
   /* insert details */
   if (!gt_feature_node_is_pseudo(fn)) {
     /* pseudo-features do not have a type */
@@ -861,6 +964,7 @@ static int insert_single_node(GtFeatureIndexGFFlike *fi,
                        gt_feature_node_is_marked(fn), err);
   rval = gt_rdb_stmt_exec(fi->stmts[GT_PSTMT_FEATURE_INSERT], err);
   if (rval < 0) gt_error_check(err);
+  fi->bulk_uncommitted++;
 
   *id = gt_rdb_last_inserted_id(fi->db, "features", err);
   /* cache DB keys to avoid redundant saving of nodes with
@@ -884,7 +988,26 @@ static int insert_single_node(GtFeatureIndexGFFlike *fi,
       had_err = -1;
   }
   gt_str_array_delete(attribs);
-  gt_mutex_unlock(fi->dblock);
+  return had_err;
+}
+
+static int gfflike_bulk_commit_if_full(GtFeatureIndexGFFlike *fi,
+                                       GtError *err)
+{
+  int had_err = 0;
+  if (fi->bulk_load && fi->bulk_uncommitted >= GT_GFFLIKE_BULK_BATCH_SIZE) {
+    gt_rdb_stmt_reset(fi->bulk_commit, err);
+    if (gt_rdb_stmt_exec(fi->bulk_commit, err) < 0)
+      had_err = -1;
+    if (!had_err) {
+      gt_rdb_stmt_reset(fi->bulk_begin, err);
+      if (gt_rdb_stmt_exec(fi->bulk_begin, err) < 0)
+        had_err = -1;
+    }
+    if (had_err)
+      fi->bulk_load = false;
+    fi->bulk_uncommitted = 0;
+  }
   return had_err;
 }
 
@@ -897,8 +1020,8 @@ static int insert_feature_node(GtFeatureIndexGFFlike *fi,
   int had_err = 0;
   GtUword num;
 
-  /* TODO: locking! subgraph insertion is a transaction
-      we also need to avoid nesting */
+  /* the caller holds the database lock for the whole subgraph, the
+     statements and caches used here are shared */
 
   /* collect relationships */
   gt_hashmap_reset(fi->node_to_parent_array);
@@ -922,7 +1045,9 @@ static int insert_feature_node(GtFeatureIndexGFFlike *fi,
   if (!had_err)
     gt_hashmap_foreach(fi->node_to_parent_array, set_parents, fi, err);
 
-  /* TODO: locking! commit this subgraph to DB */
+  /* in a bulk load, commit only at subgraph boundaries */
+  if (!had_err)
+    had_err = gfflike_bulk_commit_if_full(fi, err);
 
   gt_feature_node_iterator_delete(fni);
   gt_hashmap_reset(fi->node_to_parent_array);
@@ -1013,6 +1138,21 @@ static void node_strand_changed_callback(GtFeatureNode *changed,
   }
 }
 
+/* expects the database lock to be held */
+static int gfflike_add_feature_node_locked(GtFeatureIndexGFFlike *fi,
+                                           GtFeatureNode *gf,
+                                           GtError *err)
+{
+  int had_err = 0;
+  had_err = insert_feature_node(fi,
+                                (GtFeatureNode*)
+                                         gt_genome_node_ref((GtGenomeNode*) gf),
+                                err);
+  if (!had_err)
+    gt_hashmap_add(fi->ref_nodes, gf, (void*) 1);
+  return had_err;
+}
+
 int gt_feature_index_gfflike_add_feature_node(GtFeatureIndex *gfi,
                                               GtFeatureNode *gf,
                                               GtError *err)
@@ -1022,12 +1162,9 @@ int gt_feature_index_gfflike_add_feature_node(GtFeatureIndex *gfi,
   gt_assert(gfi && gf);
 
   fi = feature_index_gfflike_cast(gfi);
-  had_err = insert_feature_node(fi,
-                                (GtFeatureNode*)
-                                         gt_genome_node_ref((GtGenomeNode*) gf),
-                                err);
-  if (!had_err)
-    gt_hashmap_add(fi->ref_nodes, gf, (void*) 1);
+  gt_mutex_lock(fi->dblock);
+  had_err = gfflike_add_feature_node_locked(fi, gf, err);
+  gt_mutex_unlock(fi->dblock);
   return had_err;
 }
 
@@ -1142,8 +1279,8 @@ static int gt_feature_index_gfflike_save_add(void *key, GT_UNUSED void *val,
   ObserverCallbackInfo *oci = (ObserverCallbackInfo*) data;
   int had_err = 0;
 
-  had_err = gt_feature_index_add_feature_node((GtFeatureIndex*) oci->fis, fn,
-                                              err);
+  /* called from gt_feature_index_gfflike_save(), which holds the lock */
+  had_err = gfflike_add_feature_node_locked(oci->fis, fn, err);
 
   return had_err;
 }
@@ -1242,54 +1379,62 @@ static int gt_feature_index_gfflike_save_chg(void *key, GT_UNUSED void *val,
   return (had_err >= 0) ? 0  : -1;
 }
 
+/* executes <stmt> unless it is NULL */
+static void gfflike_save_exec(GtRDBStmt *stmt, GtError *err)
+{
+  if (stmt) {
+    gt_rdb_stmt_reset(stmt, err);
+    gt_rdb_stmt_exec(stmt, err);
+  }
+}
+
 static int gt_feature_index_gfflike_save(GtFeatureIndex *fi,
                                          GT_UNUSED GtError *err)
 {
   GtFeatureIndexGFFlike *fig;
   ObserverCallbackInfo *oci;
   int had_err = 0;
-  GtRDBStmt *stmt_b, *stmt_e;
+  GtRDBStmt *stmt_b = NULL, *stmt_e = NULL;
   gt_assert(fi);
   fig = feature_index_gfflike_cast(fi);
   oci = (ObserverCallbackInfo*) fig->obs->data;
 
   gt_mutex_lock(fig->dblock);
-  stmt_b = gt_rdb_prepare(fig->db, "BEGIN TRANSACTION;", 0, err);
-  stmt_e = gt_rdb_prepare(fig->db, "END TRANSACTION;", 0, err);
-  gt_rdb_stmt_exec(stmt_b, err);
+  /* during a bulk load the changes become part of its open transaction */
+  if (!fig->bulk_load) {
+    stmt_b = gt_rdb_prepare(fig->db, "BEGIN TRANSACTION;", 0, err);
+    stmt_e = gt_rdb_prepare(fig->db, "END TRANSACTION;", 0, err);
+  }
+  gfflike_save_exec(stmt_b, err);
   if (oci && fig->deleted) {
     had_err = gt_hashmap_foreach(fig->deleted,
                                  gt_feature_index_gfflike_save_del,
                                  oci, err);
   }
   gt_hashmap_reset(fig->deleted);
-  gt_rdb_stmt_exec(stmt_e, err);
+  gfflike_save_exec(stmt_e, err);
 
-  gt_rdb_stmt_reset(stmt_b, err);
-  gt_rdb_stmt_exec(stmt_b, err);
+  gfflike_save_exec(stmt_b, err);
   if (oci && fig->added) {
     had_err = gt_hashmap_foreach(fig->added,
                                  gt_feature_index_gfflike_save_add,
                                  oci, err);
   }
   gt_hashmap_reset(fig->added);
-  gt_rdb_stmt_reset(stmt_e, err);
-  gt_rdb_stmt_exec(stmt_e, err);
+  gfflike_save_exec(stmt_e, err);
 
-  gt_rdb_stmt_reset(stmt_b, err);
-  gt_rdb_stmt_exec(stmt_b, err);
+  gfflike_save_exec(stmt_b, err);
   if (oci && fig->changed) {
     had_err = gt_hashmap_foreach(fig->changed,
                                  gt_feature_index_gfflike_save_chg,
                                  oci, err);
   }
   gt_hashmap_reset(fig->changed);
-  gt_rdb_stmt_reset(stmt_e, err);
-  gt_rdb_stmt_exec(stmt_e, err);
+  gfflike_save_exec(stmt_e, err);
 
   gt_rdb_stmt_delete(stmt_e);
   gt_rdb_stmt_delete(stmt_b);
-  gt_mutex_lock(fig->dblock);
+  gt_mutex_unlock(fig->dblock);
 
   return had_err;
 }
@@ -1453,9 +1598,11 @@ GtArray* gt_feature_index_gfflike_get_features_for_seqid(GtFeatureIndex *gfi,
   fi = feature_index_gfflike_cast(gfi);
   stmt = fi->stmts[GT_PSTMT_GET_BY_SEQID_SELECT];
   a = gt_array_new(sizeof (GtFeatureNode*));
+  gt_mutex_lock(fi->dblock);
   gt_rdb_stmt_reset(stmt, err);
   gt_rdb_stmt_bind_string(stmt, 0, seqid, err);
   get_nodes_for_stmt(fi, a, stmt, err);
+  gt_mutex_unlock(fi->dblock);
   return a;
 }
 
@@ -1653,6 +1800,8 @@ void gt_feature_index_gfflike_delete(GtFeatureIndex *gfi)
   for (i=0;i<GT_PSTMT_NOF_STATEMENTS;i++) {
     gt_rdb_stmt_delete(fi->stmts[i]);
   }
+  gt_rdb_stmt_delete(fi->bulk_begin);
+  gt_rdb_stmt_delete(fi->bulk_commit);
   if (fi->db)
     gt_rdb_delete(fi->db);
   gt_hashmap_delete(fi->node_to_parent_array);
@@ -1670,9 +1819,81 @@ void gt_feature_index_gfflike_delete(GtFeatureIndex *gfi)
   gt_mutex_delete(fi->dblock);
 }
 
+static GtRDBVisitor* gfflike_index_visitor_new(bool create)
+{
+  GtRDBVisitor *v = gt_rdb_visitor_create(gfflike_index_visitor_class());
+  GFFlikeIndexVisitor *iv = gfflike_index_visitor_cast(v);
+  iv->create = create;
+  return v;
+}
+
+static int gt_feature_index_gfflike_bulk_load_begin(GtFeatureIndex *gfi,
+                                                    GtError *err)
+{
+  GtFeatureIndexGFFlike *fi;
+  GtRDBVisitor *v;
+  int had_err = 0;
+  fi = feature_index_gfflike_cast(gfi);
+  gt_assert(fi && !fi->bulk_load);
+
+  gt_mutex_lock(fi->dblock);
+  /* maintaining the indexes row by row is much slower than rebuilding them */
+  v = gfflike_index_visitor_new(false);
+  had_err = gt_rdb_accept(fi->db, v, err);
+  gt_rdb_visitor_delete(v);
+  if (!had_err) {
+    fi->bulk_begin = gt_rdb_prepare(fi->db, "BEGIN", 0, err);
+    fi->bulk_commit = gt_rdb_prepare(fi->db, "COMMIT", 0, err);
+    if (!fi->bulk_begin || !fi->bulk_commit)
+      had_err = -1;
+  }
+  if (!had_err && gt_rdb_stmt_exec(fi->bulk_begin, err) < 0)
+    had_err = -1;
+  if (!had_err) {
+    fi->bulk_uncommitted = 0;
+    fi->bulk_load = true;
+  } else {
+    gt_rdb_stmt_delete(fi->bulk_begin);
+    gt_rdb_stmt_delete(fi->bulk_commit);
+    fi->bulk_begin = fi->bulk_commit = NULL;
+  }
+  gt_mutex_unlock(fi->dblock);
+  return had_err;
+}
+
+static int gt_feature_index_gfflike_bulk_load_end(GtFeatureIndex *gfi,
+                                                  GtError *err)
+{
+  GtFeatureIndexGFFlike *fi;
+  GtRDBVisitor *v;
+  int had_err = 0;
+  fi = feature_index_gfflike_cast(gfi);
+  gt_assert(fi);
+
+  gt_mutex_lock(fi->dblock);
+  if (fi->bulk_load) {
+    gt_rdb_stmt_reset(fi->bulk_commit, err);
+    if (gt_rdb_stmt_exec(fi->bulk_commit, err) < 0)
+      had_err = -1;
+    fi->bulk_load = false;
+  }
+  gt_rdb_stmt_delete(fi->bulk_begin);
+  gt_rdb_stmt_delete(fi->bulk_commit);
+  fi->bulk_begin = fi->bulk_commit = NULL;
+  /* rebuild the indexes even if the commit failed, the database must stay
+     queryable */
+  v = gfflike_index_visitor_new(true);
+  if (gt_rdb_accept(fi->db, v, had_err ? NULL : err))
+    had_err = -1;
+  gt_rdb_visitor_delete(v);
+  gt_mutex_unlock(fi->dblock);
+  return had_err;
+}
+
 const GtFeatureIndexClass* feature_index_gfflike_class(void)
 {
-  static const GtFeatureIndexClass *fic = NULL;
+  static GtFeatureIndexClass *fic = NULL;
+  gt_class_alloc_lock_enter();
   if (!fic) {
     fic = gt_feature_index_class_new(sizeof (GtFeatureIndexGFFlike),
                                 gt_feature_index_gfflike_add_region_node,
@@ -1687,7 +1908,11 @@ const GtFeatureIndexClass* feature_index_gfflike_class(void)
                                 gt_feature_index_gfflike_get_range_for_seqid,
                                 gt_feature_index_gfflike_has_seqid,
                                 gt_feature_index_gfflike_delete);
+    gt_feature_index_class_set_bulk_load_funcs(fic,
+                                      gt_feature_index_gfflike_bulk_load_begin,
+                                      gt_feature_index_gfflike_bulk_load_end);
   }
+  gt_class_alloc_lock_leave();
   return fic;
 }
 
@@ -2014,6 +2239,20 @@ static const GtRDBVisitorClass* gfflike_setup_visitor_class()
   return svc;
 }
 
+static const GtRDBVisitorClass* gfflike_index_visitor_class()
+{
+  static const GtRDBVisitorClass *ivc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!ivc) {
+    ivc = gt_rdb_visitor_class_new(sizeof (GFFlikeIndexVisitor),
+                                   NULL,
+                                   anno_db_gfflike_indexes_sqlite,
+                                   anno_db_gfflike_indexes_mysql);
+  }
+  gt_class_alloc_lock_leave();
+  return ivc;
+}
+
 static GtRDBVisitor* gfflike_setup_visitor_new(GtAnnoDBGFFlike *adb)
 {
   GtRDBVisitor *v = gt_rdb_visitor_create(gfflike_setup_visitor_class());
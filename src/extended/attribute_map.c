@@ -0,0 +1,327 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "core/ensure.h"
+#include "core/ma.h"
+#include "core/str_api.h"
+#include "core/undef_api.h"
+#include "extended/attribute_map.h"
+#include "extended/gff3_defines.h"
+
+/* values which are replaced or removed leave garbage in the value buffer,
+   which is compacted once it makes up more than half of the buffer */
+#define GT_ATTRIBUTE_MAP_MIN_GARBAGE 64
+
+/* the tags predefined by the GFF3 specification are shared by all maps */
+static const char *attribute_map_predefined_tags[] = {
+  GT_GFF_ID,
+  GT_GFF_NAME,
+  GT_GFF_ALIAS,
+  GT_GFF_PARENT,
+  GT_GFF_TARGET,
+  GT_GFF_GAP,
+  GT_GFF_DERIVES_FROM,
+  GT_GFF_NOTE,
+  GT_GFF_DBXREF,
+  GT_GFF_ONTOLOGY_TERM,
+  GT_GFF_IS_CIRCULAR,
+  GT_GFF_START_RANGE,
+  GT_GFF_END_RANGE
+};
+
+#define GT_ATTRIBUTE_MAP_NOF_PREDEFINED_TAGS \
+        (sizeof (attribute_map_predefined_tags) \
+         / sizeof (attribute_map_predefined_tags[0]))
+
+typedef struct {
+  const char *tag; /* a predefined tag or NULL */
+  GtUword tag_offset, /* offset into <values> if <tag> is NULL */
+          value;      /* offset into <values> */
+} GtAttributePair;
+
+struct GtAttributeMap {
+  GtAttributePair *pairs;
+  GtUword nof_pairs,
+          allocated_pairs;
+  char *values;
+  GtUword values_len,
+          allocated_values,
+          garbage;
+};
+
+GtAttributeMap* gt_attribute_map_new(void)
+{
+  return gt_calloc(1, sizeof (GtAttributeMap));
+}
+
+static const char* attribute_map_predefined_tag(const char *tag)
+{
+  GtUword i;
+  for (i = 0; i < GT_ATTRIBUTE_MAP_NOF_PREDEFINED_TAGS; i++) {
+    if (attribute_map_predefined_tags[i][0] == tag[0] &&
+        !strcmp(attribute_map_predefined_tags[i], tag)) {
+      return attribute_map_predefined_tags[i];
+    }
+  }
+  return NULL;
+}
+
+static const char* attribute_map_tag(const GtAttributeMap *am, GtUword idx)
+{
+  if (am->pairs[idx].tag)
+    return am->pairs[idx].tag;
+  return am->values + am->pairs[idx].tag_offset;
+}
+
+static GtUword attribute_map_find(const GtAttributeMap *am, const char *tag)
+{
+  GtUword i;
+  const char *pairtag;
+  for (i = 0; i < am->nof_pairs; i++) {
+    pairtag = attribute_map_tag(am, i);
+    if (pairtag == tag || (pairtag[0] == tag[0] && !strcmp(pairtag, tag)))
+      return i;
+  }
+  return GT_UNDEF_UWORD;
+}
+
+static GtUword attribute_map_append_value(GtAttributeMap *am,
+                                          const char *value, size_t len)
+{
+  GtUword offset = am->values_len;
+  if (am->values_len + len + 1 > am->allocated_values) {
+    am->allocated_values += am->allocated_values / 2 + len + 1;
+    am->values = gt_realloc(am->values, am->allocated_values);
+  }
+  memcpy(am->values + offset, value, len + 1);
+  am->values_len += len + 1;
+  return offset;
+}
+
+/* returns the number of bytes used by the pair at <idx> in <values> */
+static GtUword attribute_map_pair_len(const GtAttributeMap *am, GtUword idx)
+{
+  GtUword len = strlen(am->values + am->pairs[idx].value) + 1;
+  if (!am->pairs[idx].tag)
+    len += strlen(am->values + am->pairs[idx].tag_offset) + 1;
+  return len;
+}
+
+static void attribute_map_compact(GtAttributeMap *am)
+{
+  char *values;
+  GtUword i, len = 0;
+  size_t str_len;
+  if (am->garbage < GT_ATTRIBUTE_MAP_MIN_GARBAGE ||
+      am->garbage <= am->values_len / 2) {
+    return;
+  }
+  am->allocated_values = am->values_len - am->garbage;
+  values = gt_malloc(am->allocated_values);
+  for (i = 0; i < am->nof_pairs; i++) {
+    if (!am->pairs[i].tag) {
+      str_len = strlen(am->values + am->pairs[i].tag_offset) + 1;
+      memcpy(values + len, am->values + am->pairs[i].tag_offset, str_len);
+      am->pairs[i].tag_offset = len;
+      len += str_len;
+    }
+    str_len = strlen(am->values + am->pairs[i].value) + 1;
+    memcpy(values + len, am->values + am->pairs[i].value, str_len);
+    am->pairs[i].value = len;
+    len += str_len;
+  }
+  gt_assert(len == am->allocated_values);
+  gt_free(am->values);
+  am->values = values;
+  am->values_len = len;
+  am->garbage = 0;
+}
+
+void gt_attribute_map_add(GtAttributeMap *am, const char *tag,
+                          const char *value)
+{
+  GtAttributePair *pair;
+  size_t value_len;
+  gt_assert(am && tag && value && strlen(tag));
+  gt_assert(attribute_map_find(am, tag) == GT_UNDEF_UWORD);
+  value_len = strlen(value);
+  gt_assert(value_len);
+  if (am->nof_pairs == am->allocated_pairs) {
+    am->allocated_pairs = am->allocated_pairs ? 2 * am->allocated_pairs : 4;
+    am->pairs = gt_realloc(am->pairs,
+                           am->allocated_pairs * sizeof *am->pairs);
+  }
+  pair = am->pairs + am->nof_pairs;
+  /* other tags are copied into the value buffer, so that adding an attribute
+     does not need the global (and locked) symbol table */
+  if ((pair->tag = attribute_map_predefined_tag(tag)))
+    pair->tag_offset = GT_UNDEF_UWORD;
+  else
+    pair->tag_offset = attribute_map_append_value(am, tag, strlen(tag));
+  pair->value = attribute_map_append_value(am, value, value_len);
+  am->nof_pairs++;
+}
+
+void gt_attribute_map_set(GtAttributeMap *am, const char *tag,
+                          const char *value)
+{
+  size_t old_len, new_len;
+  GtUword idx;
+  char *old_value;
+  gt_assert(am && tag && value && strlen(tag));
+  if ((idx = attribute_map_find(am, tag)) == GT_UNDEF_UWORD) {
+    gt_attribute_map_add(am, tag, value);
+    return;
+  }
+  new_len = strlen(value);
+  gt_assert(new_len);
+  old_value = am->values + am->pairs[idx].value;
+  old_len = strlen(old_value);
+  if (new_len <= old_len) {
+    /* overwrite in place */
+    memcpy(old_value, value, new_len + 1);
+    am->garbage += old_len - new_len;
+  }
+  else {
+    am->pairs[idx].value = attribute_map_append_value(am, value, new_len);
+    am->garbage += old_len + 1;
+  }
+  attribute_map_compact(am);
+}
+
+const char* gt_attribute_map_get(const GtAttributeMap *am, const char *tag)
+{
+  GtUword idx;
+  gt_assert(am && tag);
+  if ((idx = attribute_map_find(am, tag)) == GT_UNDEF_UWORD)
+    return NULL;
+  return am->values + am->pairs[idx].value;
+}
+
+void gt_attribute_map_remove(GtAttributeMap *am, const char *tag)
+{
+  GtUword idx;
+  gt_assert(am && tag);
+  idx = attribute_map_find(am, tag);
+  gt_assert(idx != GT_UNDEF_UWORD);
+  am->garbage += attribute_map_pair_len(am, idx);
+  memmove(am->pairs + idx, am->pairs + idx + 1,
+          (am->nof_pairs - idx - 1) * sizeof *am->pairs);
+  am->nof_pairs--;
+  if (!am->nof_pairs) {
+    am->values_len = 0;
+    am->garbage = 0;
+  }
+  else
+    attribute_map_compact(am);
+}
+
+GtUword gt_attribute_map_size(const GtAttributeMap *am)
+{
+  gt_assert(am);
+  return am->nof_pairs;
+}
+
+void gt_attribute_map_foreach(const GtAttributeMap *am,
+                              GtAttributeMapIteratorFunc func, void *data)
+{
+  GtUword i;
+  gt_assert(am && func);
+  for (i = 0; i < am->nof_pairs; i++)
+    func(attribute_map_tag(am, i), am->values + am->pairs[i].value, data);
+}
+
+void gt_attribute_map_delete(GtAttributeMap *am)
+{
+  if (!am) return;
+  gt_free(am->pairs);
+  gt_free(am->values);
+  gt_free(am);
+}
+
+static void attribute_map_concat(const char *tag, const char *value,
+                                 void *data)
+{
+  GtStr *str = data;
+  gt_str_append_cstr(str, tag);
+  gt_str_append_char(str, '=');
+  gt_str_append_cstr(str, value);
+  gt_str_append_char(str, ';');
+}
+
+int gt_attribute_map_unit_test(GtError *err)
+{
+  GtAttributeMap *am;
+  GtStr *str;
+  char tag[16], value[128];
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+
+  am = gt_attribute_map_new();
+  str = gt_str_new();
+  gt_ensure(gt_attribute_map_size(am) == 0);
+  gt_ensure(!gt_attribute_map_get(am, "ID"));
+  gt_attribute_map_add(am, "ID", "gene1");
+  gt_attribute_map_add(am, "Name", "foo");
+  gt_attribute_map_set(am, "Note", "bar");
+  gt_ensure(gt_attribute_map_size(am) == 3);
+  gt_ensure(!strcmp(gt_attribute_map_get(am, "ID"), "gene1"));
+  gt_ensure(!strcmp(gt_attribute_map_get(am, GT_GFF_NAME), "foo"));
+  gt_ensure(!strcmp(gt_attribute_map_get(am, "Note"), "bar"));
+  gt_ensure(!gt_attribute_map_get(am, "gene1"));
+  gt_ensure(!gt_attribute_map_get(am, "I"));
+
+  /* values are replaced in place, the order is kept */
+  gt_attribute_map_set(am, "ID", "g1");
+  gt_attribute_map_set(am, "Name", "a much longer name");
+  gt_attribute_map_foreach(am, attribute_map_concat, str);
+  gt_ensure(!strcmp(gt_str_get(str),
+                    "ID=g1;Name=a much longer name;Note=bar;"));
+
+  gt_attribute_map_remove(am, "Name");
+  gt_str_reset(str);
+  gt_attribute_map_foreach(am, attribute_map_concat, str);
+  gt_ensure(!strcmp(gt_str_get(str), "ID=g1;Note=bar;"));
+  gt_attribute_map_remove(am, "ID");
+  gt_attribute_map_remove(am, "Note");
+  gt_ensure(gt_attribute_map_size(am) == 0);
+
+  /* trigger growth and compaction */
+  for (i = 0; !had_err && i < 100; i++) {
+    (void) snprintf(tag, sizeof tag, "tag%lu", (unsigned long) (i % 10));
+    (void) snprintf(value, sizeof value, "%0*lu", (int) (i % 50) + 1,
+                    (unsigned long) i);
+    gt_attribute_map_set(am, tag, value);
+    gt_ensure(!strcmp(gt_attribute_map_get(am, tag), value));
+  }
+  gt_ensure(gt_attribute_map_size(am) == 10);
+  /* the tags are not predefined and stored with the values */
+  gt_ensure(am->values_len - am->garbage <= 10 * (51 + 5));
+  for (i = 90; !had_err && i < 100; i++) {
+    (void) snprintf(tag, sizeof tag, "tag%lu", (unsigned long) (i % 10));
+    (void) snprintf(value, sizeof value, "%0*lu", (int) (i % 50) + 1,
+                    (unsigned long) i);
+    gt_ensure(!strcmp(gt_attribute_map_get(am, tag), value));
+  }
+
+  gt_str_delete(str);
+  gt_attribute_map_delete(am);
+  return had_err;
+}
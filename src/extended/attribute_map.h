@@ -0,0 +1,58 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef ATTRIBUTE_MAP_H
+#define ATTRIBUTE_MAP_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* A <GtAttributeMap> stores the attributes of a feature node as a small vector
+   of tag/value pairs in insertion order. The tags predefined by GFF3 (like
+   ID or Parent) are shared by all maps, other tags are stored with the values
+   in a single buffer which is compacted lazily, hence changing a value does
+   not reallocate the whole map. Adding a pair takes no lock.
+   Tags and values cannot have length 0. */
+typedef struct GtAttributeMap GtAttributeMap;
+
+typedef void (*GtAttributeMapIteratorFunc)(const char *tag, const char *value,
+                                           void *data);
+
+GtAttributeMap* gt_attribute_map_new(void);
+/* Add <tag>/<value> pair to <attribute_map>, which must not contain <tag>. */
+void            gt_attribute_map_add(GtAttributeMap *attribute_map,
+                                     const char *tag, const char *value);
+/* Set <tag> to <value>, adding it at the end if <tag> is not contained yet. */
+void            gt_attribute_map_set(GtAttributeMap *attribute_map,
+                                     const char *tag, const char *value);
+/* Return the value of <tag> or <NULL>. The value is valid until
+   <attribute_map> is modified. */
+const char*     gt_attribute_map_get(const GtAttributeMap *attribute_map,
+                                     const char *tag);
+/* Remove <tag>, which must be contained in <attribute_map>. */
+void            gt_attribute_map_remove(GtAttributeMap *attribute_map,
+                                        const char *tag);
+GtUword         gt_attribute_map_size(const GtAttributeMap *attribute_map);
+/* Apply <func> to all tag/value pairs of <attribute_map> in insertion
+   order. Tags and values are valid until <attribute_map> is modified. */
+void            gt_attribute_map_foreach(const GtAttributeMap *attribute_map,
+                                         GtAttributeMapIteratorFunc func,
+                                         void *data);
+void            gt_attribute_map_delete(GtAttributeMap *attribute_map);
+int             gt_attribute_map_unit_test(GtError *err);
+
+#endif
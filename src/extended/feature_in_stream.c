@@ -78,7 +78,7 @@ void feature_in_stream_init(GtFeatureInStream *stream)
 
     seqid = gt_str_array_get(seqids, i);
     features = gt_feature_index_get_features_for_seqid(stream->fi, seqid,error);
-    if (gt_array_size(features) > 0)
+    if (features != NULL && gt_array_size(features) > 0)
     {
       gt_array_sort(features, (GtCompare)gt_genome_node_compare);
       gt_array_reverse(features);
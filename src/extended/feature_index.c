@@ -15,12 +15,14 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <stdio.h>
 #include <string.h>
 #include "core/assert_api.h"
 #include "core/class_alloc.h"
 #include "core/array.h"
 #include "core/ensure.h"
 #include "core/ma.h"
+#include "core/msort_api.h"
 #include "core/multithread_api.h"
 #include "core/unused_api.h"
 #include "core/yarandom.h"
@@ -46,6 +48,8 @@ struct GtFeatureIndexClass {
   GtFeatureIndexGetRangeForSeqidFunc get_range_for_seqid;
   GtFeatureIndexGetOrigRangeForSeqidFunc get_orig_range_for_seqid;
   GtFeatureIndexHasSeqidFunc has_seqid;
+  GtFeatureIndexBulkLoadFunc bulk_load_begin,
+                             bulk_load_end;
   GtFeatureIndexFreeFunc free;
 };
 
@@ -54,7 +58,7 @@ struct GtFeatureIndexMembers {
   GtRWLock *lock;
 };
 
-const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
+GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
                                          GtFeatureIndexAddRegionNodeFunc
                                                  add_region_node,
                                          GtFeatureIndexAddFeatureNodeFunc
@@ -97,6 +101,17 @@ const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
   return c_class;
 }
 
+void gt_feature_index_class_set_bulk_load_funcs(GtFeatureIndexClass *fic,
+                                                GtFeatureIndexBulkLoadFunc
+                                                        bulk_load_begin,
+                                                GtFeatureIndexBulkLoadFunc
+                                                        bulk_load_end)
+{
+  gt_assert(fic);
+  fic->bulk_load_begin = bulk_load_begin;
+  fic->bulk_load_end = bulk_load_end;
+}
+
 GtFeatureIndex* gt_feature_index_create(const GtFeatureIndexClass *fic)
 {
   GtFeatureIndex *fi;
@@ -172,6 +187,32 @@ int  gt_feature_index_remove_node(GtFeatureIndex *feature_index,
   return ret;
 }
 
+int gt_feature_index_bulk_load_begin(GtFeatureIndex *feature_index,
+                                     GtError *err)
+{
+  int ret = 0;
+  gt_assert(feature_index && feature_index->c_class);
+  if (feature_index->c_class->bulk_load_begin) {
+    gt_rwlock_wrlock(feature_index->pvt->lock);
+    ret = feature_index->c_class->bulk_load_begin(feature_index, err);
+    gt_rwlock_unlock(feature_index->pvt->lock);
+  }
+  return ret;
+}
+
+int gt_feature_index_bulk_load_end(GtFeatureIndex *feature_index,
+                                   GtError *err)
+{
+  int ret = 0;
+  gt_assert(feature_index && feature_index->c_class);
+  if (feature_index->c_class->bulk_load_end) {
+    gt_rwlock_wrlock(feature_index->pvt->lock);
+    ret = feature_index->c_class->bulk_load_end(feature_index, err);
+    gt_rwlock_unlock(feature_index->pvt->lock);
+  }
+  return ret;
+}
+
 int gt_feature_index_add_gff3file(GtFeatureIndex *feature_index,
                                   const char *gff3file, GtError *err)
 {
@@ -184,17 +225,27 @@ int gt_feature_index_add_gff3file(GtFeatureIndex *feature_index,
   gt_assert(feature_index && gff3file);
   tmp = gt_array_new(sizeof (GtGenomeNode*));
   gff3_in_stream = gt_gff3_in_stream_new_unsorted(1, &gff3file);
+  if (gt_jobs > 1U) {
+    gt_gff3_in_stream_enable_parallel_parsing((GtGFF3InStream*)
+                                              gff3_in_stream);
+  }
+  gt_gff3_in_stream_enable_node_arena((GtGFF3InStream*) gff3_in_stream);
   while (!(had_err = gt_node_stream_next(gff3_in_stream, &gn, err)) && gn)
     gt_array_add(tmp, gn);
+  if (!had_err)
+    had_err = gt_feature_index_bulk_load_begin(feature_index, err);
   if (!had_err) {
     GtNodeVisitor *feature_visitor = gt_feature_visitor_new(feature_index);
-    for (i=0;i<gt_array_size(tmp);i++) {
+    for (i=0;!had_err && i<gt_array_size(tmp);i++) {
       gn = *(GtGenomeNode**) gt_array_get(tmp, i);
       /* no need to lock, add_*_node() is synchronized */
-      had_err = gt_genome_node_accept(gn, feature_visitor, NULL);
-      gt_assert(!had_err); /* cannot happen */
+      had_err = gt_genome_node_accept(gn, feature_visitor, err);
     }
     gt_node_visitor_delete(feature_visitor);
+    if (!had_err)
+      had_err = gt_feature_index_bulk_load_end(feature_index, err);
+    else
+      (void) gt_feature_index_bulk_load_end(feature_index, NULL);
   }
   gt_node_stream_delete(gff3_in_stream);
   for (i=0;i<gt_array_size(tmp);i++)
@@ -231,6 +282,46 @@ int gt_feature_index_get_features_for_range(GtFeatureIndex *feature_index,
   return ret;
 }
 
+static int compare_range_indices(const void *a, const void *b, void *data)
+{
+  const GtRange *ranges = data;
+  return gt_range_compare(ranges + *(const GtUword*) a,
+                          ranges + *(const GtUword*) b);
+}
+
+int gt_feature_index_get_features_for_ranges(GtFeatureIndex *feature_index,
+                                             GtArray **results,
+                                             const char *seqid,
+                                             const GtRange *ranges,
+                                             GtUword numofranges,
+                                             GtError *err)
+{
+  GtUword i, *order;
+  int had_err = 0;
+  gt_assert(feature_index && feature_index->c_class && results && seqid &&
+            ranges);
+  /* answer the queries in order of their start positions, so that
+     consecutive queries touch neighbouring parts of the index */
+  order = gt_malloc(sizeof (GtUword) * (numofranges ? numofranges : 1));
+  for (i = 0; i < numofranges; i++) {
+    gt_assert(results[i] && gt_range_length(ranges + i) > 0);
+    order[i] = i;
+  }
+  gt_msort_r(order, numofranges, sizeof (GtUword), (void*) ranges,
+             compare_range_indices);
+  gt_rwlock_rdlock(feature_index->pvt->lock);
+  for (i = 0; !had_err && i < numofranges; i++) {
+    had_err = feature_index->c_class->get_features_for_range(feature_index,
+                                                           results[order[i]],
+                                                           seqid,
+                                                           ranges + order[i],
+                                                           err);
+  }
+  gt_rwlock_unlock(feature_index->pvt->lock);
+  gt_free(order);
+  return had_err;
+}
+
 char* gt_feature_index_get_first_seqid(const GtFeatureIndex
                                              *feature_index,
                                               GtError *err)
@@ -319,6 +410,9 @@ void* gt_feature_index_cast(GT_UNUSED const GtFeatureIndexClass *fic,
 #define GT_FI_TEST_END 10000000
 #define GT_FI_TEST_FEATURE_WIDTH 2000
 #define GT_FI_TEST_QUERY_WIDTH 50000
+#define GT_FI_TEST_BATCH_SIZE 16
+#define GT_FI_TEST_LATE_FEATURES 10
+#define GT_FI_TEST_EQUAL_FEATURES 8
 #define GT_FI_TEST_SEQID "testseqid"
 
 typedef struct {
@@ -327,6 +421,8 @@ typedef struct {
   GtArray *nodes;
   GtMutex *mutex;
   GtUword next_node_idx,
+                nof_nodes,
+                nof_queries,
                 error_count;
 } GtFeatureIndexTestShared;
 
@@ -378,7 +474,7 @@ static void* gt_feature_index_unit_test_query(void *data)
 
   /* get reference set by linear search */
   gt_mutex_lock(shm->mutex);
-  for (i=0; i<GT_FI_TEST_FEATURES_PER_THREAD * gt_jobs; i++) {
+  for (i=0; i<shm->nof_nodes; i++) {
     GtRange rng2;
     GtFeatureNode *fn;
     fn = *(GtFeatureNode**) gt_array_get(shm->nodes, i);
@@ -424,10 +520,61 @@ static void* gt_feature_index_unit_test_query(void *data)
   return NULL;
 }
 
+/* every other thread lists all features of the sequence region while the
+   others run range queries */
+static void* gt_feature_index_unit_test_query_seqid(void *data)
+{
+  GtFeatureIndexTestShared *shm = (GtFeatureIndexTestShared*) data;
+  GtArray *arr, *arr_ref;
+  GtError *err;
+  GtUword i, query;
+  int had_err = 0;
+
+  gt_mutex_lock(shm->mutex);
+  query = shm->nof_queries++;
+  gt_mutex_unlock(shm->mutex);
+  if (query % 2 == 1)
+    return gt_feature_index_unit_test_query(data);
+
+  err = gt_error_new();
+  arr_ref = gt_array_new(sizeof (GtFeatureNode*));
+  gt_mutex_lock(shm->mutex);
+  for (i = 0; i < shm->nof_nodes; i++)
+    gt_array_add(arr_ref, *(GtFeatureNode**) gt_array_get(shm->nodes, i));
+  gt_mutex_unlock(shm->mutex);
+
+  arr = gt_feature_index_get_features_for_seqid(shm->fi, GT_FI_TEST_SEQID,
+                                                err);
+  if (!arr || gt_array_size(arr) != gt_array_size(arr_ref))
+    had_err = -1;
+  if (!had_err) {
+    gt_array_sort(arr_ref, cmp_range_start);
+    gt_array_sort(arr, cmp_range_start);
+    for (i = 0; !had_err && i < gt_array_size(arr); i++) {
+      if (!gt_feature_node_is_similar(*(GtFeatureNode**) gt_array_get(arr, i),
+                                      *(GtFeatureNode**)
+                                      gt_array_get(arr_ref, i))) {
+        had_err = -1;
+      }
+    }
+  }
+
+  if (had_err) {
+    gt_mutex_lock(shm->mutex);
+    shm->error_count++;
+    gt_mutex_unlock(shm->mutex);
+  }
+
+  gt_array_delete(arr);
+  gt_array_delete(arr_ref);
+  gt_error_delete(err);
+  return NULL;
+}
+
 /* to be called from implementing class! */
 int gt_feature_index_unit_test(GtFeatureIndex *fi, GtError *err)
 {
-  int had_err = 0, i, rval;
+  int had_err = 0, i, pass, rval;
   GtFeatureIndexTestShared sh;
   GtStrArray *seqids;
   GtStr *seqid;
@@ -440,6 +587,8 @@ int gt_feature_index_unit_test(GtFeatureIndex *fi, GtError *err)
   sh.nodes = gt_array_new(sizeof (GtFeatureNode*));
   sh.error_count = 0;
   sh.next_node_idx = 0;
+  sh.nof_nodes = GT_FI_TEST_FEATURES_PER_THREAD * gt_jobs;
+  sh.nof_queries = 0;
   sh.fi = fi;
   sh.err = gt_error_new();
 
@@ -477,7 +626,9 @@ int gt_feature_index_unit_test(GtFeatureIndex *fi, GtError *err)
     gt_array_add(sh.nodes, fn);
   }
   /* test parallel addition */
+  gt_ensure(gt_feature_index_bulk_load_begin(fi, err) == 0);
   gt_multithread(gt_feature_index_unit_test_add, &sh, err);
+  gt_ensure(gt_feature_index_bulk_load_end(fi, err) == 0);
   seqids = gt_feature_index_get_seqids(fi, err);
   gt_ensure(seqids);
   gt_ensure(gt_feature_index_has_seqid(fi, &has_seqid,GT_FI_TEST_SEQID,
@@ -490,6 +641,82 @@ int gt_feature_index_unit_test(GtFeatureIndex *fi, GtError *err)
     gt_multithread(gt_feature_index_unit_test_query, &sh, err);
   gt_ensure(sh.error_count == 0);
 
+  /* add features after the queries and list them during range queries,
+     first few enough to be kept besides the frozen ones, then so many that
+     the queries have to freeze the region again */
+  for (pass = 0; !had_err && pass < 2; pass++) {
+    GtUword j, nof_late = pass == 0 ? GT_FI_TEST_LATE_FEATURES
+                                     : sh.nof_nodes + 1;
+    for (j = 0; !had_err && j < nof_late; j++) {
+      GtUword start, end;
+      GtFeatureNode *fn;
+      start = random() % (GT_FI_TEST_END - GT_FI_TEST_FEATURE_WIDTH);
+      end = start + random() % (GT_FI_TEST_FEATURE_WIDTH);
+      fn = gt_feature_node_cast(gt_feature_node_new(seqid, "gene", start, end,
+                                                    GT_STRAND_FORWARD));
+      gt_array_add(sh.nodes, fn);
+      gt_ensure(gt_feature_index_add_feature_node(fi, fn, err) == 0);
+      gt_genome_node_delete((GtGenomeNode*) fn);
+      sh.nof_nodes++;
+    }
+    if (!had_err)
+      gt_multithread(gt_feature_index_unit_test_query_seqid, &sh, err);
+    gt_ensure(sh.error_count == 0);
+  }
+
+  /* batched queries must agree with single queries, also in the order of
+     equal features (which are told apart by their names) */
+  if (!had_err) {
+    GtRange ranges[GT_FI_TEST_BATCH_SIZE];
+    GtArray *results[GT_FI_TEST_BATCH_SIZE], *single;
+    GtUword j;
+    single = gt_array_new(sizeof (GtFeatureNode*));
+    for (i = 0; i < GT_FI_TEST_BATCH_SIZE; i++) {
+      ranges[i].start = random() % (GT_FI_TEST_END - GT_FI_TEST_QUERY_WIDTH);
+      ranges[i].end = ranges[i].start + random() % (GT_FI_TEST_QUERY_WIDTH);
+      results[i] = gt_array_new(sizeof (GtFeatureNode*));
+    }
+    for (j = 0; !had_err && j < GT_FI_TEST_EQUAL_FEATURES; j++) {
+      GtFeatureNode *fn;
+      char name[32];
+      fn = gt_feature_node_cast(gt_feature_node_new(seqid, "gene",
+                                                    ranges[0].start,
+                                                    ranges[0].end,
+                                                    GT_STRAND_FORWARD));
+      (void) snprintf(name, sizeof name, "equal" GT_WU, j);
+      gt_feature_node_set_attribute(fn, "Name", name);
+      gt_array_add(sh.nodes, fn);
+      gt_ensure(gt_feature_index_add_feature_node(fi, fn, err) == 0);
+      gt_genome_node_delete((GtGenomeNode*) fn);
+      sh.nof_nodes++;
+    }
+    gt_ensure(gt_feature_index_get_features_for_ranges(fi, results,
+                                                       GT_FI_TEST_SEQID,
+                                                       ranges,
+                                                       GT_FI_TEST_BATCH_SIZE,
+                                                       err) == 0);
+    for (i = 0; !had_err && i < GT_FI_TEST_BATCH_SIZE; i++) {
+      gt_array_reset(single);
+      gt_ensure(gt_feature_index_get_features_for_range(fi, single,
+                                                        GT_FI_TEST_SEQID,
+                                                        ranges + i,
+                                                        err) == 0);
+      gt_ensure(gt_array_size(single) == gt_array_size(results[i]));
+      for (j = 0; !had_err && j < gt_array_size(single); j++) {
+        GtFeatureNode *a = *(GtFeatureNode**) gt_array_get(single, j),
+                      *b = *(GtFeatureNode**) gt_array_get(results[i], j);
+        const char *name_a = gt_feature_node_get_attribute(a, "Name"),
+                   *name_b = gt_feature_node_get_attribute(b, "Name");
+        gt_ensure((name_a == NULL && name_b == NULL) ||
+                  (name_a != NULL && name_b != NULL &&
+                   strcmp(name_a, name_b) == 0));
+      }
+    }
+    for (i = 0; i < GT_FI_TEST_BATCH_SIZE; i++)
+      gt_array_delete(results[i]);
+    gt_array_delete(single);
+  }
+
   gt_mutex_delete(sh.mutex);
   gt_error_delete(sh.err);
   gt_str_array_delete(seqids);
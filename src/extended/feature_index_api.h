@@ -47,8 +47,23 @@ int         gt_feature_index_add_feature_node(GtFeatureIndex *feature_index,
 int         gt_feature_index_remove_node(GtFeatureIndex *feature_index,
                                          GtFeatureNode *node,
                                          GtError *err);
+/* Announce that a large number of nodes is about to be added to
+   <feature_index>. Until <gt_feature_index_bulk_load_end()> is called, a
+   backend may batch insertions into large transactions and defer the
+   maintenance of its secondary indexes. Nodes can still be added concurrently
+   from several threads. Queries are only guaranteed to be fast after the bulk
+   load has ended. */
+int         gt_feature_index_bulk_load_begin(GtFeatureIndex *feature_index,
+                                             GtError *err);
+/* Finish a bulk load started with <gt_feature_index_bulk_load_begin()>,
+   committing all pending insertions and rebuilding deferred indexes. */
+int         gt_feature_index_bulk_load_end(GtFeatureIndex *feature_index,
+                                           GtError *err);
 /* Add all features contained in <gff3file> to <feature_index>, if <gff3file> is
-   valid. Otherwise, <feature_index> is not changed and <err> is set. */
+   valid. Otherwise, <feature_index> is not changed and <err> is set.
+   The whole file is parsed (in parallel, if several jobs are used) before it
+   is loaded in bulk. If adding a feature fails, <err> is set and the features
+   added before it remain in <feature_index>. */
 int         gt_feature_index_add_gff3file(GtFeatureIndex *feature_index,
                                           const char *gff3file, GtError *err);
 /* Returns an array of <GtFeatureNodes> associated with a given sequence region
@@ -64,6 +79,18 @@ int         gt_feature_index_get_features_for_range(GtFeatureIndex
                                                     const char *seqid,
                                                     const GtRange *range,
                                                     GtError*);
+/* Look up genome features in <feature_index> for sequence region <seqid> in
+   each of the <numofranges> ranges in <ranges> and store the features
+   overlapping <ranges>[i] in <results>[i]. The queries are answered in order
+   of their start positions while holding the lock on <feature_index> only
+   once, which is faster than issuing them one by one. */
+int         gt_feature_index_get_features_for_ranges(GtFeatureIndex
+                                                     *feature_index,
+                                                     GtArray **results,
+                                                     const char *seqid,
+                                                     const GtRange *ranges,
+                                                     GtUword numofranges,
+                                                     GtError *err);
 /* Returns the first sequence region identifier added to <feature_index>. */
 char*       gt_feature_index_get_first_seqid(const GtFeatureIndex
                                              *feature_index,
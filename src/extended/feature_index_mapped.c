@@ -0,0 +1,1331 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <string.h>
+#include "core/array.h"
+#include "core/class_alloc_lock.h"
+#include "core/cstr_api.h"
+#include "core/ensure.h"
+#include "core/fa.h"
+#include "core/fileutils_api.h"
+#include "core/hashmap-generic.h"
+#include "core/hashmap.h"
+#include "core/interval_index.h"
+#include "core/ma.h"
+#include "core/mapspec.h"
+#include "core/mathsupport.h"
+#include "core/minmax.h"
+#include "core/str_array.h"
+#include "core/thread_api.h"
+#include "core/unused_api.h"
+#include "core/xansi_api.h"
+#include "core/xposix.h"
+#include "extended/feature_index_mapped.h"
+#include "extended/feature_index_memory_api.h"
+#include "extended/feature_index_rep.h"
+#include "extended/feature_node.h"
+#include "extended/feature_node_iterator_api.h"
+#include "extended/genome_node.h"
+#include "extended/genome_node_rep.h"
+#include "extended/region_node_api.h"
+
+#define GT_FIM_MAGIC_NUMBER   0x4754464dUL /* "GTFM" */
+#define GT_FIM_FORMAT_VERSION 1UL
+
+/* words of the file header */
+typedef enum {
+  GT_FIM_MAGIC,
+  GT_FIM_VERSION,
+  GT_FIM_NUMOFSEQIDS,
+  GT_FIM_FIRSTSEQID,
+  GT_FIM_NUMOFINTERVALS,
+  GT_FIM_NUMOFRECORDWORDS,
+  GT_FIM_STRINGPOOLSIZE,
+  GT_FIM_HEADERSIZE
+} GtFeatureIndexMappedHeaderWord;
+
+/* words of a sequence region entry, the regions are sorted by name. As in
+   the database backends, the range of a region is the range of its sequence
+   region node, if there is one, and the range covered by its features
+   otherwise. */
+typedef enum {
+  GT_FIM_SEQID_NAME,
+  GT_FIM_SEQID_START,
+  GT_FIM_SEQID_END,
+  GT_FIM_SEQID_FIRSTINTERVAL,
+  GT_FIM_SEQID_NUMOFINTERVALS,
+  GT_FIM_SEQID_MAXLEVEL,
+  GT_FIM_SEQIDSIZE
+} GtFeatureIndexMappedSeqidWord;
+
+/* A record holds the feature graph of a top-level feature: the number of
+   nodes, followed by an entry of the words below for each node (the
+   top-level feature first) and by the attribute and child lists, which are
+   referenced by their word offset relative to the start of the record.
+   Children are referenced by node number, strings by their offset in the
+   string pool. */
+typedef enum {
+  GT_FIM_NODE_FLAGS,
+  GT_FIM_NODE_START,
+  GT_FIM_NODE_END,
+  GT_FIM_NODE_TYPE,
+  GT_FIM_NODE_SOURCE,
+  GT_FIM_NODE_SCORE,
+  GT_FIM_NODE_FILENAME,
+  GT_FIM_NODE_LINE,
+  GT_FIM_NODE_MULTIREP,
+  GT_FIM_NODE_ATTRIBUTES,
+  GT_FIM_NODE_NUMOFATTRIBUTES,
+  GT_FIM_NODE_CHILDREN,
+  GT_FIM_NODE_NUMOFCHILDREN,
+  GT_FIM_NODESIZE
+} GtFeatureIndexMappedNodeWord;
+
+/* node flags, strand and phase are stored above them */
+#define GT_FIM_PSEUDO        1UL
+#define GT_FIM_HAS_SOURCE    (1UL << 1)
+#define GT_FIM_SCORE_DEFINED (1UL << 2)
+#define GT_FIM_MULTI         (1UL << 3)
+#define GT_FIM_MARKED        (1UL << 4)
+#define GT_FIM_HAS_ORIGIN    (1UL << 5)
+#define GT_FIM_STRAND_SHIFT  8
+#define GT_FIM_PHASE_SHIFT   12
+
+#define GT_FIM_INTERVALSIZE \
+        (sizeof (GtIntervalIndexEntry) / sizeof (GtUword))
+
+/* the components of an index file */
+typedef struct {
+  GtUword *header,
+          *seqids,
+          *intervals,
+          *records,
+          numofseqids,
+          numofintervals,
+          numofrecordwords,
+          stringpoolsize;
+  char *strings;
+} GtFeatureIndexMappedLayout;
+
+struct GtFeatureIndexMapped {
+  const GtFeatureIndex parent_instance;
+  GtFeatureIndexMappedLayout layout;
+  void *mapped;
+  GtIntervalIndexEntry *intervals;
+  GtStr **seqid_strs;
+  GtHashmap *nodes,   /* maps records to their top-level features */
+            *symbols; /* maps pooled strings to <GtStr>s */
+  GtArray *indegree,  /* space for validating records */
+          *queue;
+  GtStr *filename;
+  GtMutex *nodes_lock;
+};
+
+#define gt_feature_index_mapped_cast(FI)\
+        gt_feature_index_cast(gt_feature_index_mapped_class(), FI)
+
+static void feature_index_mapped_setup_mapspec(GtMapspec *mapspec, void *data,
+                                               GT_UNUSED bool write)
+{
+  GtFeatureIndexMappedLayout *layout = data;
+  gt_mapspec_add_ulong(mapspec, layout->header, (GtUword) GT_FIM_HEADERSIZE);
+  gt_mapspec_add_ulong(mapspec, layout->seqids,
+                       layout->numofseqids * GT_FIM_SEQIDSIZE);
+  gt_mapspec_add_ulong(mapspec, layout->intervals,
+                       layout->numofintervals * GT_FIM_INTERVALSIZE);
+  gt_mapspec_add_ulong(mapspec, layout->records, layout->numofrecordwords);
+  gt_mapspec_add_char(mapspec, layout->strings, layout->stringpoolsize);
+}
+
+static GtUword feature_index_mapped_size(const GtFeatureIndexMappedLayout
+                                         *layout)
+{
+  return (GT_FIM_HEADERSIZE + layout->numofseqids * GT_FIM_SEQIDSIZE +
+          layout->numofintervals * GT_FIM_INTERVALSIZE +
+          layout->numofrecordwords) * sizeof (GtUword) +
+         layout->stringpoolsize;
+}
+
+/* writing */
+
+DECLARE_HASHMAP(char*, cstr, GtUword, ul, static, inline)
+DEFINE_HASHMAP(char*, cstr, GtUword, ul, gt_ht_cstr_elem_hash,
+               gt_ht_cstr_elem_cmp, gt_free, NULL_DESTRUCTOR, static, inline)
+
+DECLARE_HASHMAP(GtFeatureNode*, node, GtUword, ul, static, inline)
+DEFINE_HASHMAP(GtFeatureNode*, node, GtUword, ul, gt_ht_ptr_elem_hash,
+               gt_ht_ptr_elem_cmp, NULL_DESTRUCTOR, NULL_DESTRUCTOR, static,
+               inline)
+
+typedef struct {
+  GtArray *records,        /* of GtUword */
+          *nodes;          /* of the current graph */
+  GtStr *strings;
+  GtHashtable *string_ids, /* maps strings to their offset in <strings> */
+              *node_ids;   /* maps the nodes of the current graph to ids */
+  GtUword record_start,
+          numofattributes;
+} GtFeatureIndexMappedWriter;
+
+static GtUword feature_index_mapped_add_string(GtFeatureIndexMappedWriter *w,
+                                               const char *cstr)
+{
+  GtUword *offset, new_offset;
+  if ((offset = cstr_ul_gt_hashmap_get(w->string_ids, (char*) cstr)))
+    return *offset;
+  new_offset = gt_str_length(w->strings);
+  gt_str_append_cstr(w->strings, cstr);
+  gt_str_append_char(w->strings, '\0');
+  cstr_ul_gt_hashmap_add(w->string_ids, gt_cstr_dup(cstr), new_offset);
+  return new_offset;
+}
+
+static void feature_index_mapped_number_nodes(GtFeatureIndexMappedWriter *w,
+                                              GtFeatureNode *fn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *child;
+  if (node_ul_gt_hashmap_get(w->node_ids, fn))
+    return;
+  node_ul_gt_hashmap_add(w->node_ids, fn, gt_array_size(w->nodes));
+  gt_array_add(w->nodes, fn);
+  fni = gt_feature_node_iterator_new_direct(fn);
+  while ((child = gt_feature_node_iterator_next(fni)))
+    feature_index_mapped_number_nodes(w, child);
+  gt_feature_node_iterator_delete(fni);
+}
+
+static void feature_index_mapped_add_attribute(const char *attr_name,
+                                               const char *attr_value,
+                                               void *data)
+{
+  GtFeatureIndexMappedWriter *w = data;
+  GtUword name = feature_index_mapped_add_string(w, attr_name),
+          value = feature_index_mapped_add_string(w, attr_value);
+  gt_array_add(w->records, name);
+  gt_array_add(w->records, value);
+  w->numofattributes++;
+}
+
+static void feature_index_mapped_add_node(GtFeatureIndexMappedWriter *w,
+                                          GtUword nodenum)
+{
+  GtFeatureNode *fn = *(GtFeatureNode**) gt_array_get(w->nodes, nodenum),
+                *child;
+  GtGenomeNode *gn = (GtGenomeNode*) fn;
+  GtFeatureNodeIterator *fni;
+  GtUword node[GT_FIM_NODESIZE], flags = 0, *id;
+  GtRange range;
+  float score;
+
+  memset(node, 0, sizeof node);
+  range = gt_genome_node_get_range(gn);
+  node[GT_FIM_NODE_START] = range.start;
+  node[GT_FIM_NODE_END] = range.end;
+  if (gt_feature_node_is_pseudo(fn))
+    flags |= GT_FIM_PSEUDO;
+  else {
+    node[GT_FIM_NODE_TYPE] =
+      feature_index_mapped_add_string(w, gt_feature_node_get_type(fn));
+  }
+  if (gt_feature_node_has_source(fn)) {
+    flags |= GT_FIM_HAS_SOURCE;
+    node[GT_FIM_NODE_SOURCE] =
+      feature_index_mapped_add_string(w, gt_feature_node_get_source(fn));
+  }
+  if (gt_feature_node_score_is_defined(fn)) {
+    flags |= GT_FIM_SCORE_DEFINED;
+    score = gt_feature_node_get_score(fn);
+    memcpy(node + GT_FIM_NODE_SCORE, &score, sizeof (score));
+  }
+  node[GT_FIM_NODE_MULTIREP] = nodenum;
+  if (gt_feature_node_is_multi(fn) && !gt_feature_node_is_pseudo(fn)) {
+    flags |= GT_FIM_MULTI;
+    /* a representative outside of the graph cannot be referenced, the node
+       becomes a representative itself then */
+    if ((id = node_ul_gt_hashmap_get(w->node_ids,
+                                 gt_feature_node_get_multi_representative(fn))))
+      node[GT_FIM_NODE_MULTIREP] = *id;
+  }
+  if (gt_feature_node_is_marked(fn))
+    flags |= GT_FIM_MARKED;
+  if (gn->filename) {
+    flags |= GT_FIM_HAS_ORIGIN;
+    node[GT_FIM_NODE_FILENAME] =
+                  feature_index_mapped_add_string(w, gt_str_get(gn->filename));
+    node[GT_FIM_NODE_LINE] = (GtUword) gn->line_number;
+  }
+  flags |= (GtUword) gt_feature_node_get_strand(fn) << GT_FIM_STRAND_SHIFT;
+  flags |= (GtUword) gt_feature_node_get_phase(fn) << GT_FIM_PHASE_SHIFT;
+  node[GT_FIM_NODE_FLAGS] = flags;
+
+  node[GT_FIM_NODE_ATTRIBUTES] = gt_array_size(w->records) - w->record_start;
+  w->numofattributes = 0;
+  gt_feature_node_foreach_attribute(fn, feature_index_mapped_add_attribute, w);
+  node[GT_FIM_NODE_NUMOFATTRIBUTES] = w->numofattributes;
+
+  node[GT_FIM_NODE_CHILDREN] = gt_array_size(w->records) - w->record_start;
+  fni = gt_feature_node_iterator_new_direct(fn);
+  while ((child = gt_feature_node_iterator_next(fni))) {
+    id = node_ul_gt_hashmap_get(w->node_ids, child);
+    gt_assert(id);
+    gt_array_add(w->records, *id);
+    node[GT_FIM_NODE_NUMOFCHILDREN]++;
+  }
+  gt_feature_node_iterator_delete(fni);
+
+  memcpy(gt_array_get(w->records, w->record_start + 1 +
+                                  nodenum * GT_FIM_NODESIZE),
+         node, sizeof node);
+}
+
+/* returns the offset of the record */
+static GtUword feature_index_mapped_add_record(GtFeatureIndexMappedWriter *w,
+                                               GtFeatureNode *fn)
+{
+  GtUword i, numofnodes, zero = 0;
+  gt_array_reset(w->nodes);
+  gt_hashtable_reset(w->node_ids);
+  feature_index_mapped_number_nodes(w, fn);
+  numofnodes = gt_array_size(w->nodes);
+  w->record_start = gt_array_size(w->records);
+  gt_array_add(w->records, numofnodes);
+  for (i = 0; i < numofnodes * GT_FIM_NODESIZE; i++)
+    gt_array_add(w->records, zero);
+  for (i = 0; i < numofnodes; i++)
+    feature_index_mapped_add_node(w, i);
+  return w->record_start;
+}
+
+/* order features by their origin, so that features with equal ranges are
+   returned in the order they were read */
+static int compare_origin(const void *a, const void *b)
+{
+  GtGenomeNode *gn_a = *(GtGenomeNode**) a,
+               *gn_b = *(GtGenomeNode**) b;
+  int rval = strcmp(gt_genome_node_get_filename(gn_a),
+                    gt_genome_node_get_filename(gn_b));
+  if (rval)
+    return rval;
+  if (gt_genome_node_get_line_number(gn_a) ==
+      gt_genome_node_get_line_number(gn_b))
+    return 0;
+  return gt_genome_node_get_line_number(gn_a) <
+         gt_genome_node_get_line_number(gn_b) ? -1 : 1;
+}
+
+static int compare_cstr_ptr(const void *a, const void *b)
+{
+  return strcmp(*(const char**) a, *(const char**) b);
+}
+
+int gt_feature_index_mapped_write(GtFeatureIndex *feature_index,
+                                  const char *filename, GtError *err)
+{
+  GtFeatureIndexMappedWriter w;
+  GtFeatureIndexMappedLayout layout;
+  GtUword header[GT_FIM_HEADERSIZE], i, j;
+  GtArray *names, *seqids, *intervals, *features;
+  GtStrArray *seqid_array;
+  char *firstseqid = NULL;
+  FILE *fp;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(feature_index && filename);
+
+  if (!(seqid_array = gt_feature_index_get_seqids(feature_index, err)))
+    return -1;
+  names = gt_array_new(sizeof (char*));
+  for (i = 0; i < gt_str_array_size(seqid_array); i++) {
+    const char *name = gt_str_array_get(seqid_array, i);
+    gt_array_add(names, name);
+  }
+  gt_array_sort(names, compare_cstr_ptr);
+  if (gt_array_size(names) > 0 &&
+      !(firstseqid = gt_feature_index_get_first_seqid(feature_index, err)))
+    had_err = -1;
+
+  w.records = gt_array_new(sizeof (GtUword));
+  w.nodes = gt_array_new(sizeof (GtFeatureNode*));
+  w.strings = gt_str_new();
+  w.string_ids = cstr_ul_gt_hashmap_new();
+  w.node_ids = node_ul_gt_hashmap_new();
+  seqids = gt_array_new(sizeof (GtUword));
+  intervals = gt_array_new(sizeof (GtIntervalIndexEntry));
+  header[GT_FIM_FIRSTSEQID] = gt_array_size(names);
+
+  for (i = 0; !had_err && i < gt_array_size(names); i++) {
+    const char *name = *(const char**) gt_array_get(names, i);
+    GtUword seqid[GT_FIM_SEQIDSIZE];
+    GtRange range;
+    if (firstseqid && strcmp(name, firstseqid) == 0)
+      header[GT_FIM_FIRSTSEQID] = i;
+    had_err = gt_feature_index_get_range_for_seqid(feature_index, &range, name,
+                                                   err);
+    if (!had_err) {
+      had_err = gt_feature_index_get_orig_range_for_seqid(feature_index,
+                                                          &range, name, err);
+    }
+    if (!had_err &&
+        !(features = gt_feature_index_get_features_for_seqid(feature_index,
+                                                             name, err))) {
+      had_err = -1;
+    }
+    if (!had_err) {
+      seqid[GT_FIM_SEQID_NAME] = feature_index_mapped_add_string(&w, name);
+      seqid[GT_FIM_SEQID_START] = range.start;
+      seqid[GT_FIM_SEQID_END] = range.end;
+      seqid[GT_FIM_SEQID_FIRSTINTERVAL] = gt_array_size(intervals);
+      seqid[GT_FIM_SEQID_NUMOFINTERVALS] = gt_array_size(features);
+      seqid[GT_FIM_SEQID_MAXLEVEL] = 0;
+      gt_array_sort_stable(features, compare_origin);
+      for (j = 0; j < gt_array_size(features); j++) {
+        GtFeatureNode *fn = *(GtFeatureNode**) gt_array_get(features, j);
+        GtIntervalIndexEntry entry;
+        range = gt_genome_node_get_range((GtGenomeNode*) fn);
+        entry.start = range.start;
+        entry.end = range.end;
+        entry.max = range.end;
+        entry.value = feature_index_mapped_add_record(&w, fn);
+        gt_array_add(intervals, entry);
+      }
+      if (gt_array_size(features) > 0) {
+        seqid[GT_FIM_SEQID_MAXLEVEL] =
+          (GtUword) gt_interval_index_build(gt_array_get(intervals,
+                                           seqid[GT_FIM_SEQID_FIRSTINTERVAL]),
+                                            gt_array_size(features));
+      }
+      for (j = 0; j < (GtUword) GT_FIM_SEQIDSIZE; j++)
+        gt_array_add(seqids, seqid[j]);
+      gt_array_delete(features);
+    }
+  }
+
+  if (!had_err) {
+    header[GT_FIM_MAGIC] = GT_FIM_MAGIC_NUMBER;
+    header[GT_FIM_VERSION] = GT_FIM_FORMAT_VERSION;
+    header[GT_FIM_NUMOFSEQIDS] = gt_array_size(names);
+    header[GT_FIM_NUMOFINTERVALS] = gt_array_size(intervals);
+    header[GT_FIM_NUMOFRECORDWORDS] = gt_array_size(w.records);
+    header[GT_FIM_STRINGPOOLSIZE] = gt_str_length(w.strings);
+    layout.header = header;
+    layout.seqids = gt_array_get_space(seqids);
+    layout.intervals = gt_array_get_space(intervals);
+    layout.records = gt_array_get_space(w.records);
+    layout.strings = gt_str_get_mem(w.strings);
+    layout.numofseqids = header[GT_FIM_NUMOFSEQIDS];
+    layout.numofintervals = header[GT_FIM_NUMOFINTERVALS];
+    layout.numofrecordwords = header[GT_FIM_NUMOFRECORDWORDS];
+    layout.stringpoolsize = header[GT_FIM_STRINGPOOLSIZE];
+    if (!(fp = gt_fa_fopen(filename, "wb", err)))
+      had_err = -1;
+    else {
+      had_err = gt_mapspec_write(feature_index_mapped_setup_mapspec, fp,
+                                 &layout, feature_index_mapped_size(&layout),
+                                 err);
+      gt_fa_xfclose(fp);
+    }
+  }
+
+  gt_array_delete(intervals);
+  gt_array_delete(seqids);
+  gt_hashtable_delete(w.node_ids);
+  gt_hashtable_delete(w.string_ids);
+  gt_str_delete(w.strings);
+  gt_array_delete(w.nodes);
+  gt_array_delete(w.records);
+  gt_free(firstseqid);
+  gt_array_delete(names);
+  gt_str_array_delete(seqid_array);
+  return had_err;
+}
+
+/* reading */
+
+static int feature_index_mapped_read_header(GtFeatureIndexMappedLayout
+                                            *layout,
+                                            const char *filename,
+                                            GtError *err)
+{
+  GtUword header[GT_FIM_HEADERSIZE];
+  FILE *fp;
+  int had_err = 0;
+
+  if (!(fp = gt_fa_fopen(filename, "rb", err)))
+    return -1;
+  if (gt_xfread(header, sizeof (GtUword), (size_t) GT_FIM_HEADERSIZE, fp)
+        != (size_t) GT_FIM_HEADERSIZE ||
+      header[GT_FIM_MAGIC] != GT_FIM_MAGIC_NUMBER) {
+    gt_error_set(err, "file \"%s\" is not a mapped feature index", filename);
+    had_err = -1;
+  }
+  else if (header[GT_FIM_VERSION] != GT_FIM_FORMAT_VERSION) {
+    gt_error_set(err, "mapped feature index \"%s\" has format version " GT_WU
+                 ", expected " GT_WU, filename, header[GT_FIM_VERSION],
+                 GT_FIM_FORMAT_VERSION);
+    had_err = -1;
+  }
+  else {
+    /* no component can be larger than the file, which also keeps the
+       computation of the expected file size from overflowing */
+    GtUword filesize = (GtUword) gt_file_size(filename),
+            wordsize = (GtUword) sizeof (GtUword);
+    layout->numofseqids = header[GT_FIM_NUMOFSEQIDS];
+    layout->numofintervals = header[GT_FIM_NUMOFINTERVALS];
+    layout->numofrecordwords = header[GT_FIM_NUMOFRECORDWORDS];
+    layout->stringpoolsize = header[GT_FIM_STRINGPOOLSIZE];
+    if (layout->numofseqids > filesize / (GT_FIM_SEQIDSIZE * wordsize) ||
+        layout->numofintervals > filesize / (GT_FIM_INTERVALSIZE * wordsize) ||
+        layout->numofrecordwords > filesize / wordsize ||
+        layout->stringpoolsize > filesize) {
+      gt_error_set(err, "mapped feature index \"%s\" is corrupt", filename);
+      had_err = -1;
+    }
+  }
+  gt_fa_xfclose(fp);
+  return had_err;
+}
+
+/* Checks the record at word <offset>, so that it can be turned into a
+   feature graph without further checks: all offsets and node numbers have to
+   lie within the mapped file, and the child lists have to form a directed
+   acyclic graph rooted at the first node in which every node is reachable.
+   <indegree> and <queue> provide space for the nodes of the record. */
+static bool feature_index_mapped_record_is_valid(const
+                                                 GtFeatureIndexMappedLayout
+                                                 *layout,
+                                                 GtUword offset,
+                                                 GtArray *indegree,
+                                                 GtArray *queue)
+{
+  const GtUword *record, *node;
+  GtUword i, j, avail, numofnodes, processed;
+
+  if (offset >= layout->numofrecordwords)
+    return false;
+  record = layout->records + offset;
+  avail = layout->numofrecordwords - offset;
+  numofnodes = record[0];
+  if (numofnodes == 0 || numofnodes > (avail - 1) / GT_FIM_NODESIZE)
+    return false;
+  gt_array_reset(indegree);
+  for (i = 0; i < numofnodes; i++) {
+    GtUword zero = 0;
+    gt_array_add(indegree, zero);
+  }
+  for (i = 0; i < numofnodes; i++) {
+    GtUword flags, attributes, numofattributes, children, numofchildren;
+    node = record + 1 + i * GT_FIM_NODESIZE;
+    flags = node[GT_FIM_NODE_FLAGS];
+    if (((flags >> GT_FIM_STRAND_SHIFT) & 0xf) >=
+          (GtUword) GT_NUM_OF_STRAND_TYPES ||
+        ((flags >> GT_FIM_PHASE_SHIFT) & 0xf) > (GtUword) GT_PHASE_UNDEFINED ||
+        (!(flags & GT_FIM_PSEUDO) &&
+         node[GT_FIM_NODE_TYPE] >= layout->stringpoolsize) ||
+        ((flags & GT_FIM_HAS_SOURCE) &&
+         node[GT_FIM_NODE_SOURCE] >= layout->stringpoolsize) ||
+        ((flags & GT_FIM_HAS_ORIGIN) &&
+         node[GT_FIM_NODE_FILENAME] >= layout->stringpoolsize)) {
+      return false;
+    }
+    /* representatives represent themselves, pseudo-features are none */
+    if ((flags & GT_FIM_MULTI) &&
+        ((flags & GT_FIM_PSEUDO) ||
+         node[GT_FIM_NODE_MULTIREP] >= numofnodes ||
+         !(record[1 + node[GT_FIM_NODE_MULTIREP] * GT_FIM_NODESIZE +
+                  GT_FIM_NODE_FLAGS] & GT_FIM_MULTI) ||
+         record[1 + node[GT_FIM_NODE_MULTIREP] * GT_FIM_NODESIZE +
+                GT_FIM_NODE_MULTIREP] != node[GT_FIM_NODE_MULTIREP])) {
+      return false;
+    }
+    attributes = node[GT_FIM_NODE_ATTRIBUTES];
+    numofattributes = node[GT_FIM_NODE_NUMOFATTRIBUTES];
+    if (attributes > avail || numofattributes > (avail - attributes) / 2)
+      return false;
+    for (j = 0; j < 2 * numofattributes; j++) {
+      if (record[attributes + j] >= layout->stringpoolsize)
+        return false;
+    }
+    children = node[GT_FIM_NODE_CHILDREN];
+    numofchildren = node[GT_FIM_NODE_NUMOFCHILDREN];
+    if (children > avail || numofchildren > avail - children)
+      return false;
+    for (j = 0; j < numofchildren; j++) {
+      GtUword child = record[children + j];
+      if (child == 0 || child >= numofnodes)
+        return false;
+      (*(GtUword*) gt_array_get(indegree, child))++;
+    }
+  }
+  /* topological sort starting at the root, which is the only node without
+     parents */
+  gt_array_reset(queue);
+  processed = 0;
+  gt_array_add(queue, processed);
+  for (i = 1; i < numofnodes; i++) {
+    if (*(GtUword*) gt_array_get(indegree, i) == 0)
+      return false;
+  }
+  while (processed < gt_array_size(queue)) {
+    node = record + 1 + *(GtUword*) gt_array_get(queue, processed++) *
+                        GT_FIM_NODESIZE;
+    for (j = 0; j < node[GT_FIM_NODE_NUMOFCHILDREN]; j++) {
+      GtUword child = record[node[GT_FIM_NODE_CHILDREN] + j];
+      if (--(*(GtUword*) gt_array_get(indegree, child)) == 0)
+        gt_array_add(queue, child);
+    }
+  }
+  return processed == numofnodes;
+}
+
+static int feature_index_mapped_corrupt(const char *filename, GtError *err)
+{
+  gt_error_set(err, "mapped feature index \"%s\" is corrupt", filename);
+  return -1;
+}
+
+/* check the sequence region table, the records are checked on their first
+   access by <feature_index_mapped_get_node()> */
+static int feature_index_mapped_check(GtFeatureIndexMapped *fim,
+                                      const char *filename, GtError *err)
+{
+  const GtFeatureIndexMappedLayout *layout = &fim->layout;
+  GtUword i;
+  int had_err = 0;
+  for (i = 0; !had_err && i < layout->numofseqids; i++) {
+    const GtUword *seqid = layout->seqids + i * GT_FIM_SEQIDSIZE;
+    if (seqid[GT_FIM_SEQID_NAME] >= layout->stringpoolsize ||
+        seqid[GT_FIM_SEQID_FIRSTINTERVAL] > layout->numofintervals ||
+        seqid[GT_FIM_SEQID_NUMOFINTERVALS] > layout->numofintervals -
+                                          seqid[GT_FIM_SEQID_FIRSTINTERVAL] ||
+        seqid[GT_FIM_SEQID_MAXLEVEL] >= (GtUword) GT_INTWORDSIZE) {
+      had_err = -1;
+    }
+  }
+  if (!had_err && layout->stringpoolsize > 0 &&
+      layout->strings[layout->stringpoolsize - 1] != '\0') {
+    had_err = -1;
+  }
+  if (had_err)
+    feature_index_mapped_corrupt(filename, err);
+  return had_err;
+}
+
+static const GtUword* feature_index_mapped_find_seqid(const
+                                                      GtFeatureIndexMapped
+                                                      *fim,
+                                                      const char *seqid,
+                                                      GtUword *seqidnum)
+{
+  GtUword left = 0, right = fim->layout.numofseqids;
+  while (left < right) {
+    GtUword mid = left + (right - left) / 2;
+    const GtUword *entry = fim->layout.seqids + mid * GT_FIM_SEQIDSIZE;
+    int cmp = strcmp(seqid, fim->layout.strings + entry[GT_FIM_SEQID_NAME]);
+    if (cmp == 0) {
+      if (seqidnum)
+        *seqidnum = mid;
+      return entry;
+    }
+    if (cmp < 0)
+      right = mid;
+    else
+      left = mid + 1;
+  }
+  return NULL;
+}
+
+static GtStr* feature_index_mapped_get_symbol(GtFeatureIndexMapped *fim,
+                                              GtUword offset)
+{
+  const char *cstr = fim->layout.strings + offset;
+  GtStr *symbol;
+  if (!(symbol = gt_hashmap_get(fim->symbols, cstr))) {
+    symbol = gt_str_new_cstr(cstr);
+    gt_hashmap_add(fim->symbols, (void*) cstr, symbol);
+  }
+  return symbol;
+}
+
+/* Returns the top-level feature stored in the record at <offset>, which is
+   validated and created on the first access. Returns NULL if the record is
+   corrupt. Has to be called with <nodes_lock> held. */
+static GtFeatureNode* feature_index_mapped_get_node(GtFeatureIndexMapped *fim,
+                                                    GtStr *seqid,
+                                                    GtUword offset)
+{
+  const GtUword *record, *node;
+  const char *strings = fim->layout.strings;
+  GtFeatureNode *fn, **nodes;
+  GtUword i, j, numofnodes;
+  bool *linked;
+
+  if (offset >= fim->layout.numofrecordwords)
+    return NULL;
+  record = fim->layout.records + offset;
+  if ((fn = gt_hashmap_get(fim->nodes, record)))
+    return fn;
+  if (!feature_index_mapped_record_is_valid(&fim->layout, offset,
+                                            fim->indegree, fim->queue)) {
+    return NULL;
+  }
+  numofnodes = record[0];
+  nodes = gt_malloc(sizeof (GtFeatureNode*) * numofnodes);
+  for (i = 0; i < numofnodes; i++) {
+    GtGenomeNode *gn;
+    GtStrand strand;
+    GtUword flags;
+    node = record + 1 + i * GT_FIM_NODESIZE;
+    flags = node[GT_FIM_NODE_FLAGS];
+    strand = (GtStrand) ((flags >> GT_FIM_STRAND_SHIFT) & 0xf);
+    if (flags & GT_FIM_PSEUDO) {
+      gn = gt_feature_node_new_pseudo(seqid, node[GT_FIM_NODE_START],
+                                      node[GT_FIM_NODE_END], strand);
+    }
+    else {
+      gn = gt_feature_node_new(seqid, strings + node[GT_FIM_NODE_TYPE],
+                               node[GT_FIM_NODE_START], node[GT_FIM_NODE_END],
+                               strand);
+    }
+    nodes[i] = gt_feature_node_cast(gn);
+    if (flags & GT_FIM_HAS_ORIGIN) {
+      gt_genome_node_set_origin(gn,
+                                feature_index_mapped_get_symbol(fim,
+                                                  node[GT_FIM_NODE_FILENAME]),
+                                (unsigned int) node[GT_FIM_NODE_LINE]);
+    }
+    if (flags & GT_FIM_HAS_SOURCE) {
+      gt_feature_node_set_source(nodes[i],
+                                 feature_index_mapped_get_symbol(fim,
+                                                   node[GT_FIM_NODE_SOURCE]));
+    }
+    gt_feature_node_set_phase(nodes[i],
+                              (GtPhase) ((flags >> GT_FIM_PHASE_SHIFT) & 0xf));
+    if (flags & GT_FIM_SCORE_DEFINED) {
+      float score;
+      memcpy(&score, node + GT_FIM_NODE_SCORE, sizeof (score));
+      gt_feature_node_set_score(nodes[i], score);
+    }
+    if (flags & GT_FIM_MARKED)
+      gt_feature_node_mark(nodes[i]);
+    for (j = 0; j < node[GT_FIM_NODE_NUMOFATTRIBUTES]; j++) {
+      const GtUword *attribute = record + node[GT_FIM_NODE_ATTRIBUTES] + 2 * j;
+      gt_feature_node_add_attribute(nodes[i], strings + attribute[0],
+                                    strings + attribute[1]);
+    }
+  }
+
+  /* representatives have to be set up before the features they represent */
+  for (i = 0; i < numofnodes; i++) {
+    node = record + 1 + i * GT_FIM_NODESIZE;
+    if ((node[GT_FIM_NODE_FLAGS] & GT_FIM_MULTI) &&
+        node[GT_FIM_NODE_MULTIREP] == i) {
+      gt_feature_node_make_multi_representative(nodes[i]);
+    }
+  }
+  for (i = 0; i < numofnodes; i++) {
+    node = record + 1 + i * GT_FIM_NODESIZE;
+    if ((node[GT_FIM_NODE_FLAGS] & GT_FIM_MULTI) &&
+        node[GT_FIM_NODE_MULTIREP] != i) {
+      gt_feature_node_set_multi_representative(nodes[i],
+                                        nodes[node[GT_FIM_NODE_MULTIREP]]);
+    }
+  }
+
+  /* the first parent of a node takes over its reference */
+  linked = gt_calloc((size_t) numofnodes, sizeof (bool));
+  for (i = 0; i < numofnodes; i++) {
+    node = record + 1 + i * GT_FIM_NODESIZE;
+    for (j = 0; j < node[GT_FIM_NODE_NUMOFCHILDREN]; j++) {
+      GtUword child = record[node[GT_FIM_NODE_CHILDREN] + j];
+      if (linked[child])
+        gt_genome_node_ref((GtGenomeNode*) nodes[child]);
+      gt_feature_node_add_child(nodes[i], nodes[child]);
+      linked[child] = true;
+    }
+  }
+  fn = nodes[0];
+  gt_free(linked);
+  gt_free(nodes);
+  gt_hashmap_add(fim->nodes, (void*) record, fn);
+  return fn;
+}
+
+static int feature_index_mapped_read_only(GtError *err)
+{
+  gt_error_set(err, "mapped feature index is read-only");
+  return -1;
+}
+
+static int gt_feature_index_mapped_add_region_node(GT_UNUSED
+                                                   GtFeatureIndex *gfi,
+                                                   GT_UNUSED GtRegionNode *rn,
+                                                   GtError *err)
+{
+  return feature_index_mapped_read_only(err);
+}
+
+static int gt_feature_index_mapped_add_feature_node(GT_UNUSED
+                                                    GtFeatureIndex *gfi,
+                                                    GT_UNUSED
+                                                    GtFeatureNode *fn,
+                                                    GtError *err)
+{
+  return feature_index_mapped_read_only(err);
+}
+
+static int gt_feature_index_mapped_remove_node(GT_UNUSED GtFeatureIndex *gfi,
+                                               GT_UNUSED GtFeatureNode *fn,
+                                               GtError *err)
+{
+  return feature_index_mapped_read_only(err);
+}
+
+static int feature_index_mapped_no_seqid(const char *seqid, GtError *err)
+{
+  gt_error_set(err, "sequence region '%s' does not exist", seqid);
+  return -1;
+}
+
+static GtArray* gt_feature_index_mapped_get_features_for_seqid(GtFeatureIndex
+                                                               *gfi,
+                                                               const char
+                                                               *seqid,
+                                                               GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  const GtUword *entry;
+  GtUword i, seqidnum;
+  GtArray *a;
+  gt_error_check(err);
+  fim = gt_feature_index_mapped_cast(gfi);
+  if (!(entry = feature_index_mapped_find_seqid(fim, seqid, &seqidnum))) {
+    feature_index_mapped_no_seqid(seqid, err);
+    return NULL;
+  }
+  a = gt_array_new(sizeof (GtFeatureNode*));
+  gt_mutex_lock(fim->nodes_lock);
+  for (i = 0; a != NULL && i < entry[GT_FIM_SEQID_NUMOFINTERVALS]; i++) {
+    GtFeatureNode *fn =
+      feature_index_mapped_get_node(fim, fim->seqid_strs[seqidnum],
+                                    fim->intervals[entry[
+                                      GT_FIM_SEQID_FIRSTINTERVAL] + i].value);
+    if (fn == NULL) {
+      feature_index_mapped_corrupt(gt_str_get(fim->filename), err);
+      gt_array_delete(a);
+      a = NULL;
+    }
+    else
+      gt_array_add(a, fn);
+  }
+  gt_mutex_unlock(fim->nodes_lock);
+  return a;
+}
+
+typedef struct {
+  GtFeatureIndexMapped *fim;
+  GtStr *seqid;
+  GtArray *results;
+  bool corrupt;
+} GtFeatureIndexMappedFindInfo;
+
+static void feature_index_mapped_collect(const GtIntervalIndexEntry *interval,
+                                         void *data)
+{
+  GtFeatureIndexMappedFindInfo *info = data;
+  GtFeatureNode *fn = feature_index_mapped_get_node(info->fim, info->seqid,
+                                                    interval->value);
+  if (fn == NULL)
+    info->corrupt = true;
+  else
+    gt_array_add(info->results, fn);
+}
+
+static int gt_feature_index_mapped_get_features_for_range(GtFeatureIndex *gfi,
+                                                          GtArray *results,
+                                                          const char *seqid,
+                                                          const GtRange
+                                                          *qry_range,
+                                                          GtError *err)
+{
+  GtFeatureIndexMappedFindInfo info;
+  GtFeatureIndexMapped *fim;
+  const GtUword *entry;
+  GtUword seqidnum;
+  gt_error_check(err);
+  gt_assert(gfi && results && qry_range);
+
+  fim = gt_feature_index_mapped_cast(gfi);
+  if (!(entry = feature_index_mapped_find_seqid(fim, seqid, &seqidnum)))
+    return feature_index_mapped_no_seqid(seqid, err);
+  info.fim = fim;
+  info.seqid = fim->seqid_strs[seqidnum];
+  info.results = results;
+  info.corrupt = false;
+  gt_mutex_lock(fim->nodes_lock);
+  gt_interval_index_find_all_overlapping(fim->intervals +
+                                         entry[GT_FIM_SEQID_FIRSTINTERVAL],
+                                         entry[GT_FIM_SEQID_NUMOFINTERVALS],
+                                         (unsigned int)
+                                         entry[GT_FIM_SEQID_MAXLEVEL],
+                                         qry_range->start, qry_range->end,
+                                         feature_index_mapped_collect, &info);
+  gt_mutex_unlock(fim->nodes_lock);
+  if (info.corrupt)
+    return feature_index_mapped_corrupt(gt_str_get(fim->filename), err);
+  gt_genome_nodes_sort_stable(results);
+  return 0;
+}
+
+static char* gt_feature_index_mapped_get_first_seqid(const GtFeatureIndex *gfi,
+                                                     GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtUword first;
+  gt_error_check(err);
+  fim = gt_feature_index_mapped_cast((GtFeatureIndex*) gfi);
+  first = fim->layout.header[GT_FIM_FIRSTSEQID];
+  if (first >= fim->layout.numofseqids) {
+    gt_error_set(err, "no sequence regions in index");
+    return NULL;
+  }
+  return gt_cstr_dup(gt_str_get(fim->seqid_strs[first]));
+}
+
+static GtStrArray* gt_feature_index_mapped_get_seqids(const GtFeatureIndex
+                                                      *gfi,
+                                                      GT_UNUSED GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtStrArray *seqids;
+  GtUword i;
+  fim = gt_feature_index_mapped_cast((GtFeatureIndex*) gfi);
+  seqids = gt_str_array_new();
+  for (i = 0; i < fim->layout.numofseqids; i++)
+    gt_str_array_add(seqids, fim->seqid_strs[i]);
+  return seqids;
+}
+
+static int gt_feature_index_mapped_get_range_for_seqid(GtFeatureIndex *gfi,
+                                                       GtRange *range,
+                                                       const char *seqid,
+                                                       GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  const GtUword *entry;
+  gt_error_check(err);
+  gt_assert(gfi && range && seqid);
+  fim = gt_feature_index_mapped_cast(gfi);
+  if (!(entry = feature_index_mapped_find_seqid(fim, seqid, NULL)))
+    return feature_index_mapped_no_seqid(seqid, err);
+  range->start = entry[GT_FIM_SEQID_START];
+  range->end = entry[GT_FIM_SEQID_END];
+  return 0;
+}
+
+static int gt_feature_index_mapped_get_orig_range_for_seqid(GtFeatureIndex
+                                                            *gfi,
+                                                            GtRange *range,
+                                                            const char *seqid,
+                                                            GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  const GtUword *entry;
+  gt_error_check(err);
+  gt_assert(gfi && range && seqid);
+  fim = gt_feature_index_mapped_cast(gfi);
+  if (!(entry = feature_index_mapped_find_seqid(fim, seqid, NULL)))
+    return feature_index_mapped_no_seqid(seqid, err);
+  range->start = entry[GT_FIM_SEQID_START];
+  range->end = entry[GT_FIM_SEQID_END];
+  return 0;
+}
+
+static int gt_feature_index_mapped_has_seqid(const GtFeatureIndex *gfi,
+                                             bool *has_seqid,
+                                             const char *seqid,
+                                             GT_UNUSED GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  gt_assert(gfi && has_seqid && seqid);
+  fim = gt_feature_index_mapped_cast((GtFeatureIndex*) gfi);
+  *has_seqid = (feature_index_mapped_find_seqid(fim, seqid, NULL) != NULL);
+  return 0;
+}
+
+static void gt_feature_index_mapped_delete(GtFeatureIndex *gfi)
+{
+  GtFeatureIndexMapped *fim;
+  GtUword i;
+  if (!gfi) return;
+  fim = gt_feature_index_mapped_cast(gfi);
+  gt_hashmap_delete(fim->nodes);
+  gt_array_delete(fim->indegree);
+  gt_array_delete(fim->queue);
+  gt_str_delete(fim->filename);
+  gt_hashmap_delete(fim->symbols);
+  if (fim->seqid_strs) {
+    for (i = 0; i < fim->layout.numofseqids; i++)
+      gt_str_delete(fim->seqid_strs[i]);
+    gt_free(fim->seqid_strs);
+  }
+  gt_mutex_delete(fim->nodes_lock);
+  if (fim->mapped)
+    gt_fa_xmunmap(fim->mapped);
+}
+
+const GtFeatureIndexClass* gt_feature_index_mapped_class(void)
+{
+  static const GtFeatureIndexClass *fic = NULL;
+  gt_class_alloc_lock_enter();
+  if (!fic) {
+    fic = gt_feature_index_class_new(sizeof (GtFeatureIndexMapped),
+                     gt_feature_index_mapped_add_region_node,
+                     gt_feature_index_mapped_add_feature_node,
+                     gt_feature_index_mapped_remove_node,
+                     gt_feature_index_mapped_get_features_for_seqid,
+                     gt_feature_index_mapped_get_features_for_range,
+                     gt_feature_index_mapped_get_first_seqid,
+                     NULL,
+                     gt_feature_index_mapped_get_seqids,
+                     gt_feature_index_mapped_get_range_for_seqid,
+                     gt_feature_index_mapped_get_orig_range_for_seqid,
+                     gt_feature_index_mapped_has_seqid,
+                     gt_feature_index_mapped_delete);
+  }
+  gt_class_alloc_lock_leave();
+  return fic;
+}
+
+GtFeatureIndex* gt_feature_index_mapped_new(const char *filename,
+                                            GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtFeatureIndex *fi;
+  GtUword i;
+  int had_err;
+  gt_error_check(err);
+  gt_assert(filename);
+
+  fi = gt_feature_index_create(gt_feature_index_mapped_class());
+  fim = gt_feature_index_mapped_cast(fi);
+  fim->mapped = NULL;
+  fim->seqid_strs = NULL;
+  fim->nodes = gt_hashmap_new(GT_HASH_DIRECT, NULL,
+                              (GtFree) gt_genome_node_delete);
+  fim->symbols = gt_hashmap_new(GT_HASH_DIRECT, NULL, (GtFree) gt_str_delete);
+  fim->indegree = gt_array_new(sizeof (GtUword));
+  fim->queue = gt_array_new(sizeof (GtUword));
+  fim->filename = gt_str_new_cstr(filename);
+  fim->nodes_lock = gt_mutex_new();
+  had_err = feature_index_mapped_read_header(&fim->layout, filename, err);
+  if (!had_err) {
+    had_err = gt_mapspec_read(feature_index_mapped_setup_mapspec,
+                              &fim->layout, filename,
+                              feature_index_mapped_size(&fim->layout),
+                              &fim->mapped, err);
+  }
+  if (!had_err)
+    had_err = feature_index_mapped_check(fim, filename, err);
+  if (had_err) {
+    fim->layout.numofseqids = 0;
+    gt_feature_index_delete(fi);
+    return NULL;
+  }
+  fim->intervals = (GtIntervalIndexEntry*) fim->layout.intervals;
+  fim->seqid_strs = gt_malloc(sizeof (GtStr*) *
+                              MAX(fim->layout.numofseqids, 1));
+  for (i = 0; i < fim->layout.numofseqids; i++) {
+    fim->seqid_strs[i] =
+      gt_str_new_cstr(fim->layout.strings +
+                      fim->layout.seqids[i * GT_FIM_SEQIDSIZE +
+                                         GT_FIM_SEQID_NAME]);
+  }
+  return fi;
+}
+
+#define GT_FIM_TEST_SEQIDS   3
+#define GT_FIM_TEST_GENES    500
+#define GT_FIM_TEST_END      1000000
+#define GT_FIM_TEST_QUERIES  200
+
+static int compare_id(const void *a, const void *b)
+{
+  return strcmp(gt_feature_node_get_attribute(*(GtFeatureNode**) a, "ID"),
+                gt_feature_node_get_attribute(*(GtFeatureNode**) b, "ID"));
+}
+
+static int feature_index_mapped_compare_results(GtArray *a, GtArray *b,
+                                                GtError *err)
+{
+  GtUword i;
+  int had_err = 0;
+  gt_ensure(gt_array_size(a) == gt_array_size(b));
+  gt_array_sort(a, compare_id);
+  gt_array_sort(b, compare_id);
+  for (i = 0; !had_err && i < gt_array_size(a); i++) {
+    GtFeatureNode *fa = *(GtFeatureNode**) gt_array_get(a, i),
+                  *fb = *(GtFeatureNode**) gt_array_get(b, i);
+    gt_ensure(gt_feature_node_is_similar(fa, fb));
+    gt_ensure(gt_feature_node_number_of_children(fa) ==
+              gt_feature_node_number_of_children(fb));
+    gt_ensure(!strcmp(gt_feature_node_get_attribute(fa, "ID"),
+                      gt_feature_node_get_attribute(fb, "ID")));
+  }
+  return had_err;
+}
+
+/* writes <file> with the word <wordnum> replaced by <value> to <filename> and
+   checks that loading it fails */
+static int feature_index_mapped_test_corrupt(const char *file,
+                                             GtUword filesize,
+                                             const char *filename,
+                                             GtUword wordnum, GtUword value,
+                                             GtError *err)
+{
+  GtFeatureIndex *fi;
+  char *copy;
+  FILE *fp;
+  int had_err = 0;
+  gt_assert(file && filename);
+  gt_ensure((wordnum + 1) * sizeof (GtUword) <= filesize);
+  if (!had_err) {
+    copy = gt_malloc((size_t) filesize);
+    memcpy(copy, file, (size_t) filesize);
+    memcpy(copy + wordnum * sizeof (GtUword), &value, sizeof (GtUword));
+    fp = gt_fa_xfopen(filename, "wb");
+    gt_xfwrite(copy, sizeof (char), (size_t) filesize, fp);
+    gt_fa_xfclose(fp);
+    gt_free(copy);
+    /* records are only checked when they are accessed */
+    if ((fi = gt_feature_index_mapped_new(filename, err))) {
+      GtArray *features = gt_feature_index_get_features_for_seqid(fi, "seq0",
+                                                                  err);
+      gt_ensure(features == NULL);
+      gt_array_delete(features);
+    }
+    gt_ensure(gt_error_is_set(err) && strstr(gt_error_get(err), "corrupt"));
+    gt_error_unset(err);
+    gt_feature_index_delete(fi);
+  }
+  return had_err;
+}
+
+int gt_feature_index_mapped_unit_test(GtError *err)
+{
+  GtFeatureIndex *memory_fi, *mapped_fi = NULL;
+  GtStr *seqid, *tmpfilename;
+  GtArray *memory_results, *mapped_results;
+  GtUword i, j;
+  char buf[BUFSIZ];
+  bool has_seqid;
+  FILE *fp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  /* index genes with two exons each, which share a multi-feature CDS */
+  memory_fi = gt_feature_index_memory_new();
+  seqid = NULL;
+  for (i = 0; !had_err && i < GT_FIM_TEST_SEQIDS; i++) {
+    /* the index refers to the sequence ids of the nodes */
+    gt_str_delete(seqid);
+    seqid = gt_str_new_cstr("seq");
+    gt_str_append_uword(seqid, i);
+    for (j = 0; !had_err && j < GT_FIM_TEST_GENES; j++) {
+      GtFeatureNode *gene, *exon, *cds1, *cds2;
+      GtUword start = gt_rand_max(GT_FIM_TEST_END - 2000) + 1,
+              length = gt_rand_max(1000) + 20;
+      gene = (GtFeatureNode*) gt_feature_node_new(seqid, "gene", start,
+                                                  start + length,
+                                                  GT_STRAND_REVERSE);
+      (void) snprintf(buf, sizeof buf, "gene" GT_WU "_" GT_WU, i, j);
+      gt_feature_node_add_attribute(gene, "ID", buf);
+      gt_feature_node_set_score(gene, (float) j);
+      exon = (GtFeatureNode*) gt_feature_node_new(seqid, "exon", start,
+                                                  start + 9,
+                                                  GT_STRAND_REVERSE);
+      gt_feature_node_add_child(gene, exon);
+      cds1 = (GtFeatureNode*) gt_feature_node_new(seqid, "CDS", start + 2,
+                                                  start + 9,
+                                                  GT_STRAND_REVERSE);
+      cds2 = (GtFeatureNode*) gt_feature_node_new(seqid, "CDS",
+                                                  start + length - 9,
+                                                  start + length - 2,
+                                                  GT_STRAND_REVERSE);
+      gt_feature_node_set_phase(cds2, GT_PHASE_TWO);
+      gt_feature_node_make_multi_representative(cds1);
+      gt_feature_node_set_multi_representative(cds2, cds1);
+      gt_feature_node_add_child(gene, cds1);
+      gt_feature_node_add_child(gene, cds2);
+      had_err = gt_feature_index_add_feature_node(memory_fi, gene, err);
+      gt_genome_node_delete((GtGenomeNode*) gene);
+    }
+  }
+
+  tmpfilename = gt_str_new();
+  fp = gt_xtmpfp(tmpfilename);
+  gt_fa_xfclose(fp);
+  if (!had_err) {
+    had_err = gt_feature_index_mapped_write(memory_fi, gt_str_get(tmpfilename),
+                                            err);
+  }
+  if (!had_err) {
+    mapped_fi = gt_feature_index_mapped_new(gt_str_get(tmpfilename), err);
+    gt_ensure(mapped_fi);
+  }
+
+  /* range queries must give the same results */
+  memory_results = gt_array_new(sizeof (GtFeatureNode*));
+  mapped_results = gt_array_new(sizeof (GtFeatureNode*));
+  for (i = 0; !had_err && i < GT_FIM_TEST_QUERIES; i++) {
+    GtRange range;
+    (void) snprintf(buf, sizeof buf, "seq" GT_WU, i % GT_FIM_TEST_SEQIDS);
+    range.start = gt_rand_max(GT_FIM_TEST_END) + 1;
+    range.end = range.start + gt_rand_max(i % 2 ? 1000 : 100000);
+    gt_array_reset(memory_results);
+    gt_array_reset(mapped_results);
+    gt_ensure(!gt_feature_index_get_features_for_range(memory_fi,
+                                                       memory_results,
+                                                       buf, &range, err));
+    gt_ensure(!gt_feature_index_get_features_for_range(mapped_fi,
+                                                       mapped_results,
+                                                       buf, &range, err));
+    if (!had_err) {
+      had_err = feature_index_mapped_compare_results(memory_results,
+                                                     mapped_results, err);
+    }
+  }
+
+  /* multi-features and other properties survive the round trip */
+  if (!had_err) {
+    GtFeatureNode *gene, *cds;
+    GtFeatureNodeIterator *fni;
+    GtUword numofcds = 0;
+    gt_array_delete(mapped_results);
+    mapped_results = gt_feature_index_get_features_for_seqid(mapped_fi, "seq0",
+                                                             err);
+    gt_ensure(mapped_results &&
+              gt_array_size(mapped_results) == GT_FIM_TEST_GENES);
+    gene = *(GtFeatureNode**) gt_array_get(mapped_results, 0);
+    gt_ensure(gt_feature_node_get_strand(gene) == GT_STRAND_REVERSE);
+    gt_ensure(gt_feature_node_score_is_defined(gene));
+    fni = gt_feature_node_iterator_new_direct(gene);
+    while (!had_err && (cds = gt_feature_node_iterator_next(fni))) {
+      if (strcmp(gt_feature_node_get_type(cds), "CDS") == 0) {
+        numofcds++;
+        gt_ensure(gt_feature_node_is_multi(cds));
+        if (gt_feature_node_get_phase(cds) == GT_PHASE_TWO) {
+          gt_ensure(gt_feature_node_get_multi_representative(cds) != cds);
+        }
+      }
+    }
+    gt_feature_node_iterator_delete(fni);
+    gt_ensure(numofcds == 2);
+  }
+
+  /* corrupt references are detected when loading the index or when
+     accessing the corrupt record */
+  if (!had_err) {
+    GtFeatureIndexMapped *fim = gt_feature_index_mapped_cast(mapped_fi);
+    const GtUword *records = fim->layout.records,
+                  *node = records + fim->intervals[0].value + 1;
+    GtUword filesize = (GtUword) gt_file_size(gt_str_get(tmpfilename)),
+            recordword = (GtUword) (records -
+                                    (const GtUword*) fim->layout.header),
+            intervalword = (GtUword) ((const GtUword*) fim->intervals -
+                                      (const GtUword*) fim->layout.header),
+            nodeword = recordword + fim->intervals[0].value + 1;
+    GtStr *corruptfilename = gt_str_new();
+    fp = gt_xtmpfp(corruptfilename);
+    gt_fa_xfclose(fp);
+    /* too many record words for the file */
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 GT_FIM_NUMOFRECORDWORDS,
+                                                 ~0UL / 2, err));
+    /* record offset of an interval */
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 intervalword + 3,
+                                                 fim->layout.numofrecordwords,
+                                                 err));
+    /* number of nodes of a record */
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 nodeword - 1, ~0UL, err));
+    /* type string of a node */
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 nodeword + GT_FIM_NODE_TYPE,
+                                                 fim->layout.stringpoolsize,
+                                                 err));
+    /* attribute list of a node */
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 nodeword +
+                                                 GT_FIM_NODE_NUMOFATTRIBUTES,
+                                                 ~0UL / 2, err));
+    /* a child out of the record and a child which is the root */
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 nodeword - 1 +
+                                                 node[GT_FIM_NODE_CHILDREN],
+                                                 node[-1], err));
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 nodeword - 1 +
+                                                 node[GT_FIM_NODE_CHILDREN],
+                                                 0, err));
+    /* the second CDS represented by the exon, which is no multi-feature */
+    gt_ensure(!feature_index_mapped_test_corrupt(fim->mapped, filesize,
+                                                 gt_str_get(corruptfilename),
+                                                 nodeword +
+                                                 3 * GT_FIM_NODESIZE +
+                                                 GT_FIM_NODE_MULTIREP,
+                                                 1, err));
+    gt_xunlink(gt_str_get(corruptfilename));
+    gt_str_delete(corruptfilename);
+  }
+
+  if (!had_err) {
+    GtFeatureNode *gene;
+    GtRange range;
+    gt_ensure(!gt_feature_index_has_seqid(mapped_fi, &has_seqid, "seq2",
+                                          err));
+    gt_ensure(has_seqid);
+    gt_ensure(!gt_feature_index_has_seqid(mapped_fi, &has_seqid, "seq3",
+                                          err));
+    gt_ensure(!has_seqid);
+    gt_ensure(gt_feature_index_get_range_for_seqid(mapped_fi, &range, "seq3",
+                                                   err) == -1);
+    gt_error_unset(err);
+    gene = (GtFeatureNode*) gt_feature_node_new(seqid, "gene", 1, 10,
+                                                GT_STRAND_FORWARD);
+    gt_ensure(gt_feature_index_add_feature_node(mapped_fi, gene, err) == -1);
+    gt_error_unset(err);
+    gt_genome_node_delete((GtGenomeNode*) gene);
+  }
+
+  gt_array_delete(memory_results);
+  gt_array_delete(mapped_results);
+  gt_feature_index_delete(mapped_fi);
+  gt_feature_index_delete(memory_fi);
+  gt_xunlink(gt_str_get(tmpfilename));
+  gt_str_delete(tmpfilename);
+  gt_str_delete(seqid);
+  return had_err;
+}
@@ -0,0 +1,49 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef FEATURE_INDEX_MAPPED_API_H
+#define FEATURE_INDEX_MAPPED_API_H
+
+#include "extended/feature_index_api.h"
+
+/* The <GtFeatureIndexMapped> class implements a read-only <GtFeatureIndex>
+   backed by a single binary file which is memory mapped. The file contains a
+   table of sequence regions sorted by identifier, a static interval index of
+   the top-level features of each region, the feature graphs in a word-aligned
+   record format and a pool of all strings, so that opening an index only
+   reads the table of sequence regions and range queries touch only the parts
+   of the file they need. Features returned by queries are validated and
+   created from the file on first access and belong to the index, i.e., they
+   stay valid until the index is deleted. Queries which encounter a corrupt
+   record fail. Trying to add or remove nodes results in an error. */
+typedef struct GtFeatureIndexMapped GtFeatureIndexMapped;
+
+/* Returns a new <GtFeatureIndexMapped> object for the index file <filename>
+   written by <gt_feature_index_mapped_write()>. Returns NULL and sets <err>
+   if the file could not be mapped or its header or table of sequence regions
+   is invalid. */
+GtFeatureIndex* gt_feature_index_mapped_new(const char *filename,
+                                            GtError *err);
+
+/* Writes the contents of <feature_index> to the index file <filename>, which
+   can be mapped with <gt_feature_index_mapped_new()>. Returns 0 on success, -1
+   otherwise. <err> is set accordingly. */
+int             gt_feature_index_mapped_write(GtFeatureIndex *feature_index,
+                                              const char *filename,
+                                              GtError *err);
+
+#endif
@@ -24,10 +24,12 @@
 #include "core/cstr_api.h"
 #include "core/ensure.h"
 #include "core/hashmap.h"
+#include "core/interval_index.h"
 #include "core/interval_tree.h"
 #include "core/ma.h"
 #include "core/minmax.h"
 #include "core/range.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "extended/feature_index_memory.h"
@@ -45,25 +47,128 @@ struct GtFeatureIndexMemory {
   GtUword nof_region_nodes,
                 reference_count,
                 nof_nodes;
+  GtMutex *freeze_lock;
 };
 
 #define gt_feature_index_memory_cast(FI)\
         gt_feature_index_cast(gt_feature_index_memory_class(), FI)
 
+/* Regions are frozen on range queries: their features are moved into a
+   static interval index, whose entries refer to <nodes>. Features added later
+   are kept in the interval tree <features> and removed ones are cleared in
+   <nodes> until the region is frozen again, which happens once the tree holds
+   more features than the index. This way alternating modifications and
+   queries cost amortized logarithmic time per feature. */
 typedef struct {
   GtIntervalTree *features;
+  GtIntervalIndexEntry *intervals;
+  GtGenomeNode **nodes;
+  GtUword nof_intervals,
+          nof_removed;
+  unsigned int max_level;
   GtRegionNode *region;
   GtRange dyn_range;
 } RegionInfo;
 
 static void region_info_delete(RegionInfo *info)
 {
+  GtUword i;
   gt_interval_tree_delete(info->features);
+  for (i = 0; i < info->nof_intervals; i++)
+    gt_genome_node_delete(info->nodes[i]);
+  gt_free(info->intervals);
+  gt_free(info->nodes);
   if (info->region)
     gt_genome_node_delete((GtGenomeNode*)info->region);
   gt_free(info);
 }
 
+static void region_info_add_interval(RegionInfo *info, GtGenomeNode *gn)
+{
+  GtIntervalIndexEntry *interval = info->intervals + info->nof_intervals;
+  GtRange range = gt_genome_node_get_range(gn);
+  info->nodes[info->nof_intervals] = gn;
+  interval->start = range.start;
+  interval->end = range.end;
+  interval->value = info->nof_intervals++;
+}
+
+static int collect_intervals(GtIntervalTreeNode *node, void *data)
+{
+  region_info_add_interval((RegionInfo*) data,
+                      gt_genome_node_ref(gt_interval_tree_node_get_data(node)));
+  return 0;
+}
+
+static bool region_info_needs_freeze(RegionInfo *info)
+{
+  gt_assert(info);
+  return gt_interval_tree_size(info->features) >
+         info->nof_intervals - info->nof_removed ||
+         info->nof_removed > info->nof_intervals / 2;
+}
+
+static void region_info_freeze(RegionInfo *info)
+{
+  GtIntervalIndexEntry *old_intervals;
+  GtGenomeNode **old_nodes;
+  GtUword i, size, old_nof_intervals;
+  GT_UNUSED int had_err;
+  gt_assert(info);
+  old_intervals = info->intervals;
+  old_nodes = info->nodes;
+  old_nof_intervals = info->nof_intervals;
+  size = MAX(gt_interval_tree_size(info->features) + old_nof_intervals
+             - info->nof_removed, 1);
+  info->intervals = gt_malloc(sizeof (GtIntervalIndexEntry) * size);
+  info->nodes = gt_malloc(sizeof (GtGenomeNode*) * size);
+  info->nof_intervals = 0;
+  /* the index takes over the references of the remaining frozen nodes */
+  for (i = 0; i < old_nof_intervals; i++) {
+    if (old_nodes[i] != NULL)
+      region_info_add_interval(info, old_nodes[i]);
+  }
+  gt_free(old_intervals);
+  gt_free(old_nodes);
+  had_err = gt_interval_tree_traverse(info->features, collect_intervals, info);
+  gt_assert(!had_err); /* collect_intervals() is sane */
+  gt_interval_tree_delete(info->features);
+  info->features = gt_interval_tree_new((GtFree) gt_genome_node_delete);
+  info->nof_removed = 0;
+  info->max_level = gt_interval_index_build(info->intervals,
+                                            info->nof_intervals);
+}
+
+typedef struct {
+  GtGenomeNode **nodes;
+  GtArray *results;
+} RegionInfoFindInfo;
+
+static void collect_overlapping(const GtIntervalIndexEntry *interval,
+                                void *data)
+{
+  RegionInfoFindInfo *info = data;
+  if (info->nodes[interval->value] != NULL)
+    gt_array_add(info->results, info->nodes[interval->value]);
+}
+
+typedef struct {
+  GtGenomeNode **nodes,
+               *genome_node;
+  GtUword value;
+  bool found;
+} RegionInfoRemoveInfo;
+
+static void find_removed_interval(const GtIntervalIndexEntry *interval,
+                                  void *data)
+{
+  RegionInfoRemoveInfo *info = data;
+  if (!info->found && info->nodes[interval->value] == info->genome_node) {
+    info->value = interval->value;
+    info->found = true;
+  }
+}
+
 int gt_feature_index_memory_add_region_node(GtFeatureIndex *gfi,
                                             GtRegionNode *rn,
                                             GT_UNUSED GtError *err)
@@ -125,7 +230,7 @@ int gt_feature_index_memory_add_feature_node(GtFeatureIndex *gfi,
       fi->firstseqid = seqid;
   }
 
-  /* add node to the appropriate array in the hashtable */
+  /* add node to the interval tree of the region */
   new_node = gt_interval_tree_node_new(gn, node_range.start, node_range.end);
   gt_interval_tree_insert(info->features, new_node);
   /* update dynamic range */
@@ -180,6 +285,24 @@ int gt_feature_index_memory_remove_node(GtFeatureIndex *gfi,
 
   if (info.node)
     gt_interval_tree_remove(rinfo->features, info.node);
+  else {
+    /* the node was frozen, clear its entry in the interval index */
+    RegionInfoRemoveInfo remove_info;
+    remove_info.nodes = rinfo->nodes;
+    remove_info.genome_node = (GtGenomeNode*) gn;
+    remove_info.found = false;
+    gt_interval_index_find_all_overlapping(rinfo->intervals,
+                                           rinfo->nof_intervals,
+                                           rinfo->max_level, node_range.start,
+                                           node_range.end,
+                                           find_removed_interval,
+                                           &remove_info);
+    if (remove_info.found) {
+      gt_genome_node_delete(rinfo->nodes[remove_info.value]);
+      rinfo->nodes[remove_info.value] = NULL;
+      rinfo->nof_removed++;
+    }
+  }
   return 0;
 }
 
@@ -204,9 +327,17 @@ GtArray* gt_feature_index_memory_get_features_for_seqid(GtFeatureIndex *gfi,
   a = gt_array_new(sizeof (GtFeatureNode*));
   ri = (RegionInfo*) gt_hashmap_get(fi->regions, seqid);
   if (ri) {
+    GtUword i;
+    /* a concurrent range query could freeze the region meanwhile */
+    gt_mutex_lock(fi->freeze_lock);
+    for (i = 0; i < ri->nof_intervals; i++) {
+      if (ri->nodes[ri->intervals[i].value] != NULL)
+        gt_array_add(a, ri->nodes[ri->intervals[i].value]);
+    }
     had_err = gt_interval_tree_traverse(ri->features,
                                         collect_features_from_itree,
                                         a);
+    gt_mutex_unlock(fi->freeze_lock);
   }
   gt_assert(!had_err);   /* collect_features_from_itree() is sane */
   return a;
@@ -227,6 +358,7 @@ int gt_feature_index_memory_get_features_for_range(GtFeatureIndex *gfi,
                                                    GtError *err)
 {
   RegionInfo *ri;
+  RegionInfoFindInfo find_info;
   GtFeatureIndexMemory *fi;
   gt_error_check(err);
   gt_assert(gfi && results);
@@ -237,9 +369,23 @@ int gt_feature_index_memory_get_features_for_range(GtFeatureIndex *gfi,
     gt_error_set(err, "feature index does not contain the given sequence id");
     return -1;
   }
+  /* queries are answered under a read lock, so concurrent queries have to
+     agree on who freezes the region. Afterwards the region cannot change
+     before the read lock is released. */
+  gt_mutex_lock(fi->freeze_lock);
+  if (region_info_needs_freeze(ri))
+    region_info_freeze(ri);
+  gt_mutex_unlock(fi->freeze_lock);
+  find_info.nodes = ri->nodes;
+  find_info.results = results;
+  gt_interval_index_find_all_overlapping(ri->intervals, ri->nof_intervals,
+                                         ri->max_level, qry_range->start,
+                                         qry_range->end, collect_overlapping,
+                                         &find_info);
   gt_interval_tree_find_all_overlapping(ri->features, qry_range->start,
                                         qry_range->end, results);
-  gt_array_sort(results, gt_genome_node_cmp_range_start);
+  /* equal features keep the order in which the index reports them */
+  gt_array_sort_stable(results, gt_genome_node_cmp_range_start);
   return 0;
 }
 
@@ -358,6 +504,7 @@ void gt_feature_index_memory_delete(GtFeatureIndex *gfi)
   fi = gt_feature_index_memory_cast(gfi);
   gt_hashmap_delete(fi->regions);
   gt_hashmap_delete(fi->nodes_in_index);
+  gt_mutex_delete(fi->freeze_lock);
 }
 
 const GtFeatureIndexClass* gt_feature_index_memory_class(void)
@@ -393,6 +540,7 @@ GtFeatureIndex* gt_feature_index_memory_new(void)
   fim->regions = gt_hashmap_new(GT_HASH_STRING, NULL,
                                 (GtFree) region_info_delete);
   fim->nodes_in_index = gt_hashmap_new(GT_HASH_DIRECT, NULL, NULL);
+  fim->freeze_lock = gt_mutex_new();
   return fi;
 }
 
@@ -431,6 +579,51 @@ int gt_feature_index_memory_unit_test(GtError *err)
   gt_ensure(tmp == NULL);
   gt_ensure(gt_error_is_set(testerr));
   gt_genome_node_delete((GtGenomeNode*) fn);
+
+  /* remove a frozen feature and add it again */
+  if (!had_err) {
+    GtFeatureNode *fns[3];
+    GtArray *results = gt_array_new(sizeof (GtFeatureNode*)), *all;
+    GtStr *seqid = gt_str_new_cstr("removeseqid");
+    GtRange rng;
+    GtUword i;
+    gt_error_unset(testerr);
+    rng.start = 1;
+    rng.end = 1000;
+    for (i = 0; i < 3; i++) {
+      fns[i] = gt_feature_node_cast(gt_feature_node_new(seqid, "gene",
+                                                        100 * (i + 1),
+                                                        100 * (i + 1) + 50,
+                                                        GT_STRAND_FORWARD));
+      gt_ensure(!gt_feature_index_add_feature_node(fi, fns[i], testerr));
+    }
+    gt_ensure(!gt_feature_index_get_features_for_range(fi, results,
+                                                       "removeseqid", &rng,
+                                                       testerr));
+    gt_ensure(gt_array_size(results) == 3);
+    gt_ensure(!gt_feature_index_remove_node(fi, fns[1], testerr));
+    gt_array_reset(results);
+    gt_ensure(!gt_feature_index_get_features_for_range(fi, results,
+                                                       "removeseqid", &rng,
+                                                       testerr));
+    gt_ensure(gt_array_size(results) == 2);
+    gt_ensure(*(GtFeatureNode**) gt_array_get(results, 0) == fns[0]);
+    gt_ensure(*(GtFeatureNode**) gt_array_get(results, 1) == fns[2]);
+    all = gt_feature_index_get_features_for_seqid(fi, "removeseqid", testerr);
+    gt_ensure(gt_array_size(all) == 2);
+    gt_array_delete(all);
+    gt_ensure(!gt_feature_index_add_feature_node(fi, fns[1], testerr));
+    gt_array_reset(results);
+    gt_ensure(!gt_feature_index_get_features_for_range(fi, results,
+                                                       "removeseqid", &rng,
+                                                       testerr));
+    gt_ensure(gt_array_size(results) == 3);
+    gt_ensure(*(GtFeatureNode**) gt_array_get(results, 1) == fns[1]);
+    for (i = 0; i < 3; i++)
+      gt_genome_node_delete((GtGenomeNode*) fns[i]);
+    gt_array_delete(results);
+    gt_str_delete(seqid);
+  }
   gt_feature_index_delete(fi);
 
   gt_error_delete(testerr);
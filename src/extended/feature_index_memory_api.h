@@ -23,7 +23,9 @@
 /* The <GtFeatureIndexMemory> class implements a <GtFeatureIndex> in memory.
    Features are organized by region node. Each region node collects its
    feature nodes in an interval tree structure, which allows for efficient
-   range queries. */
+   range queries. On the first range query, a region is frozen into a compact
+   array sorted by start position which is searched as an implicit interval
+   tree; adding or removing features thaws the region again. */
 typedef struct GtFeatureIndexMemory GtFeatureIndexMemory;
 
 /* Creates a new <GtFeatureIndexMemory> object. */
@@ -55,6 +55,7 @@ typedef int         (*GtFeatureIndexHasSeqidFunc)(const GtFeatureIndex*,
                                                   bool*,
                                                   const char*,
                                                   GtError*);
+typedef int         (*GtFeatureIndexBulkLoadFunc)(GtFeatureIndex*, GtError*);
 typedef void        (*GtFeatureIndexFreeFunc)(GtFeatureIndex*);
 
 typedef struct GtFeatureIndexMembers GtFeatureIndexMembers;
@@ -64,7 +65,7 @@ struct GtFeatureIndex {
   GtFeatureIndexMembers *pvt;
 };
 
-const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
+GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
                                          GtFeatureIndexAddRegionNodeFunc
                                                  add_region_node,
                                          GtFeatureIndexAddFeatureNodeFunc
@@ -89,6 +90,14 @@ const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
                                                  has_seqid,
                                          GtFeatureIndexFreeFunc
                                                  free);
+/* Set the functions called before and after a bulk load (see
+   <gt_feature_index_bulk_load_begin()>). Both are optional. Has to be called
+   right after <gt_feature_index_class_new()>, before the class is used. */
+void gt_feature_index_class_set_bulk_load_funcs(GtFeatureIndexClass*,
+                                                GtFeatureIndexBulkLoadFunc
+                                                        bulk_load_begin,
+                                                GtFeatureIndexBulkLoadFunc
+                                                        bulk_load_end);
 GtFeatureIndex* gt_feature_index_create(const GtFeatureIndexClass*);
 void*           gt_feature_index_cast(const GtFeatureIndexClass*,
                                       GtFeatureIndex*);
@@ -67,6 +67,15 @@ void gt_feature_info_add(GtFeatureInfo *fi, const char *id, GtFeatureNode *fn)
                  gt_genome_node_ref((GtGenomeNode*) fn));
 }
 
+void gt_feature_info_remove(GtFeatureInfo *fi, const char *id)
+{
+  gt_assert(fi && id);
+  if (gt_hashmap_get(fi->id_to_genome_node, id))
+    gt_hashmap_remove(fi->id_to_genome_node, id);
+  if (gt_hashmap_get(fi->id_to_pseudo_parent, id))
+    gt_hashmap_remove(fi->id_to_pseudo_parent, id);
+}
+
 GtFeatureNode* gt_feature_info_get_pseudo_parent(const GtFeatureInfo *fi,
                                                  const char *id)
 {
@@ -28,6 +28,8 @@ void           gt_feature_info_reset(GtFeatureInfo*);
 GtFeatureNode* gt_feature_info_get(const GtFeatureInfo*, const char *id);
 void           gt_feature_info_add(GtFeatureInfo*, const char *id,
                                    GtFeatureNode*);
+/* Forget the feature and the pseudo-parent registered for <id>, if any. */
+void           gt_feature_info_remove(GtFeatureInfo*, const char *id);
 GtFeatureNode* gt_feature_info_get_pseudo_parent(const GtFeatureInfo*,
                                                  const char *id);
 void           gt_feature_info_add_pseudo_parent(GtFeatureInfo*, const char *id,
@@ -18,9 +18,9 @@
 #ifndef FEATURE_NODE_REP_H
 #define FEATURE_NODE_REP_H
 
+#include "extended/attribute_map.h"
 #include "extended/feature_node_observer.h"
 #include "extended/genome_node_rep.h"
-#include "extended/tag_value_map_api.h"
 
 struct GtFeatureNode {
   GtGenomeNode parent_instance;
@@ -29,7 +29,7 @@ struct GtFeatureNode {
   const char *type;
   GtRange range;
   float score;
-  GtTagValueMap attributes; /* stores the attributes; created on demand */
+  GtAttributeMap *attributes; /* stores the attributes; created on demand */
   unsigned int bit_field;
   GtDlist *children; /* created on demand */
   GtFeatureNode *representative;
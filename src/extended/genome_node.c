@@ -17,6 +17,7 @@
 
 #include <stdarg.h>
 #include "core/assert_api.h"
+#include "core/atomic.h"
 #include "core/class_alloc.h"
 #include "core/cstr_api.h"
 #include "core/ensure.h"
@@ -41,9 +42,7 @@ typedef struct {
 GtGenomeNode* gt_genome_node_ref(GtGenomeNode *gn)
 {
   gt_assert(gn);
-  gt_rwlock_wrlock(gn->lock);
-  gn->reference_count++;
-  gt_rwlock_unlock(gn->lock);
+  (void) gt_atomic_fetch_add(&gn->reference_count, 1U);
   return gn;
 }
 
@@ -212,20 +211,34 @@ static int compare_genome_nodes_with_delta(GtGenomeNode *gn_a,
   return gt_range_compare_with_delta(&range_a, &range_b, delta);
 }
 
-GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass *gnc)
+static void genome_node_init(GtGenomeNode *gn, const GtGenomeNodeClass *gnc)
 {
-  GtGenomeNode *gn;
-  gt_assert(gnc && gnc->size);
-  gn                     = gt_malloc(gnc->size);
   gn->c_class            = gnc;
   gn->filename           = NULL; /* means the node is generated */
   gn->line_number        = 0;
   gn->reference_count    = 0;
   gn->userdata           = NULL;
   gn->userdata_nof_items = 0;
-#ifdef GT_THREADS_ENABLED
-  gn->lock              = gt_rwlock_new();
-#endif
+  gn->arena              = NULL;
+}
+
+GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass *gnc)
+{
+  GtGenomeNode *gn;
+  gt_assert(gnc && gnc->size);
+  gn = gt_malloc(gnc->size);
+  genome_node_init(gn, gnc);
+  return gn;
+}
+
+GtGenomeNode* gt_genome_node_create_in_arena(const GtGenomeNodeClass *gnc,
+                                             GtNodeArena *arena)
+{
+  GtGenomeNode *gn;
+  gt_assert(gnc && gnc->size && arena);
+  gn = gt_node_arena_alloc(arena, gnc->size);
+  genome_node_init(gn, gnc);
+  gn->arena = arena;
   return gn;
 }
 
@@ -523,21 +536,16 @@ int gt_genome_node_unit_test(GtError *err)
 void gt_genome_node_delete(GtGenomeNode *gn)
 {
   if (!gn) return;
-  gt_rwlock_wrlock(gn->lock);
-  if (gn->reference_count) {
-    gn->reference_count--;
-    gt_rwlock_unlock(gn->lock);
+  if (gt_atomic_fetch_sub(&gn->reference_count, 1U) > 0)
     return;
-  }
   gt_assert(gn->c_class);
   if (gn->c_class->free)
     gn->c_class->free(gn);
   gt_str_delete(gn->filename);
   if (gn->userdata)
     gt_hashmap_delete(gn->userdata);
-  gt_rwlock_unlock(gn->lock);
-#ifdef GT_THREADS_ENABLED
-  gt_rwlock_delete(gn->lock);
-#endif
-  gt_free(gn);
+  if (gn->arena != NULL)
+    gt_node_arena_delete(gn->arena); /* the memory is freed with the arena */
+  else
+    gt_free(gn);
 }
@@ -0,0 +1,730 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/array.h"
+#include "core/cstr_api.h"
+#include "core/ensure.h"
+#include "core/fa.h"
+#include "core/hashmap-generic.h"
+#include "core/ma_api.h"
+#include "core/minmax.h"
+#include "core/unused_api.h"
+#include "core/xansi_api.h"
+#include "extended/comment_node_api.h"
+#include "extended/eof_node_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/feature_node_iterator_api.h"
+#include "extended/genome_node_io.h"
+#include "extended/genome_node_rep.h"
+#include "extended/meta_node_api.h"
+#include "extended/region_node_api.h"
+#include "extended/sequence_node_api.h"
+
+/* record types */
+typedef enum {
+  GT_NODE_IO_FEATURE,
+  GT_NODE_IO_REGION,
+  GT_NODE_IO_COMMENT,
+  GT_NODE_IO_META,
+  GT_NODE_IO_SEQUENCE,
+  GT_NODE_IO_EOF
+} GtGenomeNodeIOType;
+
+/* flags of a feature node record */
+#define GT_NODE_IO_HAS_ORIGIN      1U
+#define GT_NODE_IO_PSEUDO          (1U << 1)
+#define GT_NODE_IO_HAS_SOURCE      (1U << 2)
+#define GT_NODE_IO_SCORE_DEFINED   (1U << 3)
+#define GT_NODE_IO_MULTI           (1U << 4)
+#define GT_NODE_IO_MARKED          (1U << 5)
+#define GT_NODE_IO_HAS_DATA        (1U << 6) /* meta nodes only */
+
+DECLARE_HASHMAP(char*, cstr, GtUword, ul, static, inline)
+DEFINE_HASHMAP(char*, cstr, GtUword, ul, gt_ht_cstr_elem_hash,
+               gt_ht_cstr_elem_cmp, gt_free, NULL_DESTRUCTOR, static, inline)
+
+DECLARE_HASHMAP(GtFeatureNode*, node, GtUword, ul, static, inline)
+DEFINE_HASHMAP(GtFeatureNode*, node, GtUword, ul, gt_ht_ptr_elem_hash,
+               gt_ht_ptr_elem_cmp, NULL_DESTRUCTOR, NULL_DESTRUCTOR, static,
+               inline)
+
+struct GtGenomeNodeWriter {
+  FILE *fp;
+  GtUword bytes,
+          numofstrings,
+          numofnodes;
+  GtHashtable *strings,    /* maps strings to their number */
+              *node_ids;   /* maps the nodes of the current graph to ids */
+  GtArray *multi_features; /* of the current graph */
+};
+
+struct GtGenomeNodeReader {
+  FILE *fp;
+  GtArray *strings, /* of GtStr* */
+          *nodes;   /* of GtFeatureNode*, for the current graph */
+};
+
+/* writer */
+
+static void node_io_write_byte(GtGenomeNodeWriter *gnw, int byte)
+{
+  gt_xfputc(byte, gnw->fp);
+  gnw->bytes++;
+}
+
+/* integers are stored in 7-bit groups, least significant group first, the
+   highest bit of each byte marks whether another group follows */
+static void node_io_write_uword(GtGenomeNodeWriter *gnw, GtUword value)
+{
+  while (value >= (GtUword) 0x80) {
+    node_io_write_byte(gnw, (int) ((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  node_io_write_byte(gnw, (int) value);
+}
+
+static void node_io_write_cstr(GtGenomeNodeWriter *gnw, const char *cstr)
+{
+  GtUword len = (GtUword) strlen(cstr);
+  node_io_write_uword(gnw, len);
+  gt_xfwrite(cstr, sizeof (char), (size_t) len, gnw->fp);
+  gnw->bytes += len;
+}
+
+/* Strings which occur repeatedly are written only once: the number of the
+   string is written, followed by the string itself on its first
+   occurrence. */
+static void node_io_write_symbol(GtGenomeNodeWriter *gnw, const char *cstr)
+{
+  GtUword *num;
+  if ((num = cstr_ul_gt_hashmap_get(gnw->strings, (char*) cstr)))
+    node_io_write_uword(gnw, *num);
+  else {
+    node_io_write_uword(gnw, gnw->numofstrings);
+    node_io_write_cstr(gnw, cstr);
+    cstr_ul_gt_hashmap_add(gnw->strings, gt_cstr_dup(cstr),
+                           gnw->numofstrings++);
+  }
+}
+
+static void node_io_write_origin(GtGenomeNodeWriter *gnw, GtGenomeNode *gn)
+{
+  if (gn->filename) {
+    node_io_write_symbol(gnw, gt_str_get(gn->filename));
+    node_io_write_uword(gnw, (GtUword) gn->line_number);
+  }
+}
+
+static void store_attribute(const char *attr_name, const char *attr_value,
+                            void *data)
+{
+  GtGenomeNodeWriter *gnw = data;
+  node_io_write_symbol(gnw, attr_name);
+  node_io_write_cstr(gnw, attr_value);
+}
+
+static void count_attribute(GT_UNUSED const char *attr_name,
+                            GT_UNUSED const char *attr_value, void *data)
+{
+  GtUword *numofattributes = data;
+  (*numofattributes)++;
+}
+
+static void node_io_write_feature(GtGenomeNodeWriter *gnw, GtFeatureNode *fn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *child;
+  GtGenomeNode *gn = (GtGenomeNode*) fn;
+  GtUword numofattributes = 0;
+  GtRange range;
+  unsigned int flags = 0;
+  float score;
+
+  node_ul_gt_hashmap_add(gnw->node_ids, fn, gnw->numofnodes++);
+  if (gn->filename)
+    flags |= GT_NODE_IO_HAS_ORIGIN;
+  if (gt_feature_node_is_pseudo(fn))
+    flags |= GT_NODE_IO_PSEUDO;
+  if (gt_feature_node_has_source(fn))
+    flags |= GT_NODE_IO_HAS_SOURCE;
+  if (gt_feature_node_score_is_defined(fn))
+    flags |= GT_NODE_IO_SCORE_DEFINED;
+  if (gt_feature_node_is_multi(fn)) {
+    flags |= GT_NODE_IO_MULTI;
+    gt_array_add(gnw->multi_features, fn);
+  }
+  if (gt_feature_node_is_marked(fn))
+    flags |= GT_NODE_IO_MARKED;
+
+  node_io_write_uword(gnw, (GtUword) flags);
+  node_io_write_symbol(gnw, gt_str_get(gt_genome_node_get_seqid(gn)));
+  node_io_write_origin(gnw, gn);
+  if (!(flags & GT_NODE_IO_PSEUDO))
+    node_io_write_symbol(gnw, gt_feature_node_get_type(fn));
+  if (flags & GT_NODE_IO_HAS_SOURCE)
+    node_io_write_symbol(gnw, gt_feature_node_get_source(fn));
+  range = gt_genome_node_get_range(gn);
+  node_io_write_uword(gnw, range.start);
+  node_io_write_uword(gnw, range.end - range.start);
+  node_io_write_byte(gnw, (int) gt_feature_node_get_strand(fn));
+  node_io_write_byte(gnw, (int) gt_feature_node_get_phase(fn));
+  if (flags & GT_NODE_IO_SCORE_DEFINED) {
+    score = gt_feature_node_get_score(fn);
+    gt_xfwrite_one(&score, gnw->fp);
+    gnw->bytes += sizeof (score);
+  }
+  gt_feature_node_foreach_attribute(fn, count_attribute, &numofattributes);
+  node_io_write_uword(gnw, numofattributes);
+  gt_feature_node_foreach_attribute(fn, store_attribute, gnw);
+
+  /* children are written in order, nodes with multiple parents are written
+     only once and referenced by their id afterwards */
+  node_io_write_uword(gnw, gt_feature_node_number_of_children(fn));
+  fni = gt_feature_node_iterator_new_direct(fn);
+  while ((child = gt_feature_node_iterator_next(fni))) {
+    GtUword *id = node_ul_gt_hashmap_get(gnw->node_ids, child);
+    if (id)
+      node_io_write_uword(gnw, *id + 1);
+    else {
+      node_io_write_uword(gnw, 0);
+      node_io_write_feature(gnw, child);
+    }
+  }
+  gt_feature_node_iterator_delete(fni);
+}
+
+static void node_io_write_multi_representatives(GtGenomeNodeWriter *gnw)
+{
+  GtUword i, numofpairs = 0;
+  GtFeatureNode *fn, *rep;
+
+  for (i = 0; i < gt_array_size(gnw->multi_features); i++) {
+    fn = *(GtFeatureNode**) gt_array_get(gnw->multi_features, i);
+    rep = gt_feature_node_get_multi_representative(fn);
+    if (rep != fn && node_ul_gt_hashmap_get(gnw->node_ids, rep))
+      numofpairs++;
+  }
+  node_io_write_uword(gnw, numofpairs);
+  for (i = 0; i < gt_array_size(gnw->multi_features); i++) {
+    GtUword *repid;
+    fn = *(GtFeatureNode**) gt_array_get(gnw->multi_features, i);
+    rep = gt_feature_node_get_multi_representative(fn);
+    if (rep != fn && (repid = node_ul_gt_hashmap_get(gnw->node_ids, rep))) {
+      node_io_write_uword(gnw, *node_ul_gt_hashmap_get(gnw->node_ids, fn));
+      node_io_write_uword(gnw, *repid);
+    }
+  }
+}
+
+GtGenomeNodeWriter* gt_genome_node_writer_new(FILE *fp)
+{
+  GtGenomeNodeWriter *gnw;
+  gt_assert(fp);
+  gnw = gt_calloc(1, sizeof *gnw);
+  gnw->fp = fp;
+  gnw->strings = cstr_ul_gt_hashmap_new();
+  gnw->node_ids = node_ul_gt_hashmap_new();
+  gnw->multi_features = gt_array_new(sizeof (GtFeatureNode*));
+  return gnw;
+}
+
+int gt_genome_node_writer_write(GtGenomeNodeWriter *gnw, GtGenomeNode *gn,
+                                GtError *err)
+{
+  GtFeatureNode *fn;
+  GtRegionNode *rn;
+  GtCommentNode *cn;
+  GtMetaNode *mn;
+  GtSequenceNode *sn;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(gnw && gn);
+
+  if ((fn = gt_feature_node_try_cast(gn))) {
+    node_io_write_byte(gnw, GT_NODE_IO_FEATURE);
+    node_io_write_feature(gnw, fn);
+    node_io_write_multi_representatives(gnw);
+    gt_hashtable_reset(gnw->node_ids);
+    gt_array_reset(gnw->multi_features);
+    gnw->numofnodes = 0;
+  }
+  else if ((rn = gt_region_node_try_cast(gn))) {
+    GtRange range = gt_genome_node_get_range(gn);
+    node_io_write_byte(gnw, GT_NODE_IO_REGION);
+    node_io_write_uword(gnw, gn->filename ? GT_NODE_IO_HAS_ORIGIN : 0);
+    node_io_write_symbol(gnw, gt_str_get(gt_genome_node_get_seqid(gn)));
+    node_io_write_origin(gnw, gn);
+    node_io_write_uword(gnw, range.start);
+    node_io_write_uword(gnw, range.end - range.start);
+  }
+  else if ((cn = gt_comment_node_try_cast(gn))) {
+    node_io_write_byte(gnw, GT_NODE_IO_COMMENT);
+    node_io_write_uword(gnw, gn->filename ? GT_NODE_IO_HAS_ORIGIN : 0);
+    node_io_write_origin(gnw, gn);
+    node_io_write_cstr(gnw, gt_comment_node_get_comment(cn));
+  }
+  else if ((mn = gt_meta_node_try_cast(gn))) {
+    unsigned int flags = gn->filename ? GT_NODE_IO_HAS_ORIGIN : 0;
+    if (gt_meta_node_get_data(mn))
+      flags |= GT_NODE_IO_HAS_DATA;
+    node_io_write_byte(gnw, GT_NODE_IO_META);
+    node_io_write_uword(gnw, (GtUword) flags);
+    node_io_write_origin(gnw, gn);
+    node_io_write_symbol(gnw, gt_meta_node_get_directive(mn));
+    if (flags & GT_NODE_IO_HAS_DATA)
+      node_io_write_cstr(gnw, gt_meta_node_get_data(mn));
+  }
+  else if ((sn = gt_sequence_node_try_cast(gn))) {
+    node_io_write_byte(gnw, GT_NODE_IO_SEQUENCE);
+    node_io_write_uword(gnw, gn->filename ? GT_NODE_IO_HAS_ORIGIN : 0);
+    node_io_write_origin(gnw, gn);
+    node_io_write_cstr(gnw, gt_sequence_node_get_description(sn));
+    node_io_write_cstr(gnw, gt_sequence_node_get_sequence(sn));
+  }
+  else if (gt_eof_node_try_cast(gn)) {
+    node_io_write_byte(gnw, GT_NODE_IO_EOF);
+  }
+  else {
+    gt_error_set(err, "cannot write genome node of unknown type to temporary "
+                 "file");
+    had_err = -1;
+  }
+  return had_err;
+}
+
+GtUword gt_genome_node_writer_bytes(const GtGenomeNodeWriter *gnw)
+{
+  gt_assert(gnw);
+  return gnw->bytes;
+}
+
+void gt_genome_node_writer_delete(GtGenomeNodeWriter *gnw)
+{
+  if (!gnw) return;
+  cstr_ul_gt_hashmap_delete(gnw->strings);
+  node_ul_gt_hashmap_delete(gnw->node_ids);
+  gt_array_delete(gnw->multi_features);
+  gt_free(gnw);
+}
+
+/* reader */
+
+static int node_io_corrupt(GtError *err)
+{
+  gt_error_set(err, "unexpected end of temporary genome node file");
+  return -1;
+}
+
+static int node_io_read_uword(GtGenomeNodeReader *gnr, GtUword *value,
+                              GtError *err)
+{
+  unsigned int shift = 0;
+  int cc;
+  *value = 0;
+  do {
+    if ((cc = gt_xfgetc(gnr->fp)) == EOF)
+      return node_io_corrupt(err);
+    *value |= ((GtUword) (cc & 0x7f)) << shift;
+    shift += 7;
+  } while (cc & 0x80);
+  return 0;
+}
+
+static int node_io_read_str(GtGenomeNodeReader *gnr, GtStr *str, GtError *err)
+{
+  char buf[BUFSIZ];
+  GtUword len = 0;
+  size_t numofbytes;
+  int had_err;
+  gt_str_reset(str);
+  had_err = node_io_read_uword(gnr, &len, err);
+  while (!had_err && len > 0) {
+    numofbytes = MIN((size_t) len, sizeof buf);
+    if (gt_xfread(buf, sizeof (char), numofbytes, gnr->fp) != numofbytes)
+      had_err = node_io_corrupt(err);
+    else {
+      gt_str_append_cstr_nt(str, buf, (GtUword) numofbytes);
+      len -= (GtUword) numofbytes;
+    }
+  }
+  return had_err;
+}
+
+static int node_io_read_symbol(GtGenomeNodeReader *gnr, GtStr **symbol,
+                               GtError *err)
+{
+  GtUword num;
+  int had_err;
+  if (!(had_err = node_io_read_uword(gnr, &num, err))) {
+    if (num < gt_array_size(gnr->strings))
+      *symbol = *(GtStr**) gt_array_get(gnr->strings, num);
+    else if (num == gt_array_size(gnr->strings)) {
+      *symbol = gt_str_new();
+      gt_array_add(gnr->strings, *symbol);
+      had_err = node_io_read_str(gnr, *symbol, err);
+    }
+    else {
+      gt_error_set(err, "corrupt temporary genome node file");
+      had_err = -1;
+    }
+  }
+  return had_err;
+}
+
+static int node_io_read_origin(GtGenomeNodeReader *gnr, GtUword flags,
+                               GtStr **filename, GtUword *line_number,
+                               GtError *err)
+{
+  int had_err = 0;
+  *filename = NULL;
+  *line_number = 0;
+  if (flags & GT_NODE_IO_HAS_ORIGIN) {
+    had_err = node_io_read_symbol(gnr, filename, err);
+    if (!had_err)
+      had_err = node_io_read_uword(gnr, line_number, err);
+  }
+  return had_err;
+}
+
+static int node_io_read_feature(GtGenomeNodeReader *gnr, GtGenomeNode **gn,
+                                GtError *err)
+{
+  GtStr *seqid = NULL, *filename = NULL, *type = NULL, *source = NULL,
+        *value;
+  GtUword flags = 0, line_number = 0, start = 0, length = 0, i,
+          numofattributes = 0, numofchildren = 0;
+  GtFeatureNode *fn;
+  int strand = 0, phase = 0, had_err;
+  float score = 0.0;
+
+  *gn = NULL;
+  had_err = node_io_read_uword(gnr, &flags, err);
+  if (!had_err)
+    had_err = node_io_read_symbol(gnr, &seqid, err);
+  if (!had_err)
+    had_err = node_io_read_origin(gnr, flags, &filename, &line_number, err);
+  if (!had_err && !(flags & GT_NODE_IO_PSEUDO))
+    had_err = node_io_read_symbol(gnr, &type, err);
+  if (!had_err && (flags & GT_NODE_IO_HAS_SOURCE))
+    had_err = node_io_read_symbol(gnr, &source, err);
+  if (!had_err)
+    had_err = node_io_read_uword(gnr, &start, err);
+  if (!had_err)
+    had_err = node_io_read_uword(gnr, &length, err);
+  if (!had_err && ((strand = gt_xfgetc(gnr->fp)) == EOF ||
+                   (phase = gt_xfgetc(gnr->fp)) == EOF)) {
+    had_err = node_io_corrupt(err);
+  }
+  if (!had_err && (flags & GT_NODE_IO_SCORE_DEFINED) &&
+      gt_xfread_one(&score, gnr->fp) != (size_t) 1) {
+    had_err = node_io_corrupt(err);
+  }
+  if (had_err)
+    return had_err;
+
+  if (flags & GT_NODE_IO_PSEUDO) {
+    *gn = gt_feature_node_new_pseudo(seqid, start, start + length,
+                                     (GtStrand) strand);
+  }
+  else {
+    *gn = gt_feature_node_new(seqid, gt_str_get(type), start, start + length,
+                              (GtStrand) strand);
+  }
+  fn = gt_feature_node_cast(*gn);
+  gt_array_add(gnr->nodes, fn);
+  if (filename)
+    gt_genome_node_set_origin(*gn, filename, (unsigned int) line_number);
+  if (source)
+    gt_feature_node_set_source(fn, source);
+  gt_feature_node_set_phase(fn, (GtPhase) phase);
+  if (flags & GT_NODE_IO_SCORE_DEFINED)
+    gt_feature_node_set_score(fn, score);
+  if (flags & GT_NODE_IO_MULTI)
+    gt_feature_node_make_multi_representative(fn);
+  if (flags & GT_NODE_IO_MARKED)
+    gt_feature_node_mark(fn);
+
+  had_err = node_io_read_uword(gnr, &numofattributes, err);
+  if (!had_err && numofattributes > 0) {
+    value = gt_str_new();
+    for (i = 0; !had_err && i < numofattributes; i++) {
+      GtStr *name = NULL;
+      had_err = node_io_read_symbol(gnr, &name, err);
+      if (!had_err)
+        had_err = node_io_read_str(gnr, value, err);
+      if (!had_err)
+        gt_feature_node_add_attribute(fn, gt_str_get(name), gt_str_get(value));
+    }
+    gt_str_delete(value);
+  }
+
+  if (!had_err)
+    had_err = node_io_read_uword(gnr, &numofchildren, err);
+  for (i = 0; !had_err && i < numofchildren; i++) {
+    GtUword ref;
+    GtGenomeNode *child;
+    had_err = node_io_read_uword(gnr, &ref, err);
+    if (!had_err) {
+      if (ref == 0) {
+        had_err = node_io_read_feature(gnr, &child, err);
+        if (!had_err)
+          gt_feature_node_add_child(fn, gt_feature_node_cast(child));
+        else
+          gt_genome_node_delete(child);
+      }
+      else if (ref <= gt_array_size(gnr->nodes)) {
+        child = gt_genome_node_ref(*(GtGenomeNode**)
+                                   gt_array_get(gnr->nodes, ref - 1));
+        gt_feature_node_add_child(fn, gt_feature_node_cast(child));
+      }
+      else {
+        gt_error_set(err, "corrupt temporary genome node file");
+        had_err = -1;
+      }
+    }
+  }
+  return had_err;
+}
+
+static int node_io_read_multi_representatives(GtGenomeNodeReader *gnr,
+                                              GtError *err)
+{
+  GtUword i, numofpairs = 0, id = 0, repid = 0;
+  int had_err;
+  had_err = node_io_read_uword(gnr, &numofpairs, err);
+  for (i = 0; !had_err && i < numofpairs; i++) {
+    had_err = node_io_read_uword(gnr, &id, err);
+    if (!had_err)
+      had_err = node_io_read_uword(gnr, &repid, err);
+    if (!had_err && (id >= gt_array_size(gnr->nodes) ||
+                     repid >= gt_array_size(gnr->nodes))) {
+      gt_error_set(err, "corrupt temporary genome node file");
+      had_err = -1;
+    }
+    if (!had_err) {
+      gt_feature_node_set_multi_representative(
+                          *(GtFeatureNode**) gt_array_get(gnr->nodes, id),
+                          *(GtFeatureNode**) gt_array_get(gnr->nodes, repid));
+    }
+  }
+  return had_err;
+}
+
+GtGenomeNodeReader* gt_genome_node_reader_new(FILE *fp)
+{
+  GtGenomeNodeReader *gnr;
+  gt_assert(fp);
+  gnr = gt_calloc(1, sizeof *gnr);
+  gnr->fp = fp;
+  gnr->strings = gt_array_new(sizeof (GtStr*));
+  gnr->nodes = gt_array_new(sizeof (GtFeatureNode*));
+  return gnr;
+}
+
+int gt_genome_node_reader_read(GtGenomeNodeReader *gnr, GtGenomeNode **gn,
+                               GtError *err)
+{
+  GtStr *seqid = NULL, *filename = NULL, *directive = NULL, *text, *data;
+  GtUword flags = 0, line_number = 0, start = 0, length = 0;
+  int cc, had_err = 0;
+  gt_error_check(err);
+  gt_assert(gnr && gn);
+
+  *gn = NULL;
+  if ((cc = gt_xfgetc(gnr->fp)) == EOF)
+    return 0;
+  if (cc == GT_NODE_IO_FEATURE) {
+    had_err = node_io_read_feature(gnr, gn, err);
+    if (!had_err)
+      had_err = node_io_read_multi_representatives(gnr, err);
+    gt_array_reset(gnr->nodes);
+    if (had_err) {
+      gt_genome_node_delete(*gn);
+      *gn = NULL;
+    }
+    return had_err;
+  }
+  if (cc == GT_NODE_IO_EOF) {
+    *gn = gt_eof_node_new();
+    return 0;
+  }
+
+  text = gt_str_new();
+  data = gt_str_new();
+  had_err = node_io_read_uword(gnr, &flags, err);
+  if (!had_err && cc == GT_NODE_IO_REGION)
+    had_err = node_io_read_symbol(gnr, &seqid, err);
+  if (!had_err)
+    had_err = node_io_read_origin(gnr, flags, &filename, &line_number, err);
+  switch (cc) {
+    case GT_NODE_IO_REGION:
+      if (!had_err)
+        had_err = node_io_read_uword(gnr, &start, err);
+      if (!had_err)
+        had_err = node_io_read_uword(gnr, &length, err);
+      if (!had_err)
+        *gn = gt_region_node_new(seqid, start, start + length);
+      break;
+    case GT_NODE_IO_COMMENT:
+      if (!had_err)
+        had_err = node_io_read_str(gnr, text, err);
+      if (!had_err)
+        *gn = gt_comment_node_new(gt_str_get(text));
+      break;
+    case GT_NODE_IO_META:
+      if (!had_err)
+        had_err = node_io_read_symbol(gnr, &directive, err);
+      if (!had_err && (flags & GT_NODE_IO_HAS_DATA))
+        had_err = node_io_read_str(gnr, data, err);
+      if (!had_err) {
+        *gn = gt_meta_node_new(gt_str_get(directive),
+                               (flags & GT_NODE_IO_HAS_DATA)
+                               ? gt_str_get(data) : NULL);
+      }
+      break;
+    case GT_NODE_IO_SEQUENCE:
+      if (!had_err)
+        had_err = node_io_read_str(gnr, text, err);
+      if (!had_err)
+        had_err = node_io_read_str(gnr, data, err);
+      if (!had_err) {
+        *gn = gt_sequence_node_new(gt_str_get(text), data);
+        data = NULL; /* the sequence node took ownership */
+      }
+      break;
+    default:
+      gt_error_set(err, "corrupt temporary genome node file");
+      had_err = -1;
+  }
+  if (!had_err && filename)
+    gt_genome_node_set_origin(*gn, filename, (unsigned int) line_number);
+  gt_str_delete(data);
+  gt_str_delete(text);
+  return had_err;
+}
+
+void gt_genome_node_reader_delete(GtGenomeNodeReader *gnr)
+{
+  GtUword i;
+  if (!gnr) return;
+  for (i = 0; i < gt_array_size(gnr->strings); i++)
+    gt_str_delete(*(GtStr**) gt_array_get(gnr->strings, i));
+  gt_array_delete(gnr->strings);
+  gt_array_delete(gnr->nodes);
+  gt_free(gnr);
+}
+
+int gt_genome_node_io_unit_test(GtError *err)
+{
+  GtGenomeNode *gene, *mrna1, *mrna2, *exon, *cds1, *cds2, *meta, *gn;
+  GtGenomeNodeWriter *gnw;
+  GtGenomeNodeReader *gnr;
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *fn;
+  GtStr *seqid, *filename;
+  GtUword numofnodes = 0;
+  FILE *fp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  /* a gene with two transcripts sharing an exon and a multi-feature CDS */
+  seqid = gt_str_new_cstr("ctg123");
+  filename = gt_str_new_cstr("test.gff3");
+  gene = gt_feature_node_new(seqid, "gene", 1000, 9000, GT_STRAND_FORWARD);
+  gt_genome_node_set_origin(gene, filename, 3);
+  gt_feature_node_add_attribute((GtFeatureNode*) gene, "ID", "gene1");
+  gt_feature_node_set_score((GtFeatureNode*) gene, 0.5);
+  mrna1 = gt_feature_node_new(seqid, "mRNA", 1000, 9000, GT_STRAND_FORWARD);
+  mrna2 = gt_feature_node_new(seqid, "mRNA", 1050, 9000, GT_STRAND_FORWARD);
+  exon = gt_feature_node_new(seqid, "exon", 3000, 3902, GT_STRAND_FORWARD);
+  cds1 = gt_feature_node_new(seqid, "CDS", 3000, 3902, GT_STRAND_FORWARD);
+  cds2 = gt_feature_node_new(seqid, "CDS", 5000, 5500, GT_STRAND_FORWARD);
+  gt_feature_node_set_phase((GtFeatureNode*) cds2, GT_PHASE_TWO);
+  gt_feature_node_make_multi_representative((GtFeatureNode*) cds1);
+  gt_feature_node_set_multi_representative((GtFeatureNode*) cds2,
+                                           (GtFeatureNode*) cds1);
+  gt_feature_node_add_child((GtFeatureNode*) gene, (GtFeatureNode*) mrna1);
+  gt_feature_node_add_child((GtFeatureNode*) gene, (GtFeatureNode*) mrna2);
+  gt_feature_node_add_child((GtFeatureNode*) mrna1, (GtFeatureNode*) exon);
+  gt_feature_node_add_child((GtFeatureNode*) mrna2,
+                            (GtFeatureNode*) gt_genome_node_ref(exon));
+  gt_feature_node_add_child((GtFeatureNode*) mrna1, (GtFeatureNode*) cds2);
+  gt_feature_node_add_child((GtFeatureNode*) mrna1, (GtFeatureNode*) cds1);
+  meta = gt_meta_node_new("species", "http://example.org");
+
+  fp = gt_xtmpfp_generic(NULL, TMPFP_OPENBINARY | TMPFP_AUTOREMOVE);
+  gnw = gt_genome_node_writer_new(fp);
+  had_err = gt_genome_node_writer_write(gnw, gene, err);
+  if (!had_err)
+    had_err = gt_genome_node_writer_write(gnw, meta, err);
+  gt_ensure(gt_genome_node_writer_bytes(gnw) > 0);
+  gt_genome_node_writer_delete(gnw);
+  gt_genome_node_delete(gene);
+  gt_genome_node_delete(meta);
+  rewind(fp);
+
+  gnr = gt_genome_node_reader_new(fp);
+  if (!had_err)
+    had_err = gt_genome_node_reader_read(gnr, &gn, err);
+  gt_ensure(gn && (fn = gt_feature_node_try_cast(gn)));
+  if (!had_err) {
+    gt_ensure(!strcmp(gt_feature_node_get_type(fn), "gene"));
+    gt_ensure(!strcmp(gt_str_get(gt_genome_node_get_seqid(gn)), "ctg123"));
+    gt_ensure(!strcmp(gt_genome_node_get_filename(gn), "test.gff3"));
+    gt_ensure(gt_genome_node_get_line_number(gn) == 3);
+    gt_ensure(gt_genome_node_get_start(gn) == 1000);
+    gt_ensure(gt_genome_node_get_end(gn) == 9000);
+    gt_ensure(gt_feature_node_score_is_defined(fn));
+    gt_ensure(gt_feature_node_get_score(fn) == (float) 0.5);
+    gt_ensure(!strcmp(gt_feature_node_get_attribute(fn, "ID"), "gene1"));
+    gt_ensure(gt_feature_node_number_of_children(fn) == 2);
+    /* the shared exon is visited twice, the CDS once each */
+    fni = gt_feature_node_iterator_new(fn);
+    while ((fn = gt_feature_node_iterator_next(fni))) {
+      numofnodes++;
+      if (gt_feature_node_has_type(fn, "CDS")) {
+        gt_ensure(gt_feature_node_is_multi(fn));
+        gt_ensure(gt_genome_node_get_start(
+                   (GtGenomeNode*) gt_feature_node_get_multi_representative(fn))
+                  == 3000);
+        if (gt_genome_node_get_start((GtGenomeNode*) fn) == 5000)
+          gt_ensure(gt_feature_node_get_phase(fn) == GT_PHASE_TWO);
+      }
+    }
+    gt_feature_node_iterator_delete(fni);
+    gt_ensure(numofnodes == 7);
+  }
+  gt_genome_node_delete(gn);
+  if (!had_err)
+    had_err = gt_genome_node_reader_read(gnr, &gn, err);
+  gt_ensure(gn && gt_meta_node_try_cast(gn));
+  if (!had_err) {
+    gt_ensure(!strcmp(gt_meta_node_get_directive(gt_meta_node_cast(gn)),
+                      "species"));
+    gt_ensure(!strcmp(gt_meta_node_get_data(gt_meta_node_cast(gn)),
+                      "http://example.org"));
+  }
+  gt_genome_node_delete(gn);
+  if (!had_err)
+    had_err = gt_genome_node_reader_read(gnr, &gn, err);
+  gt_ensure(gn == NULL);
+  gt_genome_node_reader_delete(gnr);
+  gt_fa_xfclose(fp);
+  gt_str_delete(filename);
+  gt_str_delete(seqid);
+  return had_err;
+}
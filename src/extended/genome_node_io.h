@@ -0,0 +1,61 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef GENOME_NODE_IO_H
+#define GENOME_NODE_IO_H
+
+#include <stdio.h>
+#include "core/error_api.h"
+#include "extended/genome_node_api.h"
+
+/* The <GtGenomeNodeWriter> class writes <GtGenomeNode>s in a compact binary
+   format which can be read back with a <GtGenomeNodeReader>. Feature node
+   graphs are written as a whole, including multi-parent relations and
+   multi-features. Sequence IDs, file names, sources, types and attribute
+   names are stored only once per file. User data attached to nodes is not
+   written. The format depends on the platform and is meant for temporary
+   files only. */
+typedef struct GtGenomeNodeWriter GtGenomeNodeWriter;
+
+/* The <GtGenomeNodeReader> class reads <GtGenomeNode>s written by a
+   <GtGenomeNodeWriter>. */
+typedef struct GtGenomeNodeReader GtGenomeNodeReader;
+
+/* Return a new <GtGenomeNodeWriter> which writes to <fp>. */
+GtGenomeNodeWriter* gt_genome_node_writer_new(FILE *fp);
+/* Write <gn> (with all nodes reachable from it). Returns -1 and sets <err>
+   if <gn> is of a class which cannot be serialized. */
+int                 gt_genome_node_writer_write(GtGenomeNodeWriter *gnw,
+                                                GtGenomeNode *gn,
+                                                GtError *err);
+/* Return the number of bytes written by <gnw> so far. */
+GtUword             gt_genome_node_writer_bytes(const GtGenomeNodeWriter
+                                                *gnw);
+void                gt_genome_node_writer_delete(GtGenomeNodeWriter *gnw);
+
+/* Return a new <GtGenomeNodeReader> which reads from <fp>, positioned at the
+   start of the data written by a <GtGenomeNodeWriter>. */
+GtGenomeNodeReader* gt_genome_node_reader_new(FILE *fp);
+/* Read the next node into <gn>, <gn> is set to NULL if all nodes have been
+   read. Returns -1 and sets <err> if the input is corrupt. */
+int                 gt_genome_node_reader_read(GtGenomeNodeReader *gnr,
+                                               GtGenomeNode **gn,
+                                               GtError *err);
+void                gt_genome_node_reader_delete(GtGenomeNodeReader *gnr);
+
+int                 gt_genome_node_io_unit_test(GtError *err);
+
+#endif
@@ -21,8 +21,8 @@
 #include <stdio.h>
 #include "core/dlist.h"
 #include "core/hashmap.h"
-#include "core/thread_api.h"
 #include "extended/genome_node.h"
+#include "extended/node_arena.h"
 
 typedef void    (*GtGenomeNodeFreeFunc)(GtGenomeNode*);
 typedef GtStr*  (*GtGenomeNodeSetSeqidFunc)(GtGenomeNode*);
@@ -52,13 +52,9 @@ struct GtGenomeNode
   const GtGenomeNodeClass *c_class;
   GtStr *filename;
   GtHashmap *userdata; /* created on demand */
-  /* GtGenomeNodes are very space critical, therefore we can justify a bit
-     ifdef-hell here... */
-#ifdef GT_THREADS_ENABLED
-  GtRWLock *lock;
-#endif
+  GtNodeArena *arena; /* the node has been allocated from <arena> if set */
   unsigned int line_number,
-               reference_count,
+               reference_count, /* changed atomically */
                userdata_nof_items;
 };
 
@@ -71,5 +67,8 @@ const GtGenomeNodeClass* gt_genome_node_class_new(size_t size,
                                        GtGenomeNodeChangeSeqidFunc change_seqid,
                                        GtGenomeNodeAcceptFunc accept);
 GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass*);
+/* Like <gt_genome_node_create()>, but allocates the node from <arena>. */
+GtGenomeNode* gt_genome_node_create_in_arena(const GtGenomeNodeClass*,
+                                             GtNodeArena *arena);
 
 #endif
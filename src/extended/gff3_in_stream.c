@@ -84,6 +84,27 @@ void gt_gff3_in_stream_show_progress_bar(GtGFF3InStream *is)
                                             is->gff3_in_stream_plain);
 }
 
+void gt_gff3_in_stream_enable_parallel_parsing(GtGFF3InStream *is)
+{
+  gt_assert(is);
+  gt_gff3_in_stream_plain_enable_parallel_parsing((GtGFF3InStreamPlain*)
+                                                  is->gff3_in_stream_plain);
+}
+
+void gt_gff3_in_stream_enable_streaming(GtGFF3InStream *is, GtUword memlimit)
+{
+  gt_assert(is);
+  gt_gff3_in_stream_plain_enable_streaming((GtGFF3InStreamPlain*)
+                                           is->gff3_in_stream_plain, memlimit);
+}
+
+void gt_gff3_in_stream_enable_node_arena(GtGFF3InStream *is)
+{
+  gt_assert(is);
+  gt_gff3_in_stream_plain_enable_node_arena((GtGFF3InStreamPlain*)
+                                            is->gff3_in_stream_plain);
+}
+
 void gt_gff3_in_stream_set_type_checker(GtNodeStream *ns,
                                         GtTypeChecker *type_checker)
 {
@@ -33,5 +33,9 @@ int                      gt_gff3_in_stream_set_offsetfile(GtNodeStream*, GtStr*,
 void                     gt_gff3_in_stream_disable_add_ids(GtNodeStream*);
 void                     gt_gff3_in_stream_fix_region_boundaries(
                                                                GtGFF3InStream*);
+/* Allocate the feature nodes parsed by <gff3_in_stream> from node arenas
+   (see <GtNodeArena>), which is faster for large inputs whose nodes are all
+   kept until the end. */
+void                     gt_gff3_in_stream_enable_node_arena(GtGFF3InStream*);
 
 #endif
@@ -52,6 +52,24 @@ void          gt_gff3_in_stream_enable_strict_mode(GtGFF3InStream
    files underlying <gff3_in_stream>. */
 void          gt_gff3_in_stream_show_progress_bar(GtGFF3InStream
                                                                *gff3_in_stream);
+/* Enable parallel parsing for <gff3_in_stream>. That is, the GFF3 files are
+   read in large blocks which are split into chunks at terminator lines ("###",
+   and at sequence ID changes for sorted input). The chunks are parsed on the
+   <gt_jobs> threads of the process-wide thread pool and the resulting nodes
+   are returned in input order. Has no effect if ID attributes are checked
+   or an offset file is used. */
+void          gt_gff3_in_stream_enable_parallel_parsing(GtGFF3InStream
+                                                               *gff3_in_stream);
+/* Enable streaming for <gff3_in_stream>. That is, each GFF3 file is scanned
+   for its ID and Parent attributes before it is parsed, so that feature trees
+   can be returned as soon as their last part has been read, even if the file
+   contains no terminator lines ("###"). The output is the same as without
+   streaming. Complete trees waiting behind an incomplete one are moved to a
+   temporary file if the buffered features occupy more than about <memlimit>
+   bytes (0 means unlimited). Has no effect for <stdin> or if ID attributes are
+   checked. */
+void          gt_gff3_in_stream_enable_streaming(GtGFF3InStream *gff3_in_stream,
+                                                 GtUword memlimit);
 /* Returns a <GtStrArray*> which contains all type names in alphabetical order
    which have been parsed by <gff3_in_stream>. The caller is responsible to
    free it! */
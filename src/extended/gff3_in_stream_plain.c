@@ -20,10 +20,15 @@
 #include "core/class_alloc_lock.h"
 #include "core/cstr_table.h"
 #include "core/fileutils_api.h"
+#include "core/ma_api.h"
 #include "core/queue.h"
 #include "core/progressbar.h"
 #include "core/str_array.h"
+#include "core/thread_pool.h"
+#include "core/unused_api.h"
+#include "core/warning.h"
 #include "extended/genome_node.h"
+#include "extended/gff3_defines.h"
 #include "extended/gff3_in_stream_plain.h"
 #include "extended/gff3_parser.h"
 #include "extended/node_stream_api.h"
@@ -37,14 +42,39 @@ struct GtGFF3InStreamPlain {
        stdin_argument,
        stdin_processed,
        file_is_open,
-       progress_bar;
+       progress_bar,
+       parallel,
+       chunks_done; /* the rest of the current file is parsed sequentially */
   GtFile *fpin;
   GtUint64 line_number;
   GtQueue *genome_node_buffer;
   GtGFF3Parser *gff3_parser;
   GtCstrTable *used_types;
+  /* state of the chunk reader used for parallel parsing */
+  GtStr *line_buffer,
+        *last_seqid;
+  bool line_pending;
+  unsigned int last_terminator;
+  GtError *chunk_err; /* deferred until the nodes before it are delivered */
 };
 
+/* chunks are closed at the first possible line after this many bytes */
+#define GFF3_IN_STREAM_CHUNK_SIZE  (1UL << 20)
+/* number of chunks read per worker thread at once */
+#define GFF3_IN_STREAM_CHUNKS_PER_WORKER  2U
+
+typedef struct {
+  GtStr *text,
+        *filenamestr;
+  GtUint64 first_line;
+  GtGFF3Parser *parser;
+  GtQueue *genome_nodes;
+  GtCstrTable *used_types;
+  GtStrArray *warnings; /* issued in input order after parsing */
+  GtError *err;
+  int had_err;
+} GFF3InStreamChunk;
+
 #define gff3_in_stream_plain_cast(NS)\
         gt_node_stream_cast(gt_gff3_in_stream_plain_class(), NS)
 
@@ -71,6 +101,210 @@ static int buffer_is_sorted(void **elem, void *info, GtError *err)
   return 0;
 }
 
+static GFF3InStreamChunk* gff3_in_stream_chunk_new(GtGFF3InStreamPlain *is,
+                                                   GtStr *filenamestr)
+{
+  GFF3InStreamChunk *chunk = gt_malloc(sizeof *chunk);
+  chunk->text = gt_str_new();
+  /* every chunk has its own copy, reference counts are not thread-safe */
+  chunk->filenamestr = gt_str_clone(filenamestr);
+  /* a pending line has been counted already */
+  chunk->first_line = is->line_pending ? is->line_number
+                                       : is->line_number + 1;
+  chunk->parser = gt_gff3_parser_new_chunk_parser(is->gff3_parser,
+                                                  is->last_terminator);
+  chunk->genome_nodes = gt_queue_new();
+  chunk->used_types = gt_cstr_table_new();
+  chunk->warnings = gt_str_array_new();
+  chunk->err = gt_error_new();
+  chunk->had_err = 0;
+  return chunk;
+}
+
+static void gff3_in_stream_chunk_delete(GFF3InStreamChunk *chunk)
+{
+  if (!chunk) return;
+  while (gt_queue_size(chunk->genome_nodes))
+    gt_genome_node_delete(gt_queue_get(chunk->genome_nodes));
+  gt_queue_delete(chunk->genome_nodes);
+  gt_str_delete(chunk->text);
+  gt_str_delete(chunk->filenamestr);
+  gt_gff3_parser_delete(chunk->parser);
+  gt_cstr_table_delete(chunk->used_types);
+  gt_str_array_delete(chunk->warnings);
+  gt_error_delete(chunk->err);
+  gt_free(chunk);
+}
+
+static void gff3_in_stream_parse_chunks(GtUword start, GtUword end,
+                                        GT_UNUSED unsigned int workerid,
+                                        void *data)
+{
+  GFF3InStreamChunk **chunks = data;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++) {
+    GFF3InStreamChunk *chunk = chunks[idx];
+    gt_warning_collect(chunk->warnings);
+    chunk->had_err = gt_gff3_parser_parse_chunk(chunk->parser,
+                                                chunk->genome_nodes,
+                                                chunk->used_types,
+                                                chunk->filenamestr,
+                                                gt_str_get(chunk->text),
+                                                gt_str_length(chunk->text),
+                                                chunk->first_line,
+                                                chunk->err);
+    gt_warning_collect(NULL);
+  }
+}
+
+/* Returns true if a chunk ending before <line> would not separate a parent
+   from one of its children. Must be called for every line to keep track of
+   the last sequence ID. */
+static bool gff3_in_stream_is_chunk_boundary(GtGFF3InStreamPlain *is,
+                                             const char *line)
+{
+  const char *tab;
+  bool boundary = false;
+
+  if (!is->ensure_sorting || line[0] == '#' || line[0] == '\0')
+    return false;
+  /* in sorted files features with a different sequence id cannot be related */
+  if (!(tab = strchr(line, '\t')))
+    return false;
+  if (gt_str_length(is->last_seqid) != (GtUword) (tab - line) ||
+      strncmp(gt_str_get(is->last_seqid), line, (size_t) (tab - line))) {
+    boundary = gt_str_length(is->last_seqid) > 0;
+    gt_str_reset(is->last_seqid);
+    gt_str_append_cstr_nt(is->last_seqid, line, (GtUword) (tab - line));
+  }
+  return boundary;
+}
+
+/* Read the next chunks of the current file, parse them in parallel and append
+   the resulting nodes to the node buffer in input order. */
+static int gff3_in_stream_plain_parse_chunks(GtGFF3InStreamPlain *is,
+                                             GtStr *filenamestr, GtError *err)
+{
+  GFF3InStreamChunk **chunks;
+  GtThreadPool *pool;
+  GtStr *fasta_line = NULL;
+  GtError *id_err;
+  GtUword idx, numofchunks = 0, maxnumofchunks;
+  GtUint64 fasta_line_number = 0;
+  bool last_round = false;
+  int had_err = 0;
+
+  gt_error_check(err);
+  if (!(pool = gt_thread_pool_get(err)))
+    return -1;
+  maxnumofchunks = (GtUword) gt_thread_pool_size(pool)
+                   * GFF3_IN_STREAM_CHUNKS_PER_WORKER;
+  chunks = gt_malloc(sizeof *chunks * maxnumofchunks);
+
+  while (!last_round && !is->chunks_done && numofchunks < maxnumofchunks) {
+    GFF3InStreamChunk *chunk = gff3_in_stream_chunk_new(is, filenamestr);
+    chunks[numofchunks++] = chunk;
+    for (;;) {
+      const char *line;
+      if (!is->line_pending) {
+        gt_str_reset(is->line_buffer);
+        if (gt_str_read_next_line_generic(is->line_buffer, is->fpin) == EOF) {
+          is->chunks_done = true;
+          break;
+        }
+        is->line_number++;
+      }
+      line = gt_str_get(is->line_buffer);
+      if (is->line_number > 1 &&
+          (line[0] == '>' || strcmp(line, GT_GFF_FASTA_DIRECTIVE) == 0)) {
+        /* the FASTA section is parsed sequentially */
+        fasta_line = gt_str_clone(is->line_buffer);
+        fasta_line_number = is->line_number;
+        is->line_pending = false;
+        is->chunks_done = true;
+        break;
+      }
+      if (!is->line_pending && gff3_in_stream_is_chunk_boundary(is, line) &&
+          gt_str_length(chunk->text) >= GFF3_IN_STREAM_CHUNK_SIZE) {
+        is->line_pending = true;
+        break;
+      }
+      is->line_pending = false;
+      gt_str_append_str(chunk->text, is->line_buffer);
+      gt_str_append_char(chunk->text, '\n');
+      if (strncmp(line, GT_GFF_SEQUENCE_REGION,
+                  strlen(GT_GFF_SEQUENCE_REGION)) == 0 ||
+          strncmp(line, GT_GVF_VERSION_PREFIX,
+                  strlen(GT_GVF_VERSION_PREFIX)) == 0) {
+        /* later chunks depend on the state of the parser after this line */
+        last_round = true;
+      }
+      if (strncmp(line, GT_GFF_TERMINATOR, strlen(GT_GFF_TERMINATOR)) == 0) {
+        is->last_terminator = (unsigned int) is->line_number;
+        if (gt_str_length(chunk->text) >= GFF3_IN_STREAM_CHUNK_SIZE)
+          break;
+      }
+    }
+    if (gt_str_length(chunk->text) == 0) {
+      gff3_in_stream_chunk_delete(chunk);
+      numofchunks--;
+    }
+  }
+
+  gt_thread_pool_parallel_for(pool, 0, numofchunks, 1,
+                              gff3_in_stream_parse_chunks, chunks);
+
+  id_err = gt_error_new();
+
+  for (idx = 0; idx < numofchunks; idx++) {
+    GFF3InStreamChunk *chunk = chunks[idx];
+    if (!is->chunk_err) {
+      /* sequential parsing would not have reached chunks after an error */
+      GtUword i;
+      for (i = 0; i < gt_str_array_size(chunk->warnings); i++)
+        gt_warning("%s", gt_str_array_get(chunk->warnings, i));
+    }
+    if (!is->chunk_err &&
+        gt_gff3_parser_merge_chunk_parser(is->gff3_parser, chunk->parser,
+                                          gt_str_get(filenamestr), id_err)) {
+      /* the ID precedes any error found by the chunk parser itself */
+      is->chunk_err = id_err;
+      id_err = NULL;
+    }
+    if (!is->chunk_err && chunk->had_err) {
+      /* deliver the nodes of the preceding chunks before reporting the
+         error, the nodes of the erroneous chunk are discarded */
+      is->chunk_err = gt_error_new();
+      gt_error_set(is->chunk_err, "%s", gt_error_get(chunk->err));
+    }
+    if (!is->chunk_err) {
+      GtStrArray *types = gt_cstr_table_get_all(chunk->used_types);
+      GtUword i;
+      for (i = 0; i < gt_str_array_size(types); i++) {
+        if (!gt_cstr_table_get(is->used_types, gt_str_array_get(types, i)))
+          gt_cstr_table_add(is->used_types, gt_str_array_get(types, i));
+      }
+      gt_str_array_delete(types);
+      while (gt_queue_size(chunk->genome_nodes))
+        gt_queue_add(is->genome_node_buffer, gt_queue_get(chunk->genome_nodes));
+    }
+    gff3_in_stream_chunk_delete(chunk);
+  }
+  gt_free(chunks);
+  gt_error_delete(id_err);
+
+  if (!had_err && !is->chunk_err && fasta_line != NULL) {
+    had_err = gt_gff3_parser_parse_fasta_start(is->gff3_parser,
+                                               is->genome_node_buffer,
+                                               gt_str_get(fasta_line),
+                                               filenamestr, fasta_line_number,
+                                               is->fpin, err);
+  }
+  gt_str_delete(fasta_line);
+  return had_err;
+}
+
 static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
                                      GtError *err)
 {
@@ -90,6 +324,15 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
   gt_assert(gt_queue_size(is->genome_node_buffer) <= 1);
 
   for (;;) {
+    if (is->chunk_err) {
+      if (gt_queue_size(is->genome_node_buffer)) {
+        *gn = gt_queue_get(is->genome_node_buffer);
+        return 0;
+      }
+      gt_error_set(err, "%s", gt_error_get(is->chunk_err));
+      had_err = -1;
+      break;
+    }
     /* open file if necessary */
     if (!is->file_is_open) {
       if (gt_str_array_size(is->files) &&
@@ -138,22 +381,40 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
     filenamestr = gt_str_array_size(is->files)
                   ? gt_str_array_get_str(is->files, is->next_file-1)
                   : is->stdinstr;
-    /* read two nodes */
-    had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser, &status_code,
-                                                is->genome_node_buffer,
-                                                is->used_types, filenamestr,
-                                                &is->line_number, is->fpin,
-                                                err);
-    if (had_err)
-      break;
-    if (status_code != EOF) {
-      had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser, &status_code,
+    if (is->parallel && !is->chunks_done &&
+        !gt_gff3_parser_supports_chunks(is->gff3_parser)) {
+      is->parallel = false;
+    }
+    if (is->parallel && !is->chunks_done) {
+      /* parse the next chunks of the file in parallel */
+      had_err = gff3_in_stream_plain_parse_chunks(is, filenamestr, err);
+      if (had_err)
+        break;
+      if (gt_queue_size(is->genome_node_buffer) < 2)
+        continue;
+      status_code = 0;
+    }
+    else {
+      /* read two nodes */
+      had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser,
+                                                  &status_code,
                                                   is->genome_node_buffer,
                                                   is->used_types, filenamestr,
                                                   &is->line_number, is->fpin,
                                                   err);
       if (had_err)
         break;
+      if (status_code != EOF) {
+        had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser,
+                                                    &status_code,
+                                                    is->genome_node_buffer,
+                                                    is->used_types,
+                                                    filenamestr,
+                                                    &is->line_number,
+                                                    is->fpin, err);
+        if (had_err)
+          break;
+      }
     }
 
     if (status_code == EOF) {
@@ -162,6 +423,10 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
       gt_file_delete(is->fpin);
       is->fpin = NULL;
       is->file_is_open = false;
+      is->chunks_done = false;
+      is->line_pending = false;
+      is->last_terminator = 0;
+      gt_str_reset(is->last_seqid);
       gt_gff3_parser_reset(is->gff3_parser);
       if (!gt_str_array_size(is->files)) {
         is->stdin_processed = true;
@@ -204,6 +469,9 @@ static void gff3_in_stream_plain_free(GtNodeStream *ns)
   gt_gff3_parser_delete(gff3_in_stream_plain->gff3_parser);
   gt_cstr_table_delete(gff3_in_stream_plain->used_types);
   gt_file_delete(gff3_in_stream_plain->fpin);
+  gt_str_delete(gff3_in_stream_plain->line_buffer);
+  gt_str_delete(gff3_in_stream_plain->last_seqid);
+  gt_error_delete(gff3_in_stream_plain->chunk_err);
 }
 
 const GtNodeStreamClass* gt_gff3_in_stream_plain_class(void)
@@ -232,6 +500,9 @@ static GtNodeStream* gff3_in_stream_plain_new(GtStrArray *files,
   gff3_in_stream_plain->genome_node_buffer  = gt_queue_new();
   gff3_in_stream_plain->gff3_parser         = gt_gff3_parser_new(NULL);
   gff3_in_stream_plain->used_types          = gt_cstr_table_new();
+  gff3_in_stream_plain->line_buffer         = gt_str_new();
+  gff3_in_stream_plain->last_seqid          = gt_str_new();
+  gff3_in_stream_plain->chunk_err           = NULL;
   return ns;
 }
 
@@ -254,6 +525,28 @@ void gt_gff3_in_stream_plain_do_not_check_region_boundaries(GtGFF3InStreamPlain
   gt_gff3_parser_do_not_check_region_boundaries(is->gff3_parser);
 }
 
+void gt_gff3_in_stream_plain_enable_parallel_parsing(GtGFF3InStreamPlain *is)
+{
+  gt_assert(is);
+  is->parallel = true;
+}
+
+void gt_gff3_in_stream_plain_enable_node_arena(GtGFF3InStreamPlain *is)
+{
+  GtNodeArena *node_arena;
+  gt_assert(is);
+  node_arena = gt_node_arena_new();
+  gt_gff3_parser_set_node_arena(is->gff3_parser, node_arena);
+  gt_node_arena_delete(node_arena);
+}
+
+void gt_gff3_in_stream_plain_enable_streaming(GtGFF3InStreamPlain *is,
+                                              GtUword memlimit)
+{
+  gt_assert(is);
+  gt_gff3_parser_enable_streaming(is->gff3_parser, memlimit);
+}
+
 void gt_gff3_in_stream_plain_show_progress_bar(GtGFF3InStreamPlain *is)
 {
   gt_assert(is);
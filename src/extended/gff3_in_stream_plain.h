@@ -40,6 +40,11 @@ void          gt_gff3_in_stream_plain_do_not_check_region_boundaries(
 void          gt_gff3_in_stream_plain_enable_tidy_mode(GtNodeStream*);
 void          gt_gff3_in_stream_plain_enable_strict_mode(GtNodeStream*);
 void          gt_gff3_in_stream_plain_show_progress_bar(GtGFF3InStreamPlain*);
+void          gt_gff3_in_stream_plain_enable_parallel_parsing(
+                                                          GtGFF3InStreamPlain*);
+void          gt_gff3_in_stream_plain_enable_node_arena(GtGFF3InStreamPlain*);
+void          gt_gff3_in_stream_plain_enable_streaming(GtGFF3InStreamPlain*,
+                                                       GtUword memlimit);
 void          gt_gff3_in_stream_plain_set_type_checker(GtNodeStream*,
                                                        GtTypeChecker*);
 void          gt_gff3_in_stream_plain_set_xrf_checker(GtNodeStream*,
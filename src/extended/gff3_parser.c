@@ -23,9 +23,11 @@
 #include "core/assert_api.h"
 #include "core/compat.h"
 #include "core/cstr_api.h"
+#include "core/fa.h"
 #include "core/hashmap.h"
 #include "core/ma.h"
 #include "core/md5_seqid.h"
+#include "core/minmax.h"
 #include "core/parseutils.h"
 #include "core/queue.h"
 #include "core/splitter.h"
@@ -33,6 +35,7 @@
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/warning_api.h"
+#include "core/xansi_api.h"
 #include "extended/comment_node_api.h"
 #include "extended/feature_info.h"
 #include "extended/feature_node.h"
@@ -40,10 +43,13 @@
 #include "extended/feature_type.h"
 #include "extended/gap_str.h"
 #include "extended/genome_node.h"
+#include "extended/genome_node_io.h"
 #include "extended/gff3_defines.h"
 #include "extended/gff3_escaping.h"
 #include "extended/gff3_parser.h"
+#include "extended/gff3_references.h"
 #include "extended/mapping.h"
+#include "extended/node_arena.h"
 #include "extended/orphanage.h"
 #include "extended/region_node.h"
 #include "extended/xrf_checker_api.h"
@@ -66,9 +72,65 @@ struct GtGFF3Parser {
   GtOrphanage *orphanage;
   GtTypeChecker *type_checker;
   GtXRFChecker *xrf_checker;
+  GtNodeArena *node_arena; /* feature nodes are allocated here, if set */
   unsigned int last_terminator; /* line number of the last terminator */
+  /* streaming mode */
+  bool streaming;
+  GtGFF3References *references; /* of the current file, if it is streamed */
+  GtQueue *pending; /* top-level nodes which might be incomplete */
+  GtGenomeNode *open_head; /* head of <pending> known to be incomplete... */
+  GtUword open_head_completed, /* ...while this many IDs were completed */
+          memlimit, /* 0 if unlimited */
+          memused,
+          spill_threshold,
+          spill_end,
+          nof_spilled,
+          nof_flushed; /* nodes in front of <pending> to return unchecked */
+  FILE *spill_fp;
+  GtHashmap *spilled; /* the markers in <pending> for spilled graphs */
+  /* chunked parsing */
+  GtArray *chunk_ids; /* of a chunk parser: the IDs defined in its chunk */
+  GtHashmap *merged_ids; /* the IDs of merged chunks since the terminator on
+                            line <merged_ids_terminator> */
+  unsigned int merged_ids_terminator;
 };
 
+/* an ID defined in a chunk, chunks split at sequence ID changes have to be
+   checked for IDs used on both sides of the split */
+typedef struct {
+  char *id,
+       *seqid;
+  unsigned int line_number,
+               last_terminator; /* of the line defining <id> */
+} GFF3ChunkID;
+
+static void gff3_chunk_id_delete(GFF3ChunkID *chunk_id)
+{
+  if (!chunk_id) return;
+  gt_free(chunk_id->id);
+  gt_free(chunk_id->seqid);
+  gt_free(chunk_id);
+}
+
+static void gff3_parser_clear_chunk_ids(GtGFF3Parser *parser)
+{
+  GtUword i;
+  if (!parser->chunk_ids) return;
+  for (i = 0; i < gt_array_size(parser->chunk_ids); i++) {
+    gff3_chunk_id_delete(*(GFF3ChunkID**) gt_array_get(parser->chunk_ids, i));
+  }
+  gt_array_reset(parser->chunk_ids);
+}
+
+/* in streaming mode, complete graphs waiting behind an incomplete one are
+   written to a temporary file and replaced by such a marker in the queue */
+typedef struct {
+  GtWord offset;
+} GFF3SpilledGraph;
+
+/* approximate memory occupied by a feature node without attributes */
+#define GFF3_PARSER_NODE_SIZE  256
+
 typedef struct {
   GtStr *seqid_str;
   GtRange range;
@@ -110,6 +172,8 @@ GtGFF3Parser* gt_gff3_parser_new(GtTypeChecker *type_checker)
   parser->type_checker = type_checker ? gt_type_checker_ref(type_checker)
                                       : NULL;
   parser->xrf_checker = NULL;
+  parser->pending = gt_queue_new();
+  parser->spilled = gt_hashmap_new(GT_HASH_DIRECT, NULL, gt_free_func);
   return parser;
 }
 
@@ -121,6 +185,22 @@ void gt_gff3_parser_set_xrf_checker(GtGFF3Parser *parser,
   parser->xrf_checker = gt_xrf_checker_ref(xrf_checker);
 }
 
+void gt_gff3_parser_set_node_arena(GtGFF3Parser *parser,
+                                   GtNodeArena *node_arena)
+{
+  gt_assert(parser && node_arena);
+  gt_node_arena_delete(parser->node_arena);
+  parser->node_arena = gt_node_arena_ref(node_arena);
+}
+
+void gt_gff3_parser_enable_streaming(GtGFF3Parser *parser, GtUword memlimit)
+{
+  gt_assert(parser);
+  parser->streaming = true;
+  parser->memlimit = memlimit;
+  parser->spill_threshold = memlimit;
+}
+
 void gt_gff3_parser_check_id_attributes(GtGFF3Parser *parser)
 {
   gt_assert(parser);
@@ -584,10 +664,22 @@ static int process_id_attr(const char *id, GtFeatureNode *feature_node,
     gt_feature_info_add(parser->feature_info, id, feature_node);
     if (!parser->strict)
       gt_orphanage_reg_parent(parser->orphanage, id);
+    if (parser->chunk_ids) {
+      GFF3ChunkID *chunk_id = gt_malloc(sizeof *chunk_id);
+      chunk_id->id = gt_cstr_dup(id);
+      chunk_id->seqid = gt_cstr_dup(gt_str_get(gt_genome_node_get_seqid(
+                                              (GtGenomeNode*) feature_node)));
+      chunk_id->line_number = line_number;
+      chunk_id->last_terminator = parser->last_terminator;
+      gt_array_add(parser->chunk_ids, chunk_id);
+    }
   }
 
-  if (!had_err)
+  if (!had_err) {
     parser->incomplete_node = true;
+    if (parser->references)
+      (void) gt_gff3_references_use(parser->references, id);
+  }
 
   return had_err;
 }
@@ -721,7 +813,8 @@ static void join_roots(GtArray *roots, GtFeatureInfo *feature_info,
 static int process_child(GtGenomeNode *child, GtSplitter *parent_splitter,
                          GtFeatureInfo *feature_info, bool strict,
                          unsigned int last_terminator,
-                         GtTypeChecker *type_checker, GtQueue *genome_nodes,
+                         GtTypeChecker *type_checker,
+                         GtGFF3References *references, GtQueue *genome_nodes,
                          GtError *err)
 {
   GtStrArray *valid_parents;
@@ -790,6 +883,8 @@ static int process_child(GtGenomeNode *child, GtSplitter *parent_splitter,
       gt_feature_node_add_child((GtFeatureNode*) parent_gf,
                                 (GtFeatureNode*) child);
       gt_str_array_add_cstr(valid_parents, parent);
+      if (references)
+        (void) gt_gff3_references_use(references, parent);
     }
   }
   if (!had_err) {
@@ -874,7 +969,7 @@ static int process_parent_attr(char *parent_attr, GtGenomeNode *feature_node,
       had_err = process_child(feature_node, parent_splitter,
                               parser->feature_info, parser->strict,
                               parser->last_terminator, parser->type_checker,
-                              genome_nodes, err);
+                              parser->references, genome_nodes, err);
     }
     else {
       gt_assert(!parser->strict);
@@ -1474,6 +1569,21 @@ static void set_source(GtFeatureNode *feature_node, const char *source,
   gt_feature_node_set_source(feature_node, source_str);
 }
 
+static void add_attribute_size(const char *attr_name, const char *attr_value,
+                               void *data)
+{
+  GtUword *size = data;
+  *size += strlen(attr_name) + strlen(attr_value) + 2;
+}
+
+/* Return the approximate amount of memory occupied by <fn> itself. */
+static GtUword feature_node_size(GtFeatureNode *fn)
+{
+  GtUword size = GFF3_PARSER_NODE_SIZE;
+  gt_feature_node_foreach_attribute(fn, add_attribute_size, &size);
+  return size;
+}
+
 void chomp_seqid(char *seqid, const char *filename, unsigned int line_number)
 {
   GtUword len;
@@ -1614,8 +1724,15 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   /* create the feature */
   if (!had_err) {
-    feature_node = gt_feature_node_new(seqid_str, type, range.start, range.end,
-                                       gt_strand_value);
+    if (parser->node_arena) {
+      feature_node = gt_feature_node_new_in_arena(parser->node_arena,
+                                                  seqid_str, type, range.start,
+                                                  range.end, gt_strand_value);
+    }
+    else {
+      feature_node = gt_feature_node_new(seqid_str, type, range.start,
+                                         range.end, gt_strand_value);
+    }
     gt_genome_node_set_origin(feature_node, filenamestr, line_number);
   }
 
@@ -1631,6 +1748,9 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
                                seqid, genome_nodes, filename, line_number, err);
   }
 
+  if (!had_err && parser->references && parser->memlimit)
+    parser->memused += feature_node_size((GtFeatureNode*) feature_node);
+
   if (!had_err && score_is_defined)
     gt_feature_node_set_score((GtFeatureNode*) feature_node, score_value);
   if (!had_err && phase_value != GT_PHASE_UNDEFINED)
@@ -1763,7 +1883,8 @@ static int gff3_parser_parse_fasta_entry(GtQueue *genome_nodes,
 
 static int process_orphans(GtOrphanage *orphanage, GtFeatureInfo *feature_info,
                            bool strict, unsigned int last_terminator,
-                           GtTypeChecker *type_checker, GtQueue *genome_nodes,
+                           GtTypeChecker *type_checker,
+                           GtGFF3References *references, GtQueue *genome_nodes,
                            GtError *err)
 {
   GtGenomeNode *orphan;
@@ -1796,7 +1917,8 @@ static int process_orphans(GtOrphanage *orphanage, GtFeatureInfo *feature_info,
     }
     if (!had_err) {
       had_err = process_child(orphan, splitter, feature_info, strict,
-                              last_terminator, type_checker, genome_nodes, err);
+                              last_terminator, type_checker, references,
+                              genome_nodes, err);
     }
     gt_splitter_delete(splitter);
     gt_free(parent_attr_dup);
@@ -2012,7 +2134,8 @@ static int parse_meta_gff3_line(GtGFF3Parser *parser, GtQueue *genome_nodes,
     if (!parser->strict) {
       had_err = process_orphans(parser->orphanage, parser->feature_info,
                                 parser->strict, parser->last_terminator,
-                                parser->type_checker, genome_nodes, err);
+                                parser->type_checker, parser->references,
+                                genome_nodes, err);
     }
     parser->incomplete_node = false;
     if (!parser->checkids)
@@ -2102,6 +2225,262 @@ static int parse_meta_gff3_line(GtGFF3Parser *parser, GtQueue *genome_nodes,
   return had_err;
 }
 
+/* Parse a single <line> which is not the first line of a file. Sets <stop> if
+   the caller should return the nodes collected in <genome_nodes> so far. */
+static int gff3_parser_parse_line(GtGFF3Parser *parser, GtQueue *genome_nodes,
+                                  GtCstrTable *used_types, char *line,
+                                  size_t line_length, GtStr *filenamestr,
+                                  GtUint64 line_number, GtFile *fpin,
+                                  bool *stop, GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  *stop = false;
+  if (line_length == 0) {
+    gt_warning("skipping blank line "GT_LLU" in file \"%s\"", line_number,
+               gt_str_get(filenamestr));
+  }
+  else if (parser->fasta_parsing || line[0] == '>') {
+    parser->fasta_parsing = true;
+    had_err = gff3_parser_parse_fasta_entry(genome_nodes, line, filenamestr,
+                                            line_number, fpin, err);
+    *stop = true;
+  }
+  else if (line[0] == '#') {
+    had_err = parse_meta_gff3_line(parser, genome_nodes, line, line_length,
+                                   filenamestr, line_number, err);
+    if (had_err || (!parser->incomplete_node && gt_queue_size(genome_nodes)))
+      *stop = true;
+  }
+  else {
+    had_err = parse_gff3_feature_line(parser, genome_nodes, used_types, line,
+                                      line_length, filenamestr, line_number,
+                                      err);
+    if (had_err || (!parser->incomplete_node && gt_queue_size(genome_nodes)))
+      *stop = true;
+  }
+  return had_err;
+}
+
+/* Returns <true> if no line after the current one can add to the graph of
+   <gn>, that is, if all occurrences of the IDs in it have been seen. */
+static bool gff3_parser_graph_is_complete(const GtGFF3Parser *parser,
+                                          GtGenomeNode *gn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *fn;
+  const char *id;
+  bool complete = true;
+  gt_assert(parser->references);
+  if (!(fn = gt_feature_node_try_cast(gn)))
+    return true;
+  fni = gt_feature_node_iterator_new(fn);
+  while (complete && (fn = gt_feature_node_iterator_next(fni))) {
+    if ((id = gt_feature_node_get_attribute(fn, GT_GFF_ID)) &&
+        gt_gff3_references_outstanding(parser->references, id)) {
+      complete = false;
+    }
+  }
+  gt_feature_node_iterator_delete(fni);
+  return complete;
+}
+
+/* Remove the IDs of the complete graph <gn> from the parser state. */
+static void gff3_parser_forget_graph(GtGFF3Parser *parser, GtGenomeNode *gn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *fn;
+  const char *id;
+  GtUword size;
+  if (!(fn = gt_feature_node_try_cast(gn)))
+    return;
+  fni = gt_feature_node_iterator_new(fn);
+  while ((fn = gt_feature_node_iterator_next(fni))) {
+    if ((id = gt_feature_node_get_attribute(fn, GT_GFF_ID)))
+      gt_feature_info_remove(parser->feature_info, id);
+    if (parser->memlimit) {
+      size = feature_node_size(fn);
+      parser->memused -= MIN(size, parser->memused);
+    }
+  }
+  gt_feature_node_iterator_delete(fni);
+}
+
+static int spill_complete_graph(void **elem, void *info, GtError *err)
+{
+  GtGFF3Parser *parser = info;
+  GtGenomeNodeWriter *writer;
+  GFF3SpilledGraph *spilled_graph;
+  GtGenomeNode *gn = *elem;
+  int had_err;
+  gt_error_check(err);
+  /* the head is incomplete, otherwise it would have been delivered */
+  if (gn == gt_queue_head(parser->pending) ||
+      gt_hashmap_get(parser->spilled, gn) ||
+      !gff3_parser_graph_is_complete(parser, gn)) {
+    return 0;
+  }
+  if (!parser->spill_fp) {
+    parser->spill_fp = gt_xtmpfp_generic(NULL, TMPFP_OPENBINARY |
+                                               TMPFP_AUTOREMOVE);
+  }
+  spilled_graph = gt_malloc(sizeof *spilled_graph);
+  spilled_graph->offset = (GtWord) parser->spill_end;
+  gt_xfseek(parser->spill_fp, spilled_graph->offset, SEEK_SET);
+  writer = gt_genome_node_writer_new(parser->spill_fp);
+  had_err = gt_genome_node_writer_write(writer, gn, err);
+  parser->spill_end += gt_genome_node_writer_bytes(writer);
+  gt_genome_node_writer_delete(writer);
+  gt_hashmap_add(parser->spilled, spilled_graph, spilled_graph);
+  parser->nof_spilled++;
+  gff3_parser_forget_graph(parser, gn);
+  gt_genome_node_delete(gn);
+  *elem = spilled_graph;
+  return had_err;
+}
+
+/* Write the complete graphs in the pending queue to the spill file. */
+static int gff3_parser_spill(GtGFF3Parser *parser, GtError *err)
+{
+  int had_err;
+  gt_error_check(err);
+  had_err = gt_queue_iterate(parser->pending, spill_complete_graph, parser,
+                             err);
+  /* avoid rescanning the queue for every line if it cannot be shrunk */
+  if (parser->memused > parser->memlimit)
+    parser->spill_threshold = parser->memused + parser->memlimit;
+  else
+    parser->spill_threshold = parser->memlimit;
+  return had_err;
+}
+
+static int gff3_parser_read_spilled_graph(GtGFF3Parser *parser,
+                                          GFF3SpilledGraph *spilled_graph,
+                                          GtGenomeNode **gn, GtError *err)
+{
+  GtGenomeNodeReader *reader;
+  int had_err;
+  gt_error_check(err);
+  gt_xfseek(parser->spill_fp, spilled_graph->offset, SEEK_SET);
+  reader = gt_genome_node_reader_new(parser->spill_fp);
+  had_err = gt_genome_node_reader_read(reader, gn, err);
+  gt_genome_node_reader_delete(reader);
+  if (!had_err && !*gn) {
+    gt_error_set(err, "unexpected end of temporary GFF3 parser file");
+    had_err = -1;
+  }
+  gt_hashmap_remove(parser->spilled, spilled_graph);
+  if (!--parser->nof_spilled)
+    parser->spill_end = 0; /* reuse the spill file */
+  return had_err;
+}
+
+/* Move the nodes at the front of the pending queue whose graphs are complete
+   (all of them if <flush> is <true>) to <genome_nodes>. Spilled graphs are
+   only read back one at a time, that is, if <genome_nodes> is empty. */
+static int gff3_parser_deliver_nodes(GtGFF3Parser *parser,
+                                     GtQueue *genome_nodes, bool flush,
+                                     GtError *err)
+{
+  GtGenomeNode *gn;
+  GFF3SpilledGraph *spilled_graph;
+  GtUword completed;
+  int had_err = 0;
+  gt_error_check(err);
+
+  /* adopt the orphans as soon as all their parents are known */
+  if (!parser->strict && gt_orphanage_has_orphans(parser->orphanage) &&
+      !gt_orphanage_has_missing_parents(parser->orphanage)) {
+    had_err = process_orphans(parser->orphanage, parser->feature_info,
+                              parser->strict, parser->last_terminator,
+                              parser->type_checker, parser->references,
+                              parser->pending, err);
+    if (!had_err)
+      gt_orphanage_reset(parser->orphanage);
+  }
+  if (flush)
+    parser->nof_flushed = gt_queue_size(parser->pending);
+
+  completed = gt_gff3_references_completed(parser->references);
+  while (!had_err && gt_queue_size(parser->pending)) {
+    gn = gt_queue_head(parser->pending);
+    if ((spilled_graph = gt_hashmap_get(parser->spilled, gn))) {
+      if (gt_queue_size(genome_nodes))
+        break;
+      (void) gt_queue_get(parser->pending);
+      if (parser->nof_flushed)
+        parser->nof_flushed--;
+      had_err = gff3_parser_read_spilled_graph(parser, spilled_graph, &gn,
+                                               err);
+      if (!had_err)
+        gt_queue_add(genome_nodes, gn);
+      continue;
+    }
+    if (!parser->nof_flushed) {
+      /* a graph can only become complete when the last occurrence of one of
+         its IDs has been seen */
+      if (gn == parser->open_head && completed == parser->open_head_completed)
+        break;
+      if (!gff3_parser_graph_is_complete(parser, gn)) {
+        parser->open_head = gn;
+        parser->open_head_completed = completed;
+        break;
+      }
+    }
+    (void) gt_queue_get(parser->pending);
+    if (parser->nof_flushed)
+      parser->nof_flushed--;
+    parser->open_head = NULL;
+    gff3_parser_forget_graph(parser, gn);
+    gt_queue_add(genome_nodes, gn);
+  }
+
+  if (!had_err && parser->memlimit &&
+      parser->memused > parser->spill_threshold) {
+    had_err = gff3_parser_spill(parser, err);
+  }
+  return had_err;
+}
+
+static void gff3_parser_clear_pending(GtGFF3Parser *parser)
+{
+  GtGenomeNode *gn;
+  while (gt_queue_size(parser->pending)) {
+    gn = gt_queue_get(parser->pending);
+    if (!gt_hashmap_get(parser->spilled, gn))
+      gt_genome_node_delete(gn);
+  }
+  gt_hashmap_reset(parser->spilled);
+  parser->nof_spilled = 0;
+  parser->nof_flushed = 0;
+  parser->open_head = NULL;
+  parser->memused = 0;
+  parser->spill_threshold = parser->memlimit;
+  parser->spill_end = 0;
+}
+
+/* Count the references in the file <filename> just opened as <fpin>, so that
+   it can be parsed in streaming mode. */
+static int gff3_parser_start_streaming(GtGFF3Parser *parser, GtFile *fpin,
+                                       const char *filename, GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(!parser->references);
+  if (!fpin || !strcmp(filename, "-")) {
+    gt_warning("GFF3 input from stdin cannot be read twice, it is not parsed "
+               "in streaming mode");
+    return 0;
+  }
+  parser->references = gt_gff3_references_new();
+  had_err = gt_gff3_references_count_file(parser->references, filename, err);
+  if (had_err) {
+    gt_gff3_references_delete(parser->references);
+    parser->references = NULL;
+  }
+  return had_err;
+}
+
 int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
                                       GtQueue *genome_nodes,
                                       GtCstrTable *used_types,
@@ -2111,19 +2490,36 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
 {
   size_t line_length;
   GtStr *line_buffer;
+  GtQueue *queue;
   char *line;
   const char *filename;
-  int rval, had_err = 0;
+  bool stop = false;
+  int rval = 0, had_err = 0;
 
   gt_error_check(err);
   gt_assert(status_code && genome_nodes && used_types);
 
   filename = gt_str_get(filenamestr);
 
+  /* ID checking needs all IDs of the file */
+  if (parser->streaming && !parser->checkids && *line_number == 0 &&
+      !parser->references) {
+    had_err = gff3_parser_start_streaming(parser, fpin, filename, err);
+  }
+  /* in streaming mode, nodes are collected until their graphs are complete */
+  queue = parser->references ? parser->pending : genome_nodes;
+  if (!had_err && parser->references) {
+    /* return the spilled or flushed graphs left over from the last call
+       before reading on */
+    had_err = gff3_parser_deliver_nodes(parser, genome_nodes, false, err);
+    stop = gt_queue_size(genome_nodes) > 0;
+  }
+
   /* init */
   line_buffer = gt_str_new();
 
-  while ((rval = gt_str_read_next_line_generic(line_buffer, fpin)) != EOF) {
+  while (!had_err && !stop &&
+         (rval = gt_str_read_next_line_generic(line_buffer, fpin)) != EOF) {
     line = gt_str_get(line_buffer);
     line_length = gt_str_length(line_buffer);
     (*line_number)++;
@@ -2141,31 +2537,19 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
       }
       gt_assert(had_err == 0); /* line not processed */
     }
-    if (line_length == 0) {
-      gt_warning("skipping blank line "GT_LLU" in file \"%s\"", *line_number,
-                 filename);
-    }
-    else if (parser->fasta_parsing || line[0] == '>') {
-      parser->fasta_parsing = true;
-      had_err = gff3_parser_parse_fasta_entry(genome_nodes, line, filenamestr,
-                                              *line_number, fpin, err);
+    had_err = gff3_parser_parse_line(parser, queue, used_types, line,
+                                     line_length, filenamestr, *line_number,
+                                     fpin, &stop, err);
+    if (!had_err && parser->references) {
+      /* after a terminator or at the start of the FASTA section all nodes
+         are complete */
+      had_err = gff3_parser_deliver_nodes(parser, genome_nodes,
+                                          !parser->incomplete_node ||
+                                          parser->fasta_parsing, err);
+      stop = had_err || gt_queue_size(genome_nodes);
+    }
+    if (stop)
       break;
-    }
-    else if (line[0] == '#') {
-      had_err = parse_meta_gff3_line(parser, genome_nodes, line, line_length,
-                                     filenamestr, *line_number, err);
-      if (had_err ||
-          (!parser->incomplete_node && gt_queue_size(genome_nodes))) {
-        break;
-      }
-    }
-    else {
-      had_err = parse_gff3_feature_line(parser, genome_nodes, used_types, line,
-                                        line_length, filenamestr, *line_number,
-                                        err);
-      if (had_err || (!parser->incomplete_node && gt_queue_size(genome_nodes)))
-        break;
-    }
     gt_str_reset(line_buffer);
   }
 
@@ -2178,17 +2562,22 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
     }
   }
 
-  if (!had_err && !parser->strict) {
+  /* streamed files can contain orphans of later lines until the end */
+  if (!had_err && !parser->strict && (!parser->references || rval == EOF)) {
     had_err = process_orphans(parser->orphanage, parser->feature_info,
                               parser->strict, parser->last_terminator,
-                              parser->type_checker, genome_nodes, err);
+                              parser->type_checker, parser->references, queue,
+                              err);
   }
+  if (!had_err && rval == EOF && parser->references)
+    had_err = gff3_parser_deliver_nodes(parser, genome_nodes, true, err);
 
   if (had_err) {
     while (gt_queue_size(genome_nodes))
       gt_genome_node_delete(gt_queue_get(genome_nodes));
   }
-  else if (rval == EOF && !parser->eof_emitted) {
+  else if (rval == EOF && !parser->eof_emitted &&
+           !(parser->references && gt_queue_size(parser->pending))) {
     GtGenomeNode *eofn = gt_eof_node_new();
     gt_genome_node_set_origin(eofn, filenamestr, *line_number+1);
     gt_queue_add(genome_nodes, eofn);
@@ -2203,6 +2592,201 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
   return had_err;
 }
 
+bool gt_gff3_parser_supports_chunks(const GtGFF3Parser *parser)
+{
+  gt_assert(parser);
+  /* ID checking spans the whole file and offset files are mapped via Lua,
+     both cannot be used from independent workers */
+  return !parser->checkids && !parser->offset_mapping && !parser->streaming;
+}
+
+static int copy_sequence_region(void *key, void *value, void *data,
+                                GT_UNUSED GtError *err)
+{
+  SimpleSequenceRegion *ssr = value, *copy;
+  GtHashmap *seqid_to_ssr_mapping = data;
+  gt_assert(key && ssr && seqid_to_ssr_mapping);
+  copy = simple_sequence_region_new(gt_str_get(ssr->seqid_str), ssr->range,
+                                    ssr->line_number);
+  copy->pseudo = ssr->pseudo;
+  copy->is_circular = ssr->is_circular;
+  gt_hashmap_add(seqid_to_ssr_mapping, gt_str_get(copy->seqid_str), copy);
+  return 0;
+}
+
+GtGFF3Parser* gt_gff3_parser_new_chunk_parser(const GtGFF3Parser *parser,
+                                              unsigned int last_terminator)
+{
+  GtGFF3Parser *chunk_parser;
+  gt_assert(parser && gt_gff3_parser_supports_chunks(parser));
+  chunk_parser = gt_gff3_parser_new(parser->type_checker);
+  chunk_parser->checkregions = parser->checkregions;
+  chunk_parser->strict = parser->strict;
+  chunk_parser->tidy = parser->tidy;
+  chunk_parser->gvf_mode = parser->gvf_mode;
+  chunk_parser->offset = parser->offset;
+  chunk_parser->last_terminator = last_terminator;
+  chunk_parser->chunk_ids = gt_array_new(sizeof (GFF3ChunkID*));
+  if (parser->xrf_checker)
+    chunk_parser->xrf_checker = gt_xrf_checker_ref(parser->xrf_checker);
+  /* arenas cannot be allocated from concurrently, use a separate one */
+  if (parser->node_arena)
+    chunk_parser->node_arena = gt_node_arena_new();
+  /* deep copy, the sequence ids must not be shared between threads */
+  (void) gt_hashmap_foreach(parser->seqid_to_ssr_mapping, copy_sequence_region,
+                            chunk_parser->seqid_to_ssr_mapping, NULL);
+  return chunk_parser;
+}
+
+int gt_gff3_parser_parse_chunk(GtGFF3Parser *chunk_parser,
+                               GtQueue *genome_nodes,
+                               GtCstrTable *used_types,
+                               GtStr *filenamestr,
+                               char *chunk, GtUword chunk_length,
+                               GtUint64 line_number,
+                               GtError *err)
+{
+  char *line = chunk, *chunk_end = chunk + chunk_length, *line_end;
+  bool stop;
+  int had_err = 0;
+
+  gt_error_check(err);
+  gt_assert(chunk_parser && genome_nodes && used_types && chunk);
+
+  for (; !had_err && line < chunk_end; line = line_end + 1, line_number++) {
+    line_end = memchr(line, '\n', (size_t) (chunk_end - line));
+    gt_assert(line_end != NULL);
+    *line_end = '\0';
+    if (line_number == 1) {
+      had_err = parse_first_gff3_line(line, gt_str_get(filenamestr),
+                                      genome_nodes, filenamestr, &line_number,
+                                      &chunk_parser->gvf_mode,
+                                      chunk_parser->tidy, err);
+      if (had_err == 1) {
+        had_err = 0;
+        continue;
+      }
+      if (had_err)
+        break;
+    }
+    had_err = gff3_parser_parse_line(chunk_parser, genome_nodes, used_types,
+                                     line, (size_t) (line_end - line),
+                                     filenamestr, line_number, NULL, &stop,
+                                     err);
+    /* FASTA sections are never part of a chunk */
+    gt_assert(!chunk_parser->fasta_parsing);
+  }
+
+  /* the end of a chunk is a terminator */
+  if (!had_err && !chunk_parser->strict) {
+    had_err = process_orphans(chunk_parser->orphanage,
+                              chunk_parser->feature_info,
+                              chunk_parser->strict,
+                              chunk_parser->last_terminator,
+                              chunk_parser->type_checker, NULL, genome_nodes,
+                              err);
+  }
+  return had_err;
+}
+
+static int merge_sequence_region(void *key, void *value, void *data,
+                                 GT_UNUSED GtError *err)
+{
+  SimpleSequenceRegion *ssr = value, *target;
+  GtHashmap *seqid_to_ssr_mapping = data;
+  gt_assert(key && ssr && seqid_to_ssr_mapping);
+  if (ssr->pseudo && !ssr->is_circular)
+    return 0;
+  if ((target = gt_hashmap_get(seqid_to_ssr_mapping, key))) {
+    if (!ssr->pseudo) {
+      target->range = ssr->range;
+      target->line_number = ssr->line_number;
+      target->pseudo = false;
+    }
+    target->is_circular = target->is_circular || ssr->is_circular;
+  }
+  else
+    (void) copy_sequence_region(key, value, data, NULL);
+  return 0;
+}
+
+/* Sequential parsing forgets IDs only at terminators, so an ID defined in
+   a chunk which was also defined in a preceding chunk since the last
+   terminator refers to a multi-feature spanning a sequence ID change. */
+static int gff3_parser_check_chunk_ids(GtGFF3Parser *parser,
+                                       GtGFF3Parser *chunk_parser,
+                                       const char *filename, GtError *err)
+{
+  GtUword i;
+  int had_err = 0;
+
+  gt_error_check(err);
+  if (!parser->merged_ids) {
+    parser->merged_ids = gt_hashmap_new(GT_HASH_STRING, NULL,
+                                        (GtFree) gff3_chunk_id_delete);
+  }
+  for (i = 0; !had_err && i < gt_array_size(chunk_parser->chunk_ids); i++) {
+    GFF3ChunkID **chunk_id = gt_array_get(chunk_parser->chunk_ids, i),
+                *counterpart;
+    if ((*chunk_id)->last_terminator > parser->merged_ids_terminator) {
+      gt_hashmap_reset(parser->merged_ids);
+      parser->merged_ids_terminator = (*chunk_id)->last_terminator;
+    }
+    if ((counterpart = gt_hashmap_get(parser->merged_ids, (*chunk_id)->id))) {
+      if (strcmp(counterpart->seqid, (*chunk_id)->seqid)) {
+        gt_error_set(err, "the multi-feature with %s \"%s\" on line %u in "
+                     "file \"%s\" has a different sequence id than its "
+                     "counterpart on line %u", GT_GFF_ID, (*chunk_id)->id,
+                     (*chunk_id)->line_number, filename,
+                     counterpart->line_number);
+        had_err = -1;
+      }
+    }
+    else {
+      gt_hashmap_add(parser->merged_ids, (*chunk_id)->id, *chunk_id);
+      *chunk_id = NULL;
+    }
+  }
+  if (chunk_parser->last_terminator > parser->merged_ids_terminator) {
+    gt_hashmap_reset(parser->merged_ids);
+    parser->merged_ids_terminator = chunk_parser->last_terminator;
+  }
+  gff3_parser_clear_chunk_ids(chunk_parser);
+  return had_err;
+}
+
+int gt_gff3_parser_merge_chunk_parser(GtGFF3Parser *parser,
+                                      GtGFF3Parser *chunk_parser,
+                                      const char *filename, GtError *err)
+{
+  gt_error_check(err);
+  gt_assert(parser && chunk_parser && chunk_parser->chunk_ids && filename);
+  if (gff3_parser_check_chunk_ids(parser, chunk_parser, filename, err))
+    return -1;
+  (void) gt_hashmap_foreach(chunk_parser->seqid_to_ssr_mapping,
+                            merge_sequence_region,
+                            parser->seqid_to_ssr_mapping, NULL);
+  if (chunk_parser->gvf_mode)
+    parser->gvf_mode = true;
+  if (chunk_parser->last_terminator > parser->last_terminator)
+    parser->last_terminator = chunk_parser->last_terminator;
+  return 0;
+}
+
+int gt_gff3_parser_parse_fasta_start(GtGFF3Parser *parser,
+                                     GtQueue *genome_nodes, char *line,
+                                     GtStr *filenamestr, GtUint64 line_number,
+                                     GtFile *fpin, GtError *err)
+{
+  gt_error_check(err);
+  gt_assert(parser && genome_nodes && line);
+  parser->fasta_parsing = true;
+  if (strcmp(line, GT_GFF_FASTA_DIRECTIVE) == 0)
+    return 0;
+  return gff3_parser_parse_fasta_entry(genome_nodes, line, filenamestr,
+                                       line_number, fpin, err);
+}
+
 void gt_gff3_parser_reset(GtGFF3Parser *parser)
 {
   gt_assert(parser);
@@ -2213,6 +2797,12 @@ void gt_gff3_parser_reset(GtGFF3Parser *parser)
   gt_hashmap_reset(parser->source_to_str_mapping);
   gt_orphanage_reset(parser->orphanage);
   parser->last_terminator = 0;
+  if (parser->merged_ids)
+    gt_hashmap_reset(parser->merged_ids);
+  parser->merged_ids_terminator = 0;
+  gff3_parser_clear_pending(parser);
+  gt_gff3_references_delete(parser->references);
+  parser->references = NULL;
 }
 
 void gt_gff3_parser_delete(GtGFF3Parser *parser)
@@ -2225,5 +2815,15 @@ void gt_gff3_parser_delete(GtGFF3Parser *parser)
   gt_orphanage_delete(parser->orphanage);
   gt_type_checker_delete(parser->type_checker);
   gt_xrf_checker_delete(parser->xrf_checker);
+  gt_node_arena_delete(parser->node_arena);
+  gff3_parser_clear_pending(parser);
+  gt_queue_delete(parser->pending);
+  gt_hashmap_delete(parser->spilled);
+  gt_gff3_references_delete(parser->references);
+  if (parser->spill_fp)
+    gt_fa_xfclose(parser->spill_fp);
+  gff3_parser_clear_chunk_ids(parser);
+  gt_array_delete(parser->chunk_ids);
+  gt_hashmap_delete(parser->merged_ids);
   gt_free(parser);
 }
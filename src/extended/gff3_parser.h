@@ -19,8 +19,21 @@
 #define GFF3_PARSER_H
 
 #include "extended/gff3_parser_api.h"
+#include "extended/node_arena.h"
 
 void gt_gff3_parser_enable_strict_mode(GtGFF3Parser*);
+/* Enable streaming mode for <parser>: before a file is parsed, the
+   occurrences of all its IDs are counted (see <GtGFF3References>), so that
+   feature graphs can be returned as soon as they are complete instead of
+   waiting for the next terminator ("###") or the end of the file. The nodes
+   are returned in the same order as without streaming. Complete graphs waiting
+   behind incomplete ones are written to a temporary file once more than about
+   <memlimit> bytes are occupied by buffered nodes (0 means unlimited).
+   Streaming requires files which can be read twice and is not used for stdin
+   or when ID attributes are checked. */
+void gt_gff3_parser_enable_streaming(GtGFF3Parser*, GtUword memlimit);
+/* Allocate the feature nodes created by <parser> from <node_arena>. */
+void gt_gff3_parser_set_node_arena(GtGFF3Parser*, GtNodeArena *node_arena);
 int  gt_gff3_parser_set_offsetfile(GtGFF3Parser*, GtStr*, GtError*);
 int  gt_gff3_parser_parse_target_attributes(const char *values,
                                             GtUword *num_of_targets,
@@ -40,4 +53,42 @@ void gt_gff3_parser_build_target_str(GtStr *target, GtStrArray *target_ids,
                                      GtArray *target_ranges,
                                      GtArray *target_strands);
 
+/* Chunked parsing: the lines of a GFF3 file are split into chunks which end at
+   terminators ("###"), or at sequence ID changes in sorted files, and each
+   chunk is parsed by its own chunk parser (possibly in a separate thread).
+   Returns <true> if <parser> is configured such that chunks can be parsed
+   independently of each other. */
+bool          gt_gff3_parser_supports_chunks(const GtGFF3Parser *parser);
+/* Return a new parser with the settings and the sequence regions known to
+   <parser>, for parsing a chunk which follows the terminator on line
+   <last_terminator>. */
+GtGFF3Parser* gt_gff3_parser_new_chunk_parser(const GtGFF3Parser *parser,
+                                              unsigned int last_terminator);
+/* Parse the <chunk_length> many characters of <chunk> (newline separated
+   lines, the first of which has number <line_number>) with <chunk_parser> and
+   add all resulting nodes to <genome_nodes>. The end of the chunk is treated
+   like a terminator. <chunk> is modified. */
+int           gt_gff3_parser_parse_chunk(GtGFF3Parser *chunk_parser,
+                                         GtQueue *genome_nodes,
+                                         GtCstrTable *used_types,
+                                         GtStr *filenamestr,
+                                         char *chunk, GtUword chunk_length,
+                                         GtUint64 line_number,
+                                         GtError *err);
+/* Make the sequence regions defined in the chunk parsed by <chunk_parser>
+   known to <parser>. Chunk parsers must be merged in input order. Returns -1
+   and sets <err> if an ID defined in the chunk of file <filename> has been
+   defined in a preceding chunk since the last terminator, 0 otherwise. */
+int           gt_gff3_parser_merge_chunk_parser(GtGFF3Parser *parser,
+                                                GtGFF3Parser *chunk_parser,
+                                                const char *filename,
+                                                GtError *err);
+/* Let <parser> process <line> on <line_number>, which starts the FASTA section
+   of the file <fpin> (it is either a FASTA directive or a FASTA header). */
+int           gt_gff3_parser_parse_fasta_start(GtGFF3Parser *parser,
+                                               GtQueue *genome_nodes,
+                                               char *line, GtStr *filenamestr,
+                                               GtUint64 line_number,
+                                               GtFile *fpin, GtError *err);
+
 #endif
@@ -0,0 +1,267 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <string.h>
+#include "core/cstr_api.h"
+#include "core/ensure.h"
+#include "core/fa.h"
+#include "core/file.h"
+#include "core/hashmap_api.h"
+#include "core/ma.h"
+#include "core/str_api.h"
+#include "core/xansi_api.h"
+#include "extended/gff3_defines.h"
+#include "extended/gff3_references.h"
+
+struct GtGFF3References {
+  GtHashmap *counts; /* maps unescaped IDs to outstanding occurrences */
+  GtStr *id;         /* buffer for unescaping */
+  GtUword completed;
+};
+
+GtGFF3References* gt_gff3_references_new(void)
+{
+  GtGFF3References *refs = gt_malloc(sizeof *refs);
+  refs->counts = gt_hashmap_new(GT_HASH_STRING, gt_free_func, gt_free_func);
+  refs->id = gt_str_new();
+  refs->completed = 0;
+  return refs;
+}
+
+static int gff3_references_hexdigit(char c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+/* Unescape the first <len> characters of <id> into the buffer of <refs>, so
+   that different escapings of the same ID share one counter. Invalid escapes
+   are kept as they are. */
+static const char* gff3_references_unescape(GtGFF3References *refs,
+                                            const char *id, size_t len)
+{
+  size_t i;
+  gt_str_reset(refs->id);
+  for (i = 0; i < len; i++) {
+    char c = id[i];
+    int high, low;
+    if (c == '%' && i + 2 < len &&
+        (high = gff3_references_hexdigit(id[i+1])) >= 0 &&
+        (low = gff3_references_hexdigit(id[i+2])) >= 0) {
+      c = (char) (high * 16 + low);
+      i += 2;
+    }
+    gt_str_append_char(refs->id, c);
+  }
+  return gt_str_get(refs->id);
+}
+
+static void gff3_references_add_id(GtGFF3References *refs, const char *id,
+                                   size_t len)
+{
+  GtUword *count;
+  id = gff3_references_unescape(refs, id, len);
+  if ((count = gt_hashmap_get(refs->counts, id)))
+    (*count)++;
+  else {
+    count = gt_malloc(sizeof *count);
+    *count = 1;
+    gt_hashmap_add(refs->counts, gt_cstr_dup(id), count);
+  }
+}
+
+void gt_gff3_references_add(GtGFF3References *refs, const char *id)
+{
+  gt_assert(refs && id);
+  gff3_references_add_id(refs, id, strlen(id));
+}
+
+/* Count the values of the ID and Parent attributes in <attributes>, split in
+   the same way as the parser does it. */
+static void gff3_references_count_attributes(GtGFF3References *refs,
+                                             const char *attributes,
+                                             const char *end)
+{
+  const char *token, *token_end, *value, *value_end;
+  for (token = attributes; token < end; token = token_end + 1) {
+    if (!(token_end = memchr(token, ';', (size_t) (end - token))))
+      token_end = end;
+    while (token < token_end && *token == ' ')
+      token++;
+    if ((size_t) (token_end - token) > strlen(GT_GFF_ID) &&
+        !strncmp(token, GT_GFF_ID "=", strlen(GT_GFF_ID) + 1)) {
+      value = token + strlen(GT_GFF_ID) + 1;
+      gff3_references_add_id(refs, value, (size_t) (token_end - value));
+    }
+    else if ((size_t) (token_end - token) > strlen(GT_GFF_PARENT) &&
+             !strncmp(token, GT_GFF_PARENT "=", strlen(GT_GFF_PARENT) + 1)) {
+      for (value = token + strlen(GT_GFF_PARENT) + 1; value <= token_end;
+           value = value_end + 1) {
+        if (!(value_end = memchr(value, ',', (size_t) (token_end - value))))
+          value_end = token_end;
+        gff3_references_add_id(refs, value, (size_t) (value_end - value));
+      }
+    }
+  }
+}
+
+int gt_gff3_references_count_file(GtGFF3References *refs, const char *filename,
+                                  GtError *err)
+{
+  const char *line, *column, *end;
+  size_t length;
+  GtFile *file;
+  int rval, i;
+  gt_error_check(err);
+  gt_assert(refs && filename);
+
+  if (!(file = gt_file_new(filename, "r", err)))
+    return -1;
+  do {
+    rval = gt_file_xread_line(file, &line, &length);
+    if (!length)
+      continue;
+    /* the features end where the sequences start */
+    if (line[0] == '>' ||
+        (length >= strlen(GT_GFF_FASTA_DIRECTIVE) &&
+         !strncmp(line, GT_GFF_FASTA_DIRECTIVE,
+                  strlen(GT_GFF_FASTA_DIRECTIVE)))) {
+      break;
+    }
+    if (line[0] == '#')
+      continue;
+    /* skip to the attribute column */
+    end = line + length;
+    column = line;
+    for (i = 0; column && i < 8; i++) {
+      if ((column = memchr(column, '\t', (size_t) (end - column))))
+        column++;
+    }
+    if (column)
+      gff3_references_count_attributes(refs, column, end);
+  } while (rval != EOF);
+  gt_file_delete(file);
+  return 0;
+}
+
+bool gt_gff3_references_use(GtGFF3References *refs, const char *id)
+{
+  GtUword *count;
+  gt_assert(refs && id);
+  id = gff3_references_unescape(refs, id, strlen(id));
+  if (!(count = gt_hashmap_get(refs->counts, id)))
+    return false;
+  if (--(*count))
+    return false;
+  gt_hashmap_remove(refs->counts, id);
+  refs->completed++;
+  return true;
+}
+
+bool gt_gff3_references_outstanding(GtGFF3References *refs, const char *id)
+{
+  gt_assert(refs && id);
+  id = gff3_references_unescape(refs, id, strlen(id));
+  return gt_hashmap_get(refs->counts, id) != NULL;
+}
+
+GtUword gt_gff3_references_completed(const GtGFF3References *refs)
+{
+  gt_assert(refs);
+  return refs->completed;
+}
+
+void gt_gff3_references_reset(GtGFF3References *refs)
+{
+  gt_assert(refs);
+  gt_hashmap_reset(refs->counts);
+  refs->completed = 0;
+}
+
+void gt_gff3_references_delete(GtGFF3References *refs)
+{
+  if (!refs) return;
+  gt_hashmap_delete(refs->counts);
+  gt_str_delete(refs->id);
+  gt_free(refs);
+}
+
+int gt_gff3_references_unit_test(GtError *err)
+{
+  GtGFF3References *refs;
+  GtStr *tmpfilename;
+  FILE *tmpfp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  refs = gt_gff3_references_new();
+  tmpfilename = gt_str_new();
+  tmpfp = gt_xtmpfp(tmpfilename);
+  gt_xfputs("##gff-version 3\n"
+            "ctg1\t.\tgene\t1\t100\t.\t+\t.\tID=gene1\n"
+            "ctg1\t.\texon\t1\t10\t.\t+\t.\t Parent=mRNA1,mRNA2;Note=x\n"
+            "# a comment with ID=gene1\n"
+            "ctg1\t.\tmRNA\t1\t100\t.\t+\t.\tID=mRNA1;Parent=gene1\n"
+            "ctg1\t.\tmRNA\t1\t100\t.\t+\t.\tParent=gene1;ID=mRNA2\n"
+            "##FASTA\n"
+            ">ID=gene1\n"
+            "acgt\n", tmpfp);
+  gt_fa_xfclose(tmpfp);
+  had_err = gt_gff3_references_count_file(refs, gt_str_get(tmpfilename), err);
+  gt_xremove(gt_str_get(tmpfilename));
+
+  /* gene1 occurs three times, the mRNAs twice each */
+  gt_ensure(gt_gff3_references_outstanding(refs, "gene1"));
+  gt_ensure(!gt_gff3_references_use(refs, "gene1"));
+  gt_ensure(!gt_gff3_references_use(refs, "gene1"));
+  gt_ensure(gt_gff3_references_use(refs, "gene1"));
+  gt_ensure(!gt_gff3_references_outstanding(refs, "gene1"));
+  gt_ensure(!gt_gff3_references_use(refs, "gene1"));
+  gt_ensure(!gt_gff3_references_use(refs, "mRNA1"));
+  gt_ensure(gt_gff3_references_use(refs, "mRNA1"));
+  gt_ensure(!gt_gff3_references_use(refs, "mRNA2"));
+  gt_ensure(gt_gff3_references_use(refs, "mRNA2"));
+  gt_ensure(!gt_gff3_references_outstanding(refs, "Note"));
+  gt_ensure(!gt_gff3_references_outstanding(refs, "x"));
+  gt_ensure(gt_gff3_references_completed(refs) == 3);
+
+  gt_gff3_references_reset(refs);
+  gt_ensure(gt_gff3_references_completed(refs) == 0);
+  gt_gff3_references_add(refs, "foo");
+  gt_ensure(gt_gff3_references_outstanding(refs, "foo"));
+  gt_ensure(gt_gff3_references_use(refs, "foo"));
+  gt_ensure(gt_gff3_references_completed(refs) == 1);
+
+  /* IDs are compared unescaped */
+  gt_gff3_references_add(refs, "a%3Bb%2c");
+  gt_gff3_references_add(refs, "a;b,");
+  gt_ensure(!gt_gff3_references_use(refs, "a%3bb%2C"));
+  gt_ensure(gt_gff3_references_outstanding(refs, "a;b%2C"));
+  gt_ensure(gt_gff3_references_use(refs, "a;b,"));
+  gt_gff3_references_add(refs, "c%2");
+  gt_ensure(!gt_gff3_references_outstanding(refs, "c"));
+  gt_ensure(gt_gff3_references_use(refs, "c%2"));
+
+  gt_str_delete(tmpfilename);
+  gt_gff3_references_delete(refs);
+  return had_err;
+}
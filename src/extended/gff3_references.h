@@ -0,0 +1,57 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef GFF3_REFERENCES_H
+#define GFF3_REFERENCES_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* A <GtGFF3References> object counts how often each ID of a GFF3 file occurs,
+   either as the value of an ID attribute (multi-features have several lines
+   with the same ID) or as one of the values of a Parent attribute. While the
+   file is parsed, every occurrence is checked off again; once all occurrences
+   of all IDs of a feature graph have been seen, the graph is complete and no
+   later line can refer to it.
+   IDs are stored unescaped, so that different escapings of the same ID are
+   counted together. */
+typedef struct GtGFF3References GtGFF3References;
+
+GtGFF3References* gt_gff3_references_new(void);
+/* Count all ID and Parent attribute values of the feature lines in the GFF3
+   file <filename>. Returns -1 and sets <err> if the file cannot be read. */
+int               gt_gff3_references_count_file(GtGFF3References *refs,
+                                                const char *filename,
+                                                GtError *err);
+/* Count one occurrence of <id>. */
+void              gt_gff3_references_add(GtGFF3References *refs,
+                                         const char *id);
+/* Check off one occurrence of <id>. Returns <true> if this was the last
+   outstanding one. */
+bool              gt_gff3_references_use(GtGFF3References *refs,
+                                         const char *id);
+/* Returns <true> if not all occurrences of <id> have been checked off. */
+bool              gt_gff3_references_outstanding(GtGFF3References *refs,
+                                                 const char *id);
+/* Returns the number of IDs whose occurrences have all been checked off. */
+GtUword           gt_gff3_references_completed(const GtGFF3References *refs);
+/* Remove all counts and reset the number of completed IDs. */
+void              gt_gff3_references_reset(GtGFF3References *refs);
+void              gt_gff3_references_delete(GtGFF3References *refs);
+int               gt_gff3_references_unit_test(GtError *err);
+
+#endif
@@ -0,0 +1,146 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <string.h>
+#include "core/atomic.h"
+#include "core/ensure.h"
+#include "core/ma.h"
+#include "extended/node_arena.h"
+
+/* size of the blocks the nodes are carved from */
+#define GT_NODE_ARENA_BLOCKSIZE ((size_t) 1 << 20)
+/* all allocations are aligned to this many bytes */
+#define GT_NODE_ARENA_ALIGNMENT ((size_t) 16)
+
+#define GT_NODE_ARENA_ALIGN(SIZE) \
+        (((SIZE) + GT_NODE_ARENA_ALIGNMENT - 1) & \
+         ~(GT_NODE_ARENA_ALIGNMENT - 1))
+
+/* the blocks are chained through a header at their start */
+typedef struct GtNodeArenaBlock {
+  struct GtNodeArenaBlock *next;
+} GtNodeArenaBlock;
+
+#define GT_NODE_ARENA_HEADERSIZE \
+        GT_NODE_ARENA_ALIGN(sizeof (GtNodeArenaBlock))
+
+struct GtNodeArena {
+  GtNodeArenaBlock *blocks; /* the first block is the current one */
+  size_t used,              /* bytes used in the current block */
+         allocated;         /* bytes handed out in total */
+  unsigned int reference_count;
+};
+
+GtNodeArena* gt_node_arena_new(void)
+{
+  GtNodeArena *arena = gt_calloc((size_t) 1, sizeof *arena);
+  arena->used = GT_NODE_ARENA_BLOCKSIZE;
+  return arena;
+}
+
+GtNodeArena* gt_node_arena_ref(GtNodeArena *arena)
+{
+  if (!arena) return NULL;
+  (void) gt_atomic_fetch_add(&arena->reference_count, 1U);
+  return arena;
+}
+
+void* gt_node_arena_alloc(GtNodeArena *arena, size_t size)
+{
+  GtNodeArenaBlock *block;
+  void *ptr;
+  gt_assert(arena && size > 0);
+  size = GT_NODE_ARENA_ALIGN(size);
+  if (GT_NODE_ARENA_HEADERSIZE + size > GT_NODE_ARENA_BLOCKSIZE) {
+    /* oversized allocations get a block of their own, which is chained after
+       the current block to keep using the latter */
+    block = gt_malloc(GT_NODE_ARENA_HEADERSIZE + size);
+    if (arena->blocks != NULL) {
+      block->next = arena->blocks->next;
+      arena->blocks->next = block;
+    }
+    else {
+      block->next = NULL;
+      arena->blocks = block;
+      arena->used = GT_NODE_ARENA_BLOCKSIZE;
+    }
+    ptr = (char*) block + GT_NODE_ARENA_HEADERSIZE;
+  }
+  else {
+    if (arena->used + size > GT_NODE_ARENA_BLOCKSIZE) {
+      block = gt_malloc(GT_NODE_ARENA_BLOCKSIZE);
+      block->next = arena->blocks;
+      arena->blocks = block;
+      arena->used = GT_NODE_ARENA_HEADERSIZE;
+    }
+    ptr = (char*) arena->blocks + arena->used;
+    arena->used += size;
+  }
+  arena->allocated += size;
+  (void) gt_node_arena_ref(arena);
+  return ptr;
+}
+
+size_t gt_node_arena_size(const GtNodeArena *arena)
+{
+  gt_assert(arena);
+  return arena->allocated;
+}
+
+void gt_node_arena_delete(GtNodeArena *arena)
+{
+  GtNodeArenaBlock *block, *next;
+  if (!arena) return;
+  if (gt_atomic_fetch_sub(&arena->reference_count, 1U) > 0)
+    return;
+  for (block = arena->blocks; block != NULL; block = next) {
+    next = block->next;
+    gt_free(block);
+  }
+  gt_free(arena);
+}
+
+int gt_node_arena_unit_test(GtError *err)
+{
+  GtNodeArena *arena;
+  char *ptrs[1000], *big;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+
+  arena = gt_node_arena_new();
+  for (i = 0; i < 1000UL; i++) {
+    ptrs[i] = gt_node_arena_alloc(arena, (size_t) (1 + i * 7));
+    gt_ensure(((size_t) ptrs[i]) % GT_NODE_ARENA_ALIGNMENT == 0);
+    memset(ptrs[i], (int) (i % 256), (size_t) (1 + i * 7));
+  }
+  big = gt_node_arena_alloc(arena, 2 * GT_NODE_ARENA_BLOCKSIZE);
+  memset(big, 0, 2 * GT_NODE_ARENA_BLOCKSIZE);
+  for (i = 0; !had_err && i < 1000UL; i++) {
+    gt_ensure(ptrs[i][0] == (char) (i % 256));
+    gt_ensure(ptrs[i][i * 7] == (char) (i % 256));
+  }
+  gt_ensure(gt_node_arena_size(arena) >= 2 * GT_NODE_ARENA_BLOCKSIZE);
+  /* the memory stays valid as long as allocations hold references */
+  gt_node_arena_delete(arena);
+  for (i = 0; !had_err && i < 1000UL; i++) {
+    gt_ensure(ptrs[i][i * 7] == (char) (i % 256));
+    gt_node_arena_delete(arena);
+  }
+  gt_node_arena_delete(arena);
+  return had_err;
+}
@@ -0,0 +1,45 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef NODE_ARENA_H
+#define NODE_ARENA_H
+
+#include <stdlib.h>
+#include "core/error_api.h"
+
+/* A <GtNodeArena> hands out memory for <GtGenomeNode>s by bumping a pointer
+   through large blocks. Every allocation holds a reference to the arena, so
+   the blocks are freed in bulk once the arena itself and all nodes allocated
+   from it have been deleted. Allocating is not thread-safe, but references can
+   be dropped from any thread. */
+typedef struct GtNodeArena GtNodeArena;
+
+GtNodeArena* gt_node_arena_new(void);
+/* Increases the reference count of <arena>. */
+GtNodeArena* gt_node_arena_ref(GtNodeArena *arena);
+/* Returns <size> bytes of uninitialized memory from <arena>, suitably aligned
+   for any node class. The memory is valid until the reference it holds is
+   dropped with <gt_node_arena_delete()>. */
+void*        gt_node_arena_alloc(GtNodeArena *arena, size_t size);
+/* Returns the number of bytes allocated from <arena> so far. */
+size_t       gt_node_arena_size(const GtNodeArena *arena);
+/* Drops a reference to <arena>, its memory is freed with the last one. */
+void         gt_node_arena_delete(GtNodeArena *arena);
+
+int          gt_node_arena_unit_test(GtError *err);
+
+#endif
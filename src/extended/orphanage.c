@@ -28,6 +28,7 @@ struct GtOrphanage {
   GtQueue *orphans;
   GtCstrTable *missing_parents,
               *orphan_ids;
+  GtUword nof_missing_parents;
 };
 
 GtOrphanage* gt_orphanage_new(void)
@@ -36,6 +37,7 @@ GtOrphanage* gt_orphanage_new(void)
   o->orphans = gt_queue_new();
   o->missing_parents = gt_cstr_table_new();
   o->orphan_ids = gt_cstr_table_new();
+  o->nof_missing_parents = 0;
   return o;
 }
 
@@ -57,6 +59,7 @@ void gt_orphanage_reset(GtOrphanage *o)
     gt_genome_node_delete(gt_queue_get(o->orphans));
   gt_cstr_table_reset(o->missing_parents);
   gt_cstr_table_reset(o->orphan_ids);
+  o->nof_missing_parents = 0;
 }
 
 void gt_orphanage_add(GtOrphanage *o, GtGenomeNode *orphan,
@@ -73,8 +76,10 @@ void gt_orphanage_add(GtOrphanage *o, GtGenomeNode *orphan,
   if (missing_parents) {
     for (i = 0; i < gt_str_array_size(missing_parents); i++) {
       missing_parent = gt_str_array_get(missing_parents, i);
-      if (!gt_cstr_table_get(o->missing_parents, missing_parent))
+      if (!gt_cstr_table_get(o->missing_parents, missing_parent)) {
         gt_cstr_table_add(o->missing_parents, missing_parent);
+        o->nof_missing_parents++;
+      }
     }
   }
 }
@@ -82,7 +87,11 @@ void gt_orphanage_add(GtOrphanage *o, GtGenomeNode *orphan,
 void gt_orphanage_reg_parent(GtOrphanage *o, const char *parent_id)
 {
   gt_assert(o && parent_id);
-  gt_cstr_table_remove(o->missing_parents, parent_id);
+  if (o->nof_missing_parents &&
+      gt_cstr_table_get(o->missing_parents, parent_id)) {
+    gt_cstr_table_remove(o->missing_parents, parent_id);
+    o->nof_missing_parents--;
+  }
 }
 
 GtGenomeNode* gt_orphanage_get_orphan(GtOrphanage *o)
@@ -93,6 +102,18 @@ GtGenomeNode* gt_orphanage_get_orphan(GtOrphanage *o)
   return NULL;
 }
 
+bool gt_orphanage_has_orphans(const GtOrphanage *o)
+{
+  gt_assert(o);
+  return gt_queue_size(o->orphans) ? true : false;
+}
+
+bool gt_orphanage_has_missing_parents(const GtOrphanage *o)
+{
+  gt_assert(o);
+  return o->nof_missing_parents ? true : false;
+}
+
 bool gt_orphanage_parent_is_missing(GtOrphanage *o, const char *parent_id)
 {
   gt_assert(o && parent_id);
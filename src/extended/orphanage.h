@@ -28,6 +28,10 @@ void          gt_orphanage_add(GtOrphanage*, GtGenomeNode *orphan,
                                GtStrArray *missing_parents);
 void          gt_orphanage_reg_parent(GtOrphanage*, const char *id);
 GtGenomeNode* gt_orphanage_get_orphan(GtOrphanage*);
+bool          gt_orphanage_has_orphans(const GtOrphanage*);
+/* Returns <true> if at least one orphan refers to a parent which has not been
+   registered yet. Otherwise, all orphans can be adopted. */
+bool          gt_orphanage_has_missing_parents(const GtOrphanage*);
 bool          gt_orphanage_parent_is_missing(GtOrphanage*, const char *id);
 bool          gt_orphanage_is_orphan(GtOrphanage*, const char *id);
 
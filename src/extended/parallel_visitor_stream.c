@@ -0,0 +1,241 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include "core/assert_api.h"
+#include "core/class_alloc_lock.h"
+#include "core/ma.h"
+#include "core/thread_pool.h"
+#include "core/undef_api.h"
+#include "extended/genome_node.h"
+#include "extended/parallel_visitor_stream.h"
+
+/* number of nodes read per worker thread at once */
+#define GT_PARALLEL_VISITOR_STREAM_BATCH  64
+
+typedef struct {
+  GtNodeVisitor *visitor;
+  GtError *err,     /* error of the first failed node of the current batch */
+          *scratch;
+  GtUword failed;   /* index of that node, <GT_UNDEF_UWORD> if none failed */
+} ParallelVisitorWorker;
+
+struct GtParallelVisitorStream {
+  const GtNodeStream parent_instance;
+  GtNodeStream *in_stream;
+  GtNodeVisitorFactoryFunc factory;
+  void *data;
+  ParallelVisitorWorker *workers;
+  unsigned int numofworkers;
+  GtGenomeNode **batch;
+  GtUword batch_allocated,
+          batch_next,
+          batch_end;
+  GtError *batch_err; /* deferred until the nodes before it are delivered */
+  bool in_stream_done;
+};
+
+#define parallel_visitor_stream_cast(NS)\
+        gt_node_stream_cast(gt_parallel_visitor_stream_class(), NS)
+
+/* Make sure that every worker of <pool> has its own visitor. */
+static int parallel_visitor_stream_add_workers(GtParallelVisitorStream *pvs,
+                                               const GtThreadPool *pool,
+                                               GtError *err)
+{
+  unsigned int numofworkers = gt_thread_pool_size(pool);
+  int had_err = 0;
+  gt_error_check(err);
+  if (numofworkers <= pvs->numofworkers)
+    return 0;
+  pvs->workers = gt_realloc(pvs->workers,
+                            sizeof *pvs->workers * numofworkers);
+  while (!had_err && pvs->numofworkers < numofworkers) {
+    ParallelVisitorWorker *worker = pvs->workers + pvs->numofworkers;
+    if (!(worker->visitor = pvs->factory(pvs->data, err))) {
+      had_err = -1;
+      break;
+    }
+    worker->err = gt_error_new();
+    worker->scratch = gt_error_new();
+    worker->failed = GT_UNDEF_UWORD;
+    pvs->numofworkers++;
+  }
+  return had_err;
+}
+
+static void parallel_visitor_stream_visit(GtUword start, GtUword end,
+                                          unsigned int workerid, void *data)
+{
+  GtParallelVisitorStream *pvs = data;
+  ParallelVisitorWorker *worker = pvs->workers + workerid;
+  GtError *tmp;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++) {
+    /* the nodes after a failed one are discarded anyway */
+    if (idx > worker->failed)
+      break;
+    if (gt_genome_node_accept(pvs->batch[idx], worker->visitor,
+                              worker->scratch)) {
+      /* ranges can be processed out of order, keep the first error */
+      if (idx < worker->failed) {
+        tmp = worker->err;
+        worker->err = worker->scratch;
+        worker->scratch = tmp;
+        worker->failed = idx;
+      }
+      gt_error_unset(worker->scratch);
+    }
+  }
+}
+
+/* Read the next batch of nodes from the input stream and visit them in
+   parallel. */
+static int parallel_visitor_stream_fill_batch(GtParallelVisitorStream *pvs,
+                                              GtError *err)
+{
+  GtThreadPool *pool;
+  GtGenomeNode *gn;
+  GtUword idx, numofnodes = 0, failed = GT_UNDEF_UWORD;
+  unsigned int w;
+  int had_err = 0;
+  gt_error_check(err);
+
+  if (!(pool = gt_thread_pool_get(err)))
+    return -1;
+  if (parallel_visitor_stream_add_workers(pvs, pool, err))
+    return -1;
+  if (pvs->batch_allocated < (GtUword) pvs->numofworkers
+                             * GT_PARALLEL_VISITOR_STREAM_BATCH) {
+    pvs->batch_allocated = (GtUword) pvs->numofworkers
+                           * GT_PARALLEL_VISITOR_STREAM_BATCH;
+    pvs->batch = gt_realloc(pvs->batch,
+                            sizeof *pvs->batch * pvs->batch_allocated);
+  }
+
+  while (numofnodes < pvs->batch_allocated) {
+    if ((had_err = gt_node_stream_next(pvs->in_stream, &gn, err)) || !gn) {
+      pvs->in_stream_done = true;
+      break;
+    }
+    pvs->batch[numofnodes++] = gn;
+  }
+  if (had_err) {
+    /* visit and deliver the nodes read before the error */
+    pvs->batch_err = gt_error_new();
+    gt_error_set(pvs->batch_err, "%s", gt_error_get(err));
+    gt_error_unset(err);
+  }
+
+  gt_thread_pool_parallel_for(pool, 0, numofnodes, 0,
+                              parallel_visitor_stream_visit, pvs);
+
+  for (w = 0; w < pvs->numofworkers; w++) {
+    ParallelVisitorWorker *worker = pvs->workers + w;
+    if (worker->failed < failed) {
+      failed = worker->failed;
+      if (!pvs->batch_err)
+        pvs->batch_err = gt_error_new();
+      gt_error_set(pvs->batch_err, "%s", gt_error_get(worker->err));
+    }
+    gt_error_unset(worker->err);
+    worker->failed = GT_UNDEF_UWORD;
+  }
+  if (failed != GT_UNDEF_UWORD) {
+    for (idx = failed; idx < numofnodes; idx++)
+      gt_genome_node_delete(pvs->batch[idx]);
+    numofnodes = failed;
+    pvs->in_stream_done = true;
+  }
+  pvs->batch_next = 0;
+  pvs->batch_end = numofnodes;
+  return 0;
+}
+
+static int parallel_visitor_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                                        GtError *err)
+{
+  GtParallelVisitorStream *pvs;
+  int had_err = 0;
+  gt_error_check(err);
+  pvs = parallel_visitor_stream_cast(ns);
+  *gn = NULL;
+
+  if (pvs->batch_next == pvs->batch_end && !pvs->in_stream_done)
+    had_err = parallel_visitor_stream_fill_batch(pvs, err);
+  if (!had_err) {
+    if (pvs->batch_next < pvs->batch_end)
+      *gn = pvs->batch[pvs->batch_next++];
+    else if (pvs->batch_err) {
+      gt_error_set(err, "%s", gt_error_get(pvs->batch_err));
+      had_err = -1;
+    }
+  }
+  return had_err;
+}
+
+static void parallel_visitor_stream_free(GtNodeStream *ns)
+{
+  GtParallelVisitorStream *pvs = parallel_visitor_stream_cast(ns);
+  unsigned int w;
+  for (w = 0; w < pvs->numofworkers; w++) {
+    gt_node_visitor_delete(pvs->workers[w].visitor);
+    gt_error_delete(pvs->workers[w].err);
+    gt_error_delete(pvs->workers[w].scratch);
+  }
+  gt_free(pvs->workers);
+  while (pvs->batch_next < pvs->batch_end)
+    gt_genome_node_delete(pvs->batch[pvs->batch_next++]);
+  gt_free(pvs->batch);
+  gt_error_delete(pvs->batch_err);
+  gt_node_stream_delete(pvs->in_stream);
+}
+
+const GtNodeStreamClass* gt_parallel_visitor_stream_class(void)
+{
+  static const GtNodeStreamClass *nsc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nsc) {
+    nsc = gt_node_stream_class_new(sizeof (GtParallelVisitorStream),
+                                   parallel_visitor_stream_free,
+                                   parallel_visitor_stream_next);
+  }
+  gt_class_alloc_lock_leave();
+  return nsc;
+}
+
+GtNodeStream* gt_parallel_visitor_stream_new(GtNodeStream *in_stream,
+                                             GtNodeVisitorFactoryFunc factory,
+                                             void *data)
+{
+  GtParallelVisitorStream *pvs;
+  GtNodeStream *ns;
+  gt_assert(in_stream && factory);
+  ns = gt_node_stream_create(gt_parallel_visitor_stream_class(),
+                             gt_node_stream_is_sorted(in_stream));
+  pvs = parallel_visitor_stream_cast(ns);
+  pvs->in_stream = gt_node_stream_ref(in_stream);
+  pvs->factory = factory;
+  pvs->data = data;
+  pvs->workers = NULL;
+  pvs->numofworkers = 0;
+  pvs->batch = NULL;
+  pvs->batch_allocated = pvs->batch_next = pvs->batch_end = 0;
+  pvs->batch_err = NULL;
+  pvs->in_stream_done = false;
+  return ns;
+}
@@ -0,0 +1,47 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef PARALLEL_VISITOR_STREAM_H
+#define PARALLEL_VISITOR_STREAM_H
+
+#include "extended/node_stream_api.h"
+#include "extended/node_visitor_api.h"
+
+/* Implements the <GtNodeStream> interface. */
+typedef struct GtParallelVisitorStream GtParallelVisitorStream;
+
+/* Return a new <GtNodeVisitor> for one worker thread of a
+   <GtParallelVisitorStream>. The visitors returned for different workers must
+   not share any state which is modified during the visit. Returns NULL and
+   sets <err> on error. */
+typedef GtNodeVisitor* (*GtNodeVisitorFactoryFunc)(void *data, GtError *err);
+
+const GtNodeStreamClass* gt_parallel_visitor_stream_class(void);
+
+/* Create a new <GtParallelVisitorStream*> which applies a visitor to each node
+   passing through it, like a <GtVisitorStream>. The nodes are read from
+   <in_stream> in batches and visited on the workers of the process-wide
+   thread pool (see <gt_jobs>), each of which uses its own visitor created by
+   <factory> with <data>. Hence the visit of a node must only depend on the
+   node itself (e.g., a top-level feature graph), not on the nodes before it.
+   The nodes are returned in input order. If a visit fails, the nodes before
+   the failing one are returned before the error is reported. */
+GtNodeStream* gt_parallel_visitor_stream_new(GtNodeStream *in_stream,
+                                             GtNodeVisitorFactoryFunc factory,
+                                             void *data);
+
+#endif
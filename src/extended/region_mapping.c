@@ -143,6 +143,36 @@ static GtStr* region_mapping_map(GtRegionMapping *rm,
     return gt_mapping_map_string(rm->mapping, sequence_region, err);
 }
 
+static int region_mapping_load_seq_col(GtRegionMapping *rm, GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(rm && !rm->mapping);
+  if (!rm->seq_col) {
+    if (rm->encseq) {
+      if (!(rm->seq_col = gt_encseq_col_new(rm->encseq, err)))
+        had_err = -1;
+    } else {
+      gt_assert(rm->sequence_filenames);
+      if (!(rm->seq_col = gt_bioseq_col_new(rm->sequence_filenames, err)))
+        had_err = -1;
+    }
+    /* handle -matchdescstart, i.e. load seqids into cache */
+    if (!had_err && rm->seq_col && rm->matchdescstart)
+        gt_seq_col_enable_match_desc_start(rm->seq_col);
+  }
+  return had_err;
+}
+
+int gt_region_mapping_load_sequences(GtRegionMapping *rm, GtError *err)
+{
+  gt_error_check(err);
+  gt_assert(rm && !rm->mapping);
+  if (rm->userawseq)
+    return 0;
+  return region_mapping_load_seq_col(rm, err);
+}
+
 static int update_seq_col_if_necessary(GtRegionMapping *rm, GtStr *seqid,
                                        GtError *err)
 {
@@ -183,19 +213,7 @@ static int update_seq_col_if_necessary(GtRegionMapping *rm, GtStr *seqid,
     }
   } else {
     /* ...otherwise, just make sure the seqcol is loaded */
-    if (!rm->seq_col) {
-      if (rm->encseq) {
-        if (!(rm->seq_col = gt_encseq_col_new(rm->encseq, err)))
-          had_err = -1;
-      } else {
-        gt_assert(rm->sequence_filenames);
-        if (!(rm->seq_col = gt_bioseq_col_new(rm->sequence_filenames, err)))
-          had_err = -1;
-      }
-      /* handle -matchdescstart, i.e. load seqids into cache */
-      if (!had_err && rm->seq_col && rm->matchdescstart)
-          gt_seq_col_enable_match_desc_start(rm->seq_col);
-    }
+    had_err = region_mapping_load_seq_col(rm, err);
     if (!had_err && rm->usedesc) {
       if (rm->seqid2seqnum_mapping)
         gt_seqid2seqnum_mapping_delete(rm->seqid2seqnum_mapping);
@@ -27,5 +27,12 @@ GtRegionMapping* gt_region_mapping_new_encseq_seqno(GtEncseq *encseq);
 /* Enables matching only at the beginning of sequence descriptions up to the
    first whitespace */
 void             gt_region_mapping_enable_match_desc_start(GtRegionMapping *rm);
+/* Load the sequences of <rm> now instead of on the first access, creating
+   missing index files of sequence files. Afterwards, accessing <rm> does not
+   create any files. Must not be used for a region mapping based on a mapping
+   file, which loads the sequence file of each sequence region on access.
+   Returns -1 and sets <err> on error. */
+int              gt_region_mapping_load_sequences(GtRegionMapping *rm,
+                                                  GtError *err);
 
 #endif
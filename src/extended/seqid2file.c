@@ -194,6 +194,12 @@ bool gt_seqid2file_option_used(GtSeqid2FileInfo *s2fi)
   return false;
 }
 
+bool gt_seqid2file_mapping_used(GtSeqid2FileInfo *s2fi)
+{
+  gt_assert(s2fi);
+  return gt_str_length(s2fi->region_mapping) > 0;
+}
+
 GtRegionMapping* gt_seqid2file_region_mapping_new(GtSeqid2FileInfo *s2fi,
                                                   GtError *err)
 {
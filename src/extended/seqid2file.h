@@ -38,6 +38,9 @@ void              gt_seqid2file_register_options_ext(GtOptionParser
                                                      bool debug);
 
 bool              gt_seqid2file_option_used(GtSeqid2FileInfo*);
+/* Returns <true> if the sequence files are given by a mapping file (option
+   -regionmapping). */
+bool              gt_seqid2file_mapping_used(GtSeqid2FileInfo*);
 GtRegionMapping*  gt_seqid2file_region_mapping_new(GtSeqid2FileInfo*,
                                                    GtError*);
 
@@ -15,25 +15,304 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <string.h>
 #include "core/array.h"
 #include "core/assert_api.h"
 #include "core/class_alloc_lock.h"
+#include "core/fa.h"
+#include "core/ma_api.h"
+#include "extended/comment_node_api.h"
 #include "extended/eof_node_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/feature_node_iterator_api.h"
 #include "extended/genome_node.h"
+#include "extended/genome_node_io.h"
 #include "extended/node_stream_api.h"
+#include "extended/sequence_node_api.h"
 #include "extended/sort_stream.h"
 
+/* approximate space of a genome node (including its list elements and
+   allocation overhead) without attributes or sequence data */
+#define SORT_STREAM_NODE_SIZE  256
+
+/* this many runs of the same level are merged into one run of the next
+   level, which bounds the number of open runs logarithmically */
+#define SORT_STREAM_MERGE_WIDTH  16
+
+/* a sorted run of nodes which has been written to a temporary file */
+typedef struct {
+  FILE *fp;
+  GtGenomeNodeReader *reader;
+  unsigned int level; /* number of merge passes the nodes went through */
+} GtSortStreamRun;
+
+/* the current node of a run during a merge */
+typedef struct {
+  GtGenomeNode *node;
+  GtUword run;
+} GtSortStreamHead;
+
 struct GtSortStream {
   const GtNodeStream parent_instance;
   GtNodeStream *in_stream;
-  GtUword idx;
-  GtArray *nodes;
+  GtUword idx,
+          memlimit,  /* 0 if unlimited */
+          memused;
+  GtArray *nodes,
+          *runs,     /* of GtSortStreamRun, in input order */
+          *heads;    /* heap of GtSortStreamHead for the final merge */
+  GtGenomeNode *lookahead;
   bool sorted;
 };
 
 #define gt_sort_stream_cast(GS)\
         gt_node_stream_cast(gt_sort_stream_class(), GS);
 
+static void sort_stream_add_attribute_size(const char *attr_name,
+                                           const char *attr_value, void *data)
+{
+  GtUword *size = data;
+  *size += strlen(attr_name) + strlen(attr_value) + 2;
+}
+
+/* Return the approximate amount of memory occupied by <gn>. */
+static GtUword sort_stream_node_size(GtGenomeNode *gn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *fn;
+  GtCommentNode *cn;
+  GtSequenceNode *sn;
+  GtUword size = SORT_STREAM_NODE_SIZE;
+  if ((fn = gt_feature_node_try_cast(gn))) {
+    /* pseudo-features are skipped by the iterator */
+    fni = gt_feature_node_iterator_new(fn);
+    while ((fn = gt_feature_node_iterator_next(fni))) {
+      size += SORT_STREAM_NODE_SIZE;
+      gt_feature_node_foreach_attribute(fn, sort_stream_add_attribute_size,
+                                        &size);
+    }
+    gt_feature_node_iterator_delete(fni);
+  }
+  else if ((cn = gt_comment_node_try_cast(gn)))
+    size += strlen(gt_comment_node_get_comment(cn));
+  else if ((sn = gt_sequence_node_try_cast(gn))) {
+    size += gt_sequence_node_get_sequence_length(sn) +
+            strlen(gt_sequence_node_get_description(sn));
+  }
+  return size;
+}
+
+/* Return true if <a> has to be returned before <b>. For equal nodes, the one
+   from the earlier run comes first, which keeps the sort stable. */
+static bool sort_stream_head_precedes(GtSortStreamHead *a, GtSortStreamHead *b)
+{
+  int rval = gt_genome_node_compare(&a->node, &b->node);
+  return rval < 0 || (rval == 0 && a->run < b->run);
+}
+
+static void sort_stream_heap_sift_up(GtSortStreamHead *heap, GtUword i)
+{
+  while (i > 0 && sort_stream_head_precedes(heap + i, heap + (i - 1) / 2)) {
+    GtSortStreamHead tmp = heap[i];
+    heap[i] = heap[(i - 1) / 2];
+    heap[(i - 1) / 2] = tmp;
+    i = (i - 1) / 2;
+  }
+}
+
+static void sort_stream_heap_sift_down(GtSortStreamHead *heap, GtUword size,
+                                       GtUword i)
+{
+  for (;;) {
+    GtUword min = i, child = 2 * i + 1;
+    GtSortStreamHead tmp;
+    if (child < size && sort_stream_head_precedes(heap + child, heap + min))
+      min = child;
+    if (child + 1 < size &&
+        sort_stream_head_precedes(heap + child + 1, heap + min)) {
+      min = child + 1;
+    }
+    if (min == i)
+      break;
+    tmp = heap[i];
+    heap[i] = heap[min];
+    heap[min] = tmp;
+    i = min;
+  }
+}
+
+/* Read the next node of run <run> into <gn> (NULL if the run is exhausted).
+   The run after the last written one consists of the nodes in memory. */
+static int sort_stream_read_run(GtSortStream *sort_stream, GtUword run,
+                                GtGenomeNode **gn, GtError *err)
+{
+  gt_error_check(err);
+  *gn = NULL;
+  if (run == gt_array_size(sort_stream->runs)) {
+    if (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
+      *gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
+                                           sort_stream->idx);
+      sort_stream->idx++;
+    }
+    return 0;
+  }
+  return gt_genome_node_reader_read(((GtSortStreamRun*)
+                                     gt_array_get(sort_stream->runs,
+                                                  run))->reader, gn, err);
+}
+
+/* Fill <heap> with the first nodes of the runs <first> to <end> - 1. */
+static int sort_stream_heap_init(GtSortStream *sort_stream, GtArray *heap,
+                                 GtUword first, GtUword end, GtError *err)
+{
+  GtSortStreamHead head;
+  int had_err = 0;
+  gt_error_check(err);
+
+  for (head.run = first; !had_err && head.run < end; head.run++) {
+    if (head.run < gt_array_size(sort_stream->runs)) {
+      GtSortStreamRun *run = gt_array_get(sort_stream->runs, head.run);
+      rewind(run->fp);
+      run->reader = gt_genome_node_reader_new(run->fp);
+    }
+    had_err = sort_stream_read_run(sort_stream, head.run, &head.node, err);
+    if (!had_err && head.node) {
+      gt_array_add(heap, head);
+      sort_stream_heap_sift_up(gt_array_get_space(heap),
+                               gt_array_size(heap) - 1);
+    }
+  }
+  return had_err;
+}
+
+/* Remove the first node from <heap> and return it in <gn> (NULL if <heap> is
+   empty), replacing it by its successor in the same run. */
+static int sort_stream_heap_next(GtSortStream *sort_stream, GtArray *heap,
+                                 GtGenomeNode **gn, GtError *err)
+{
+  GtSortStreamHead *top;
+  int had_err;
+  gt_error_check(err);
+
+  if (!gt_array_size(heap)) {
+    *gn = NULL;
+    return 0;
+  }
+  top = gt_array_get_space(heap);
+  *gn = top->node;
+  had_err = sort_stream_read_run(sort_stream, top->run, &top->node, err);
+  if (!top->node)
+    *top = *(GtSortStreamHead*) gt_array_pop(heap);
+  sort_stream_heap_sift_down(top, gt_array_size(heap), 0);
+  return had_err;
+}
+
+static void sort_stream_heap_clear(GtArray *heap)
+{
+  GtUword i;
+  for (i = 0; i < gt_array_size(heap); i++)
+    gt_genome_node_delete(((GtSortStreamHead*) gt_array_get(heap, i))->node);
+  gt_array_reset(heap);
+}
+
+static void sort_stream_run_close(GtSortStreamRun *run)
+{
+  gt_genome_node_reader_delete(run->reader);
+  gt_fa_xfclose(run->fp);
+}
+
+/* Merge the runs from <first> on into a single run of the next level. */
+static int sort_stream_merge_runs(GtSortStream *sort_stream, GtUword first,
+                                  GtError *err)
+{
+  GtGenomeNodeWriter *writer;
+  GtSortStreamRun merged, *run;
+  GtGenomeNode *gn;
+  GtArray *heap;
+  GtUword i;
+  int had_err;
+  gt_error_check(err);
+
+  run = gt_array_get(sort_stream->runs, first);
+  merged.fp = gt_xtmpfp_generic(NULL, TMPFP_OPENBINARY | TMPFP_AUTOREMOVE);
+  merged.reader = NULL;
+  merged.level = run->level + 1;
+  writer = gt_genome_node_writer_new(merged.fp);
+  heap = gt_array_new(sizeof (GtSortStreamHead));
+  had_err = sort_stream_heap_init(sort_stream, heap, first,
+                                  gt_array_size(sort_stream->runs), err);
+  while (!had_err &&
+         !(had_err = sort_stream_heap_next(sort_stream, heap, &gn, err)) &&
+         gn) {
+    had_err = gt_genome_node_writer_write(writer, gn, err);
+    gt_genome_node_delete(gn);
+  }
+  sort_stream_heap_clear(heap);
+  gt_array_delete(heap);
+  gt_genome_node_writer_delete(writer);
+  for (i = first; i < gt_array_size(sort_stream->runs); i++)
+    sort_stream_run_close(gt_array_get(sort_stream->runs, i));
+  gt_array_set_size(sort_stream->runs, first);
+  gt_array_add(sort_stream->runs, merged);
+  return had_err;
+}
+
+/* Sort the collected nodes and write them to a new run. Whenever the last
+   <SORT_STREAM_MERGE_WIDTH> runs have the same level, they are merged. */
+static int sort_stream_spill_run(GtSortStream *sort_stream, GtError *err)
+{
+  GtGenomeNodeWriter *writer;
+  GtSortStreamRun run;
+  GtUword i, numofruns;
+  int had_err = 0;
+  gt_error_check(err);
+
+  gt_genome_nodes_sort_stable(sort_stream->nodes);
+  run.fp = gt_xtmpfp_generic(NULL, TMPFP_OPENBINARY | TMPFP_AUTOREMOVE);
+  run.reader = NULL;
+  run.level = 0;
+  gt_array_add(sort_stream->runs, run);
+  writer = gt_genome_node_writer_new(run.fp);
+  for (i = 0; i < gt_array_size(sort_stream->nodes); i++) {
+    GtGenomeNode *gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes, i);
+    if (!had_err)
+      had_err = gt_genome_node_writer_write(writer, gn, err);
+    gt_genome_node_delete(gn);
+  }
+  gt_genome_node_writer_delete(writer);
+  gt_array_reset(sort_stream->nodes);
+  sort_stream->memused = 0;
+  /* the levels of the runs are non-increasing */
+  while (!had_err &&
+         (numofruns = gt_array_size(sort_stream->runs)) >=
+         SORT_STREAM_MERGE_WIDTH &&
+         ((GtSortStreamRun*) gt_array_get(sort_stream->runs, numofruns -
+                                          SORT_STREAM_MERGE_WIDTH))->level ==
+         ((GtSortStreamRun*) gt_array_get_last(sort_stream->runs))->level) {
+    had_err = sort_stream_merge_runs(sort_stream,
+                                     numofruns - SORT_STREAM_MERGE_WIDTH, err);
+  }
+  return had_err;
+}
+
+/* Return the next node in sorted order in <gn> (NULL if none is left). If
+   runs have been written, they are merged with the nodes in memory. */
+static int sort_stream_get(GtSortStream *sort_stream, GtGenomeNode **gn,
+                           GtError *err)
+{
+  gt_error_check(err);
+
+  if (sort_stream->lookahead) {
+    *gn = sort_stream->lookahead;
+    sort_stream->lookahead = NULL;
+    return 0;
+  }
+  if (!gt_array_size(sort_stream->runs)) {
+    return sort_stream_read_run(sort_stream, 0, gn, err);
+  }
+  return sort_stream_heap_next(sort_stream, sort_stream->heads, gn, err);
+}
+
 static int gt_sort_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
                                GtError *err)
 {
@@ -49,43 +328,56 @@ static int gt_sort_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
                                            err)) && node) {
       if ((eofn = gt_eof_node_try_cast(node)))
         gt_genome_node_delete(node); /* get rid of EOF nodes */
-      else
+      else {
         gt_array_add(sort_stream->nodes, node);
+        if (sort_stream->memlimit) {
+          sort_stream->memused += sort_stream_node_size(node);
+          if (sort_stream->memused > sort_stream->memlimit &&
+              (had_err = sort_stream_spill_run(sort_stream, err))) {
+            break;
+          }
+        }
+      }
     }
     if (!had_err) {
       gt_genome_nodes_sort_stable(sort_stream->nodes);
+      if (gt_array_size(sort_stream->runs)) {
+        /* the nodes in memory form the last run */
+        had_err = sort_stream_heap_init(sort_stream, sort_stream->heads, 0,
+                                        gt_array_size(sort_stream->runs) + 1,
+                                        err);
+      }
       sort_stream->sorted = true;
     }
   }
 
   if (!had_err) {
     gt_assert(sort_stream->sorted);
-    if (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
-      *gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
-                                           sort_stream->idx);
-      sort_stream->idx++;
-      /* join region nodes with the same sequence ID */
-      if (gt_region_node_try_cast(*gn)) {
-        GtRange range_a, range_b;
-        while (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
-          node = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
-                                                sort_stream->idx);
-          if (!gt_region_node_try_cast(node) ||
-              gt_str_cmp(gt_genome_node_get_seqid(*gn),
-                         gt_genome_node_get_seqid(node))) {
-            /* the next node is not a region node with the same ID */
-            break;
-          }
-          range_a = gt_genome_node_get_range(*gn);
-          range_b = gt_genome_node_get_range(node);
-          range_a = gt_range_join(&range_a, &range_b);
-          gt_genome_node_set_range(*gn, &range_a);
-          gt_genome_node_delete(node);
-          sort_stream->idx++;
+    had_err = sort_stream_get(sort_stream, gn, err);
+    /* join region nodes with the same sequence ID */
+    if (!had_err && *gn && gt_region_node_try_cast(*gn)) {
+      GtRange range_a, range_b;
+      while (!(had_err = sort_stream_get(sort_stream, &node, err)) && node) {
+        if (!gt_region_node_try_cast(node) ||
+            gt_str_cmp(gt_genome_node_get_seqid(*gn),
+                       gt_genome_node_get_seqid(node))) {
+          /* the next node is not a region node with the same ID */
+          sort_stream->lookahead = node;
+          break;
         }
+        range_a = gt_genome_node_get_range(*gn);
+        range_b = gt_genome_node_get_range(node);
+        range_a = gt_range_join(&range_a, &range_b);
+        gt_genome_node_set_range(*gn, &range_a);
+        gt_genome_node_delete(node);
+      }
+      if (had_err) {
+        gt_genome_node_delete(*gn);
+        *gn = NULL;
       }
-      return 0;
     }
+    if (!had_err && *gn)
+      return 0;
   }
 
   if (!had_err) {
@@ -105,6 +397,12 @@ static void gt_sort_stream_free(GtNodeStream *ns)
                           gt_array_get(sort_stream->nodes, i));
   }
   gt_array_delete(sort_stream->nodes);
+  sort_stream_heap_clear(sort_stream->heads);
+  gt_array_delete(sort_stream->heads);
+  for (i = 0; i < gt_array_size(sort_stream->runs); i++)
+    sort_stream_run_close(gt_array_get(sort_stream->runs, i));
+  gt_array_delete(sort_stream->runs);
+  gt_genome_node_delete(sort_stream->lookahead);
   gt_node_stream_delete(sort_stream->in_stream);
 }
 
@@ -129,6 +427,17 @@ GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream)
   sort_stream->in_stream = gt_node_stream_ref(in_stream);
   sort_stream->sorted = false;
   sort_stream->idx = 0;
+  sort_stream->memlimit = 0;
+  sort_stream->memused = 0;
   sort_stream->nodes = gt_array_new(sizeof (GtGenomeNode*));
+  sort_stream->runs = gt_array_new(sizeof (GtSortStreamRun));
+  sort_stream->heads = gt_array_new(sizeof (GtSortStreamHead));
+  sort_stream->lookahead = NULL;
   return ns;
 }
+
+void gt_sort_stream_set_memlimit(GtSortStream *sort_stream, GtUword memlimit)
+{
+  gt_assert(sort_stream && !sort_stream->sorted);
+  sort_stream->memlimit = memlimit;
+}
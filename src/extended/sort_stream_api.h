@@ -28,4 +28,12 @@ typedef struct GtSortStream GtSortStream;
    <in_stream> and returns them unmodified, but in sorted order. */
 GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream);
 
+/* Limit the memory used by <sort_stream> to about <memlimit> bytes. If the
+   retrieved nodes exceed the limit, they are sorted in runs which are written
+   to temporary files and merged afterwards. A <memlimit> of 0 (the default)
+   keeps all nodes in memory. Must be called before the first node is
+   retrieved from <sort_stream>. */
+void          gt_sort_stream_set_memlimit(GtSortStream *sort_stream,
+                                          GtUword memlimit);
+
 #endif
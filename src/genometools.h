@@ -106,6 +106,7 @@ extern "C" {
 #include "extended/eof_node_api.h"
 #include "extended/extract_feature_stream_api.h"
 #include "extended/feature_index_api.h"
+#include "extended/feature_index_mapped_api.h"
 #include "extended/feature_index_memory_api.h"
 #include "extended/feature_in_stream_api.h"
 #include "extended/feature_node_api.h"
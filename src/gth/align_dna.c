@@ -15,8 +15,14 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <float.h>
 #include <math.h>
+#include <string.h>
 #include "core/divmodmul.h"
+#include "core/ensure.h"
+#include "core/ma_api.h"
+#include "core/mathsupport.h"
+#include "core/minmax.h"
 #include "core/safearith.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
@@ -46,6 +52,119 @@ static const char* dna_showretracenames(DnaRetrace retrace)
   return dna_retracenames[retrace];
 }
 
+/* score of the cells next to the band, they are never part of an optimal
+   path */
+#define DNA_OUTSIDE_BAND  ((GthFlt) -FLT_MAX)
+
+/* the following structure stores for every genomic position n of a banded DP
+   the range of reference positions evaluated for n */
+typedef struct {
+  GtUword *lo,
+          *hi;
+} DnaBand;
+
+/* the following function determines the band around the potential exons
+   given by <chain_ranges>: Within the exons the cDNA/EST advances with the
+   genomic sequence, within the introns it does not advance. Hence, after <n>
+   genomic positions containing <covered> exon positions, the reference position
+   lies between <covered> minus the excess of the exons over the reference and
+   <covered> plus the excess of the reference over the exons. The band extends
+   this range by <bandwidth> positions to both sides, to allow for insertions
+   and deletions and for imprecise exon borders. */
+static DnaBand* dna_band_new(const GtArray *chain_ranges,
+                             GtUword gen_dp_length,
+                             GtUword ref_dp_length,
+                             GtUword bandwidth)
+{
+  GtUword i = 0, n, pos, covered = 0, left, right;
+  const GtRange *range;
+  DnaBand *band;
+
+  gt_assert(chain_ranges && gt_array_size(chain_ranges));
+  band = gt_malloc(sizeof *band);
+  band->lo = gt_malloc(sizeof *band->lo * (gen_dp_length + 1));
+  band->hi = gt_malloc(sizeof *band->hi * (gen_dp_length + 1));
+
+  /* count the exon positions up to every genomic position */
+  range = gt_array_get_first(chain_ranges);
+  pos = range->start;
+  for (n = 1; n <= gen_dp_length; n++, pos++) {
+    while (pos > range->end && i + 1 < gt_array_size(chain_ranges))
+      range = gt_array_get(chain_ranges, ++i);
+    if (pos >= range->start && pos <= range->end)
+      covered++;
+    band->lo[n] = covered;
+  }
+
+  left = bandwidth + (covered > ref_dp_length ? covered - ref_dp_length : 0);
+  right = bandwidth + (ref_dp_length > covered ? ref_dp_length - covered : 0);
+
+  /* the first row is always evaluated completely */
+  band->lo[0] = 0;
+  band->hi[0] = ref_dp_length;
+  for (n = 1; n <= gen_dp_length; n++) {
+    covered = band->lo[n];
+    band->lo[n] = covered > left ? MIN(covered - left, ref_dp_length) : 0;
+    band->hi[n] = MIN(covered + right, ref_dp_length);
+  }
+  gt_assert(band->hi[gen_dp_length] == ref_dp_length);
+
+  return band;
+}
+
+static void dna_band_delete(DnaBand *band)
+{
+  if (!band) return;
+  gt_free(band->lo);
+  gt_free(band->hi);
+  gt_free(band);
+}
+
+/* every row of the backtrace table stores the genomic positions 2k and 2k+1,
+   the following function returns the number of reference positions stored in
+   row <k> of a banded backtrace table */
+static GtUword dna_band_row_width(const DnaBand *band, GtUword k,
+                                  GtUword gen_dp_length)
+{
+  return band->hi[MIN(GT_MULT2(k) + 1, gen_dp_length)] -
+         band->lo[GT_MULT2(k)] + 1;
+}
+
+/* the following macro refers to the cell of the backtrace table of <DPM> for
+   the genomic positions 2<K> and 2<K>+1 and the reference position <M> */
+#define DNA_PATH(DPM, K, M)\
+        (DPM)->path[K][(M) - ((DPM)->path_offset ? (DPM)->path_offset[K] : 0)]
+
+/* the following function allocates space for a banded backtrace table. Only
+   the cells in the band are stored, row <k> starts with reference position
+   dpm->path_offset[k]. */
+static void dp_matrix_alloc_banded_path(GthDPMatrix *dpm, const DnaBand *band,
+                                        GtUword numofrows, GtUword matrixsize,
+                                        GtUword gen_dp_length)
+{
+  GthPath *space;
+  GtUword k, offset = 0;
+
+  dpm->path = malloc(sizeof *dpm->path * numofrows);
+  if (!dpm->path)
+    return;
+  /* the cells have to be cleared, because the upper half of a cell may be set
+     although the lower half is outside of the band */
+  space = calloc(matrixsize, sizeof *space);
+  if (!space) {
+    free(dpm->path);
+    dpm->path = NULL;
+    return;
+  }
+  dpm->path_offset = gt_malloc(sizeof *dpm->path_offset * numofrows);
+  for (k = 0; k < numofrows; k++) {
+    dpm->path[k] = space + offset;
+    dpm->path_offset[k] = band->lo[GT_MULT2(k)];
+    offset += dna_band_row_width(band, k, gen_dp_length);
+  }
+  gt_assert(offset == matrixsize);
+}
+
 /* the following function allocates space for the DP tables for cDNAs/ESTs */
 static int dp_matrix_init(GthDPMatrix *dpm,
                           GtUword gen_dp_length,
@@ -53,21 +172,28 @@ static int dp_matrix_init(GthDPMatrix *dpm,
                           GtUword autoicmaxmatrixsize,
                           bool introncutout,
                           GthJumpTable *jump_table,
+                          const DnaBand *band,
                           GthStat *stat)
 {
-  GtUword t, n, m, matrixsize, sizeofpathtype =  sizeof (GthPath);
+  GtUword t, n, m, matrixsize, sizeofpathtype =  sizeof (GthPath),
+          numofrows = GT_DIV2(gen_dp_length + 1) + GT_MOD2(gen_dp_length + 1);
 
-  /* XXX: adjust this check for QUARTER_MATRIX case */
-  if (DNA_NUMOFSTATES * sizeofpathtype * (gen_dp_length + 1) >=
-      (~0)/(ref_dp_length + 1)) {
-    /* in this case the matrix would be larger than the addressable memory
-       of this machine -> return ERROR_MATRIX_ALLOCATION_FAILED */
-    return GTH_ERROR_MATRIX_ALLOCATION_FAILED;
+  if (band) {
+    matrixsize = 0;
+    for (n = 0; n < numofrows; n++)
+      matrixsize += dna_band_row_width(band, n, gen_dp_length);
   }
+  else {
+    /* XXX: adjust this check for QUARTER_MATRIX case */
+    if (DNA_NUMOFSTATES * sizeofpathtype * (gen_dp_length + 1) >=
+        (~0)/(ref_dp_length + 1)) {
+      /* in this case the matrix would be larger than the addressable memory
+         of this machine -> return ERROR_MATRIX_ALLOCATION_FAILED */
+      return GTH_ERROR_MATRIX_ALLOCATION_FAILED;
+    }
 
-  matrixsize = gt_safe_mult_ulong((GT_DIV2(gen_dp_length + 1) +
-                                   GT_MOD2(gen_dp_length + 1)),
-                                   ref_dp_length + 1);
+    matrixsize = gt_safe_mult_ulong(numofrows, ref_dp_length + 1);
+  }
 
   if (!introncutout && autoicmaxmatrixsize > 0) {
     /* in this case the automatic intron cutout technique is enabled
@@ -80,15 +206,16 @@ static int dp_matrix_init(GthDPMatrix *dpm,
   }
 
   /* allocate space for dpm->path */
-  if (jump_table) {
-    gth_array2dim_plain_calloc(dpm->path,
-                               GT_DIV2(gen_dp_length + 1) +
-                               GT_MOD2(gen_dp_length + 1), ref_dp_length + 1);
+  dpm->path_offset = NULL;
+  if (band) {
+    dp_matrix_alloc_banded_path(dpm, band, numofrows, matrixsize,
+                                gen_dp_length);
+  }
+  else if (jump_table) {
+    gth_array2dim_plain_calloc(dpm->path, numofrows, ref_dp_length + 1);
   }
   else {
-    gth_array2dim_plain_malloc(dpm->path,
-                               GT_DIV2(gen_dp_length + 1) +
-                               GT_MOD2(gen_dp_length + 1), ref_dp_length + 1);
+    gth_array2dim_plain_malloc(dpm->path, numofrows, ref_dp_length + 1);
   }
   dpm->path_jt = NULL;
   if (!dpm->path)
@@ -109,11 +236,11 @@ static int dp_matrix_init(GthDPMatrix *dpm,
   }
 
   /* initialize the DP matrices */
-  dpm->path[0][0]  = DNA_E_NM;
-  dpm->path[0][0] |= I_STATE_E_N;
+  DNA_PATH(dpm, 0, 0)  = DNA_E_NM;
+  DNA_PATH(dpm, 0, 0) |= I_STATE_E_N;
   for (m = 1; m <= ref_dp_length; m++) {
-    dpm->path[0][m]  = DNA_E_M;
-    dpm->path[0][m] |= I_STATE_I_N;
+    DNA_PATH(dpm, 0, m)  = DNA_E_M;
+    DNA_PATH(dpm, 0, m) |= I_STATE_I_N;
   }
 
   for (n = 0; n < DNA_NUMOFSCORETABLES; n++) {
@@ -222,7 +349,7 @@ static void E_1m(GthDPMatrix *dpm, unsigned char genomicchar,
 
   /* save maximum values */
   dpm->score[DNA_E_STATE][1][m] = maxvalue;
-  dpm->path[0][m] |= (retrace << 4);
+  DNA_PATH(dpm, 0, m) |= (retrace << 4);
 
   switch (retrace) {
     case DNA_I_NM:
@@ -260,7 +387,7 @@ static void I_1m(GthDPMatrix *dpm, GtUword m, GthDbl log_1minusprobies)
 
   /* save maximum values */
   dpm->score[DNA_I_STATE][1][m] = maxvalue;
-  dpm->path[0][m] |= (retrace << 4);
+  DNA_PATH(dpm, 0, m) |= (retrace << 4);
 
   switch (retrace) {
     case I_STATE_E_N:
@@ -275,7 +402,28 @@ static void I_1m(GthDPMatrix *dpm, GtUword m, GthDbl log_1minusprobies)
   }
 }
 
-/* the following function evaluate the dynamic programming tables */
+/* the following function sets the scores of the cells which are read when
+   the genomic positions <n> and <n>+1 are evaluated, but which lie outside of
+   the band of position <n> */
+static void dp_matrix_set_band_borders(GthDPMatrix *dpm, const DnaBand *band,
+                                       GtUword n)
+{
+  GtUword m, modn = GT_MOD2(n);
+
+  if (band->lo[n] > 0) {
+    dpm->score[DNA_E_STATE][modn][band->lo[n] - 1] = DNA_OUTSIDE_BAND;
+    dpm->score[DNA_I_STATE][modn][band->lo[n] - 1] = DNA_OUTSIDE_BAND;
+  }
+  if (n < dpm->gen_dp_length) {
+    for (m = band->hi[n] + 1; m <= band->hi[n + 1]; m++) {
+      dpm->score[DNA_E_STATE][modn][m] = DNA_OUTSIDE_BAND;
+      dpm->score[DNA_I_STATE][modn][m] = DNA_OUTSIDE_BAND;
+    }
+  }
+}
+
+/* the following function evaluate the dynamic programming tables, if <band> is
+   given only the cells in the band are evaluated */
 static void dna_complete_path_matrix(GthDPMatrix *dpm,
                                      const unsigned char *gen_seq_tran,
                                      const unsigned char *ref_seq_tran,
@@ -283,11 +431,12 @@ static void dna_complete_path_matrix(GthDPMatrix *dpm,
                                      GtAlphabet *gen_alphabet,
                                      GthDPParam *dp_param,
                                      GthDPOptionsEST *dp_options_est,
-                                     GthDPOptionsCore *dp_options_core)
+                                     GthDPOptionsCore *dp_options_core,
+                                     const DnaBand *band)
 {
   GthFlt value, maxvalue;
   GthPath retrace;
-  GtUword n, m, modn, modnminus1;
+  GtUword n, m, modn, modnminus1, mstart = 1, mend = dpm->ref_dp_length;
   GthDbl rval, outputweight, **outputweights,
          log_probies,          /* initial exon state probability */
          log_1minusprobies;    /* initial intron state probability */
@@ -314,11 +463,16 @@ static void dna_complete_path_matrix(GthDPMatrix *dpm,
 
   if (!genomic_offset) {
     /* handle case for n equals 1 */
-    dpm->path[0][0] |= UPPER_E_N;
-    dpm->path[0][0] |= UPPER_I_STATE_I_N;
+    DNA_PATH(dpm, 0, 0) |= UPPER_E_N;
+    DNA_PATH(dpm, 0, 0) |= UPPER_I_STATE_I_N;
+
+    if (band) {
+      dp_matrix_set_band_borders(dpm, band, 1);
+      mend = band->hi[1];
+    }
 
     /* stepping along the cDNA/EST sequence */
-    for (m = 1; m <= dpm->ref_dp_length; m++) {
+    for (m = 1; m <= mend; m++) {
       E_1m(dpm, gen_seq_tran[0], ref_seq_tran, m, gen_alphabet, log_probies,
            dp_options_est, dp_options_core);
       I_1m(dpm, m, log_1minusprobies);
@@ -337,17 +491,25 @@ static void dna_complete_path_matrix(GthDPMatrix *dpm,
     modnminus1 = GT_MOD2(n-1);
     genomicchar = gen_seq_tran[n-1];
 
-    if (modn) {
-      dpm->path[GT_DIV2(n)][0] |= UPPER_E_N;
-      dpm->path[GT_DIV2(n)][0] |= UPPER_I_STATE_I_N;
+    if (band) {
+      dp_matrix_set_band_borders(dpm, band, n);
+      mstart = MAX(band->lo[n], 1);
+      mend = band->hi[n];
     }
-    else {
-      dpm->path[GT_DIV2(n)][0]  = DNA_E_N;
-      dpm->path[GT_DIV2(n)][0] |= I_STATE_I_N;
+
+    if (!band || !band->lo[n]) {
+      if (modn) {
+        DNA_PATH(dpm, GT_DIV2(n), 0) |= UPPER_E_N;
+        DNA_PATH(dpm, GT_DIV2(n), 0) |= UPPER_I_STATE_I_N;
+      }
+      else {
+        DNA_PATH(dpm, GT_DIV2(n), 0)  = DNA_E_N;
+        DNA_PATH(dpm, GT_DIV2(n), 0) |= I_STATE_I_N;
+      }
     }
 
     /* stepping along the cDNA/EST sequence */
-    for (m = 1; m <= dpm->ref_dp_length; m++) {
+    for (m = mstart; m <= mend; m++) {
       referencechar = ref_seq_tran[m-1];
 
       /* evaluate E_nm */
@@ -430,9 +592,9 @@ static void dna_complete_path_matrix(GthDPMatrix *dpm,
       /* save maximum values */
       dpm->score[DNA_E_STATE][modn][m] = maxvalue;
       if (modn)
-        dpm->path[GT_DIV2(n)][m] |= (retrace << 4);
+        DNA_PATH(dpm, GT_DIV2(n), m) |= (retrace << 4);
       else
-        dpm->path[GT_DIV2(n)][m]  = retrace;
+        DNA_PATH(dpm, GT_DIV2(n), m)  = retrace;
 
       switch (retrace) {
         case DNA_I_NM:
@@ -472,9 +634,9 @@ static void dna_complete_path_matrix(GthDPMatrix *dpm,
       /* save maximum values */
       dpm->score[DNA_I_STATE][modn][m] = maxvalue;
       if (modn)
-        dpm->path[GT_DIV2(n)][m] |= (retrace << 4);
+        DNA_PATH(dpm, GT_DIV2(n), m) |= (retrace << 4);
       else
-        dpm->path[GT_DIV2(n)][m] |= retrace;
+        DNA_PATH(dpm, GT_DIV2(n), m) |= retrace;
 
       switch (retrace) {
        case I_STATE_E_N:
@@ -542,7 +704,7 @@ static int dna_evaltracepath(GthBacktracePath *backtrace_path, GthDPMatrix *dpm,
     /* here we map the quarter matrix bitvector stuff back on the simple Retrace
        types.  Thereby, no further changes on the backtracing procedure are
        necessary. */
-    pathtype = dpm->path[GT_DIV2(genptr)][refptr];
+    pathtype = DNA_PATH(dpm, GT_DIV2(genptr), refptr);
     if (dpm->path_jt)
       pathtype_jt = dpm->path_jt[GT_DIV2(genptr)][refptr];
     lower = (bool) !GT_MOD2(genptr);
@@ -762,6 +924,7 @@ static void dp_matrix_free(GthDPMatrix *dpm)
 
   /* freeing space for dpm->path */
   gth_array2dim_plain_delete(dpm->path);
+  gt_free(dpm->path_offset);
   if (dpm->path_jt)
     gt_array2dim_delete(dpm->path_jt);
 }
@@ -997,7 +1160,7 @@ static void detect_small_terminal_exons(GthSA *sa,
   }
 
   if (dp_matrix_init(&dpm_terminal, gen_dp_length_terminal,
-                     ref_dp_length_terminal, 0, false, NULL, stat)) {
+                     ref_dp_length_terminal, 0, false, NULL, NULL, stat)) {
     /* out of memory */
     return;
   }
@@ -1033,7 +1196,7 @@ static void detect_small_terminal_exons(GthSA *sa,
                            0,
                            gen_alphabet,
                            dp_param_terminal, dp_options_est_terminal,
-                           dp_options_core_terminal);
+                           dp_options_core_terminal, NULL);
   backtrace_path = gth_backtrace_path_new(gen_dp_start_terminal,
                                           gen_dp_length_terminal,
                                           ref_dp_start_terminal,
@@ -1135,7 +1298,7 @@ static void detect_small_initial_exons(GthSA *sa,
             gen_seq_bounds->end);
 
   if (dp_matrix_init(&dpm_initial, gen_dp_length_initial,
-                     ref_dp_length_initial, 0, false, NULL, stat)) {
+                     ref_dp_length_initial, 0, false, NULL, NULL, stat)) {
     /* out of memory */
     return;
   }
@@ -1153,7 +1316,7 @@ static void detect_small_initial_exons(GthSA *sa,
   dna_complete_path_matrix(&dpm_initial,
                            gen_seq_tran + gen_dp_start_initial, ref_seq_tran, 0,
                            gen_alphabet, dp_param_initial, dp_options_est,
-                           dp_options_core);
+                           dp_options_core, NULL);
   backtrace_path = gth_backtrace_path_new(gen_dp_start_initial,
                                           gen_dp_length_initial,
                                           ref_dp_start_initial,
@@ -1224,6 +1387,7 @@ static void detect_small_exons(GthSA *sa, GtUword *gen_dp_start,
 
 int gth_align_dna(GthSA *sa,
                   GtArray *gen_ranges,
+                  const GtArray *chain_ranges,
                   const unsigned char *gen_seq_tran,
                   GT_UNUSED const unsigned char *gen_seq_orig,
                   const unsigned char *ref_seq_tran,
@@ -1252,6 +1416,7 @@ int gth_align_dna(GthSA *sa,
   GthPathMatrix *pm = NULL;
   GthDPParam *dp_param;
   GthDPMatrix dpm;
+  DnaBand *band = NULL;
   int rval;
 
   gt_assert(gen_ranges);
@@ -1269,11 +1434,16 @@ int gth_align_dna(GthSA *sa,
     spliced_seq = gth_spliced_seq_new_with_comments(gen_seq_tran, gen_ranges,
                                                     comments, outfp);
   }
+  else if (dp_options_core->dpbandwidth && chain_ranges && !jump_table) {
+    band = dna_band_new(chain_ranges, gen_dp_length, ref_dp_length,
+                        dp_options_core->dpbandwidth);
+  }
   if ((rval = dp_matrix_init(&dpm,
                              introncutout ? spliced_seq->splicedseqlen
                                           : gen_dp_length,
                              ref_dp_length, autoicmaxmatrixsize, introncutout,
-                             jump_table, stat))) {
+                             jump_table, band, stat))) {
+    dna_band_delete(band);
     gth_dp_param_delete(dp_param);
     gth_spliced_seq_delete(spliced_seq);
     return rval;
@@ -1295,16 +1465,17 @@ int gth_align_dna(GthSA *sa,
                              introncutout ? spliced_seq->splicedseq
                                           : gen_seq_tran + gen_dp_start,
                              ref_seq_tran, 0, gen_alphabet, dp_param,
-                             dp_options_est, dp_options_core);
+                             dp_options_est, dp_options_core, band);
   }
 
-  /* debugging */
-  if (!dpm.path_jt &&
+  /* debugging (not possible for a banded backtrace table) */
+  if (!dpm.path_jt && !band &&
       dp_options_core->btmatrixgenrange.start != GT_UNDEF_UWORD) {
     pm = gth_path_matrix_new(dpm.path, dpm.gen_dp_length, dpm.ref_dp_length,
                              &dp_options_core->btmatrixgenrange,
                              &dp_options_core->btmatrixrefrange, NULL);
   }
+  dna_band_delete(band);
 
   /* backtracing */
   if ((rval = dna_find_optimal_path(gth_sa_backtrace_path(sa), &dpm,
@@ -1417,6 +1588,7 @@ GthSA* gth_align_dna_simple(GthInput *input,
   gt_array_add_elem(gen_ranges, (void*) gen_range, sizeof (GtRange));
   rval = gth_align_dna(sa,
                        gen_ranges,
+                       NULL,
                        gen_strand_forward
                        ? gth_input_current_gen_seq_tran(input)
                        : gth_input_current_gen_seq_tran_rc(input),
@@ -1454,3 +1626,152 @@ GthSA* gth_align_dna_simple(GthInput *input,
   gth_dp_options_core_delete(dp_options_core);
   return sa;
 }
+
+/* the following function aligns <ref_seq> to the part <gen_range> of
+   <gen_seq>, the band is derived from <chain_ranges> if <bandwidth> is not 0 */
+static GthSA* align_dna_unit_test_align(const char *gen_seq,
+                                        const GtUchar *gen_seq_tran,
+                                        GtUword gen_total_length,
+                                        const char *ref_seq,
+                                        const GtUchar *ref_seq_tran,
+                                        GtUword ref_dp_length,
+                                        GtRange gen_range,
+                                        const GtArray *chain_ranges,
+                                        GtUword bandwidth,
+                                        GtAlphabet *alphabet,
+                                        GthSpliceSiteModel *splice_site_model,
+                                        int *rval)
+{
+  GthDPOptionsCore *dp_options_core;
+  GthDPOptionsEST *dp_options_est;
+  GthDPOptionsPostpro *dp_options_postpro;
+  GtRange gen_seq_bounds;
+  GtArray *gen_ranges;
+  GthStat *stat;
+  GthSA *sa;
+  dp_options_core = gth_dp_options_core_new();
+  dp_options_core->dpbandwidth = bandwidth;
+  dp_options_est = gth_dp_options_est_new();
+  dp_options_postpro = gth_dp_options_postpro_new();
+  stat = gth_stat_new();
+  gen_seq_bounds.start = 0;
+  gen_seq_bounds.end = gen_total_length - 1;
+  sa = gth_sa_new();
+  gth_sa_set_gen_total_length(sa, gen_total_length);
+  gth_sa_set_ref_total_length(sa, ref_dp_length);
+  gth_backtrace_path_set_ref_dp_length(gth_sa_backtrace_path(sa),
+                                       ref_dp_length);
+  gen_ranges = gt_array_new(sizeof (GtRange));
+  gt_array_add(gen_ranges, gen_range);
+  *rval = gth_align_dna(sa, gen_ranges, chain_ranges, gen_seq_tran,
+                        (const unsigned char*) gen_seq, ref_seq_tran,
+                        (const unsigned char*) ref_seq, ref_dp_length,
+                        alphabet, alphabet, false, 0, false, false, false,
+                        &gen_seq_bounds, splice_site_model, dp_options_core,
+                        dp_options_est, dp_options_postpro, NULL, NULL, 0,
+                        stat, NULL);
+  gt_array_delete(gen_ranges);
+  gth_stat_delete(stat);
+  gth_dp_options_postpro_delete(dp_options_postpro);
+  gth_dp_options_est_delete(dp_options_est);
+  gth_dp_options_core_delete(dp_options_core);
+  return sa;
+}
+
+#define ALIGN_DNA_TEST_GEN_LENGTH  3000
+#define ALIGN_DNA_TEST_NUM_OF_EXONS  4
+
+int gth_align_dna_unit_test(GtError *err)
+{
+  static const GtUword exons[ALIGN_DNA_TEST_NUM_OF_EXONS][2] = {
+    { 150, 249 }, { 800, 879 }, { 1500, 1649 }, { 2400, 2499 }
+  };
+  static const GtUword bandwidths[] = { 15, 40 };
+  char gen_seq[ALIGN_DNA_TEST_GEN_LENGTH],
+       ref_seq[ALIGN_DNA_TEST_GEN_LENGTH];
+  GtUchar gen_seq_tran[ALIGN_DNA_TEST_GEN_LENGTH],
+          ref_seq_tran[ALIGN_DNA_TEST_GEN_LENGTH];
+  GthSpliceSiteModel *splice_site_model;
+  GtArray *chain_ranges;
+  GtAlphabet *alphabet;
+  GthSA *full_sa, *banded_sa;
+  GtRange gen_range, range;
+  GtUword i, j, pos, ref_dp_length = 0;
+  int rval, had_err = 0;
+  gt_error_check(err);
+
+  /* a random gene with canonical GT-AG introns, the cDNA carries a few
+     mismatches */
+  for (pos = 0; pos < ALIGN_DNA_TEST_GEN_LENGTH; pos++)
+    gen_seq[pos] = "acgt"[gt_rand_max(3)];
+  for (i = 0; i < ALIGN_DNA_TEST_NUM_OF_EXONS; i++) {
+    if (i + 1 < ALIGN_DNA_TEST_NUM_OF_EXONS) {
+      gen_seq[exons[i][1] + 1] = 'g';
+      gen_seq[exons[i][1] + 2] = 't';
+    }
+    if (i > 0) {
+      gen_seq[exons[i][0] - 2] = 'a';
+      gen_seq[exons[i][0] - 1] = 'g';
+    }
+    for (pos = exons[i][0]; pos <= exons[i][1]; pos++) {
+      ref_seq[ref_dp_length++] = gt_rand_max(49)
+                                 ? gen_seq[pos]
+                                 : "acgt"[gt_rand_max(3)];
+    }
+  }
+  alphabet = gt_alphabet_new_dna();
+  gt_alphabet_encode_seq(alphabet, gen_seq_tran, gen_seq,
+                         ALIGN_DNA_TEST_GEN_LENGTH);
+  gt_alphabet_encode_seq(alphabet, ref_seq_tran, ref_seq, ref_dp_length);
+  splice_site_model = gth_splice_site_model_new();
+
+  /* the chain ranges miss the inner exon borders and add short flanking
+     regions, the band covers the optimal alignment as long as these
+     deviations do not exceed the band width */
+  gen_range.start = exons[0][0] - 10;
+  gen_range.end = exons[ALIGN_DNA_TEST_NUM_OF_EXONS - 1][1] + 10;
+  chain_ranges = gt_array_new(sizeof (GtRange));
+  for (i = 0; i < ALIGN_DNA_TEST_NUM_OF_EXONS; i++) {
+    range.start = i ? exons[i][0] + 5 : gen_range.start;
+    range.end = i + 1 < ALIGN_DNA_TEST_NUM_OF_EXONS ? exons[i][1] - 5
+                                                    : gen_range.end;
+    gt_array_add(chain_ranges, range);
+  }
+
+  full_sa = align_dna_unit_test_align(gen_seq, gen_seq_tran,
+                                      ALIGN_DNA_TEST_GEN_LENGTH, ref_seq,
+                                      ref_seq_tran, ref_dp_length, gen_range,
+                                      NULL, 0, alphabet, splice_site_model,
+                                      &rval);
+  gt_ensure(!rval);
+  gt_ensure(gth_sa_num_of_exons(full_sa) == ALIGN_DNA_TEST_NUM_OF_EXONS);
+
+  for (j = 0; !had_err && j < sizeof bandwidths / sizeof *bandwidths; j++) {
+    banded_sa = align_dna_unit_test_align(gen_seq, gen_seq_tran,
+                                          ALIGN_DNA_TEST_GEN_LENGTH, ref_seq,
+                                          ref_seq_tran, ref_dp_length,
+                                          gen_range, chain_ranges,
+                                          bandwidths[j], alphabet,
+                                          splice_site_model, &rval);
+    gt_ensure(!rval);
+    gt_ensure(gth_sa_score(banded_sa) == gth_sa_score(full_sa));
+    gt_ensure(gth_sa_get_editoperations_length(banded_sa) ==
+              gth_sa_get_editoperations_length(full_sa));
+    gt_ensure(!memcmp(gth_sa_get_editoperations(banded_sa),
+                      gth_sa_get_editoperations(full_sa),
+                      sizeof (Editoperation) *
+                      gth_sa_get_editoperations_length(full_sa)));
+    gt_ensure(gth_sa_num_of_exons(banded_sa) == gth_sa_num_of_exons(full_sa));
+    for (i = 0; !had_err && i < gth_sa_num_of_exons(full_sa); i++) {
+      gt_ensure(!memcmp(gth_sa_get_exon(banded_sa, i),
+                        gth_sa_get_exon(full_sa, i), sizeof (Exoninfo)));
+    }
+    gth_sa_delete(banded_sa);
+  }
+
+  gth_sa_delete(full_sa);
+  gt_array_delete(chain_ranges);
+  gth_splice_site_model_delete(splice_site_model);
+  gt_alphabet_delete(alphabet);
+  return had_err;
+}
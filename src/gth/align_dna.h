@@ -105,9 +105,13 @@ typedef void (*GthDNACompletePathMatrixJT)(GthDPMatrix *dpm,
         }
 
 /* The following function implements the Spliced Alignment of Genomic DNA with
-   cDNA, as described by Usuka, Zhu and Brendel. */
+   cDNA, as described by Usuka, Zhu and Brendel. If <dp_options_core> sets a
+   band width, the DP is restricted to a band around the potential exons given
+   by <chain_ranges> (which can be NULL), unless <introncutout> or a
+   <jump_table> is used. */
 int gth_align_dna(GthSA*,
                   GtArray *gen_ranges,
+                  const GtArray *chain_ranges,
                   const unsigned char *gen_seq_tran,
                   const unsigned char *gen_seq_orig,
                   const unsigned char *ref_seq_tran,
@@ -147,4 +151,6 @@ void gth_show_backtrace_matrix(GthPath **path,
                                const GtRange *btmatrixgenrange,
                                const GtRange *btmatrixrefrange);
 
+int  gth_align_dna_unit_test(GtError*);
+
 #endif
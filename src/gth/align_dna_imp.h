@@ -78,6 +78,9 @@ struct GthDPMatrix {
   GthPath **path;                   /* backtrace table of size
                                         gen_dp_length * ref_dp_length */
   GthPath **path_jt;
+  GtUword *path_offset;             /* reference position of the first cell of
+                                       every row of a banded backtrace table,
+                                       NULL for a full table */
   GtUword *intronstart[DNA_NUMOFSCORETABLES],
                 *exonstart[DNA_NUMOFSCORETABLES],
                 gen_dp_length,
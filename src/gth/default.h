@@ -102,6 +102,7 @@
 #define GTH_DEFAULT_DPMININTRONLENGTH    50
 #define GTH_DEFAULT_SHORTEXONPENALTY     100.0
 #define GTH_DEFAULT_SHORTINTRONPENALTY   100.0
+#define GTH_DEFAULT_DPBANDWIDTH          0
 
 #define GTH_DEFAULT_JTOVERLAP            5
 #define GTH_DEFAULT_JTDEBUG              false
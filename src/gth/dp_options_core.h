@@ -30,6 +30,8 @@ typedef struct {
                dpminintronlength; /* minimum intron length */
   double shortexonpenalty,        /* penalty for short exons */
          shortintronpenalty;      /* penalty for short introns */
+  GtUword dpbandwidth;            /* band width of the DNA DP, 0 for the full
+                                     matrix */
   GtRange btmatrixgenrange,
           btmatrixrefrange;
   GtUword jtoverlap;
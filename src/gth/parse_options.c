@@ -186,6 +186,7 @@ GtOPrval gth_parse_options(GthCallInfo *call_info, GthInput *input,
          *optdpminintronlength = NULL,    /* short exon/intron parameters */
          *optshortexonpenalty = NULL,     /* short exon/intron parameters */
          *optshortintronpenalty = NULL,   /* short exon/intron parameters */
+         *optdpbandwidth = NULL,          /* banded DP */
          *optbtmatrixgenrange = NULL,
          *optbtmatrixrefrange = NULL,
          *optjtoverlap = NULL,
@@ -992,6 +993,21 @@ GtOPrval gth_parse_options(GthCallInfo *call_info, GthInput *input,
     gt_option_parser_add_option(op, optshortintronpenalty);
   }
 
+  /* -dpbandwidth */
+  if (!gthconsensus_parsing) {
+    optdpbandwidth = gt_option_new_uword("dpbandwidth", "restrict the DP for "
+                                         "cDNAs/ESTs to a band around the "
+                                         "potential exons of each chain, "
+                                         "which tolerates the given number of "
+                                         "insertions/deletions (0 evaluates "
+                                         "the complete matrix)",
+                                         &call_info->dp_options_core
+                                         ->dpbandwidth,
+                                         GTH_DEFAULT_DPBANDWIDTH);
+    gt_option_is_extended_option(optdpbandwidth);
+    gt_option_parser_add_option(op, optdpbandwidth);
+  }
+
   /* -btmatrixgenrage */
   if (!gthconsensus_parsing) {
     optbtmatrixgenrange = gt_option_new_range("btmatrixgenrange", "set the "
@@ -1316,6 +1332,8 @@ GtOPrval gth_parse_options(GthCallInfo *call_info, GthInput *input,
     gt_option_exclude(optskipalignmentout, optintermediate);
   if (optxmlout && optgff3out)
     gt_option_exclude(optxmlout, optgff3out);
+  if (optdpbandwidth && optintroncutout)
+    gt_option_exclude(optdpbandwidth, optintroncutout);
 
   /* option implications (single) */
   if (opttopos && optfrompos)
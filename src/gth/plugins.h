@@ -33,7 +33,8 @@ typedef struct {
   const char *gth_version;                            /* required */
   GtShowVersionFunc gth_version_func;                 /* required */
 
-  /* the optional jump table methods */
+  /* the optional jump table methods, the complete path matrix methods are
+     called concurrently for different chains if <gt_jobs> is larger than 1 */
   GthJumpTableNew jump_table_new;
   GthJumpTableNewReverse jump_table_new_reverse;
   GthJumpTableDelete jump_table_delete;
@@ -15,6 +15,8 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include "core/ma_api.h"
+#include "core/thread_pool.h"
 #include "core/trans_table.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
@@ -190,6 +192,7 @@ static int callsahmt(bool call_dna_dp,
     if (forward) {
       if (call_dna_dp) {
         rval = gth_align_dna(sa, used_chain->forwardranges,
+                             actual_chain->forwardranges,
                              gth_input_current_gen_seq_tran(input),
                              gth_input_current_gen_seq_orig(input),
                              ref_seq_tran, ref_seq_orig, ref_total_length,
@@ -225,6 +228,7 @@ static int callsahmt(bool call_dna_dp,
       /* the DP is called with the revers positions specifiers */
       if (call_dna_dp) {
         rval = gth_align_dna(sa, used_chain->reverseranges,
+                             actual_chain->reverseranges,
                              gth_input_current_gen_seq_tran_rc(input),
                              gth_input_current_gen_seq_orig_rc(input),
                              ref_seq_tran, ref_seq_orig, ref_total_length,
@@ -355,9 +359,13 @@ static bool isunsuccessfulalignment(GthSA *sa,
   return false;
 }
 
+/* the following function computes the spliced alignment <saA> of a DNA
+   reference sequence. If the other strand has to be considered, too, its
+   alignment is stored in <*saB> (allocated, if it is NULL). The alignment which
+   has to be saved is stored in <*sa_result>, the other one is deleted. */
 static int call_dna_DP(bool directmatches, GthCallInfo *call_info,
                        GthInput *input, GthStat *stat,
-                       GthSACollection *sa_collection, GthSA *saA,
+                       GthSA *saA, GthSA **saB, GthSA **sa_result,
                        GtUword gen_file_num,
                        GtUword ref_file_num,
                        GtUword gen_total_length,
@@ -379,7 +387,6 @@ static int call_dna_DP(bool directmatches, GthCallInfo *call_info,
   int rval;
   bool bothstrandsanalyzed, firstdp = true,
        GT_UNUSED gs2outdirectmatches = directmatches;
-  GthSA *saB = NULL;
   GtFile *outfp = call_info->out->outfp;
 
   if (directmatches ? gth_input_forward(input)
@@ -417,7 +424,7 @@ static int call_dna_DP(bool directmatches, GthCallInfo *call_info,
        Otherwise we have to calculate the alignment to the other strand
        first and then save the better one. */
     if (!bothstrandsanalyzed)
-      save_sa(sa_collection, saA, call_info->sa_filter, match_info, stat);
+      *sa_result = saA;
   }
 
   if (directmatches ? gth_input_reverse(input)
@@ -430,20 +437,20 @@ static int call_dna_DP(bool directmatches, GthCallInfo *call_info,
         gth_sa_set_gen_strand(saA, !directmatches);
         gth_sa_set_ref_strand(saA, false);
       }
-      else {
+      else if (!*saB) {
         /* allocating space for second alignment */
-        saB = gth_sa_new_and_set(!directmatches, false, input,
-                                 chain->gen_file_num, chain->gen_seq_num,
-                                 chain->ref_file_num, chain->ref_seq_num,
-                                 match_info->call_number, gen_total_length,
-                                 gen_offset, ref_total_length);
+        *saB = gth_sa_new_and_set(!directmatches, false, input,
+                                  chain->gen_file_num, chain->gen_seq_num,
+                                  chain->ref_file_num, chain->ref_seq_num,
+                                  match_info->call_number, gen_total_length,
+                                  gen_offset, ref_total_length);
       }
 
       /* setting gs2outdirectmatches (for compatibility) */
       gs2outdirectmatches = (bool) !directmatches;
 
       /* calculate alignment */
-      rval = callsahmt(true, firstdp ? saA : saB, !directmatches,
+      rval = callsahmt(true, firstdp ? saA : *saB, !directmatches,
                        gen_file_num, ref_file_num, chain, gen_total_length,
                        gen_offset, gen_seq_bounds, gen_seq_bounds_rc,
                        ref_seq_tran_rc, ref_seq_orig_rc, ref_total_length,
@@ -473,28 +480,29 @@ static int call_dna_DP(bool directmatches, GthCallInfo *call_info,
           return 0; /* continue */
         }
 
-        save_sa(sa_collection, saA, call_info->sa_filter, match_info, stat);
+        *sa_result = saA;
       }
       else /* !firstdp */
       {
         if (rval == GTH_ERROR_SA_COULD_NOT_BE_DETERMINED ||
-            isunsuccessfulalignment(saB, call_info->out->comments, outfp) ||
-            !gth_sa_B_is_better_than_A(saA, saB)) {
+            isunsuccessfulalignment(*saB, call_info->out->comments, outfp) ||
+            !gth_sa_B_is_better_than_A(saA, *saB)) {
           /* insert first SA */
-          save_sa(sa_collection, saA, call_info->sa_filter, match_info, stat);
+          *sa_result = saA;
           /* discard second SA */
-          gth_sa_delete(saB);
+          gth_sa_delete(*saB);
         }
         else {
           /* insert second SA */
-          save_sa(sa_collection, saB, call_info->sa_filter, match_info, stat);
+          *sa_result = *saB;
           /* free first SA */
           gth_sa_delete(saA);
         }
+        *saB = NULL;
       }
     }
     else
-      save_sa(sa_collection, saA, call_info->sa_filter, match_info, stat);
+      *sa_result = saA;
   }
 
   return 0;
@@ -504,8 +512,8 @@ static int call_protein_DP(bool directmatches,
                            GthCallInfo *call_info,
                            GthInput *input,
                            GthStat *stat,
-                           GthSACollection *sa_collection,
                            GthSA *saA,
+                           GthSA **sa_result,
                            GtUword gen_file_num,
                            GtUword ref_file_num,
                            GtUword gen_total_length,
@@ -563,7 +571,7 @@ static int call_protein_DP(bool directmatches,
   }
 
   /* we can save the alignment now */
-  save_sa(sa_collection, saA, call_info->sa_filter, match_info, stat);
+  *sa_result = saA;
 
   return 0;
 }
@@ -626,6 +634,348 @@ static GthChainCollection* match_and_chain(GthCallInfo *call_info,
   return chain_collection;
 }
 
+/* the data needed to compute the spliced alignment of a single chain */
+typedef struct {
+  GthChain *chain;
+  GtRange gen_seq_bounds,
+          gen_seq_bounds_rc,
+          range;               /* of the reference sequence */
+  GtUword gen_total_length,
+          gen_offset,
+          ref_total_length;
+  const unsigned char *ref_seq_tran,
+                      *ref_seq_orig,
+                      *ref_seq_tran_rc,
+                      *ref_seq_orig_rc;
+  GthSA *saA,
+        *saB,
+        *sa_result;
+  GthMatchInfo match_info;     /* for the parallel computation only */
+  GthStat *stat;               /* for the parallel computation only */
+  int rval;
+} GthSATask;
+
+/* the shared data of the parallel computation of spliced alignments */
+typedef struct {
+  GthSATask *tasks;
+  GthCallInfo *call_info;
+  GthInput *input;
+  GtUword gen_file_num,
+          ref_file_num,
+          num_of_chains;
+  bool refseqisdna,
+       directmatches;
+  GthDNACompletePathMatrixJT dna_complete_path_matrix_jt;
+  GthProteinCompletePathMatrixJT protein_complete_path_matrix_jt;
+} GthSATaskInfo;
+
+static void show_max_call_number_reached(const GthCallInfo *call_info,
+                                         bool refseqisdna)
+{
+  GtFile *outfp = call_info->out->outfp;
+
+  if (!(call_info->out->xmlout || call_info->out->gff3out))
+    gt_file_xfputc('\n', outfp);
+  else if (call_info->out->xmlout)
+    gt_file_xprintf(outfp, "<!--\n");
+
+  if (!call_info->out->gff3out) {
+    gt_file_xprintf(outfp, "Maximal matching %s count (%u) reached.\n",
+                    refseqisdna ? "EST" : "protein",
+                    call_info->firstalshown);
+    gt_file_xprintf(outfp, "Only the first %u matches will be "
+                       "displayed.\n", call_info->firstalshown);
+  }
+
+  if (!(call_info->out->xmlout || call_info->out->gff3out))
+    gt_file_xfputc('\n', outfp);
+  else if (call_info->out->xmlout)
+    gt_file_xprintf(outfp, "-->\n");
+}
+
+static void sa_task_prepare(GthSATask *task, GthChain *chain, GthInput *input,
+                            bool refseqisdna)
+{
+  task->chain = chain;
+
+  /* compute considered genomic regions if not set by -frompos */
+  if (!gth_input_use_substring_spec(input)) {
+    task->gen_seq_bounds = gth_input_get_genomic_range(input,
+                                                       chain->gen_file_num,
+                                                       chain->gen_seq_num);
+    task->gen_total_length  = gt_range_length(&task->gen_seq_bounds);
+    task->gen_offset        = task->gen_seq_bounds.start;
+    task->gen_seq_bounds_rc = task->gen_seq_bounds;
+  }
+  else {
+    /* genomic multiseq contains exactly one sequence */
+    gt_assert(gth_input_num_of_gen_seqs(input, chain->gen_file_num) == 1);
+    task->gen_total_length =
+      gth_input_genomic_file_total_length(input, chain->gen_file_num);
+    task->gen_seq_bounds.start    = gth_input_genomic_substring_from(input);
+    task->gen_seq_bounds.end      = gth_input_genomic_substring_to(input);
+    task->gen_offset              = 0;
+    task->gen_seq_bounds_rc.start = task->gen_total_length - 1
+                                    - task->gen_seq_bounds.end;
+    task->gen_seq_bounds_rc.end   = task->gen_total_length - 1
+                                    - task->gen_seq_bounds.start;
+  }
+
+  /* "retrieving" the reference sequence */
+  task->range = gth_input_get_reference_range(input, chain->ref_file_num,
+                                              chain->ref_seq_num);
+  task->ref_seq_tran = gth_input_current_ref_seq_tran(input)
+                       + task->range.start;
+  task->ref_seq_orig = gth_input_current_ref_seq_orig(input)
+                       + task->range.start;
+  task->ref_seq_tran_rc = task->ref_seq_orig_rc = NULL;
+  if (refseqisdna) {
+    task->ref_seq_tran_rc = gth_input_current_ref_seq_tran_rc(input)
+                            + task->range.start;
+    task->ref_seq_orig_rc = gth_input_current_ref_seq_orig_rc(input)
+                            + task->range.start;
+  }
+  task->ref_total_length = task->range.end - task->range.start + 1;
+
+  task->saA = task->saB = task->sa_result = NULL;
+  task->stat = NULL;
+  task->rval = 0;
+}
+
+static void sa_task_check_stop_amino_acid(const GthSATask *task,
+                                          GthInput *input, bool refseqisdna,
+                                          GthMatchInfo *match_info)
+{
+  /* check if protein sequences have a stop amino acid */
+  if (!refseqisdna && !match_info->stop_amino_acid_warning &&
+     task->ref_seq_orig[task->ref_total_length - 1] != GT_STOP_AMINO) {
+    GtStr *ref_id = gt_str_new();
+    gth_input_save_ref_id(input, ref_id, task->chain->ref_file_num,
+                          task->chain->ref_seq_num);
+    gt_warning("protein sequence '%s' (#" GT_WU " in file %s) does not end "
+               "with a stop amino acid ('%c'). If it is not a protein "
+               "fragment you should add a stop amino acid to improve the "
+               "prediction. For example with `gt seqtransform "
+               "-addstopaminos` (see http://genometools.org for details).",
+               gt_str_get(ref_id), task->chain->ref_seq_num,
+               gth_input_get_reference_filename(input,
+                                                task->chain->ref_file_num),
+               GT_STOP_AMINO);
+    match_info->stop_amino_acid_warning = true;
+    gt_str_delete(ref_id);
+  }
+}
+
+static void sa_task_new_sa(GthSATask *task, bool directmatches,
+                           GthInput *input, GtUword call_number)
+{
+  GthChain *chain = task->chain;
+
+  /* allocating space for alignment */
+  task->saA = gth_sa_new_and_set(directmatches, true, input,
+                                 chain->gen_file_num, chain->gen_seq_num,
+                                 chain->ref_file_num, chain->ref_seq_num,
+                                 call_number, task->gen_total_length,
+                                 task->gen_offset, task->ref_total_length);
+
+  /* extend the DP borders to the left and to the right */
+  gth_chain_extend_borders(chain, &task->gen_seq_bounds,
+                           &task->gen_seq_bounds_rc, task->gen_total_length,
+                           task->gen_offset);
+
+  /* From here on the dp positions always refer to the forward strand of the
+     genomic DNA. */
+}
+
+static int sa_task_calc(GthSATask *task, GthCallInfo *call_info,
+                        GthInput *input, GthStat *stat, GtUword gen_file_num,
+                        GtUword ref_file_num, bool refseqisdna,
+                        bool directmatches, GtUword chainctr,
+                        GtUword num_of_chains, GthMatchInfo *match_info,
+                        GthDNACompletePathMatrixJT dna_complete_path_matrix_jt,
+                        GthProteinCompletePathMatrixJT
+                        protein_complete_path_matrix_jt)
+{
+  /* call the Dynamic Programming */
+  if (refseqisdna) {
+    return call_dna_DP(directmatches, call_info, input, stat, task->saA,
+                       &task->saB, &task->sa_result, gen_file_num,
+                       ref_file_num, task->gen_total_length, task->gen_offset,
+                       &task->gen_seq_bounds, &task->gen_seq_bounds_rc,
+                       task->ref_total_length, task->range.start, chainctr,
+                       num_of_chains, match_info, task->ref_seq_tran,
+                       task->ref_seq_orig, task->ref_seq_tran_rc,
+                       task->ref_seq_orig_rc, task->chain,
+                       dna_complete_path_matrix_jt,
+                       protein_complete_path_matrix_jt);
+  }
+  return call_protein_DP(directmatches, call_info, input, stat, task->saA,
+                         &task->sa_result, gen_file_num, ref_file_num,
+                         task->gen_total_length, task->gen_offset,
+                         &task->gen_seq_bounds, &task->gen_seq_bounds_rc,
+                         task->ref_total_length, task->range.start, chainctr,
+                         num_of_chains, match_info, task->ref_seq_tran,
+                         task->ref_seq_orig, task->chain,
+                         dna_complete_path_matrix_jt,
+                         protein_complete_path_matrix_jt);
+}
+
+/* the following function saves the alignment computed by <task> (with return
+   value <rval>) in <sa_collection> and frees the remaining ones */
+static int sa_task_save(GthSATask *task, int rval,
+                        GthSACollection *sa_collection, GthCallInfo *call_info,
+                        GthStat *stat, GthMatchInfo *match_info)
+{
+  gth_sa_delete(task->saB);
+  task->saB = NULL;
+
+  /* check return value */
+  if (rval == GTH_ERROR_DP_PARAMETER_ALLOCATION_FAILED) {
+    /* statistics bookkeeping */
+    gth_stat_increment_numoffailedDPparameterallocations(stat);
+    gth_stat_increment_numofundeterminedSAs(stat);
+    /* free space */
+    gth_sa_delete(task->saA);
+    match_info->call_number--;
+    return 0; /* continue with the next DP range */
+  }
+  else if (rval) {
+    gth_sa_delete(task->saA);
+    return -1;
+  }
+
+  if (task->sa_result) {
+    save_sa(sa_collection, task->sa_result, call_info->sa_filter, match_info,
+            stat);
+  }
+  return 0;
+}
+
+static void sa_task_calc_range(GtUword start, GtUword end,
+                               GT_UNUSED unsigned int workerid, void *data)
+{
+  GthSATaskInfo *info = (GthSATaskInfo*) data;
+  GtUword chainctr;
+
+  for (chainctr = start; chainctr < end; chainctr++) {
+    GthSATask *task = info->tasks + chainctr;
+    /* the call number of this chain is only known after the alignments of
+       all previous chains have been saved, here we only record whether it
+       has been given back */
+    task->match_info.call_number = 1;
+    task->match_info.significant_match_found = false;
+    task->match_info.max_call_number_reached = false;
+    task->match_info.stop_amino_acid_warning = false;
+    task->rval = sa_task_calc(task, info->call_info, info->input, task->stat,
+                              info->gen_file_num, info->ref_file_num,
+                              info->refseqisdna, info->directmatches, chainctr,
+                              info->num_of_chains, &task->match_info,
+                              info->dna_complete_path_matrix_jt,
+                              info->protein_complete_path_matrix_jt);
+  }
+}
+
+/* The DP of the chains is independent of each other, only the input has to
+   be accessed sequentially. Hence the alignments are prepared sequentially,
+   computed on the workers of <pool>, and saved in the order of the chains.
+   This yields the same call numbers, statistics and spliced alignment
+   collection as the sequential computation. */
+static int calc_spliced_alignments_parallel(GthSACollection *sa_collection,
+                                            GthChainCollection
+                                            *chain_collection,
+                                            GthCallInfo *call_info,
+                                            GthInput *input,
+                                            GthStat *stat,
+                                            GtUword gen_file_num,
+                                            GtUword ref_file_num,
+                                            bool refseqisdna,
+                                            bool directmatches,
+                                            GthMatchInfo *match_info,
+                                            GthDNACompletePathMatrixJT
+                                            dna_complete_path_matrix_jt,
+                                            GthProteinCompletePathMatrixJT
+                                            protein_complete_path_matrix_jt,
+                                            GtThreadPool *pool)
+{
+  GthSATaskInfo info;
+  GthSATask *task;
+  GtUword chainctr;
+  int had_err = 0;
+
+  info.num_of_chains = gth_chain_collection_size(chain_collection);
+  info.tasks = gt_malloc(sizeof *info.tasks * info.num_of_chains);
+  info.call_info = call_info;
+  info.input = input;
+  info.gen_file_num = gen_file_num;
+  info.ref_file_num = ref_file_num;
+  info.refseqisdna = refseqisdna;
+  info.directmatches = directmatches;
+  info.dna_complete_path_matrix_jt = dna_complete_path_matrix_jt;
+  info.protein_complete_path_matrix_jt = protein_complete_path_matrix_jt;
+
+  for (chainctr = 0; chainctr < info.num_of_chains; chainctr++) {
+    task = info.tasks + chainctr;
+    sa_task_prepare(task,
+                    gth_chain_collection_get(chain_collection, chainctr),
+                    input, refseqisdna);
+    sa_task_new_sa(task, directmatches, input, 0);
+    if (refseqisdna && gth_input_both(input) && !call_info->cdnaforward) {
+      /* the alignment to the other strand might be needed */
+      task->saB = gth_sa_new_and_set(!directmatches, false, input,
+                                     task->chain->gen_file_num,
+                                     task->chain->gen_seq_num,
+                                     task->chain->ref_file_num,
+                                     task->chain->ref_seq_num, 0,
+                                     task->gen_total_length,
+                                     task->gen_offset,
+                                     task->ref_total_length);
+    }
+    task->stat = gth_stat_new();
+  }
+
+  gt_thread_pool_parallel_for(pool, 0, info.num_of_chains, 1,
+                              sa_task_calc_range, &info);
+
+  for (chainctr = 0; chainctr < info.num_of_chains; chainctr++) {
+    task = info.tasks + chainctr;
+    if (++match_info->call_number > call_info->firstalshown &&
+        call_info->firstalshown > 0) {
+      show_max_call_number_reached(call_info, refseqisdna);
+      match_info->max_call_number_reached = true;
+      break; /* break out of loop */
+    }
+    sa_task_check_stop_amino_acid(task, input, refseqisdna, match_info);
+    gth_stat_add(stat, task->stat);
+    if (task->sa_result)
+      gth_sa_set_call_number(task->sa_result, match_info->call_number);
+    if (!task->match_info.call_number)
+      match_info->call_number--;
+    if (task->match_info.significant_match_found)
+      match_info->significant_match_found = true;
+    if (sa_task_save(task, task->rval, sa_collection, call_info, stat,
+                     match_info)) {
+      chainctr++;
+      had_err = -1;
+      break;
+    }
+  }
+
+  /* free the alignments which have not been saved */
+  for (; chainctr < info.num_of_chains; chainctr++) {
+    task = info.tasks + chainctr;
+    if (task->rval)
+      gth_sa_delete(task->saA);
+    else
+      gth_sa_delete(task->sa_result);
+    gth_sa_delete(task->saB);
+  }
+  for (chainctr = 0; chainctr < info.num_of_chains; chainctr++)
+    gth_stat_delete(info.tasks[chainctr].stat);
+  gt_free(info.tasks);
+
+  return had_err;
+}
+
 static int calc_spliced_alignments(GthSACollection *sa_collection,
                                    GthChainCollection *chain_collection,
                                    GthCallInfo *call_info,
@@ -640,148 +990,55 @@ static int calc_spliced_alignments(GthSACollection *sa_collection,
                                    GthProteinCompletePathMatrixJT
                                    protein_complete_path_matrix_jt)
 {
-  const unsigned char *ref_seq_tran, *ref_seq_orig, *ref_seq_tran_rc = NULL,
-                      *ref_seq_orig_rc = NULL;
-  GtUword chainctr, gen_offset = GT_UNDEF_UWORD, gen_total_length,
-                ref_total_length;
+  GtUword chainctr, num_of_chains;
   GtFile *outfp = call_info->out->outfp;
-  GtRange gen_seq_bounds, gen_seq_bounds_rc;
+  GtThreadPool *pool;
   bool refseqisdna;
-  GthChain *chain;
-  GtRange range;
-  GthSA *saA;
+  GthSATask task;
   int rval;
 
   gt_assert(sa_collection && chain_collection);
 
   refseqisdna = gth_input_ref_file_is_dna(input, ref_file_num);
-
-  for (chainctr = 0;
-       chainctr < gth_chain_collection_size(chain_collection);
-       chainctr++) {
-       chain = gth_chain_collection_get(chain_collection, chainctr);
-    if (++match_info->call_number > call_info->firstalshown &&
-        call_info->firstalshown > 0) {
-      if (!(call_info->out->xmlout || call_info->out->gff3out))
-        gt_file_xfputc('\n', outfp);
-      else if (call_info->out->xmlout)
-        gt_file_xprintf(outfp, "<!--\n");
-
-      if (!call_info->out->gff3out) {
-        gt_file_xprintf(outfp, "Maximal matching %s count (%u) reached.\n",
-                        refseqisdna ? "EST" : "protein",
-                        call_info->firstalshown);
-        gt_file_xprintf(outfp, "Only the first %u matches will be "
-                           "displayed.\n", call_info->firstalshown);
-      }
-
-      if (!(call_info->out->xmlout || call_info->out->gff3out))
-        gt_file_xfputc('\n', outfp);
-      else if (call_info->out->xmlout)
-        gt_file_xprintf(outfp, "-->\n");
-
-      match_info->max_call_number_reached = true;
-      break; /* break out of loop */
-    }
-
-    /* compute considered genomic regions if not set by -frompos */
-    if (!gth_input_use_substring_spec(input)) {
-      gen_seq_bounds = gth_input_get_genomic_range(input, chain->gen_file_num,
-                                                   chain->gen_seq_num);
-      gen_total_length      = gt_range_length(&gen_seq_bounds);
-      gen_offset            = gen_seq_bounds.start;
-      gen_seq_bounds_rc     = gen_seq_bounds;
-    }
-    else {
-      /* genomic multiseq contains exactly one sequence */
-      gt_assert(gth_input_num_of_gen_seqs(input, chain->gen_file_num) == 1);
-      gen_total_length = gth_input_genomic_file_total_length(input,
-                                                             chain
-                                                             ->gen_file_num);
-      gen_seq_bounds.start    = gth_input_genomic_substring_from(input);
-      gen_seq_bounds.end      = gth_input_genomic_substring_to(input);
-      gen_offset              = 0;
-      gen_seq_bounds_rc.start = gen_total_length - 1 - gen_seq_bounds.end;
-      gen_seq_bounds_rc.end   = gen_total_length - 1 - gen_seq_bounds.start;
-    }
-
-    /* "retrieving" the reference sequence */
-    range = gth_input_get_reference_range(input, chain->ref_file_num,
-                                          chain->ref_seq_num);
-    ref_seq_tran = gth_input_current_ref_seq_tran(input) + range.start;
-    ref_seq_orig = gth_input_current_ref_seq_orig(input) + range.start;
-    if (refseqisdna) {
-      ref_seq_tran_rc = gth_input_current_ref_seq_tran_rc(input) + range.start;
-      ref_seq_orig_rc = gth_input_current_ref_seq_orig_rc(input) + range.start;
-    }
-    ref_total_length = range.end - range.start + 1;
-
-    /* check if protein sequences have a stop amino acid */
-    if (!refseqisdna && !match_info->stop_amino_acid_warning &&
-       ref_seq_orig[ref_total_length - 1] != GT_STOP_AMINO) {
-      GtStr *ref_id = gt_str_new();
-      gth_input_save_ref_id(input, ref_id, chain->ref_file_num,
-                            chain->ref_seq_num);
-      gt_warning("protein sequence '%s' (#" GT_WU " in file %s) does not end "
-                 "with a stop amino acid ('%c'). If it is not a protein "
-                 "fragment you should add a stop amino acid to improve the "
-                 "prediction. For example with `gt seqtransform "
-                 "-addstopaminos` (see http://genometools.org for details).",
-                 gt_str_get(ref_id), chain->ref_seq_num,
-                 gth_input_get_reference_filename(input, chain->ref_file_num),
-                 GT_STOP_AMINO);
-      match_info->stop_amino_acid_warning = true;
-      gt_str_delete(ref_id);
-    }
-
-    /* allocating space for alignment */
-    saA = gth_sa_new_and_set(directmatches, true, input, chain->gen_file_num,
-                             chain->gen_seq_num, chain->ref_file_num,
-                             chain->ref_seq_num, match_info->call_number,
-                             gen_total_length, gen_offset, ref_total_length);
-
-    /* extend the DP borders to the left and to the right */
-    gth_chain_extend_borders(chain, &gen_seq_bounds, &gen_seq_bounds_rc,
-                             gen_total_length, gen_offset);
-
-    /* From here on the dp positions always refer to the forward strand of the
-       genomic DNA. */
-
-    /* call the Dynamic Programming */
-    if (refseqisdna) {
-      rval = call_dna_DP(directmatches, call_info, input, stat,
-                         sa_collection, saA, gen_file_num, ref_file_num,
-                         gen_total_length, gen_offset, &gen_seq_bounds,
-                         &gen_seq_bounds_rc, ref_total_length, range.start,
-                         chainctr, gth_chain_collection_size(chain_collection),
-                         match_info, ref_seq_tran, ref_seq_orig,
-                         ref_seq_tran_rc, ref_seq_orig_rc, chain,
-                         dna_complete_path_matrix_jt,
-                         protein_complete_path_matrix_jt);
-    }
-    else {
-      rval = call_protein_DP(directmatches, call_info, input,
-                             stat, sa_collection, saA, gen_file_num,
-                             ref_file_num, gen_total_length, gen_offset,
-                             &gen_seq_bounds, &gen_seq_bounds_rc,
-                             ref_total_length, range.start, chainctr,
-                             gth_chain_collection_size(chain_collection),
-                             match_info, ref_seq_tran, ref_seq_orig, chain,
-                             dna_complete_path_matrix_jt,
-                             protein_complete_path_matrix_jt);
+  num_of_chains = gth_chain_collection_size(chain_collection);
+
+  /* the DP only runs in parallel if it does not produce any output */
+  if (gt_jobs > 1 && num_of_chains > 1 && !call_info->out->showverbose &&
+      !call_info->out->comments && !call_info->out->showeops &&
+      (pool = gt_thread_pool_get(NULL)) != NULL) {
+    if (calc_spliced_alignments_parallel(sa_collection, chain_collection,
+                                         call_info, input, stat, gen_file_num,
+                                         ref_file_num, refseqisdna,
+                                         directmatches, match_info,
+                                         dna_complete_path_matrix_jt,
+                                         protein_complete_path_matrix_jt,
+                                         pool)) {
+      return -1;
     }
-    /* check return value */
-    if (rval == GTH_ERROR_DP_PARAMETER_ALLOCATION_FAILED) {
-      /* statistics bookkeeping */
-      gth_stat_increment_numoffailedDPparameterallocations(stat);
-      gth_stat_increment_numofundeterminedSAs(stat);
-      /* free space */
-      gth_sa_delete(saA);
-      match_info->call_number--;
-      continue; /* continue with the next DP range */
+  }
+  else {
+    for (chainctr = 0; chainctr < num_of_chains; chainctr++) {
+      if (++match_info->call_number > call_info->firstalshown &&
+          call_info->firstalshown > 0) {
+        show_max_call_number_reached(call_info, refseqisdna);
+        match_info->max_call_number_reached = true;
+        break; /* break out of loop */
+      }
+      sa_task_prepare(&task,
+                      gth_chain_collection_get(chain_collection, chainctr),
+                      input, refseqisdna);
+      sa_task_check_stop_amino_acid(&task, input, refseqisdna, match_info);
+      sa_task_new_sa(&task, directmatches, input, match_info->call_number);
+      rval = sa_task_calc(&task, call_info, input, stat, gen_file_num,
+                          ref_file_num, refseqisdna, directmatches, chainctr,
+                          num_of_chains, match_info,
+                          dna_complete_path_matrix_jt,
+                          protein_complete_path_matrix_jt);
+      if (sa_task_save(&task, rval, sa_collection, call_info, stat,
+                       match_info)) {
+        return -1;
+      }
     }
-    else if (rval)
-      return -1;
   }
 
   if (!call_info->out->xmlout && !call_info->out->gff3out && !directmatches &&
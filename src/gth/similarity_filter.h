@@ -21,6 +21,12 @@
 #include "gth/plugins.h"
 #include "gth/stat.h"
 
+/* Compute the spliced alignments of the chains of all genomic and reference
+   files given by <GthInput> and process them. If <gt_jobs> is larger than 1
+   and no verbose, comment or edit operation output is requested, the
+   alignments of the chains of each genomic and reference file pair are
+   computed on the workers of the thread pool, with the same result as the
+   sequential computation. */
 int gth_similarity_filter(GthCallInfo*, GthInput*, GthStat*,
                           unsigned int indentlevel, const GthPlugins *plugins,
                           GtError*);
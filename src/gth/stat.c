@@ -348,6 +348,28 @@ static void outputmemorystatistics(GthStat *stat, bool show_full_stats,
   }
 }
 
+void gth_stat_add(GthStat *dest, const GthStat *src)
+{
+  gt_assert(dest && src);
+  dest->numofchains += src->numofchains;
+  dest->numofremovedzerobaseexons += src->numofremovedzerobaseexons;
+  dest->numofautointroncutoutcalls += src->numofautointroncutoutcalls;
+  dest->numofunsuccessfulintroncutoutDPs +=
+    src->numofunsuccessfulintroncutoutDPs;
+  dest->numoffailedDPparameterallocations +=
+    src->numoffailedDPparameterallocations;
+  dest->numoffailedmatrixallocations += src->numoffailedmatrixallocations;
+  dest->numofundeterminedSAs += src->numofundeterminedSAs;
+  dest->numoffilteredpolyAtailmatches += src->numoffilteredpolyAtailmatches;
+  dest->numofSAs += src->numofSAs;
+  dest->numofPGLs_stored += src->numofPGLs_stored;
+  gt_safe_add(dest->totalsizeofbacktracematricesinMB,
+              dest->totalsizeofbacktracematricesinMB,
+              src->totalsizeofbacktracematricesinMB);
+  dest->numofbacktracematrixallocations +=
+    src->numofbacktracematrixallocations;
+}
+
 void gth_stat_show(GthStat *stat, bool show_full_stats, bool xmlout,
                    GtFile *outfp)
 {
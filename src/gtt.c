@@ -39,9 +39,11 @@
 #include "core/dlist.h"
 #include "core/dyn_bittab.h"
 #include "core/encseq.h"
+#include "core/file.h"
 #include "core/grep_api.h"
 #include "core/hashmap.h"
 #include "core/hashtable.h"
+#include "core/interval_index.h"
 #include "core/interval_tree.h"
 #include "core/mathsupport.h"
 #include "core/md5_seqid.h"
@@ -50,11 +52,13 @@
 #include "core/sequence_buffer.h"
 #include "core/splitter.h"
 #include "core/symbol.h"
+#include "core/thread_pool.h"
 #include "core/tokenizer.h"
 #include "core/trans_table.h"
 #include "core/translator.h"
 #include "extended/alignment.h"
 #include "extended/anno_db_gfflike_api.h"
+#include "extended/attribute_map.h"
 #include "extended/compressed_bitsequence.h"
 #include "extended/editscript.h"
 #include "extended/elias_gamma.h"
@@ -62,11 +66,14 @@
 #include "extended/evaluator.h"
 #include "extended/feature_in_stream.h"
 #include "extended/feature_index.h"
+#include "extended/feature_index_mapped.h"
 #include "extended/feature_index_memory.h"
 #include "extended/feature_node.h"
 #include "extended/feature_node_iterator_api.h"
 #include "extended/genome_node.h"
+#include "extended/genome_node_io.h"
 #include "extended/gff3_escaping.h"
+#include "extended/gff3_references.h"
 #include "extended/golomb.h"
 #include "extended/hmm.h"
 #include "extended/huffcode.h"
@@ -74,6 +81,7 @@
 #include "extended/kmer_database.h"
 #include "extended/luaserialize.h"
 #include "extended/multieoplist.h"
+#include "extended/node_arena.h"
 #include "extended/popcount_tab.h"
 #include "extended/priority_queue.h"
 #include "extended/ranked_list.h"
@@ -83,6 +91,7 @@
 #include "extended/string_matching.h"
 #include "extended/tag_value_map.h"
 #include "extended/uint64hashtable.h"
+#include "gth/align_dna.h"
 #include "ltr/gt_ltrclustering.h"
 #include "ltr/gt_ltrdigest.h"
 #include "ltr/gt_ltrharvest.h"
@@ -91,6 +100,7 @@
 #include "match/rdj-spmlist.h"
 #include "match/rdj-strgraph.h"
 #include "match/shu-encseq-gc.h"
+#include "match/wordwise-lcp.h"
 #include "match/xdrop.h"
 #include "tools/gt_bed_to_gff3.h"
 #include "tools/gt_cds.h"
@@ -266,10 +276,8 @@ GtToolbox* gtt_tools(void)
   gt_toolbox_add_tool(tools, "sketch", gt_sketch());
   gt_toolbox_add_tool(tools, "sketch_page", gt_sketch_page());
 #endif
-#if defined (HAVE_MYSQL) || defined (HAVE_SQLITE)
   gt_toolbox_add_tool(tools, "featureindex", gt_featureindex());
   gt_toolbox_add_tool(tools, "mkfeatureindex", gt_mkfeatureindex());
-#endif
 
   return tools;
 }
@@ -288,6 +296,7 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "array2dim sparse example",
                                                    gt_array2dim_sparse_example);
   gt_hashmap_add(unit_tests, "array3dim example", gt_array3dim_example);
+  gt_hashmap_add(unit_tests, "attribute map class", gt_attribute_map_unit_test);
   gt_hashmap_add(unit_tests, "basename module", gt_basename_unit_test);
   gt_hashmap_add(unit_tests, "bit pack array class", gt_bitpackarray_unit_test);
   gt_hashmap_add(unit_tests, "bit pack string module",
@@ -322,20 +331,29 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "encseq gc module", gt_encseq_gc_unit_test);
   gt_hashmap_add(unit_tests, "evaluator class", gt_evaluator_unit_test);
   gt_hashmap_add(unit_tests, "evalue module", gt_evalue_unit_test);
+  gt_hashmap_add(unit_tests, "file class", gt_file_unit_test);
+  gt_hashmap_add(unit_tests, "mapped feature index class",
+                                             gt_feature_index_mapped_unit_test);
   gt_hashmap_add(unit_tests, "feature node iterator example",
                                              gt_feature_node_iterator_example);
   gt_hashmap_add(unit_tests, "feature node class", gt_feature_node_unit_test);
   gt_hashmap_add(unit_tests, "feature in stream class",
                                                 gt_feature_in_stream_unit_test);
   gt_hashmap_add(unit_tests, "genome node class", gt_genome_node_unit_test);
+  gt_hashmap_add(unit_tests, "genome node io", gt_genome_node_io_unit_test);
   gt_hashmap_add(unit_tests, "gff3 escaping module",
                                                     gt_gff3_escaping_unit_test);
+  gt_hashmap_add(unit_tests, "gff3 references class",
+                 gt_gff3_references_unit_test);
   gt_hashmap_add(unit_tests, "grep module", gt_grep_unit_test);
+  gt_hashmap_add(unit_tests, "gth DNA alignment module",
+                                                       gth_align_dna_unit_test);
   gt_hashmap_add(unit_tests, "golomb class", gt_golomb_unit_test);
   gt_hashmap_add(unit_tests, "hashmap class", gt_hashmap_unit_test);
   gt_hashmap_add(unit_tests, "hashtable class", gt_hashtable_unit_test);
   gt_hashmap_add(unit_tests, "hmm class", gt_hmm_unit_test);
   gt_hashmap_add(unit_tests, "huffman coding class", gt_huffman_unit_test);
+  gt_hashmap_add(unit_tests, "interval index", gt_interval_index_unit_test);
   gt_hashmap_add(unit_tests, "interval tree class", gt_interval_tree_unit_test);
   gt_hashmap_add(unit_tests, "intset classes", gt_intset_unit_test);
   gt_hashmap_add(unit_tests, "karlin altschul class",
@@ -347,6 +365,7 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "memory allocator module", gt_ma_unit_test);
   gt_hashmap_add(unit_tests, "multieoplist", gt_multieoplist_unit_test);
   gt_hashmap_add(unit_tests, "MD5 seqid module", gt_md5_seqid_unit_test);
+  gt_hashmap_add(unit_tests, "node arena class", gt_node_arena_unit_test);
   gt_hashmap_add(unit_tests, "rdj: suffix-prefix matches list module",
                                                           gt_spmlist_unit_test);
   gt_hashmap_add(unit_tests, "PBS finder module",
@@ -373,10 +392,12 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "symbol module", gt_symbol_unit_test);
   gt_hashmap_add(unit_tests, "tag value map class", gt_tag_value_map_unit_test);
   gt_hashmap_add(unit_tests, "tag value map example", gt_tag_value_map_example);
+  gt_hashmap_add(unit_tests, "thread pool class", gt_thread_pool_unit_test);
   gt_hashmap_add(unit_tests, "tokenizer class", gt_tokenizer_unit_test);
   gt_hashmap_add(unit_tests, "translator class", gt_translator_unit_test);
   gt_hashmap_add(unit_tests, "transtable class", gt_trans_table_unit_test);
   gt_hashmap_add(unit_tests, "uint64hashtable", gt_uint64hashtable_unit_test);
+  gt_hashmap_add(unit_tests, "wordwise lcp", gt_wordwise_lcp_unit_test);
   gt_hashmap_add(unit_tests, "xdrop", gt_xdrop_unit_test);
 #ifndef WITHOUT_CAIRO
   gt_hashmap_add(unit_tests, "block class", gt_block_unit_test);
@@ -29,10 +29,10 @@
 #include "core/mathsupport.h"
 #include "core/md5_seqid.h"
 #include "core/minmax.h"
-#include "core/multithread_api.h"
 #include "core/qsort_r_api.h"
 #include "core/str_api.h"
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #include "core/types_api.h"
 #include "core/undef_api.h"
 #include "core/warning_api.h"
@@ -892,17 +892,51 @@ static void adjustboundariesfromXdropextension(GtXdropbest xdropbest_left,
   boundaries->rightLTR_3 = seed2_endpos + xdropbest_right.jvalue;
 }
 
+/* The resources needed by one worker thread to extend and check seeds. */
+typedef struct {
+  GtXdropresources *xdropresources;
+  GtSeqabstract *sa_useq, *sa_vseq;
+  GtFrontResource *frontresource;
+} GtLTRharvestWorkspace;
+
+typedef struct {
+  GtLTRharvestStream *lo;
+  GtArrayLTRboundaries *arrayLTRboundaries;
+  GtLTRharvestWorkspace *workspaces;
+  GtError *err;
+  GtMutex *wmutex;
+  bool haserr;
+} GtLTRharvestThreadInfo;
+
+/* <haserr> is set by any of the workers, so it is only read under
+   <wmutex> */
+static bool gt_ltrharvest_thread_haserr(GtLTRharvestThreadInfo *info)
+{
+  bool haserr;
+
+  gt_mutex_lock(info->wmutex);
+  haserr = info->haserr;
+  gt_mutex_unlock(info->wmutex);
+  return haserr;
+}
+
 /* The following function applies the filter algorithms one after another
-   to all candidate pairs */
-static int gt_searchforLTRs(GtLTRharvestStream *lo,
-                            GtArrayLTRboundaries *arrayLTRboundaries,
-                            GT_UNUSED GtMutex *rmutex,
-                            GT_UNUSED GtMutex *wmutex,
-                            GtUword *cur_seed,
-                            GtError *err)
+   to the candidate pairs with seed numbers from <seedstart> to
+   <seedend> - 1 */
+static void gt_searchforLTRs(GtUword seedstart,
+                             GtUword seedend,
+                             unsigned int workerid,
+                             void *data)
 {
+  GtLTRharvestThreadInfo *info = (GtLTRharvestThreadInfo*) data;
+  GtLTRharvestStream *lo = info->lo;
+  GtArrayLTRboundaries *arrayLTRboundaries = info->arrayLTRboundaries;
+#ifdef GT_THREADS_ENABLED
+  GtMutex *wmutex = info->wmutex;
+#endif
   GtUword my_seed;
-  GtXdropresources *xdropresources;
+  GtXdropresources *xdropresources
+    = info->workspaces[workerid].xdropresources;
   GtXdropbest xdropbest_left, xdropbest_right;
 #undef GT_GREEDY_BUFFER
 #ifdef GT_GREEDY_BUFFER
@@ -910,32 +944,22 @@ static int gt_searchforLTRs(GtLTRharvestStream *lo,
   GtUchar *useq = NULL,
           *vseq = NULL;
 #endif
-  GtSeqabstract *sa_useq = gt_seqabstract_new_empty(),
-                *sa_vseq = gt_seqabstract_new_empty();
+  GtSeqabstract *sa_useq = info->workspaces[workerid].sa_useq,
+                *sa_vseq = info->workspaces[workerid].sa_vseq;
   GtUword edist,
                 alilen = 0;
   Repeat *repeatptr;
   LTRboundaries boundaries, *boundaries_ptr;
-  GtFrontResource *frontresource = gt_frontresource_new(100UL);
-  bool haserr = false;
-
-  gt_error_check(err);
-  xdropresources = gt_xdrop_resources_new(&lo->arbitscores);
+  GtFrontResource *frontresource = info->workspaces[workerid].frontresource;
+  GtError *err = gt_error_new();
 
-  /* XXX: do thread-synchronized error checking */
-  while (true) {
+  for (my_seed = seedstart;
+       my_seed < seedend && !gt_ltrharvest_thread_haserr(info);
+       my_seed++) {
     GtUword ulen,
                   vlen,
                   seqend,
                   seqstart;
-    gt_mutex_lock(rmutex);
-    if (*cur_seed < lo->repeatinfo.repeats.nextfreeRepeat)
-      my_seed = (*cur_seed)++;
-    else {
-      gt_mutex_unlock(rmutex);
-      break;
-    }
-    gt_mutex_unlock(rmutex);
     repeatptr = &(lo->repeatinfo.repeats.spaceRepeat[my_seed]);
 
     /* check whether max LTR length is exceeded by seed alone */
@@ -1059,7 +1083,13 @@ static int gt_searchforLTRs(GtLTRharvestStream *lo,
     {
       if (gt_findcorrectboundaries(lo, &boundaries, err) != 0)
       {
-        haserr = true;
+        gt_mutex_lock(wmutex);
+        if (!info->haserr)
+        {
+          gt_error_set(info->err, "%s", gt_error_get(err));
+          info->haserr = true;
+        }
+        gt_mutex_unlock(wmutex);
         break;
       }
 
@@ -1139,30 +1169,7 @@ static int gt_searchforLTRs(GtLTRharvestStream *lo,
   FREESPACE(useq);
   FREESPACE(vseq);
 #endif
-  gt_xdrop_resources_delete(xdropresources);
-  gt_seqabstract_delete(sa_useq);
-  gt_seqabstract_delete(sa_vseq);
-  gt_frontresource_delete(frontresource);
-  return haserr ? -1 : 0;
-}
-
-typedef struct {
-  GtLTRharvestStream *lo;
-  GtArrayLTRboundaries *arrayLTRboundaries;
-  const GtEncseq *encseq;
-  GtError *err;
-  GtMutex *rmutex, *wmutex;
-  GtUword cur_seed;
-} GtLTRharvestThreadInfo;
-
-static void* gt_searchforLTRs_threadfunc(void *data) {
-  GtLTRharvestThreadInfo *info = (GtLTRharvestThreadInfo*) data;
-  GT_UNUSED int rval;
-  gt_assert(info);
-  rval = gt_searchforLTRs(info->lo, info->arrayLTRboundaries, info->rmutex,
-                          info->wmutex, &info->cur_seed, info->err);
-  gt_assert(rval == 0);
-  return NULL;
+  gt_error_delete(err);
 }
 
 /* The following function removes exact duplicates from the (sorted!)
@@ -1250,6 +1257,7 @@ static int gt_ltrharvest_stream_next(GtNodeStream *ns,
 {
   GtLTRharvestStream *ltrh_stream;
   GtLTRharvestThreadInfo threadinfo;
+  GtThreadPool *pool = NULL;
   int had_err = 0;
   gt_error_check(err);
 
@@ -1266,29 +1274,56 @@ static int gt_ltrharvest_stream_next(GtNodeStream *ns,
       had_err = -1;
     }
 
-    threadinfo.lo = ltrh_stream;
-    threadinfo.encseq = ltrh_stream->encseq;
-    threadinfo.arrayLTRboundaries = &ltrh_stream->arrayLTRboundaries;
-    threadinfo.err = err;
-    threadinfo.cur_seed = 0;
-    threadinfo.rmutex = gt_mutex_new();
-    threadinfo.wmutex = gt_mutex_new();
-    /* apply the seed extension and filter algorithms */
-    if (!had_err && gt_multithread(gt_searchforLTRs_threadfunc,
-                                   &threadinfo, err) != 0)
+    /* apply the seed extension and filter algorithms, seeds are distributed
+       over the workers of the thread pool */
+    if (!had_err && !(pool = gt_thread_pool_get(err)))
     {
       had_err = -1;
     }
-    gt_mutex_delete(threadinfo.rmutex);
-    gt_mutex_delete(threadinfo.wmutex);
+    if (!had_err)
+    {
+      unsigned int w;
+
+      threadinfo.lo = ltrh_stream;
+      threadinfo.arrayLTRboundaries = &ltrh_stream->arrayLTRboundaries;
+      threadinfo.err = err;
+      threadinfo.wmutex = gt_mutex_new();
+      threadinfo.haserr = false;
+      threadinfo.workspaces = gt_malloc(sizeof *threadinfo.workspaces
+                                        * gt_thread_pool_size(pool));
+      for (w = 0; w < gt_thread_pool_size(pool); w++)
+      {
+        threadinfo.workspaces[w].xdropresources
+          = gt_xdrop_resources_new(&ltrh_stream->arbitscores);
+        threadinfo.workspaces[w].sa_useq = gt_seqabstract_new_empty();
+        threadinfo.workspaces[w].sa_vseq = gt_seqabstract_new_empty();
+        threadinfo.workspaces[w].frontresource = gt_frontresource_new(100UL);
+      }
+      gt_thread_pool_parallel_for(pool, 0,
+                                  ltrh_stream->repeatinfo.repeats.nextfreeRepeat,
+                                  0, gt_searchforLTRs, &threadinfo);
+      for (w = 0; w < gt_thread_pool_size(pool); w++)
+      {
+        gt_xdrop_resources_delete(threadinfo.workspaces[w].xdropresources);
+        gt_seqabstract_delete(threadinfo.workspaces[w].sa_useq);
+        gt_seqabstract_delete(threadinfo.workspaces[w].sa_vseq);
+        gt_frontresource_delete(threadinfo.workspaces[w].frontresource);
+      }
+      gt_free(threadinfo.workspaces);
+      gt_mutex_delete(threadinfo.wmutex);
+      if (threadinfo.haserr)
+      {
+        had_err = -1;
+      }
+    }
 
     /* not needed any longer */
     GT_FREEARRAY(&ltrh_stream->repeatinfo.repeats, Repeat);
 
     /* sort results after seed extension */
-    if (!had_err && threadinfo.arrayLTRboundaries->spaceLTRboundaries) {
-      gt_qsort_r(threadinfo.arrayLTRboundaries->spaceLTRboundaries,
-            (size_t) threadinfo.arrayLTRboundaries->nextfreeLTRboundaries,
+    if (!had_err && ltrh_stream->arrayLTRboundaries.spaceLTRboundaries) {
+      gt_qsort_r(ltrh_stream->arrayLTRboundaries.spaceLTRboundaries,
+            (size_t) ltrh_stream->arrayLTRboundaries.nextfreeLTRboundaries,
              sizeof (LTRboundaries), NULL, bdcompare);
     }
 
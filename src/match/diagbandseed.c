@@ -55,6 +55,7 @@
 
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 
 /* We need to use 6 digits for the micro seconds */
@@ -116,6 +117,7 @@ struct GtDiagbandseedInfo
        debug_kmer,
        debug_seedpair,
        use_kmerfile,
+       pipeline_parts,
        trimstat_on;
 };
 
@@ -236,6 +238,7 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
                                              bool debug_kmer,
                                              bool debug_seedpair,
                                              bool use_kmerfile,
+                                             bool pipeline_parts,
                                              bool trimstat_on,
                                              GtUword maxmat,
                                              const GtStr *chainarguments,
@@ -266,6 +269,7 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
   info->debug_kmer = debug_kmer;
   info->debug_seedpair = debug_seedpair;
   info->use_kmerfile = use_kmerfile;
+  info->pipeline_parts = pipeline_parts;
   info->trimstat_on = trimstat_on;
   info->maxmat = maxmat;
   info->chainarguments = chainarguments;
@@ -3971,74 +3975,255 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
 }
 
 #ifdef GT_THREADS_ENABLED
-typedef struct{
+/* A combination of a part of the 1st and a part of the 2nd sequence set,
+   processed as one task by the scheduler below. */
+typedef struct
+{
+  GtUwordPair comb;
+  double estimated_seeds;
+} GtDiagbandseedTask;
+
+/* Threads pull the tasks from a shared queue sorted by decreasing estimated
+   number of seeds, so that the largest combinations are started first and
+   the small ones fill the gaps at the end. If <prefetch_aidx> is a valid part
+   number, the k-mers of this part of the 1st sequence set are extracted by
+   whichever thread first acquires the mutex, instead of taking a task, while
+   the other threads already process the current part.
+   A combination of parts is the smallest unit of work: the seed pairs of a
+   combination are extended in the order of the sorted seed pair list, using
+   the diagonal band coverage, the extension and output buffers and the
+   maximal match store of this combination, so they are not split into
+   separate tasks. As the combinations are started in decreasing order of
+   size, the time to process all of them is bounded by the average load per
+   thread plus the size of the largest combination, which decreases
+   quadratically with the number of parts. So the load is balanced by
+   choosing sufficiently many parts, which is reported in verbose mode. */
+typedef struct
+{
   const GtDiagbandseedInfo *arg;
   const GtArrayGtDiagbandseedKmerPos *alist;
-  FILE *stream;
-  const GtEncseq *aencseq, *bencseq;
+  FILE **stream_tab;
   const GtSequencePartsInfo *aseqranges,
                             *bseqranges;
-  GtSegmentRejectFunc segment_reject_func;
-  GtArray *combinations;
+  const GtKarlinAltschulStat *karlin_altschul_stat;
+  GtDiagbandseedTask *tasks;
+  GtUword numoftasks,
+          nexttask,
+          prefetch_aidx;
+  GtArrayGtDiagbandseedKmerPos *prefetch_list;
+  GtMutex *mutex;
   int had_err;
   GtError *err;
-  const GtKarlinAltschulStat *karlin_altschul_stat;
-} GtDiagbandseedThreadInfo;
+} GtDiagbandseedScheduler;
+
+static double gt_diagbandseed_estimated_seeds(const GtDiagbandseedInfo *arg,
+                                              const GtSequencePartsInfo
+                                                *aseqranges,
+                                              GtUword aidx,
+                                              const GtSequencePartsInfo
+                                                *bseqranges,
+                                              GtUword bidx)
+{
+  /* the number of seeds is proportional to the product of the number of
+     k-mers of both parts, only one half is compared if a part is compared
+     with itself */
+  const GtUword alen
+    = gt_sequence_parts_info_partlength(
+                   aseqranges,
+                   gt_sequence_parts_info_start_get(aseqranges,aidx),
+                   gt_sequence_parts_info_end_get(aseqranges,aidx)),
+                blen
+    = gt_sequence_parts_info_partlength(
+                   bseqranges,
+                   gt_sequence_parts_info_start_get(bseqranges,bidx),
+                   gt_sequence_parts_info_end_get(bseqranges,bidx));
+  double estimate = (double) alen * (double) blen;
+
+  if (arg->aencseq == arg->bencseq && aidx == bidx)
+  {
+    estimate /= 2.0;
+  }
+  return estimate;
+}
 
-static void gt_diagbandseed_thread_info_set(GtDiagbandseedThreadInfo *ti,
-                                     const GtDiagbandseedInfo *arg,
-                                     const GtArrayGtDiagbandseedKmerPos *alist,
-                                     FILE *stream,
-                                     const GtEncseq *aencseq,
-                                     const GtSequencePartsInfo *aseqranges,
-                                     const GtEncseq *bencseq,
-                                     const GtSequencePartsInfo *bseqranges,
-                                     const GtKarlinAltschulStat
-                                       *karlin_altschul_stat,
-                                     GtArray *combinations,
-                                     GtError *err)
+static int gt_diagbandseed_task_compare(const void *a, const void *b)
+{
+  const GtDiagbandseedTask *ta = (const GtDiagbandseedTask *) a,
+                           *tb = (const GtDiagbandseedTask *) b;
+
+  if (ta->estimated_seeds > tb->estimated_seeds)
+  {
+    return -1;
+  }
+  if (ta->estimated_seeds < tb->estimated_seeds)
+  {
+    return 1;
+  }
+  /* keep the order of the combinations for equally sized tasks */
+  if (ta->comb.a != tb->comb.a)
+  {
+    return ta->comb.a < tb->comb.a ? -1 : 1;
+  }
+  if (ta->comb.b != tb->comb.b)
+  {
+    return ta->comb.b < tb->comb.b ? -1 : 1;
+  }
+  return 0;
+}
+
+static void gt_diagbandseed_scheduler_add(GtArray *tasks,
+                                          const GtDiagbandseedInfo *arg,
+                                          const GtSequencePartsInfo
+                                            *aseqranges,
+                                          GtUword aidx,
+                                          const GtSequencePartsInfo
+                                            *bseqranges,
+                                          GtUword bidx)
 {
-  gt_assert(ti != NULL);
-  ti->arg = arg;
-  ti->alist = alist;
-  ti->stream = stream;
-  ti->aencseq = aencseq;
-  ti->aseqranges = aseqranges;
-  ti->bencseq = bencseq;
-  ti->bseqranges = bseqranges;
-  ti->karlin_altschul_stat = karlin_altschul_stat;
-  ti->combinations = gt_array_clone(combinations);
-  ti->had_err = 0;
-  ti->err = err;
+  GtDiagbandseedTask task;
+
+  task.comb.a = aidx;
+  task.comb.b = bidx;
+  task.estimated_seeds = gt_diagbandseed_estimated_seeds(arg,aseqranges,aidx,
+                                                         bseqranges,bidx);
+  gt_array_add(tasks,task);
 }
 
-static void *gt_diagbandseed_thread_algorithm(void *thread_info)
+static void gt_diagbandseed_scheduler_worker(unsigned int workerid,
+                                             void *data)
 {
-  GtDiagbandseedThreadInfo *info = (GtDiagbandseedThreadInfo *)thread_info;
-  if (gt_array_size(info->combinations) > 0) {
-    const GtUwordPair *last = gt_array_get_last(info->combinations),
-                      *comb;
-
-    for (comb = gt_array_get_first(info->combinations); comb <= last; comb++) {
-      info->had_err = gt_diagbandseed_algorithm(
-                           info->arg,
-                           info->alist,
-                           info->stream,
-                           info->aencseq,
-                           info->aseqranges,
-                           comb->a,
-                           info->bencseq,
-                           info->bseqranges,
-                           comb->b,
-                           info->karlin_altschul_stat,
-                           NULL,
-                           NULL,
-                           info->err);
-      if (info->had_err) break;
+  GtDiagbandseedScheduler *sched = (GtDiagbandseedScheduler *) data;
+
+  while (true)
+  {
+    GtUword taskidx = GT_UWORD_MAX, prefetch_aidx = GT_UWORD_MAX;
+    const GtDiagbandseedTask *task;
+    int had_err;
+
+    gt_mutex_lock(sched->mutex);
+    if (sched->prefetch_aidx != GT_UWORD_MAX)
+    {
+      prefetch_aidx = sched->prefetch_aidx;
+      sched->prefetch_aidx = GT_UWORD_MAX;
+    } else
+    {
+      if (sched->had_err == 0 && sched->nexttask < sched->numoftasks)
+      {
+        taskidx = sched->nexttask++;
+      }
+    }
+    gt_mutex_unlock(sched->mutex);
+    if (prefetch_aidx != GT_UWORD_MAX)
+    {
+      const GtDiagbandseedInfo *arg = sched->arg;
+
+      *sched->prefetch_list
+        = gt_diagbandseed_get_kmers(
+                    arg->aencseq,
+                    arg->seedweight,
+                    arg->seedlength,
+                    GT_READMODE_FORWARD,
+                    gt_sequence_parts_info_start_get(sched->aseqranges,
+                                                     prefetch_aidx),
+                    gt_sequence_parts_info_end_get(sched->aseqranges,
+                                                   prefetch_aidx),
+                    arg->debug_kmer,
+                    arg->verbose,
+                    0,
+                    sched->stream_tab[workerid]);
+      continue;
+    }
+    if (taskidx == GT_UWORD_MAX)
+    {
+      break;
+    }
+    task = sched->tasks + taskidx;
+    had_err = gt_diagbandseed_algorithm(sched->arg,
+                                        sched->alist,
+                                        sched->stream_tab[workerid],
+                                        sched->arg->aencseq,
+                                        sched->aseqranges,
+                                        task->comb.a,
+                                        sched->arg->bencseq,
+                                        sched->bseqranges,
+                                        task->comb.b,
+                                        sched->karlin_altschul_stat,
+                                        NULL,
+                                        NULL,
+                                        sched->err);
+    if (had_err)
+    {
+      gt_mutex_lock(sched->mutex);
+      sched->had_err = had_err;
+      gt_mutex_unlock(sched->mutex);
     }
   }
-  gt_array_delete(info->combinations);
-  return NULL;
+}
+
+/* Process all combinations in <tasks> with <gt_jobs> threads, the k-mer list
+   <alist> of the 1st sequence set is used if it is not NULL. If
+   <prefetch_aidx> is not <GT_UWORD_MAX>, the k-mers of this part of the 1st
+   sequence set are stored in <prefetch_list>. */
+static int gt_diagbandseed_scheduler_run(const GtDiagbandseedInfo *arg,
+                                         const GtArrayGtDiagbandseedKmerPos
+                                           *alist,
+                                         FILE **stream_tab,
+                                         const GtSequencePartsInfo *aseqranges,
+                                         const GtSequencePartsInfo *bseqranges,
+                                         const GtKarlinAltschulStat
+                                           *karlin_altschul_stat,
+                                         GtArray *tasks,
+                                         GtUword prefetch_aidx,
+                                         GtArrayGtDiagbandseedKmerPos
+                                           *prefetch_list,
+                                         GtError *err)
+{
+  GtDiagbandseedScheduler sched;
+  GtThreadPool *pool;
+
+  gt_assert(prefetch_aidx == GT_UWORD_MAX || prefetch_list != NULL);
+  if (!(pool = gt_thread_pool_get(err)))
+  {
+    return -1;
+  }
+  gt_assert(gt_thread_pool_size(pool) == gt_jobs);
+  qsort(gt_array_get_space(tasks),gt_array_size(tasks),
+        sizeof (GtDiagbandseedTask),gt_diagbandseed_task_compare);
+  sched.arg = arg;
+  sched.alist = alist;
+  sched.stream_tab = stream_tab;
+  sched.aseqranges = aseqranges;
+  sched.bseqranges = bseqranges;
+  sched.karlin_altschul_stat = karlin_altschul_stat;
+  sched.tasks = gt_array_get_space(tasks);
+  sched.numoftasks = gt_array_size(tasks);
+  sched.nexttask = 0;
+  sched.prefetch_aidx = prefetch_aidx;
+  sched.prefetch_list = prefetch_list;
+  sched.mutex = gt_mutex_new();
+  sched.had_err = 0;
+  sched.err = err;
+  if (arg->verbose && sched.numoftasks > 0)
+  {
+    double total_estimated_seeds = 0.0;
+    GtUword taskidx;
+
+    for (taskidx = 0; taskidx < sched.numoftasks; taskidx++)
+    {
+      total_estimated_seeds += sched.tasks[taskidx].estimated_seeds;
+    }
+    if (sched.tasks[0].estimated_seeds * gt_jobs > total_estimated_seeds)
+    {
+      printf("# combination (" GT_WU "," GT_WU ") of parts exceeds the "
+             "average load of the %u threads, use more parts to balance "
+             "the load\n",sched.tasks[0].comb.a,sched.tasks[0].comb.b,
+             gt_jobs);
+    }
+  }
+  gt_thread_pool_run(pool,(GtUword) gt_thread_pool_size(pool),
+                     gt_diagbandseed_scheduler_worker,&sched);
+  gt_mutex_delete(sched.mutex);
+  return sched.had_err;
 }
 #endif
 
@@ -4136,10 +4321,12 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
   GtKarlinAltschulStat *karlin_altschul_stat = NULL;
   GtDiagbandseedState *dbs_state = NULL;
 #ifdef GT_THREADS_ENABLED
-  GtDiagbandseedThreadInfo *tinfo = gt_malloc(gt_jobs * sizeof *tinfo);
+  GtArrayGtDiagbandseedKmerPos next_alist;
+  GtUword next_aidx = GT_UWORD_MAX;
   FILE **stream_tab;
   unsigned int tidx;
 
+  GT_INITARRAY(&next_alist, GtDiagbandseedKmerPos);
   /* create output streams */
   stream_tab = gt_malloc(gt_jobs * sizeof *stream_tab);
   stream_tab[0] = stdout;
@@ -4244,6 +4431,15 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
                                            anumseqranges, aidx);
     }
 
+#ifdef GT_THREADS_ENABLED
+    if (next_aidx == aidx)
+    {
+      /* the k-mers were extracted while processing the previous part */
+      use_alist = true;
+      alist = next_alist;
+      next_aidx = GT_UWORD_MAX;
+    } else
+#endif
     if (!arg->use_kmerfile || gt_create_or_update_file(path,arg->aencseq))
     {
       use_alist = true;
@@ -4290,86 +4486,37 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       }
 #ifdef GT_THREADS_ENABLED
     } else if (!arg->use_kmerfile) {
-      const GtUword num_runs = bpick ? 1 : bnumseqranges - bidx;
-      const GtUword num_runs_per_thread = (num_runs - 1) / gt_jobs + 1;
-      const GtUword num_threads = (num_runs - 1) / num_runs_per_thread + 1;
-      GtArray *combinations = gt_array_new(sizeof (GtUwordPair));
-      GtArray *threads = gt_array_new(sizeof (GtThread *));
+      GtArray *tasks = gt_array_new(sizeof (GtDiagbandseedTask));
+      GtUword prefetch_aidx = GT_UWORD_MAX;
 
       gt_assert(bidx < bnumseqranges);
-      gt_assert(num_threads <= gt_jobs);
-      gt_assert(!bpick || num_threads == 1);
-
-      /* start additional threads */
-      for (tidx = 1; !had_err && tidx < num_threads; tidx++) {
-        GtThread *thread;
-        GtUword idx;
-        bidx += num_runs_per_thread;
-        const GtUword end = MIN(bidx + num_runs_per_thread, bnumseqranges);
-
-        for (idx = bidx; idx < end; idx++) {
-          GtUwordPair comb = {aidx, idx};
-          gt_array_add(combinations, comb);
-        }
-        gt_diagbandseed_thread_info_set(tinfo + tidx,
-                                        arg,
-                                        use_alist ? &alist : NULL,
-                                        stream_tab[tidx],
-                                        arg->aencseq,
-                                        aseqranges,
-                                        arg->bencseq,
-                                        bseqranges,
-                                        karlin_altschul_stat,
-                                        combinations,
-                                        err);
-        gt_array_reset(combinations);
-        if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
-                                    tinfo + tidx, err)) != NULL) {
-          gt_array_add(threads, thread);
-        } else {
-          had_err = -1;
+      for (/* Nothing */; bidx < bnumseqranges; bidx++) {
+        if (!bpick || pick->b == bidx) {
+          gt_diagbandseed_scheduler_add(tasks, arg, aseqranges, aidx,
+                                        bseqranges, bidx);
         }
       }
-
-      /* start main thread */
-      if (!had_err) {
-        GtUword idx;
-        bidx = self ? aidx : 0;
-        for (idx = bidx;
-             idx < MIN(bidx + num_runs_per_thread, bnumseqranges);
-             ++idx) {
-          if (!bpick || pick->b == idx) {
-            GtUwordPair comb = {aidx, idx};
-            gt_array_add(combinations, comb);
-          }
-        }
-        gt_diagbandseed_thread_info_set(tinfo,
-                                        arg,
-                                        use_alist ? &alist : NULL,
-                                        stream_tab[0],
-                                        arg->aencseq,
-                                        aseqranges,
-                                        arg->bencseq,
-                                        bseqranges,
-                                        karlin_altschul_stat,
-                                        combinations,
-                                        err);
-        gt_diagbandseed_thread_algorithm(tinfo);
+      if (arg->pipeline_parts && !apick && aidx + 1 < anumseqranges) {
+        prefetch_aidx = aidx + 1;
       }
-
-      /* clean up */
-      for (tidx = 0; tidx < gt_array_size(threads); tidx++) {
-        GtThread *thread = *(GtThread**) gt_array_get(threads, tidx);
-        if (!had_err) {
-          gt_thread_join(thread);
+      had_err = gt_diagbandseed_scheduler_run(arg,
+                                              &alist,
+                                              stream_tab,
+                                              aseqranges,
+                                              bseqranges,
+                                              karlin_altschul_stat,
+                                              tasks,
+                                              prefetch_aidx,
+                                              &next_alist,
+                                              err);
+      if (prefetch_aidx != GT_UWORD_MAX) {
+        if (had_err) {
+          GT_FREEARRAY(&next_alist, GtDiagbandseedKmerPos);
+        } else {
+          next_aidx = prefetch_aidx;
         }
-        gt_thread_delete(thread);
       }
-      gt_array_delete(threads);
-      for (tidx = 0; tidx < num_threads && !had_err; tidx++) {
-        had_err = tinfo[tidx].had_err;
-      }
-      gt_array_delete(combinations);
+      gt_array_delete(tasks);
     }
 #endif
     if (use_alist) {
@@ -4377,76 +4524,30 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
     }
   }
 #ifdef GT_THREADS_ENABLED
-  if (gt_jobs > 1 && arg->use_kmerfile) {
-    GtArray *combinations[gt_jobs];
-    GtArray *threads = gt_array_new(sizeof (GtThread *));
-    GtUword counter = 0;
-    for (tidx = 0; tidx < gt_jobs; tidx++) {
-      combinations[tidx] = gt_array_new(sizeof (GtUwordPair));
-    }
+  if (!had_err && gt_jobs > 1 && arg->use_kmerfile) {
+    GtArray *tasks = gt_array_new(sizeof (GtDiagbandseedTask));
+
     for (aidx = 0; aidx < anumseqranges; aidx++) {
       if (apick && pick->a != aidx) continue;
       for (bidx = self ? aidx : 0; bidx < bnumseqranges; bidx++) {
         if (!bpick || pick->b == bidx) {
-          GtUwordPair comb = {aidx, bidx};
-          gt_array_add(combinations[counter++ % gt_jobs], comb);
+          gt_diagbandseed_scheduler_add(tasks, arg, aseqranges, aidx,
+                                        bseqranges, bidx);
         }
       }
     }
-
-    for (tidx = 1; !had_err && tidx < gt_jobs; tidx++) {
-      GtThread *thread;
-      gt_diagbandseed_thread_info_set(tinfo + tidx,
-                                      arg,
-                                      NULL,
-                                      stream_tab[tidx],
-                                      arg->aencseq,
-                                      aseqranges,
-                                      arg->bencseq,
-                                      bseqranges,
-                                      karlin_altschul_stat,
-                                      combinations[tidx],
-                                      err);
-      if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
-                                  tinfo + tidx, err)) != NULL) {
-        gt_array_add(threads, thread);
-      } else {
-        had_err = -1;
-      }
-    }
-    /* start main thread */
-    if (!had_err) {
-      gt_diagbandseed_thread_info_set(tinfo,
-                                      arg,
-                                      NULL,
-                                      stream_tab[0],
-                                      arg->aencseq,
-                                      aseqranges,
-                                      arg->bencseq,
-                                      bseqranges,
-                                      karlin_altschul_stat,
-                                      combinations[0],
-                                      err);
-      gt_diagbandseed_thread_algorithm(tinfo);
-    }
-
-    /* clean up */
-    for (tidx = 0; tidx < gt_array_size(threads); tidx++) {
-      GtThread *thread = *(GtThread**) gt_array_get(threads, tidx);
-      if (!had_err) {
-        gt_thread_join(thread);
-      }
-      gt_thread_delete(thread);
-    }
-    for (tidx = 0; tidx < gt_array_size(threads) && !had_err; tidx++) {
-      had_err = tinfo[tidx].had_err;
-    }
-    gt_array_delete(threads);
-    for (tidx = 0; tidx < gt_jobs; tidx++) {
-      gt_array_delete(combinations[tidx]);
-    }
+    had_err = gt_diagbandseed_scheduler_run(arg,
+                                            NULL,
+                                            stream_tab,
+                                            aseqranges,
+                                            bseqranges,
+                                            karlin_altschul_stat,
+                                            tasks,
+                                            GT_UWORD_MAX,
+                                            NULL,
+                                            err);
+    gt_array_delete(tasks);
   }
-  gt_free(tinfo);
 
   /* print the threads' output to stdout */
   for (tidx = 1; tidx < gt_jobs; tidx++) {
@@ -62,6 +62,7 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
                                              bool debug_kmer,
                                              bool debug_seedpair,
                                              bool use_kmerfile,
+                                             bool pipeline_parts,
                                              bool trimstat_on,
                                              GtUword maxmat,
                                              const GtStr *chainarguments,
@@ -38,6 +38,10 @@
 #include "core/log.h"
 #include "core/minmax.h"
 #include "core/str.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#endif
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "eis-blockcomp-construct.h"
@@ -292,8 +296,116 @@ writeOutputBuffer(struct blockCompositionSeq *newSeqIdx,
   return 1;
 }
 
+/* Full blocks are read in batches of about this many symbols. The
+ * composition and permutation indices of the blocks in a batch are
+ * computed in parallel, then appended to the output in order. */
+#define EIS_BLOCK_BATCH_SYMBOLS (1U << 16)
+
+struct blockBatch
+{
+  const struct blockCompositionSeq *seqIdx;
+  const MRAEnc *alphabet, *blockMapAlphabet;
+  unsigned blockSize, numWorkers;
+  GtUword maxBlocks;
+  Symbol *blocks, *mappedBlocks;
+  PermCompIndex *permCompIdx;
+  unsigned *significantPermIdxBits, *compositionPreAlloc;
+  BitString permCompBSPreAlloc;
+  size_t permCompBSElems;
+};
+
+static void
+initBlockBatch(struct blockBatch *batch,
+               const struct blockCompositionSeq *seqIdx,
+               const MRAEnc *alphabet, const MRAEnc *blockMapAlphabet,
+               unsigned blockSize, BitOffset bitsPerPermComp)
+{
+  batch->seqIdx = seqIdx;
+  batch->alphabet = alphabet;
+  batch->blockMapAlphabet = blockMapAlphabet;
+  batch->blockSize = blockSize;
+  batch->maxBlocks = MAX(EIS_BLOCK_BATCH_SYMBOLS / blockSize, 1);
+  batch->numWorkers = 1;
+#ifdef GT_THREADS_ENABLED
+  batch->numWorkers = gt_jobs;
+#endif
+  batch->blocks = gt_malloc(sizeof (Symbol) * blockSize * batch->maxBlocks);
+  batch->mappedBlocks = gt_malloc(sizeof (Symbol) * blockSize
+                                  * batch->maxBlocks);
+  batch->permCompIdx = gt_malloc(sizeof (batch->permCompIdx[0]) * 2
+                                 * batch->maxBlocks);
+  batch->significantPermIdxBits
+    = gt_malloc(sizeof (batch->significantPermIdxBits[0]) * batch->maxBlocks);
+  batch->compositionPreAlloc
+    = gt_malloc(sizeof (batch->compositionPreAlloc[0])
+                * seqIdx->blockMapAlphabetSize * batch->numWorkers);
+  batch->permCompBSElems = bitElemsAllocSize(bitsPerPermComp);
+  batch->permCompBSPreAlloc = gt_malloc(sizeof (BitElem)
+                                        * batch->permCompBSElems
+                                        * batch->numWorkers);
+}
+
+static void
+destructBlockBatch(struct blockBatch *batch)
+{
+  gt_free(batch->blocks);
+  gt_free(batch->mappedBlocks);
+  gt_free(batch->permCompIdx);
+  gt_free(batch->significantPermIdxBits);
+  gt_free(batch->compositionPreAlloc);
+  gt_free(batch->permCompBSPreAlloc);
+}
+
+/* Translates the blocks <start> to <end> - 1 of a batch and computes their
+ * composition and permutation indices, using the scratch space of worker
+ * <workerid>. */
+static void
+encodeBlockBatchRange(GtUword start, GtUword end, unsigned workerid,
+                      void *data)
+{
+  struct blockBatch *batch = data;
+  const struct blockCompositionSeq *seqIdx = batch->seqIdx;
+  unsigned blockSize = batch->blockSize;
+  GtUword blockIdx;
+  for (blockIdx = start; blockIdx < end; ++blockIdx)
+  {
+    Symbol *block = batch->blocks + blockIdx * blockSize,
+      *mappedBlock = batch->mappedBlocks + blockIdx * blockSize;
+    gt_MRAEncSymbolsTransform(batch->alphabet, block, blockSize);
+    memcpy(mappedBlock, block, sizeof (Symbol) * blockSize);
+    gt_MRAEncSymbolsTransform(batch->blockMapAlphabet, mappedBlock,
+                              blockSize);
+    gt_block2IndexPair(&seqIdx->compositionTable, blockSize,
+                       seqIdx->blockMapAlphabetSize, mappedBlock,
+                       batch->permCompIdx + 2 * blockIdx,
+                       batch->significantPermIdxBits + blockIdx,
+                       batch->permCompBSPreAlloc
+                       + (size_t)workerid * batch->permCompBSElems,
+                       batch->compositionPreAlloc
+                       + (size_t)workerid * seqIdx->blockMapAlphabetSize);
+  }
+}
+
+static void
+encodeBlockBatch(struct blockBatch *batch, GtUword numBlocks)
+{
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool;
+  if (batch->numWorkers > 1 && numBlocks > 1
+      && (pool = gt_thread_pool_get(NULL)) != NULL)
+  {
+    gt_assert(gt_thread_pool_size(pool) <= batch->numWorkers);
+    gt_thread_pool_parallel_for(pool, 0, numBlocks, 0,
+                                encodeBlockBatchRange, batch);
+    return;
+  }
+#endif
+  encodeBlockBatchRange(0, numBlocks, 0, batch);
+}
+
 #define newBlockEncIdxSeqLoopErr()                      \
   destructAppendState(&aState);                         \
+  destructBlockBatch(&batch);                           \
   deletePartialSymSums(buck);                           \
   deletePartialSymSums(buckLast);                       \
   gt_free(compositionPreAlloc);                         \
@@ -532,40 +644,52 @@ gt_newGenBlockEncIdxSeq(GtUword totalLen, const char *projectName,
             lastUpdatePos = 0;
           /* pos == totalLen - symbolsLeft */
           struct appendState aState;
+          struct blockBatch batch;
           initAppendState(&aState, newSeqIdx);
+          initBlockBatch(&batch, newSeqIdx, alphabet, blockMapAlphabet,
+                         blockSize, bitsPerComposition + bitsPerPermutation);
           blockNum = 0;
-          while (blockNum < numFullBlocks)
+          while (!hadGtError && blockNum < numFullBlocks)
           {
             size_t readResult;
-            /* 3. for each chunk: */
-            readResult = SDRRead(BWTGenerator, block, blockSize);
-            if (readResult != blockSize)
+            GtUword batchBlocks = MIN(batch.maxBlocks,
+                                      numFullBlocks - blockNum), batchIdx;
+            /* 3. for each batch of chunks: */
+            readResult = SDRRead(BWTGenerator, batch.blocks,
+                                 batchBlocks * blockSize);
+            if (readResult != batchBlocks * blockSize)
             {
               hadGtError = 1;
               perror("error condition while reading index data");
               break;
             }
-            gt_MRAEncSymbolsTransform(alphabet, block, blockSize);
-            addBlock2OutputBuffer(newSeqIdx, buck, blockNum,
-                                  block, blockSize,
-                                  alphabet, modesCopy,
-                                  blockMapAlphabet, blockMapAlphabetSize,
-                                  permCompBSPreAlloc, compositionPreAlloc,
-                                  compositionIdxBits, &aState);
-            /* update on-disk structure */
-            if (!((++blockNum) % bucketBlocks))
+            encodeBlockBatch(&batch, batchBlocks);
+            for (batchIdx = 0; batchIdx < batchBlocks; ++batchIdx)
             {
-              GtUword pos = blockNum * blockSize;
-              if (writeOutputBuffer(newSeqIdx, &aState, biFunc, lastUpdatePos,
-                                    bucketLen, callBackDataOffsetBits, cbState,
-                                    buckLast) < 0)
+              const Symbol *batchBlock = batch.blocks + batchIdx * blockSize;
+              addBlock2PartialSymSums(buck, batchBlock, blockSize);
+              addRangeEncodedSyms(newSeqIdx->rangeEncs, batchBlock, blockSize,
+                                  blockNum, alphabet, REGIONS_LIST,
+                                  modesCopy);
+              append2IdxOutput(&aState, batch.permCompIdx + 2 * batchIdx,
+                               compositionIdxBits,
+                               batch.significantPermIdxBits[batchIdx]);
+              /* update on-disk structure */
+              if (!((++blockNum) % bucketBlocks))
               {
-                hadGtError = 1;
-                break;
+                GtUword pos = blockNum * blockSize;
+                if (writeOutputBuffer(newSeqIdx, &aState, biFunc,
+                                      lastUpdatePos, bucketLen,
+                                      callBackDataOffsetBits, cbState,
+                                      buckLast) < 0)
+                {
+                  hadGtError = 1;
+                  break;
+                }
+                /* update retained data */
+                copyPartialSymSums(totalAlphabetSize, buckLast, buck);
+                lastUpdatePos = pos;
               }
-              /* update retained data */
-              copyPartialSymSums(totalAlphabetSize, buckLast, buck);
-              lastUpdatePos = pos;
             }
           }
           /* handle last chunk */
@@ -638,6 +762,7 @@ gt_newGenBlockEncIdxSeq(GtUword totalLen, const char *projectName,
           }
           /* 4. dealloc resources no longer required */
           destructAppendState(&aState);
+          destructBlockBatch(&batch);
           deletePartialSymSums(buck);
           deletePartialSymSums(buckLast);
         }
@@ -1572,6 +1697,33 @@ blockCompSeqGet(struct encIdxSeq *seq, GtUword pos, union EISHint *hint)
   return sym;
 }
 
+enum {
+  EIS_PREFETCH_STRIDE = 64,
+};
+
+/* Only the constant width data of the bucket can be prefetched: the
+ * offset of the variable width data is itself stored there. */
+static void
+blockCompSeqPrefetch(GT_UNUSED const struct encIdxSeq *seq,
+                     GT_UNUSED GtUword pos)
+{
+#ifdef __GNUC__
+  const struct blockCompositionSeq *seqIdx;
+  gt_assert(seq && seq->classInfo == &blockCompositionSeqClass);
+  seqIdx = constEncIdxSeq2blockCompositionSeq(seq);
+  if (seqIdxUsesMMap(seqIdx) && pos < seq->seqLen)
+  {
+    BitOffset bucketOffset = bucketNumFromPos(seqIdx, pos)
+      * superBlockCWBits(seqIdx);
+    const char *cwData = seqIdx->externalData.idxMMap
+      + bucketOffset / bitElemBits * sizeof (BitElem);
+    size_t offset, cwSize = superBlockCWMaxReadSize(seqIdx);
+    for (offset = 0; offset < cwSize; offset += EIS_PREFETCH_STRIDE)
+      __builtin_prefetch(cwData + offset, 0, 1);
+  }
+#endif
+}
+
 static inline partialSymSum *
 newPartialSymSums(AlphabetRangeSize alphabetSize)
 {
@@ -2741,6 +2893,7 @@ static const struct encIdxSeqClass blockCompositionSeqClass =
   .posPairRangeRank = blockCompSeqPosPairRangeRank,
   .select = blockCompSeqSelect,
   .get = blockCompSeqGet,
+  .prefetch = blockCompSeqPrefetch,
   .newHint = newBlockCompSeqHint,
   .deleteHint = deleteBlockCompSeqHint,
   .expose = blockCompSeqExpose,
@@ -18,7 +18,9 @@
 
 #include "core/chardef.h"
 #include "core/log.h"
+#include "core/ma_api.h"
 #include "core/minmax.h"
+#include "core/radix_sort.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "match/eis-specialsrank.h"
@@ -697,78 +699,120 @@ gt_BWTSeqPosHasLocateInfo(const BWTSeq *bwtSeq, GtUword pos,
   return 0;
 }
 
-GtUword
-gt_BWTSeqLocateMatch(const BWTSeq *bwtSeq, GtUword pos,
-                  struct extBitsRetrieval *extBits)
+/* If row pos of the BWT carries a locate sample, store the original
+ * position of the corresponding suffix in *matchPos and return true. */
+static inline bool
+BWTSeqGetLocateSample(const BWTSeq *bwtSeq, GtUword pos,
+                      struct extBitsRetrieval *extBits, GtUword *matchPos)
 {
+  unsigned bitsPerOrigPos
+    = requiredUlongBits(((bwtSeq->featureToggles & BWTReversiblySorted)?
+                          (BWTSeqLength(bwtSeq) - 1)
+                          /bwtSeq->locateSampleInterval:
+                          BWTSeqLength(bwtSeq) - 1));
   if (bwtSeq->featureToggles & BWTLocateBitmap)
   {
-    GtUword nextLocate = pos;
-    unsigned locateOffset = 0;
-    while (!gt_BWTSeqPosHasLocateInfo(bwtSeq, nextLocate, extBits))
-      nextLocate = BWTSeqLFMap(bwtSeq, nextLocate, extBits), ++locateOffset;
-    EISRetrieveExtraBits(bwtSeq->seqIdx, nextLocate,
+    if (!gt_BWTSeqPosHasLocateInfo(bwtSeq, pos, extBits))
+      return false;
+    EISRetrieveExtraBits(bwtSeq->seqIdx, pos,
                          EBRF_RETRIEVE_CWBITS | EBRF_RETRIEVE_VARBITS,
                          extBits, bwtSeq->hint);
     {
-      GtUword maxPosVal = ((bwtSeq->featureToggles & BWTReversiblySorted)?
-                          (BWTSeqLength(bwtSeq) - 1)
-                          /bwtSeq->locateSampleInterval:
-                          BWTSeqLength(bwtSeq) - 1);
       unsigned bitsPerCount = requiredUlongBits(extBits->len),
-        bitsPerBWTPos = requiredUlongBits(extBits->len - 1),
-        bitsPerOrigPos = requiredUlongBits(maxPosVal);
+        bitsPerBWTPos = requiredUlongBits(extBits->len - 1);
       BitOffset locateRecordIndex =
         gt_bs1BitsCount(extBits->cwPart, extBits->cwOffset,
-                     nextLocate - extBits->start),
+                     pos - extBits->start),
         locateRecordOffset = ((bwtSeq->featureToggles & BWTLocateCount?
                                bitsPerBWTPos:0) + bitsPerOrigPos)
         * locateRecordIndex
         + ((bwtSeq->featureToggles & BWTLocateCount)?bitsPerCount:0);
-      GtUword matchPos =
+      *matchPos =
         gt_bsGetUlong(
           extBits->varPart, extBits->varOffset + locateRecordOffset
           + ((bwtSeq->featureToggles & BWTLocateCount)?bitsPerBWTPos:0),
           bitsPerOrigPos);
-      if (bwtSeq->featureToggles & BWTReversiblySorted)
-        matchPos = matchPos * bwtSeq->locateSampleInterval;
-      matchPos += locateOffset;
       gt_assert(!(bwtSeq->featureToggles & BWTLocateCount)
              || gt_bsGetUlong(extBits->varPart,
                             extBits->varOffset + locateRecordOffset,
                             bitsPerBWTPos)
-             == nextLocate - extBits->start);
-      return matchPos;
+             == pos - extBits->start);
     }
   }
   else if (bwtSeq->featureToggles & BWTLocateCount)
   {
-    BitOffset markOffset;
-    GtUword nextLocate = pos, matchPos;
-    unsigned locateOffset = 0;  /* mark is at most locateInterval
-                                 * positions away */
-    unsigned bitsPerOrigPos
-      = requiredUlongBits(((bwtSeq->featureToggles & BWTReversiblySorted)?
-                            (BWTSeqLength(bwtSeq) - 1)
-                            /bwtSeq->locateSampleInterval:
-                            BWTSeqLength(bwtSeq) - 1));
-    while ((markOffset = searchLocateCountMark(bwtSeq, nextLocate,
-                                               extBits)) == 0)
+    BitOffset markOffset = searchLocateCountMark(bwtSeq, pos, extBits);
+    if (markOffset == 0)
+      return false;
+    *matchPos = gt_bsGetUlong(extBits->varPart, markOffset, bitsPerOrigPos);
+  }
+  else
+  {
+    /* Internal error: Trying to locate in BWT sequence index without locate
+       information. */
+    abort();
+  }
+  if (bwtSeq->featureToggles & BWTReversiblySorted)
+    *matchPos = *matchPos * bwtSeq->locateSampleInterval;
+  return true;
+}
+
+GtUword
+gt_BWTSeqLocateMatch(const BWTSeq *bwtSeq, GtUword pos,
+                  struct extBitsRetrieval *extBits)
+{
+  GtUword nextLocate = pos, matchPos = 0;
+  unsigned locateOffset = 0;  /* mark is at most locateInterval
+                               * positions away */
+  while (!BWTSeqGetLocateSample(bwtSeq, nextLocate, extBits, &matchPos))
+  {
+    nextLocate = BWTSeqLFMap(bwtSeq, nextLocate, extBits);
+    ++locateOffset;
+    gt_assert(locateOffset <= BWTSeqLength(bwtSeq));
+  }
+  return matchPos + locateOffset;
+}
+
+void
+gt_BWTSeqLocateMatches(const BWTSeq *bwtSeq, GtUword start, GtUword end,
+                       GtUword *positions, struct extBitsRetrieval *extBits)
+{
+  GtUwordPair *pending;
+  GtUword numPending, i, locateOffset = 0;
+
+  gt_assert(bwtSeq && start <= end && (positions || start == end));
+  if (start == end)
+    return;
+  pending = gt_malloc(sizeof (*pending) * (end - start));
+  for (i = 0; i < end - start; ++i)
+  {
+    pending[i].a = start + i;
+    pending[i].b = i;
+  }
+  numPending = end - start;
+  while (numPending > 0)
+  {
+    GtUword numStillPending = 0;
+    for (i = 0; i < numPending; ++i)
     {
-      nextLocate = BWTSeqLFMap(bwtSeq, nextLocate, extBits);
-      ++locateOffset;
-      gt_assert(locateOffset <= BWTSeqLength(bwtSeq));
+      GtUword matchPos;
+      if (BWTSeqGetLocateSample(bwtSeq, pending[i].a, extBits, &matchPos))
+        positions[pending[i].b] = matchPos + locateOffset;
+      else
+      {
+        pending[numStillPending].a = BWTSeqLFMap(bwtSeq, pending[i].a,
+                                                 extBits);
+        pending[numStillPending++].b = pending[i].b;
+      }
     }
-    matchPos = gt_bsGetUlong(extBits->varPart, markOffset, bitsPerOrigPos);
-    if (bwtSeq->featureToggles & BWTReversiblySorted)
-        matchPos = matchPos * bwtSeq->locateSampleInterval;
-    matchPos += locateOffset;
-    return matchPos;
+    numPending = numStillPending;
+    ++locateOffset;
+    gt_assert(locateOffset <= BWTSeqLength(bwtSeq));
+    /* rows of the same bucket are processed together in the next step */
+    if (numPending > 1)
+      gt_radixsort_inplace_GtUwordPair(pending, numPending);
   }
-  /* Internal error: Trying to locate in BWT sequence index without locate
-     information. */
-   abort();
-   return 0; /* shut up compiler */
+  gt_free(pending);
 }
 
 static inline BitOffset
@@ -57,6 +57,13 @@ GtUword
 gt_BWTSeqLocateMatch(const BWTSeq *bwtSeq, GtUword pos,
                   struct extBitsRetrieval *extBits);
 
+/* Locates the rows start..end-1 together and stores the position of row
+ * start+i in positions[i]. All rows not yet located are LF-mapped in one
+ * round, ordered by row, which keeps the accesses within few buckets. */
+void
+gt_BWTSeqLocateMatches(const BWTSeq *bwtSeq, GtUword start, GtUword end,
+                       GtUword *positions, struct extBitsRetrieval *extBits);
+
 BWTSeq *
 gt_newBWTSeq(EISeq *seqIdx, MRAEnc *alphabet,
           const enum rangeSortMode *defaultRangeSort);
@@ -152,6 +152,35 @@ typedef struct
   GtCodetype code;
 } GtPrebwtstate;
 
+void
+gt_BWTSeqLogLocateTradeoff(const BWTSeq *bwtSeq, GtLogger *logger)
+{
+  GtUword seqLen, numSamples;
+  unsigned bitsPerOrigPos;
+
+  gt_assert(bwtSeq);
+  if (!bwtSeq->locateSampleInterval)
+  {
+    gt_logger_log(logger, "no locate information stored, matches cannot "
+                  "be located");
+    return;
+  }
+  seqLen = BWTSeqLength(bwtSeq);
+  numSamples = (seqLen - 1) / bwtSeq->locateSampleInterval + 1;
+  bitsPerOrigPos
+    = requiredUlongBits((bwtSeq->featureToggles & BWTReversiblySorted)
+                        ? (seqLen - 1) / bwtSeq->locateSampleInterval
+                        : seqLen - 1);
+  gt_logger_log(logger, "locate information: every %u-th position sampled, "
+                GT_WU" samples of %u bits (%.2f bits per symbol) marked by %s",
+                bwtSeq->locateSampleInterval, numSamples, bitsPerOrigPos,
+                (double) numSamples * bitsPerOrigPos / seqLen,
+                (bwtSeq->featureToggles & BWTLocateBitmap) ? "bitmap"
+                                                           : "count");
+  gt_logger_log(logger, "locating a match takes at most %u LF-mapping steps",
+                bwtSeq->locateSampleInterval - 1);
+}
+
 static const Mbtab *gt_prebwt_next(GtPrebwtstate *prebwt,unsigned int cc)
 {
   prebwt->code = prebwt->code * prebwt->numofchars + cc;
@@ -376,6 +405,115 @@ gt_BWTSeqMatchCount(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
     return match.end - match.start;
 }
 
+enum {
+  BWTSEQ_BATCH_PREFETCH_DISTANCE = 8,
+};
+
+static inline unsigned int
+batchQuerySym(const Symbol *query, size_t queryLen, size_t depth, bool forward)
+{
+  return (unsigned int) (forward ? query[depth] : query[queryLen - 1 - depth]);
+}
+
+static inline void
+batchPrefetchBounds(const BWTSeq *bwtSeq, const struct matchBound *match)
+{
+  EISPrefetch(bwtSeq->seqIdx, match->start);
+  EISPrefetch(bwtSeq->seqIdx, match->end);
+}
+
+void
+gt_BWTSeqMatchBoundsBatch(const BWTSeq *bwtSeq, const Symbol *const *queries,
+                          const size_t *queryLens, GtUword numQueries,
+                          struct matchBound *bounds, bool forward)
+{
+  GtUword *active, numActive = 0, idx;
+  size_t *matched;
+  const Mbtab **mbtab;
+  unsigned int numofchars = 0, maxdepth = 0;
+
+  gt_assert(bwtSeq && queries && queryLens && bounds);
+  if (numQueries == 0)
+    return;
+  active = gt_malloc(sizeof (*active) * numQueries);
+  matched = gt_malloc(sizeof (*matched) * numQueries);
+  mbtab = gt_bwtseq2mbtab((const FMindex *) bwtSeq);
+  if (mbtab != NULL)
+  {
+    numofchars = gt_bwtseq2numofchars((const FMindex *) bwtSeq);
+    maxdepth = gt_bwtseq2maxdepth((const FMindex *) bwtSeq);
+  }
+  /* prefixes covered by the bucket table do not need rank queries */
+  for (idx = 0; idx < numQueries; idx++)
+  {
+    struct matchBound *match = bounds + idx;
+    size_t depth = 0, queryLen = queryLens[idx];
+    unsigned int cc;
+
+    gt_assert(queries[idx] != NULL && queryLen > 0);
+    if (mbtab != NULL)
+    {
+      GtCodetype code = 0;
+      do
+      {
+        cc = batchQuerySym(queries[idx], queryLen, depth, forward);
+        gt_assert(ISNOTSPECIAL(cc));
+        code = code * numofchars + cc;
+        depth++;
+        match->start = mbtab[depth][code].lowerbound;
+        match->end = mbtab[depth][code].upperbound;
+      } while (match->start < match->end && depth < queryLen
+               && depth < (size_t) maxdepth);
+    } else
+    {
+      cc = batchQuerySym(queries[idx], queryLen, 0, forward);
+      gt_assert(ISNOTSPECIAL(cc));
+      match->start = bwtSeq->count[cc];
+      match->end = bwtSeq->count[cc + 1];
+      depth = 1;
+    }
+    matched[idx] = depth;
+    if (match->start < match->end && depth < queryLen)
+      active[numActive++] = idx;
+  }
+  /* extend all unfinished queries by one symbol per round, the
+   * occurrence data for the query BWTSEQ_BATCH_PREFETCH_DISTANCE
+   * positions ahead is requested while the current one is processed */
+  while (numActive > 0)
+  {
+    GtUword numNextActive = 0;
+
+    for (idx = 0; idx < numActive && idx < BWTSEQ_BATCH_PREFETCH_DISTANCE;
+         idx++)
+      batchPrefetchBounds(bwtSeq, bounds + active[idx]);
+    for (idx = 0; idx < numActive; idx++)
+    {
+      GtUword queryNum = active[idx];
+      struct matchBound *match = bounds + queryNum;
+      GtUwordPair occPair;
+      unsigned int cc;
+
+      if (idx + BWTSEQ_BATCH_PREFETCH_DISTANCE < numActive)
+        batchPrefetchBounds(bwtSeq,
+                            bounds + active[idx
+                                            + BWTSEQ_BATCH_PREFETCH_DISTANCE]);
+      cc = batchQuerySym(queries[queryNum], queryLens[queryNum],
+                         matched[queryNum], forward);
+      gt_assert(ISNOTSPECIAL(cc));
+      occPair = BWTSeqTransformedPosPairOcc(bwtSeq, (Symbol) cc, match->start,
+                                            match->end);
+      match->start = bwtSeq->count[cc] + occPair.a;
+      match->end   = bwtSeq->count[cc] + occPair.b;
+      if (match->start < match->end
+          && ++matched[queryNum] < queryLens[queryNum])
+        active[numNextActive++] = queryNum;
+    }
+    numActive = numNextActive;
+  }
+  gt_free(active);
+  gt_free(matched);
+}
+
 bool
 gt_initEMIterator(BWTSeqExactMatchesIterator *iter, const BWTSeq *bwtSeq,
                const Symbol *query, size_t queryLen, bool forward)
@@ -432,6 +570,15 @@ gt_reinitEMIterator(BWTSeqExactMatchesIterator *iter, const BWTSeq *bwtSeq,
   return true;
 }
 
+void
+gt_reinitEMIteratorFromBounds(BWTSeqExactMatchesIterator *iter,
+                              const struct matchBound *bounds)
+{
+  gt_assert(iter && bounds);
+  iter->bounds = *bounds;
+  iter->nextMatchBWTPos = iter->bounds.start;
+}
+
 void
 gt_destructEMIterator(struct BWTSeqExactMatchesIterator *iter)
 {
@@ -444,6 +591,22 @@ gt_deleteEMIterator(struct BWTSeqExactMatchesIterator *iter)
   gt_free(iter);
 }
 
+GtUword
+gt_EMIGetNextMatches(BWTSeqExactMatchesIterator *iter, GtUword *positions,
+                     GtUword maxNumMatches, const BWTSeq *bwtSeq)
+{
+  GtUword numMatches;
+  gt_assert(iter && positions && bwtSeq);
+  if (iter->nextMatchBWTPos >= iter->bounds.end)
+    return 0;
+  numMatches = MIN(iter->bounds.end - iter->nextMatchBWTPos, maxNumMatches);
+  gt_BWTSeqLocateMatches(bwtSeq, iter->nextMatchBWTPos,
+                         iter->nextMatchBWTPos + numMatches, positions,
+                         &iter->extBits);
+  iter->nextMatchBWTPos += numMatches;
+  return numMatches;
+}
+
 GtUword
 gt_EMINumMatchesTotal(const struct BWTSeqExactMatchesIterator *iter)
 {
@@ -106,6 +106,16 @@ gt_loadBWTSeq(const char *projectName, int BWTOptFlags, GtLogger *verbosity,
 void
 gt_deleteBWTSeq(BWTSeq *bwtseq);
 
+/**
+ * \brief Log the tradeoff of the locate information stored in the
+ * index, i.e. the space used for the sampled suffix array values and
+ * the maximal number of LF-mapping steps needed to locate a match.
+ * @param bwtSeq reference of object to query
+ * @param logger log messages are passed to this object
+ */
+void
+gt_BWTSeqLogLocateTradeoff(const BWTSeq *bwtSeq, GtLogger *logger);
+
 /**
  * \brief Query BWT sequence object for availability of added
  * information to locate matches.
@@ -301,6 +311,28 @@ GtUword
 gt_BWTSeqMatchCount(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
                  bool forward);
 
+/**
+ * \brief Given a batch of query strings, compute the interval of
+ * matching rows for each of them.
+ *
+ * The searches of all queries advance in lock-step, one symbol per
+ * round, and while one query is extended the occurrence data needed
+ * by the queries following it is prefetched. For large indices this
+ * hides most of the memory latency a sequence of independent calls to
+ * gt_BWTSeqMatchCount would incur.
+ * @param bwtSeq reference of object to query
+ * @param queries array of numQueries symbol strings to search for
+ * @param queryLens lengths of the query strings
+ * @param numQueries number of queries in the batch
+ * @param bounds the interval of query i is written to bounds[i], the
+ * interval is empty if bounds[i].start >= bounds[i].end
+ * @param forward direction of processing the queries
+ */
+void
+gt_BWTSeqMatchBoundsBatch(const BWTSeq *bwtSeq, const Symbol *const *queries,
+                          const size_t *queryLens, GtUword numQueries,
+                          struct matchBound *bounds, bool forward);
+
 /**
  * \brief Given a pair of limiting positions in the suffix array and a
  * symbol, compute the interval reached by matching one symbol further.
@@ -431,6 +463,17 @@ gt_initEmptyEMIterator(BWTSeqExactMatchesIterator *iter, const BWTSeq *bwt);
 bool
 gt_reinitEMIterator(BWTSeqExactMatchesIterator *iter, const BWTSeq *bwtSeq,
                  const Symbol *query, size_t queryLen, bool forward);
+
+/**
+ * \brief Set up iterator for the matches in an interval computed
+ * before, e.g. by gt_BWTSeqMatchBoundsBatch. iter must have been
+ * initialized previously.
+ * @param iter points to storage for iterator
+ * @param bounds interval of matching rows
+ */
+void
+gt_reinitEMIteratorFromBounds(BWTSeqExactMatchesIterator *iter,
+                              const struct matchBound *bounds);
 /**
  * \brief Destruct resources of matches iterator. Does not free the
  * storage of iterator itself.
@@ -475,6 +518,22 @@ static inline bool
 EMIGetNextMatch(BWTSeqExactMatchesIterator *iter, GtUword *pos,
                 const BWTSeq *bwtSeq);
 
+/**
+ * \brief Get positions of the next matches from an iterator. The
+ * matches are located together, which is considerably faster than
+ * calling EMIGetNextMatch for each of them if there are many.
+ * @param iter reference of iterator object
+ * @param positions locations of at most maxNumMatches matches are
+ * stored here, in the order EMIGetNextMatch would deliver them
+ * @param maxNumMatches maximal number of matches to locate
+ * @param bwtSeq reference of bwt sequence object to use for matching
+ * @return number of matches stored in positions, 0 if no further
+ * match is available
+ */
+GtUword
+gt_EMIGetNextMatches(BWTSeqExactMatchesIterator *iter, GtUword *positions,
+                     GtUword maxNumMatches, const BWTSeq *bwtSeq);
+
 /**
  * \brief Query an iterator for the total number of matches.
  * @param iter reference of iterator object
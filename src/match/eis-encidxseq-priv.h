@@ -39,6 +39,7 @@ struct encIdxSeqClass
   GtUword (*select)(EISeq *seq, Symbol sym, GtUword count,
                    union EISHint *hint);
   Symbol (*get)(EISeq *seq, GtUword pos, EISHint hint);
+  void (*prefetch)(const EISeq *seq, GtUword pos);
   union EISHint *(*newHint)(const EISeq *seq);
   void (*deleteHint)(EISeq *seq, EISHint hint);
   const MRAEnc *(*getAlphabet)(const EISeq *seq);
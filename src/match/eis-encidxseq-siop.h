@@ -51,6 +51,14 @@ EISGetTransformedSym(EISeq *seq, GtUword pos, EISHint hint)
   return seq->classInfo->get(seq, pos, hint);
 }
 
+static inline void
+EISPrefetch(const EISeq *seq, GtUword pos)
+{
+  gt_assert(seq);
+  if (seq->classInfo->prefetch)
+    seq->classInfo->prefetch(seq, pos);
+}
+
 static inline GtUword
 EISRank(EISeq *seq, Symbol sym, GtUword pos, union EISHint *hint)
 {
@@ -349,6 +349,16 @@ EISGetSym(EISeq *seq, GtUword pos, EISHint hint);
 static inline Symbol
 EISGetTransformedSym(EISeq *seq, GtUword pos, EISHint hint);
 
+/**
+ * \brief Announce that rank queries for the given position will
+ * follow soon, so the data they need can be moved into the cache in
+ * the meantime. Does not change the state of the index.
+ * @param seq indexed sequence object to be queried
+ * @param pos position subsequent queries refer to
+ */
+static inline void
+EISPrefetch(const EISeq *seq, GtUword pos);
+
 /**
  * \brief Construct new hinting structure to accelerate operations on
  * related positions.
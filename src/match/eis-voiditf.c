@@ -18,6 +18,7 @@
 #include "core/divmodmul.h"
 #include "core/encseq_metadata.h"
 #include "core/log_api.h"
+#include "core/minmax.h"
 #include "eis-bwtseq-construct.h"
 #include "eis-bwtseq-priv.h"
 #include "eis-bwtseq.h"
@@ -72,6 +73,25 @@ bool gt_Bwtseqpositioniterator_next(GtUword *pos,
   return false;
 }
 
+GtUword gt_Bwtseqpositioniterator_next_batch(GtUword *positions,
+                                             GtUword maxnumofpositions,
+                                             Bwtseqpositioniterator *bspi)
+{
+  GtUword numofpositions;
+
+  if (bspi->currentbound >= bspi->upperbound)
+  {
+    return 0;
+  }
+  numofpositions = MIN(bspi->upperbound - bspi->currentbound,
+                       maxnumofpositions);
+  gt_BWTSeqLocateMatches(bspi->bwtseq,bspi->currentbound,
+                         bspi->currentbound + numofpositions,positions,
+                         &bspi->extBits);
+  bspi->currentbound += numofpositions;
+  return numofpositions;
+}
+
 bool gt_BwtseqpositionwithoutSEPiterator_next(GtUword *pos,
                                               Bwtseqpositioniterator *bspi)
 {
@@ -458,6 +478,41 @@ GtUword gt_voidpackedindexmstatsforward(const void *fmindex,
   return matchlength;
 }
 
+/* number of matches located together when reporting exact matches */
+#define GT_PCK_LOCATEBATCH 1024UL
+
+static void pck_processexactmatches(const FMindex *fmindex,
+                                    BWTSeqExactMatchesIterator *bsemi,
+                                    GtUword patternlength,
+                                    GtUword totallength,
+                                    const GtUchar *dbsubstring,
+                                    ProcessIdxMatch processmatch,
+                                    void *processmatchinfo)
+{
+  GtUword idx, numoflocated,
+          dbstartpos[GT_PCK_LOCATEBATCH];
+  GtIdxMatch match;
+
+  match.dbabsolute = true;
+  match.dblen = patternlength;
+  match.dbsubstring = dbsubstring;
+  match.querystartpos = 0;
+  match.querylen = patternlength;
+  match.distance = 0;
+  match.alignment = NULL;
+  while ((numoflocated = gt_EMIGetNextMatches(bsemi,dbstartpos,
+                                              GT_PCK_LOCATEBATCH,
+                                              (const BWTSeq *) fmindex)) > 0)
+  {
+    for (idx = 0; idx < numoflocated; idx++)
+    {
+      gt_assert(totallength >= (dbstartpos[idx] + patternlength));
+      match.dbstartpos = totallength - (dbstartpos[idx] + patternlength);
+      processmatch(processmatchinfo,&match);
+    }
+  }
+}
+
 bool gt_pck_exactpatternmatching(const FMindex *fmindex,
                                  const GtUchar *pattern,
                                  GtUword patternlength,
@@ -467,26 +522,14 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
                                  void *processmatchinfo)
 {
   BWTSeqExactMatchesIterator *bsemi;
-  GtUword dbstartpos, numofmatches;
-  GtIdxMatch match;
+  GtUword numofmatches;
 
   bsemi = gt_newEMIterator((const BWTSeq *) fmindex,
                            pattern,(size_t) patternlength, true);
   gt_assert(bsemi != NULL);
   numofmatches = gt_EMINumMatchesTotal(bsemi);
-  match.dbabsolute = true;
-  match.dblen = patternlength;
-  match.dbsubstring = dbsubstring;
-  match.querystartpos = 0;
-  match.querylen = patternlength;
-  match.distance = 0;
-  match.alignment = NULL;
-  while (EMIGetNextMatch(bsemi,&dbstartpos,(const BWTSeq *) fmindex))
-  {
-    gt_assert(totallength >= (dbstartpos + patternlength));
-    match.dbstartpos = totallength - (dbstartpos + patternlength);
-    processmatch(processmatchinfo,&match);
-  }
+  pck_processexactmatches(fmindex,bsemi,patternlength,totallength,
+                          dbsubstring,processmatch,processmatchinfo);
   if (bsemi != NULL)
   {
     gt_deleteEMIterator(bsemi);
@@ -495,6 +538,66 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
   return numofmatches > 0 ? true : false;
 }
 
+void gt_pck_exactpatternmatching_bounds(const FMindex *fmindex,
+                                        const GtUchar *const *patterns,
+                                        const GtUword *patternlengths,
+                                        GtUword numofpatterns,
+                                        Mbtab *bounds)
+{
+  struct matchBound *matchbounds;
+  size_t *querylengths;
+  GtUword idx;
+
+  if (numofpatterns == 0)
+  {
+    return;
+  }
+  matchbounds = gt_malloc(sizeof (*matchbounds) * numofpatterns);
+  querylengths = gt_malloc(sizeof (*querylengths) * numofpatterns);
+  for (idx = 0; idx < numofpatterns; idx++)
+  {
+    querylengths[idx] = (size_t) patternlengths[idx];
+  }
+  gt_BWTSeqMatchBoundsBatch((const BWTSeq *) fmindex,
+                            patterns,
+                            querylengths,
+                            numofpatterns,
+                            matchbounds,
+                            true);
+  for (idx = 0; idx < numofpatterns; idx++)
+  {
+    bounds[idx].lowerbound = matchbounds[idx].start;
+    bounds[idx].upperbound = matchbounds[idx].end;
+  }
+  gt_free(matchbounds);
+  gt_free(querylengths);
+}
+
+bool gt_pck_exactpatternmatching_report(const FMindex *fmindex,
+                                        const Mbtab *bound,
+                                        GtUword patternlength,
+                                        GtUword totallength,
+                                        const GtUchar *dbsubstring,
+                                        ProcessIdxMatch processmatch,
+                                        void *processmatchinfo)
+{
+  BWTSeqExactMatchesIterator bsemi;
+  struct matchBound matchbound;
+  GtUword numofmatches;
+  GT_UNUSED bool initialized;
+
+  initialized = gt_initEmptyEMIterator(&bsemi,(const BWTSeq *) fmindex);
+  gt_assert(initialized);
+  matchbound.start = bound->lowerbound;
+  matchbound.end = bound->upperbound;
+  gt_reinitEMIteratorFromBounds(&bsemi,&matchbound);
+  numofmatches = gt_EMINumMatchesTotal(&bsemi);
+  pck_processexactmatches(fmindex,&bsemi,patternlength,totallength,
+                          dbsubstring,processmatch,processmatchinfo);
+  gt_destructEMIterator(&bsemi);
+  return numofmatches > 0 ? true : false;
+}
+
 GtUword gt_voidpackedindex_totallength_get(const FMindex *fmindex)
 {
   GtUword bwtlen = BWTSeqLength((const BWTSeq *) fmindex);
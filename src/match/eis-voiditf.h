@@ -43,6 +43,12 @@ Bwtseqpositioniterator *gt_Bwtseqpositioniterator_new(const FMindex *fmindex,
 bool gt_Bwtseqpositioniterator_next(GtUword *pos,
                                     Bwtseqpositioniterator *bspi);
 
+/* stores the next at most <maxnumofpositions> positions in <positions>,
+   locating them together. Returns the number of positions stored. */
+GtUword gt_Bwtseqpositioniterator_next_batch(GtUword *positions,
+                                             GtUword maxnumofpositions,
+                                             Bwtseqpositioniterator *bspi);
+
 bool gt_BwtseqpositionwithoutSEPiterator_next(GtUword *pos,
                                               Bwtseqpositioniterator *bspi);
 
@@ -114,15 +120,36 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
                                  ProcessIdxMatch processmatch,
                                  void *processmatchinfo);
 
-GtUword gt_voidpackedfindfirstmatchconvert(const FMindex *fmindex,
-                                                 GtUword witnessbound,
-                                                 GtUword matchlength);
-
 typedef struct
 {
   GtUword lowerbound, upperbound;
 } Mbtab;
 
+/* computes in <bounds>[i] the interval of the matches of <patterns>[i] of
+   length <patternlengths>[i], for all i < <numofpatterns>. The backward
+   searches are performed in lock-step, see gt_BWTSeqMatchBoundsBatch. */
+void gt_pck_exactpatternmatching_bounds(const FMindex *fmindex,
+                                        const GtUchar *const *patterns,
+                                        const GtUword *patternlengths,
+                                        GtUword numofpatterns,
+                                        Mbtab *bounds);
+
+/* reports the matches of <pattern> in the interval <bound> previously
+   computed by gt_pck_exactpatternmatching_bounds. The result and the
+   matches passed to <processmatch> are the same as for
+   gt_pck_exactpatternmatching. */
+bool gt_pck_exactpatternmatching_report(const FMindex *fmindex,
+                                        const Mbtab *bound,
+                                        GtUword patternlength,
+                                        GtUword totallength,
+                                        const GtUchar *dbsubstring,
+                                        ProcessIdxMatch processmatch,
+                                        void *processmatchinfo);
+
+GtUword gt_voidpackedfindfirstmatchconvert(const FMindex *fmindex,
+                                                 GtUword witnessbound,
+                                                 GtUword matchlength);
+
 GtUword gt_bwtrangesplitallwithoutspecial(Mbtab *mbtab,
                                                 GtUword *rangeOccs,
                                                 const FMindex *fmindex,
@@ -18,6 +18,7 @@
 #include "match/ft-trimstat.h"
 #include "match/ft-polish.h"
 #include "match/ft-front-generation.h"
+#include "match/wordwise-lcp.h"
 
 #define GT_UPDATE_MATCH_HISTORY(FRONTVAL)\
         if ((FRONTVAL)->matchhistory_size < max_history)\
@@ -248,6 +249,83 @@ static GtUword ft_longest_common_all(GtFtSequenceObject *useq,
 
 #include "match/ft-longest-common.inc"
 
+/* compares <GT_UNITSIN2BITENC> characters at a time, replaces
+   ft_longest_common_twobit_twobit. Like the latter, only the characters of
+   <vseq> are complemented, <useq> is always read in forward mode. */
+static GtUword ft_longest_common_twobit_wordwise(GtFtSequenceObject *useq,
+                                                 GtUword ustart,
+                                                 GtFtSequenceObject *vseq,
+                                                 GtUword vstart)
+{
+  if (ustart < useq->substringlength && vstart < vseq->substringlength)
+  {
+    const GtUword maxlen = MIN(useq->substringlength - ustart,
+                               vseq->substringlength - vstart);
+
+    return gt_twobitencoding_lcp(useq->twobitencoding,
+                                 useq->read_seq_left2right
+                                   ? useq->offset + ustart
+                                   : useq->offset - ustart,
+                                 useq->read_seq_left2right,
+                                 vseq->twobitencoding,
+                                 vseq->read_seq_left2right
+                                   ? vseq->offset + vstart
+                                   : vseq->offset - vstart,
+                                 vseq->read_seq_left2right,
+                                 vseq->dir_is_complement,
+                                 maxlen);
+  }
+  return 0;
+}
+
+/* replaces ft_longest_common_bytes_bytes and
+   ft_longest_common_bytes_bytes_wildcard if both sequences are read in the
+   same direction and are not complemented */
+static GtUword ft_longest_common_bytes_wordwise_generic(
+                                                    GtFtSequenceObject *useq,
+                                                    GtUword ustart,
+                                                    GtFtSequenceObject *vseq,
+                                                    GtUword vstart,
+                                                    bool haswildcards)
+{
+  if (ustart < useq->substringlength && vstart < vseq->substringlength)
+  {
+    const GtUword maxlen = MIN(useq->substringlength - ustart,
+                               vseq->substringlength - vstart);
+
+    gt_assert(useq->read_seq_left2right == vseq->read_seq_left2right);
+    return gt_bytes_lcp(useq->read_seq_left2right
+                          ? useq->bytesequenceptr + useq->offset + ustart
+                          : useq->bytesequenceptr + useq->offset - ustart,
+                        vseq->read_seq_left2right
+                          ? vseq->bytesequenceptr + vseq->offset + vstart
+                          : vseq->bytesequenceptr + vseq->offset - vstart,
+                        useq->read_seq_left2right,
+                        haswildcards,
+                        maxlen);
+  }
+  return 0;
+}
+
+static GtUword ft_longest_common_bytes_wordwise(GtFtSequenceObject *useq,
+                                                GtUword ustart,
+                                                GtFtSequenceObject *vseq,
+                                                GtUword vstart)
+{
+  return ft_longest_common_bytes_wordwise_generic(useq,ustart,vseq,vstart,
+                                                  false);
+}
+
+static GtUword ft_longest_common_bytes_wordwise_wildcard(
+                                                    GtFtSequenceObject *useq,
+                                                    GtUword ustart,
+                                                    GtFtSequenceObject *vseq,
+                                                    GtUword vstart)
+{
+  return ft_longest_common_bytes_wordwise_generic(useq,ustart,vseq,vstart,
+                                                  true);
+}
+
 static int ft_sequenceobject2mode(const GtFtSequenceObject *seq)
 {
   if (seq->twobitencoding != NULL)
@@ -700,7 +778,21 @@ GtUword front_prune_edist_inplace(
       = (ufsr->haswildcards && vfsr->haswildcards) ? true : false;
     const int func_index
       = gt_sequenceobject_longest_func_index(&useq,&vseq,haswildcards);
-    ft_longest_common = ft_longest_common_func_tab[func_index];
+    if (useq.twobitencoding != NULL && vseq.twobitencoding != NULL)
+    {
+      ft_longest_common = ft_longest_common_twobit_wordwise;
+    } else if (ft_sequenceobject2mode(&useq) == 3 &&
+               ft_sequenceobject2mode(&vseq) == 3 &&
+               useq.read_seq_left2right == vseq.read_seq_left2right &&
+               !useq.dir_is_complement && !vseq.dir_is_complement)
+    {
+      ft_longest_common = haswildcards
+                            ? ft_longest_common_bytes_wordwise_wildcard
+                            : ft_longest_common_bytes_wordwise;
+    } else
+    {
+      ft_longest_common = ft_longest_common_func_tab[func_index];
+    }
   }
   frontspace->offset = 0;
   for (distance = 0, valid = 1UL; /* Nothing */; distance++, valid += 2)
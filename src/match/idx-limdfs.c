@@ -32,6 +32,9 @@
 #include "idxlocalidp.h"
 #include "esa-minunique.h"
 
+/* number of matches in a packed index interval located together */
+#define GT_LIMDFS_LOCATEBATCH 1024UL
+
 #define DECLAREDFSSTATE(V)\
         Aliasdfsstate V[5]
 
@@ -444,17 +447,23 @@ static void gen_pck_overinterval(const Genericindex *genericindex,
                                  GtIdxMatch *match)
 {
   Bwtseqpositioniterator *bspi;
-  GtUword dbstartpos;
+  GtUword idx, numoflocated, dbstartpos[GT_LIMDFS_LOCATEBATCH];
 
   gt_assert(itv->leftbound < itv->rightbound);
   bspi = gt_Bwtseqpositioniterator_new(genericindex->packedindex,
                                        itv->leftbound,itv->rightbound);
-  while (gt_Bwtseqpositioniterator_next(&dbstartpos,bspi))
+  while ((numoflocated
+            = gt_Bwtseqpositioniterator_next_batch(dbstartpos,
+                                                   GT_LIMDFS_LOCATEBATCH,
+                                                   bspi)) > 0)
   {
-    gt_assert(totallength >= (dbstartpos + itv->offset));
-    /* call processmatch */
-    match->dbstartpos = totallength - (dbstartpos + itv->offset);
-    processmatch(processmatchinfo,match);
+    for (idx = 0; idx < numoflocated; idx++)
+    {
+      gt_assert(totallength >= (dbstartpos[idx] + itv->offset));
+      /* call processmatch */
+      match->dbstartpos = totallength - (dbstartpos[idx] + itv->offset);
+      processmatch(processmatchinfo,match);
+    }
   }
   gt_Bwtseqpositioniterator_delete(bspi);
 }
@@ -1368,6 +1377,37 @@ bool gt_indexbasedexactpatternmatching(const Limdfsresources *limdfsresources,
   }
 }
 
+void gt_indexbasedexactpatternmatching_bounds(
+                                    const Limdfsresources *limdfsresources,
+                                    const GtUchar *const *patterns,
+                                    const GtUword *patternlengths,
+                                    GtUword numofpatterns,
+                                    Mbtab *bounds)
+{
+  gt_assert(!limdfsresources->genericindex->withesa);
+  gt_pck_exactpatternmatching_bounds(limdfsresources->genericindex->packedindex,
+                                     patterns,
+                                     patternlengths,
+                                     numofpatterns,
+                                     bounds);
+}
+
+bool gt_indexbasedexactpatternmatching_report(
+                                    const Limdfsresources *limdfsresources,
+                                    const Mbtab *bound,
+                                    GtUword patternlength)
+{
+  gt_assert(!limdfsresources->genericindex->withesa);
+  return gt_pck_exactpatternmatching_report(
+                                    limdfsresources->genericindex->packedindex,
+                                    bound,
+                                    patternlength,
+                                    limdfsresources->genericindex->totallength,
+                                    limdfsresources->currentpathspace,
+                                    limdfsresources->processmatch,
+                                    limdfsresources->processmatchinfo);
+}
+
 GtUchar gt_limdfs_getencodedchar(const Limdfsresources *limdfsresources,
                               GtUword pos,
                               GtReadmode readmode)
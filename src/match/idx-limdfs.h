@@ -100,6 +100,22 @@ bool gt_indexbasedexactpatternmatching(const Limdfsresources *limdfsresources,
                                     const GtUchar *pattern,
                                     GtUword patternlength);
 
+/* The following two functions split gt_indexbasedexactpatternmatching for
+   a batch of patterns into the computation of the match intervals of all
+   patterns and the report of the matches of each pattern. They only work
+   for packed indexes. */
+void gt_indexbasedexactpatternmatching_bounds(
+                                    const Limdfsresources *limdfsresources,
+                                    const GtUchar *const *patterns,
+                                    const GtUword *patternlengths,
+                                    GtUword numofpatterns,
+                                    Mbtab *bounds);
+
+bool gt_indexbasedexactpatternmatching_report(
+                                    const Limdfsresources *limdfsresources,
+                                    const Mbtab *bound,
+                                    GtUword patternlength);
+
 GtUchar gt_limdfs_getencodedchar(const Limdfsresources *limdfsresources,
                               GtUword pos,
                               GtReadmode readmode);
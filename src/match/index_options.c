@@ -339,6 +339,7 @@ gt_index_options_register_generic_output(GtOptionParser *op,
     idxo->optionoutsuftab
       = idxo->optionoutlcptab = idxo->optionoutbwttab = NULL;
     idxo->sfxstrategy.spmopt_minlength = 0;
+    idxo->sfxstrategy.withsain = false;
 #ifndef S_SPLINT_S
     gt_registerPackedIndexOptions(op,
                                   &idxo->bwtIdxParams,
@@ -456,6 +457,19 @@ static GtIndexOptions* gt_index_options_register_generic_create(
                            idxo->memlimit, NULL);
     gt_option_parser_add_option(op, idxo->optionmemlimit);
     gt_option_exclude(idxo->optionmemlimit, idxo->optionparts);
+    idxo->option = gt_option_new_bool("sain",
+                                      "sort the suffixes with the induced "
+                                      "suffix sorting algorithm SA-IS instead "
+                                      "of sorting the buckets; runs in "
+                                      "parallel if more than one job is "
+                                      "requested with option -j",
+                                      &idxo->sfxstrategy.withsain,
+                                      false);
+    gt_option_parser_add_option(op, idxo->option);
+    gt_option_exclude(idxo->option, idxo->optionspmopt);
+    gt_option_exclude(idxo->option, idxo->optiondifferencecover);
+    gt_option_exclude(idxo->option, idxo->optionmemlimit);
+    gt_option_exclude(idxo->option, idxo->optionparts);
   }
 
   idxo->option = gt_option_new_bool("iterscan",
@@ -25,12 +25,17 @@
 #include "core/fileutils.h"
 #include "core/format64.h"
 #include "core/hashmap-generic.h"
+#include "core/intbits.h"
 #include "core/log.h"
 #include "core/ma.h"
 #include "core/progressbar.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/spacecalc.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#endif
 #include "extended/assembly_stats_calculator.h"
 #include "match/asqg_writer.h"
 #include "match/gfa_writer.h"
@@ -983,32 +988,118 @@ GtUword gt_strgraph_redwithrc(GtStrgraph *strgraph, bool show_progressbar)
   return (counter >> 1);
 }
 
-/* return value: number of transitive edges */
-GtUword gt_strgraph_redtrans(GtStrgraph *strgraph, bool show_progressbar)
+typedef struct {
+  GtStrgraphVnum vnum;
+  GtStrgraphVEdgenum edgenum;
+} GtStrgraphEdgeID;
+
+/* minimal number of vertices for which the edges to be reduced are
+   searched in parallel */
+#define GT_STRGRAPH_PARALLEL_MINVERTICES (1UL << 12)
+
+/* in the parallel search, the edges to be reduced are collected in one
+   array per worker, otherwise they are marked directly */
+static inline void gt_strgraph_mark_edge(GtStrgraph *strgraph,
+                                         GtArray *marked,
+                                         GtStrgraphVnum vnum,
+                                         GtStrgraphVEdgenum edgenum)
 {
+  GtStrgraphEdgeID edgeid;
+
+  if (marked != NULL)
+  {
+    edgeid.vnum = vnum;
+    edgeid.edgenum = edgenum;
+    gt_array_add(marked, edgeid);
+  }
+  else
+    GT_STRGRAPH_EDGE_SET_MARK(strgraph, vnum, edgenum);
+}
+
+#ifdef GT_THREADS_ENABLED
+/* returns the thread pool, if the vertices of <strgraph> shall be processed
+   in parallel, NULL otherwise */
+static GtThreadPool* gt_strgraph_thread_pool(const GtStrgraph *strgraph)
+{
+  if (gt_jobs > 1U && GT_STRGRAPH_NOFVERTICES(strgraph) >=
+      (GtStrgraphVnum)GT_STRGRAPH_PARALLEL_MINVERTICES)
+    return gt_thread_pool_get(NULL);
+  return NULL;
+}
+
+static GtArray** gt_strgraph_marked_edges_new(GtUword numofworkers)
+{
+  GtArray **marked;
+  GtUword w;
+
+  marked = gt_malloc(sizeof (*marked) * numofworkers);
+  for (w = 0; w < numofworkers; w++)
+    marked[w] = gt_array_new(sizeof (GtStrgraphEdgeID));
+  return marked;
+}
+
+/* the edges are bitpacked, thus the marks are only set after the
+   parallel phase, when no other thread accesses the graph */
+static void gt_strgraph_marked_edges_apply_and_delete(GtStrgraph *strgraph,
+                                                      GtArray **marked,
+                                                      GtUword numofworkers)
+{
+  GtStrgraphEdgeID *edgeid;
+  GtUword w, idx;
+
+  for (w = 0; w < numofworkers; w++)
+  {
+    for (idx = 0; idx < gt_array_size(marked[w]); idx++)
+    {
+      edgeid = gt_array_get(marked[w], idx);
+      GT_STRGRAPH_EDGE_SET_MARK(strgraph, edgeid->vnum, edgeid->edgenum);
+    }
+    gt_array_delete(marked[w]);
+  }
+  gt_free(marked);
+}
+#endif
+
+typedef struct {
+  GtStrgraph *strgraph;
+  /* if <inplay> is NULL, the vertex marks are used to flag the successors
+     of the current vertex and the transitive edges are marked directly;
+     otherwise each worker uses its own bit table and collects the
+     transitive edges in <marked>, as the graph is not written to while
+     several workers read it */
+  GtBitsequence **inplay;
+  GtArray **marked;
+  GtUint64 *progress;
+} GtStrgraphRedtransInfo;
+
+static void gt_strgraph_redtrans_range(GtUword start, GtUword end,
+                                       unsigned int workerid, void *data)
+{
+  GtStrgraphRedtransInfo *info = data;
+  GtStrgraph *strgraph = info->strgraph;
+  GtBitsequence *inplay = NULL;
   GtStrgraphLength jlen, klen, longest;
   GtStrgraphVEdgenum j, k, l;
   GtStrgraphVnum i, jdest, kdest;
-  GtUword counter;
-  GtUint64 progress = 0;
-
-  gt_assert(strgraph != NULL);
-  gt_assert(strgraph->state == GT_STRGRAPH_SORTED_BY_L);
-
-  for (i = 0; i < GT_STRGRAPH_NOFVERTICES(strgraph); i++)
-    GT_STRGRAPH_V_SET_MARK(strgraph, i, GT_STRGRAPH_V_VACANT);
+  GtArray *marked = NULL;
+  bool kdest_inplay;
 
-  if (show_progressbar)
-    gt_progressbar_start(&progress,
-        (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph));
-  for (i = 0; i < GT_STRGRAPH_NOFVERTICES(strgraph); i++)
+  if (info->inplay != NULL)
+  {
+    inplay = info->inplay[workerid];
+    marked = info->marked[workerid];
+  }
+  for (i = (GtStrgraphVnum)start; i < (GtStrgraphVnum)end; i++)
   {
     if (GT_STRGRAPH_V_OUTDEG(strgraph, i) > 0)
     {
       for (j = 0; j < GT_STRGRAPH_V_NOFEDGES(strgraph, i); j++)
       {
-        GT_STRGRAPH_V_SET_MARK(strgraph, GT_STRGRAPH_EDGE_DEST(strgraph, i, j),
-            GT_STRGRAPH_V_INPLAY);
+        jdest = GT_STRGRAPH_EDGE_DEST(strgraph, i, j);
+        if (inplay != NULL)
+          GT_SETIBIT(inplay, jdest);
+        else
+          GT_STRGRAPH_V_SET_MARK(strgraph, jdest, GT_STRGRAPH_V_INPLAY);
       }
       GT_STRGRAPH_FIND_LONGEST_EDGE(strgraph, i, longest);
       for (j = 0; j < GT_STRGRAPH_V_NOFEDGES(strgraph, i); j++)
@@ -1020,14 +1111,19 @@ GtUword gt_strgraph_redtrans(GtStrgraph *strgraph, bool show_progressbar)
         {
           kdest = GT_STRGRAPH_EDGE_DEST(strgraph, jdest, k);
           klen = GT_STRGRAPH_EDGE_LEN(strgraph, jdest, k);
-          if (GT_STRGRAPH_V_MARK(strgraph, kdest) == GT_STRGRAPH_V_INPLAY)
+          if (inplay != NULL)
+            kdest_inplay = GT_ISIBITSET(inplay, kdest) ? true : false;
+          else
+            kdest_inplay = (GT_STRGRAPH_V_MARK(strgraph, kdest) ==
+                GT_STRGRAPH_V_INPLAY) ? true : false;
+          if (kdest_inplay)
           {
             for (l = 0; l < GT_STRGRAPH_V_NOFEDGES(strgraph, i); l++)
             {
               if (GT_STRGRAPH_EDGE_DEST(strgraph, i, l) == kdest &&
                   GT_STRGRAPH_EDGE_LEN(strgraph, i, l) == jlen + klen)
               {
-                GT_STRGRAPH_EDGE_SET_MARK(strgraph, i, l);
+                gt_strgraph_mark_edge(strgraph, marked, i, l);
               }
             }
           }
@@ -1035,12 +1131,71 @@ GtUword gt_strgraph_redtrans(GtStrgraph *strgraph, bool show_progressbar)
       }
       for (j = 0; j < GT_STRGRAPH_V_NOFEDGES(strgraph, i); j++)
       {
-        GT_STRGRAPH_V_SET_MARK(strgraph, GT_STRGRAPH_EDGE_DEST(strgraph, i, j),
-            GT_STRGRAPH_V_VACANT);
+        jdest = GT_STRGRAPH_EDGE_DEST(strgraph, i, j);
+        if (inplay != NULL)
+          GT_UNSETIBIT(inplay, jdest);
+        else
+          GT_STRGRAPH_V_SET_MARK(strgraph, jdest, GT_STRGRAPH_V_VACANT);
       }
     }
+    if (info->progress != NULL)
+      (*info->progress)++;
+  }
+}
+
+/* return value: number of transitive edges */
+GtUword gt_strgraph_redtrans(GtStrgraph *strgraph, bool show_progressbar)
+{
+  GtStrgraphRedtransInfo info;
+  GtStrgraphVnum i;
+  GtUword counter;
+  GtUint64 progress = 0;
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool;
+  GtUword w, numofworkers;
+#endif
+
+  gt_assert(strgraph != NULL);
+  gt_assert(strgraph->state == GT_STRGRAPH_SORTED_BY_L);
+
+  info.strgraph = strgraph;
+  info.inplay = NULL;
+  info.marked = NULL;
+  info.progress = NULL;
+  if (show_progressbar)
+    gt_progressbar_start(&progress,
+        (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph));
+#ifdef GT_THREADS_ENABLED
+  pool = gt_strgraph_thread_pool(strgraph);
+  if (pool != NULL)
+  {
+    numofworkers = (GtUword)gt_thread_pool_size(pool);
+    info.inplay = gt_malloc(sizeof (*info.inplay) * numofworkers);
+    for (w = 0; w < numofworkers; w++)
+    {
+      GT_INITBITTAB(info.inplay[w],
+          (GtUword)GT_STRGRAPH_NOFVERTICES(strgraph));
+    }
+    info.marked = gt_strgraph_marked_edges_new(numofworkers);
+    gt_thread_pool_parallel_for(pool, 0,
+        (GtUword)GT_STRGRAPH_NOFVERTICES(strgraph), 0,
+        gt_strgraph_redtrans_range, &info);
+    gt_strgraph_marked_edges_apply_and_delete(strgraph, info.marked,
+                                              numofworkers);
+    for (w = 0; w < numofworkers; w++)
+      gt_free(info.inplay[w]);
+    gt_free(info.inplay);
+    progress = (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph);
+  }
+  else
+#endif
+  {
+    for (i = 0; i < GT_STRGRAPH_NOFVERTICES(strgraph); i++)
+      GT_STRGRAPH_V_SET_MARK(strgraph, i, GT_STRGRAPH_V_VACANT);
     if (show_progressbar)
-      progress++;
+      info.progress = &progress;
+    gt_strgraph_redtrans_range(0, (GtUword)GT_STRGRAPH_NOFVERTICES(strgraph),
+        0, &info);
   }
   if (show_progressbar)
     gt_progressbar_stop();
@@ -1124,35 +1279,38 @@ static inline GtStrgraphVEdgenum gt_strgraph_find_only_edge(
 }
 
 typedef struct {
-  GtStrgraphVnum vnum;
-  GtStrgraphVEdgenum edgenum;
-} GtStrgraphEdgeID;
-
-GtUword gt_strgraph_reddepaths(GtStrgraph *strgraph,
-    GtUword maxdepth, bool show_progressbar)
-{
+  GtStrgraph *strgraph;
+  GtUword maxdepth;
+  /* for each worker: the edges of the current path, the edges to be
+     reduced (NULL if they are marked directly) and the number of dead
+     paths */
+  GtStrgraphEdgeID **edges;
+  GtArray **marked;
+  GtUword *nofdepaths;
+  GtUint64 *progress;
+} GtStrgraphReddepathsInfo;
+
+/* the graph is only read while the dead paths are searched, thus the
+   vertices can be processed in any order */
+static void gt_strgraph_reddepaths_range(GtUword start, GtUword end,
+                                         unsigned int workerid, void *data)
+{
+  GtStrgraphReddepathsInfo *info = data;
+  GtStrgraph *strgraph = info->strgraph;
+  GtStrgraphEdgeID *edges = info->edges[workerid];
+  GtArray *marked = NULL;
   GtStrgraphVnum i, from, to;
   GtStrgraphVEdgenum j, from_to;
   GtUword depth, d;
-  GtUword counter = 0, nofdepaths = 0;
-  GtUint64 progress = 0;
   bool i_branching;
-  GtStrgraphEdgeID *edges;
-
-  gt_assert(strgraph != NULL);
 
-  edges = gt_malloc(sizeof (GtStrgraphEdgeID) * (maxdepth + 1));
-
-  if (show_progressbar)
-    gt_progressbar_start(&progress,
-        (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph));
-
-  for (i = 0; i < GT_STRGRAPH_NOFVERTICES(strgraph); i++)
+  if (info->marked != NULL)
+    marked = info->marked[workerid];
+  for (i = (GtStrgraphVnum)start; i < (GtStrgraphVnum)end; i++)
   {
-    if (GT_STRGRAPH_V_OUTDEG(strgraph, i) > 0)
+    if (GT_STRGRAPH_V_OUTDEG(strgraph, i) > 0 &&
+        !GT_STRGRAPH_V_IS_INTERNAL(strgraph, i))
     {
-      if (GT_STRGRAPH_V_IS_INTERNAL(strgraph, i))
-        continue;
       i_branching =
         (GT_STRGRAPH_V_OUTDEG(strgraph, i) > (GtStrgraphVEdgenum)1 &&
          GT_STRGRAPH_V_INDEG(strgraph, i) > 0) ||
@@ -1170,34 +1328,92 @@ GtUword gt_strgraph_reddepaths(GtStrgraph *strgraph,
           edges->edgenum = from_to;
           depth = 1UL;
           while (GT_STRGRAPH_V_IS_INTERNAL(strgraph, to) &&
-              depth <= maxdepth)
+              depth <= info->maxdepth)
           {
             depth++;
             from = to;
             from_to = gt_strgraph_find_only_edge(strgraph, from);
             to = GT_STRGRAPH_EDGE_DEST(strgraph, from, from_to);
             gt_assert(depth >= 1UL);
-            gt_assert(depth - 1UL <= maxdepth);
+            gt_assert(depth - 1UL <= info->maxdepth);
             edges[depth - 1UL].vnum = from;
             edges[depth - 1UL].edgenum = from_to;
           }
-          if (depth <= maxdepth &&
+          if (depth <= info->maxdepth &&
               (!i_branching || GT_STRGRAPH_V_OUTDEG(strgraph, to) == 0))
           {
-            nofdepaths++;
+            info->nofdepaths[workerid]++;
             for (d = 0; d < depth; d++)
             {
-              GT_STRGRAPH_EDGE_SET_MARK(strgraph, edges[d].vnum,
+              gt_strgraph_mark_edge(strgraph, marked, edges[d].vnum,
                   edges[d].edgenum);
             }
           }
         }
       }
     }
+    if (info->progress != NULL)
+      (*info->progress)++;
+  }
+}
+
+GtUword gt_strgraph_reddepaths(GtStrgraph *strgraph,
+    GtUword maxdepth, bool show_progressbar)
+{
+  GtStrgraphReddepathsInfo info;
+  GtUword w, numofworkers = 1UL, counter = 0, nofdepaths = 0;
+  GtUint64 progress = 0;
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool;
+#endif
+
+  gt_assert(strgraph != NULL);
+
+#ifdef GT_THREADS_ENABLED
+  pool = gt_strgraph_thread_pool(strgraph);
+  if (pool != NULL)
+    numofworkers = (GtUword)gt_thread_pool_size(pool);
+#endif
+  info.strgraph = strgraph;
+  info.maxdepth = maxdepth;
+  info.marked = NULL;
+  info.progress = NULL;
+  info.edges = gt_malloc(sizeof (*info.edges) * numofworkers);
+  for (w = 0; w < numofworkers; w++)
+    info.edges[w] = gt_malloc(sizeof (GtStrgraphEdgeID) * (maxdepth + 1));
+  info.nofdepaths = gt_calloc((size_t)numofworkers,
+                              sizeof (*info.nofdepaths));
+
+  if (show_progressbar)
+    gt_progressbar_start(&progress,
+        (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph));
+
+#ifdef GT_THREADS_ENABLED
+  if (pool != NULL)
+  {
+    info.marked = gt_strgraph_marked_edges_new(numofworkers);
+    gt_thread_pool_parallel_for(pool, 0,
+        (GtUword)GT_STRGRAPH_NOFVERTICES(strgraph), 0,
+        gt_strgraph_reddepaths_range, &info);
+    gt_strgraph_marked_edges_apply_and_delete(strgraph, info.marked,
+                                              numofworkers);
+    progress = (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph);
+  }
+  else
+#endif
+  {
     if (show_progressbar)
-      progress++;
+      info.progress = &progress;
+    gt_strgraph_reddepaths_range(0,
+        (GtUword)GT_STRGRAPH_NOFVERTICES(strgraph), 0, &info);
+  }
+  for (w = 0; w < numofworkers; w++)
+  {
+    nofdepaths += info.nofdepaths[w];
+    gt_free(info.edges[w]);
   }
-  gt_free(edges);
+  gt_free(info.nofdepaths);
+  gt_free(info.edges);
   counter = gt_strgraph_reduce_marked_edges(strgraph);
   if (show_progressbar)
     gt_progressbar_stop();
@@ -1227,48 +1443,39 @@ static int gt_strgraph_path_info_compare(const void *pi_a, const void *pi_b)
   return retv;
 }
 
-GtUword gt_strgraph_redpbubbles(GtStrgraph *strgraph,
-    GtUword maxwidth, const GtUword maxdiff,
-    bool show_progressbar)
-{
+typedef struct {
+  GtStrgraph *strgraph;
+  GtUword maxwidth, maxdiff;
+  /* for each worker: the paths starting in the current vertex, the edges
+     to be reduced (NULL if they are marked directly) and the number of
+     p-bubbles */
+  GtStrgraphPathInfo **info;
+  GtArray **marked;
+  GtUword *nofpbubbles;
+  GtUint64 *progress;
+} GtStrgraphRedpbubblesInfo;
+
+/* the graph is only read while the p-bubbles are searched, thus the
+   vertices can be processed in any order */
+static void gt_strgraph_redpbubbles_range(GtUword start, GtUword end,
+                                          unsigned int workerid, void *data)
+{
+  GtStrgraphRedpbubblesInfo *pbinfo = data;
+  GtStrgraph *strgraph = pbinfo->strgraph;
+  GtStrgraphPathInfo *info = pbinfo->info[workerid], *prev;
+  GtArray *marked = NULL;
   GtStrgraphVnum i, from, to;
   GtStrgraphVEdgenum j, from_to, p, nofpaths;
   GtStrgraphLength len;
-  GtUword depth, width, counter = 0, nofpbubbles = 0;
-  GtUint64 progress = 0;
-  GtStrgraphPathInfo *info, *prev;
-
-  gt_assert(strgraph != NULL);
-
-  if (maxwidth == 0)
-    maxwidth = (GtUword)(gt_strgraph_longest_read(strgraph) << 2) -
-        (strgraph->minmatchlen << 1) - 1;
-  gt_log_log("redpbubbles(maxwidth="GT_WU", maxdiff="GT_WU")", maxwidth,
-             maxdiff);
-
-  /* allocate info and set all marks to VACANT */
-  {
-    GtUword maxoutdeg = 0;
-    for (i = 0; i < GT_STRGRAPH_NOFVERTICES(strgraph); i++)
-    {
-      GT_STRGRAPH_V_SET_MARK(strgraph, i, GT_STRGRAPH_V_VACANT);
-      if (GT_STRGRAPH_V_OUTDEG(strgraph, i) > (GtStrgraphVEdgenum)maxoutdeg)
-        maxoutdeg = (GtUword)GT_STRGRAPH_V_OUTDEG(strgraph, i);
-    }
-    gt_log_log("maxoutdeg = "GT_WU"", maxoutdeg);
-    info = gt_malloc(sizeof (GtStrgraphPathInfo) * maxoutdeg);
-  }
-
-  if (show_progressbar)
-    gt_progressbar_start(&progress,
-        (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph));
+  GtUword depth, width;
 
-  for (i = 0; i < GT_STRGRAPH_NOFVERTICES(strgraph); i++)
+  if (pbinfo->marked != NULL)
+    marked = pbinfo->marked[workerid];
+  for (i = (GtStrgraphVnum)start; i < (GtStrgraphVnum)end; i++)
   {
-    if (GT_STRGRAPH_V_OUTDEG(strgraph, i) > 0)
+    if (GT_STRGRAPH_V_OUTDEG(strgraph, i) > 0 &&
+        !GT_STRGRAPH_V_IS_INTERNAL(strgraph, i))
     {
-      if (GT_STRGRAPH_V_IS_INTERNAL(strgraph, i))
-        continue;
       nofpaths = 0;
       for (j = 0; j < GT_STRGRAPH_V_NOFEDGES(strgraph, i); j++)
       {
@@ -1280,7 +1487,8 @@ GtUword gt_strgraph_redpbubbles(GtStrgraph *strgraph,
           gt_assert(sizeof (GtUword) >= sizeof (GtStrgraphLength) ||
               len <= (GtStrgraphLength)ULONG_MAX);
           width = (GtUword)len;
-          while (GT_STRGRAPH_V_IS_INTERNAL(strgraph, to) && width <= maxwidth)
+          while (GT_STRGRAPH_V_IS_INTERNAL(strgraph, to) &&
+              width <= pbinfo->maxwidth)
           {
             depth++;
             from = to;
@@ -1292,7 +1500,7 @@ GtUword gt_strgraph_redpbubbles(GtStrgraph *strgraph,
             width += (GtUword)len;
             to = GT_STRGRAPH_EDGE_DEST(strgraph, from, from_to);
           }
-          if (width <= maxwidth && depth > 1UL)
+          if (width <= pbinfo->maxwidth && depth > 1UL)
           {
             info[nofpaths].edgenum = j;
             info[nofpaths].dest = to;
@@ -1310,9 +1518,9 @@ GtUword gt_strgraph_redpbubbles(GtStrgraph *strgraph,
         for (p = (GtStrgraphVEdgenum)1; p < nofpaths; p++)
         {
           if (info[p].dest == prev->dest &&
-              (info[p].width - prev->width <= maxdiff))
+              (info[p].width - prev->width <= pbinfo->maxdiff))
           {
-            nofpbubbles++;
+            pbinfo->nofpbubbles[workerid]++;
             if (info[p].depth <= prev->depth)
             {
               from_to = info[p].edgenum;
@@ -1322,13 +1530,13 @@ GtUword gt_strgraph_redpbubbles(GtStrgraph *strgraph,
               from_to = prev->edgenum;
               prev = info + p;
             }
-            GT_STRGRAPH_EDGE_SET_MARK(strgraph, i, from_to);
+            gt_strgraph_mark_edge(strgraph, marked, i, from_to);
             to = GT_STRGRAPH_EDGE_DEST(strgraph, i, from_to);
             while (GT_STRGRAPH_V_IS_INTERNAL(strgraph, to))
             {
               from = to;
               from_to = gt_strgraph_find_only_edge(strgraph, from);
-              GT_STRGRAPH_EDGE_SET_MARK(strgraph, from, from_to);
+              gt_strgraph_mark_edge(strgraph, marked, from, from_to);
               to = GT_STRGRAPH_EDGE_DEST(strgraph, from, from_to);
             }
           }
@@ -1339,14 +1547,91 @@ GtUword gt_strgraph_redpbubbles(GtStrgraph *strgraph,
         }
       }
     }
+    if (pbinfo->progress != NULL)
+      (*pbinfo->progress)++;
+  }
+}
+
+GtUword gt_strgraph_redpbubbles(GtStrgraph *strgraph,
+    GtUword maxwidth, const GtUword maxdiff,
+    bool show_progressbar)
+{
+  GtStrgraphRedpbubblesInfo pbinfo;
+  GtStrgraphVnum i;
+  GtUword w, numofworkers = 1UL, maxoutdeg = 0, counter = 0,
+          nofpbubbles = 0;
+  GtUint64 progress = 0;
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool;
+#endif
+
+  gt_assert(strgraph != NULL);
+
+  if (maxwidth == 0)
+    maxwidth = (GtUword)(gt_strgraph_longest_read(strgraph) << 2) -
+        (strgraph->minmatchlen << 1) - 1;
+  gt_log_log("redpbubbles(maxwidth="GT_WU", maxdiff="GT_WU")", maxwidth,
+             maxdiff);
+
+#ifdef GT_THREADS_ENABLED
+  pool = gt_strgraph_thread_pool(strgraph);
+  if (pool != NULL)
+    numofworkers = (GtUword)gt_thread_pool_size(pool);
+#endif
+
+  /* allocate info and set all marks to VACANT */
+  for (i = 0; i < GT_STRGRAPH_NOFVERTICES(strgraph); i++)
+  {
+    GT_STRGRAPH_V_SET_MARK(strgraph, i, GT_STRGRAPH_V_VACANT);
+    if (GT_STRGRAPH_V_OUTDEG(strgraph, i) > (GtStrgraphVEdgenum)maxoutdeg)
+      maxoutdeg = (GtUword)GT_STRGRAPH_V_OUTDEG(strgraph, i);
+  }
+  gt_log_log("maxoutdeg = "GT_WU"", maxoutdeg);
+  pbinfo.strgraph = strgraph;
+  pbinfo.maxwidth = maxwidth;
+  pbinfo.maxdiff = maxdiff;
+  pbinfo.marked = NULL;
+  pbinfo.progress = NULL;
+  pbinfo.info = gt_malloc(sizeof (*pbinfo.info) * numofworkers);
+  for (w = 0; w < numofworkers; w++)
+    pbinfo.info[w] = gt_malloc(sizeof (GtStrgraphPathInfo) * maxoutdeg);
+  pbinfo.nofpbubbles = gt_calloc((size_t)numofworkers,
+                                 sizeof (*pbinfo.nofpbubbles));
+
+  if (show_progressbar)
+    gt_progressbar_start(&progress,
+        (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph));
+
+#ifdef GT_THREADS_ENABLED
+  if (pool != NULL)
+  {
+    pbinfo.marked = gt_strgraph_marked_edges_new(numofworkers);
+    gt_thread_pool_parallel_for(pool, 0,
+        (GtUword)GT_STRGRAPH_NOFVERTICES(strgraph), 0,
+        gt_strgraph_redpbubbles_range, &pbinfo);
+    gt_strgraph_marked_edges_apply_and_delete(strgraph, pbinfo.marked,
+                                              numofworkers);
+    progress = (GtUint64)GT_STRGRAPH_NOFVERTICES(strgraph);
+  }
+  else
+#endif
+  {
     if (show_progressbar)
-      progress++;
+      pbinfo.progress = &progress;
+    gt_strgraph_redpbubbles_range(0,
+        (GtUword)GT_STRGRAPH_NOFVERTICES(strgraph), 0, &pbinfo);
   }
   counter = gt_strgraph_reduce_marked_edges(strgraph);
 
   if (show_progressbar)
     gt_progressbar_stop();
-  gt_free(info);
+  for (w = 0; w < numofworkers; w++)
+  {
+    nofpbubbles += pbinfo.nofpbubbles[w];
+    gt_free(pbinfo.info[w]);
+  }
+  gt_free(pbinfo.nofpbubbles);
+  gt_free(pbinfo.info);
   gt_log_log("p-bubbles = "GT_WU"", nofpbubbles);
   gt_log_log("removed p-bubble edges = "GT_WU"", counter);
 #ifndef NDEBUG
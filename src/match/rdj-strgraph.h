@@ -119,7 +119,11 @@ int gt_strgraph_load_reads_library_table(GtStrgraph *strgraph,
 GtStrgraph* gt_strgraph_new_from_file(const GtEncseq *encseq,
     GtUword fixlen, const char *indexname, const char *suffix);
 
-/* --- simplify --- */
+/* --- simplify ---
+   if more than one thread is used (option -j), gt_strgraph_redtrans(),
+   gt_strgraph_reddepaths() and gt_strgraph_redpbubbles() process the vertices
+   of large graphs in parallel, the results do not depend on the number of
+   threads */
 
 void gt_strgraph_sort_edges_by_len(GtStrgraph *strgraph, bool show_progressbar);
 
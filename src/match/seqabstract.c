@@ -26,6 +26,7 @@
 #include "core/types_api.h"
 #include "match/seqabstract.h"
 #include "match/extend-offset.h"
+#include "match/wordwise-lcp.h"
 
 #define GT_SEQABSTRACT_TOTALLENGTH_UNDEF GT_UWORD_MAX
 
@@ -46,6 +47,9 @@ struct GtSeqabstract
     const GtUchar *string;
     const GtEncseq *encseq;
   } seq;
+  /* set if the substring contains no special characters and can thus be
+     compared via the two bit encoding of the encseq */
+  const GtTwobitencoding *twobitencoding;
 };
 
 void gt_seqabstract_reset(GtSeqabstract *sa)
@@ -57,6 +61,7 @@ void gt_seqabstract_reset(GtSeqabstract *sa)
   sa->totallength = GT_SEQABSTRACT_TOTALLENGTH_UNDEF;
   sa->seqstartpos = 0;
   sa->seq.string = NULL;
+  sa->twobitencoding = NULL;
 }
 
 GtSeqabstract *gt_seqabstract_new_empty(void)
@@ -114,6 +119,7 @@ void gt_seqabstract_reinit_gtuchar(bool rightextension,
   sa->seqtype = GT_SEQABSTRACT_STRING;
   sa->totallength = totallength;
   sa->seq.string = string;
+  sa->twobitencoding = NULL;
   gt_seqabstract_init(sa,
                       rightextension,
                       readmode,
@@ -136,6 +142,51 @@ GtSeqabstract *gt_seqabstract_new_gtuchar(bool rightextension,
   return sa;
 }
 
+/* Returns the two bit encoding of <encseq> if all positions of the substring
+   represented by <sa> are within a single sequence free of wildcards, and
+   NULL otherwise. */
+static const GtTwobitencoding *gt_seqabstract_twobitencoding(
+                                                    const GtSeqabstract *sa,
+                                                    const GtEncseq *encseq)
+{
+  GtUword first, last;
+
+  if (sa->len == 0 || gt_encseq_is_mirrored(encseq) ||
+      !gt_encseq_has_twobitencoding(encseq) || gt_encseq_wildcards(encseq) > 0)
+  {
+    return NULL;
+  }
+  if (sa->read_seq_left2right)
+  {
+    first = sa->offset;
+    last = sa->offset + sa->len - 1;
+  } else
+  {
+    if (sa->offset + 1 < sa->len)
+    {
+      return NULL;
+    }
+    first = sa->offset + 1 - sa->len;
+    last = sa->offset;
+  }
+  if (last >= gt_encseq_total_length(encseq))
+  {
+    return NULL;
+  }
+  if (gt_encseq_num_of_sequences(encseq) > 1)
+  {
+    const GtUword seqnum = gt_encseq_seqnum(encseq,first),
+                  seqstartpos = gt_encseq_seqstartpos(encseq,seqnum);
+
+    if (first < seqstartpos ||
+        last >= seqstartpos + gt_encseq_seqlength(encseq,seqnum))
+    {
+      return NULL;
+    }
+  }
+  return gt_encseq_twobitencoding_export(encseq);
+}
+
 void gt_seqabstract_reinit_encseq(bool rightextension,
                                   GtReadmode readmode,
                                   GtSeqabstract *sa,
@@ -152,6 +203,7 @@ void gt_seqabstract_reinit_encseq(bool rightextension,
                       len,
                       startpos,
                       sa->totallength);
+  sa->twobitencoding = gt_seqabstract_twobitencoding(sa,encseq);
 }
 
 GtSeqabstract *gt_seqabstract_new_encseq(bool rightextension,
@@ -213,6 +265,40 @@ GtUword gt_seqabstract_lcp(bool rightextension,
   gt_assert(useq != NULL && vseq != NULL &&
             useq->len >= u_start && vseq->len >= v_start);
   maxlen = MIN(useq->len - u_start, vseq->len - v_start);
+  if (useq->twobitencoding != NULL && vseq->twobitencoding != NULL)
+  {
+    return gt_twobitencoding_lcp(useq->twobitencoding,
+                                 useq->read_seq_left2right
+                                   ? useq->offset + u_start
+                                   : useq->offset - u_start,
+                                 useq->read_seq_left2right,
+                                 vseq->twobitencoding,
+                                 vseq->read_seq_left2right
+                                   ? vseq->offset + v_start
+                                   : vseq->offset - v_start,
+                                 vseq->read_seq_left2right,
+                                 useq->dir_is_complement !=
+                                 vseq->dir_is_complement,
+                                 maxlen);
+  }
+  if (maxlen > 0 &&
+      useq->seqtype == GT_SEQABSTRACT_STRING &&
+      vseq->seqtype == GT_SEQABSTRACT_STRING &&
+      useq->read_seq_left2right == vseq->read_seq_left2right &&
+      useq->dir_is_complement == vseq->dir_is_complement)
+  {
+    /* complementing both sides does not change the result, and a special
+       character in <vseq> is a mismatch unless <useq> has one there, too */
+    return gt_bytes_lcp(useq->read_seq_left2right
+                          ? useq->seq.string + useq->offset + u_start
+                          : useq->seq.string + useq->offset - u_start,
+                        vseq->read_seq_left2right
+                          ? vseq->seq.string + vseq->offset + v_start
+                          : vseq->seq.string + vseq->offset - v_start,
+                        useq->read_seq_left2right,
+                        true,
+                        maxlen);
+  }
   for (lcp = 0; lcp < maxlen; lcp++)
   {
     GtUchar u_cc, v_cc;
@@ -37,6 +37,7 @@
 #include "sfx-shortreadsort.h"
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 
 #define ACCESSCHARRAND(POS)    gt_encseq_get_encoded_char(bsr->encseq,\
@@ -1655,10 +1656,10 @@ typedef struct
   GtUword totalwidth;
   GtBentsedgresources *bsr;
   unsigned int thread_num;
-  GtThread *thread;
 } GtBentsedg_partition_thread_info;
 
-static void *gt_bentsedg_partition_thread_caller(void *data)
+static void gt_bentsedg_partition_thread_caller(GT_UNUSED unsigned int workerid,
+                                                void *data)
 {
   GtCodetype code;
   GtBentsedg_partition_thread_info *thinfo
@@ -1682,7 +1683,6 @@ static void *gt_bentsedg_partition_thread_caller(void *data)
                                (GtUword) thinfo->prefixlength);
     }
   }
-  return NULL;
 }
 
 void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
@@ -1702,6 +1702,7 @@ void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   bool haserr = false;
   GtBentsedg_partition_thread_info *th_tab;
   GtSuffixsortspace **sssp_tab;
+  GtThreadPool *pool;
 
   gt_assert(partition_for_threads != NULL);
   thread_parts = gt_suftabparts_numofparts(partition_for_threads);
@@ -1736,20 +1737,19 @@ void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
       = processunsortedsuffixrange;
     th_tab[tp].bsr->processunsortedsuffixrangeinfo
       = processunsortedsuffixrangeinfo;
-    th_tab[tp].thread
-      = gt_thread_new (gt_bentsedg_partition_thread_caller,th_tab + tp,NULL);
-    if (th_tab[tp].thread == NULL)
-    {
-      haserr = true;
-    }
   }
-  for (tp = 0; tp < thread_parts; tp++)
+  if (!(pool = gt_thread_pool_get(NULL)))
   {
-    if (!haserr)
+    haserr = true;
+  } else
+  {
+    GtThreadPoolGroup *group = gt_thread_pool_group_new(pool);
+    for (tp = 0; tp < thread_parts; tp++)
     {
-      gt_thread_join(th_tab[tp].thread);
+      gt_thread_pool_group_submit(group,gt_bentsedg_partition_thread_caller,
+                                  th_tab + tp);
     }
-    gt_thread_delete(th_tab[tp].thread);
+    gt_thread_pool_group_delete(group);
   }
   for (tp = 0; tp < thread_parts; tp++)
   {
@@ -1949,13 +1949,14 @@ typedef struct
   unsigned int prefixlength, thread_num;
   GtBentsedgIterator *bs_it; /* shared, _next-function needs a mutex */
   GtBentsedgSynchronizer *bs_sync; /* shared _process-function needs a mutex */
-  GtThread *thread;
 } GtBentsedg_stream_thread_info;
 
-static void *gt_bentsedg_stream_thread_caller(void *data)
+/* Each worker of the thread pool uses its own sort resources, which are
+   indexed by <workerid>. */
+static void gt_bentsedg_stream_thread_caller(unsigned int workerid, void *data)
 {
   GtBentsedg_stream_thread_info *thinfo
-    = (GtBentsedg_stream_thread_info *) data;
+    = ((GtBentsedg_stream_thread_info *) data) + workerid;
 
   while (true)
   {
@@ -1980,7 +1981,6 @@ static void *gt_bentsedg_stream_thread_caller(void *data)
     gt_bendsedgSynchronizer_process(thinfo->bs_sync,bucketnumber);
     gt_mutex_unlock(thinfo->bs_sync->mutex);
   }
-  return NULL;
 }
 
 void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
@@ -2004,6 +2004,7 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   bool haserr = false;
   GtBentsedg_stream_thread_info *th_tab;
   GtSuffixsortspace **sssp_tab;
+  GtThreadPool *pool;
 
   gt_assert(gt_jobs > 1U);
   th_tab = gt_malloc(sizeof *th_tab * gt_jobs);
@@ -2035,20 +2036,15 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
       = processunsortedsuffixrangeinfo;
     th_tab[tp].bs_it = bs_it;
     th_tab[tp].bs_sync = bs_sync;
-    th_tab[tp].thread
-      = gt_thread_new (gt_bentsedg_stream_thread_caller,th_tab + tp,NULL);
-    if (th_tab[tp].thread == NULL)
-    {
-      haserr = true;
-    }
   }
-  for (tp = 0; tp < gt_jobs; tp++)
+  if (!(pool = gt_thread_pool_get(NULL)))
   {
-    if (!haserr)
-    {
-      gt_thread_join(th_tab[tp].thread);
-    }
-    gt_thread_delete(th_tab[tp].thread);
+    haserr = true;
+  } else
+  {
+    gt_assert(gt_thread_pool_size(pool) == gt_jobs);
+    gt_thread_pool_run(pool,(GtUword) gt_jobs,
+                       gt_bentsedg_stream_thread_caller,th_tab);
   }
   for (tp = 0; tp < gt_jobs; tp++)
   {
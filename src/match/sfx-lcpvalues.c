@@ -28,6 +28,8 @@
 
 GT_DECLAREARRAYSTRUCT(Largelcpvalue);
 
+#define GT_PLCPBUFFERSIZE 65536UL
+
 typedef struct
 {
   FILE *outfplcptab,
@@ -122,6 +124,20 @@ static void outsmalllcpvalues(Lcpoutput2file *lcp2file,
              lcp2file->outfplcptab);
 }
 
+static void outlargelcpvalues(Lcpoutput2file *lcp2file)
+{
+  if (lcp2file->largelcpvalues.nextfreeLargelcpvalue > 0)
+  {
+    lcp2file->totalnumoflargelcpvalues
+      += lcp2file->largelcpvalues.nextfreeLargelcpvalue;
+    gt_assert(lcp2file->outfpllvtab != NULL);
+    gt_xfwrite(lcp2file->largelcpvalues.spaceLargelcpvalue,
+               sizeof (*lcp2file->largelcpvalues.spaceLargelcpvalue),
+               (size_t) lcp2file->largelcpvalues.nextfreeLargelcpvalue,
+               lcp2file->outfpllvtab);
+  }
+}
+
 static unsigned int lcp_bucketends(Lcpsubtab *lcpsubtab,
                                    Suffixwithcode *previoussuffix,
                                    GT_UNUSED GtUword firstspecialsuffix,
@@ -418,18 +434,61 @@ static void outlcpvalues(Lcpsubtab *lcpsubtab,
     }
   }
   outsmalllcpvalues(lcpsubtab->lcp2file,width);
-  if (lcpsubtab->lcp2file->largelcpvalues.nextfreeLargelcpvalue > 0)
-  {
-    lcpsubtab->lcp2file->totalnumoflargelcpvalues
-      += lcpsubtab->lcp2file->largelcpvalues.nextfreeLargelcpvalue;
-    gt_assert(lcpsubtab->lcp2file->outfpllvtab != NULL);
-    gt_xfwrite(lcpsubtab->lcp2file->largelcpvalues.spaceLargelcpvalue,
-               sizeof (*lcpsubtab->lcp2file->largelcpvalues.
-                                   spaceLargelcpvalue),
-               (size_t) lcpsubtab->lcp2file->largelcpvalues.
-                                   nextfreeLargelcpvalue,
-               lcpsubtab->lcp2file->outfpllvtab);
+  outlargelcpvalues(lcpsubtab->lcp2file);
+}
+
+void gt_Outlcpinfo_plcptab2file(GtOutlcpinfo *outlcpinfo,
+                                const unsigned int *suftab,
+                                const unsigned int *plcptab,
+                                GtUword numoflcpvalues)
+{
+  Lcpsubtab *lcpsubtab;
+  Lcpoutput2file *lcp2file;
+  GtUword idx, bufferidx = 0, lcpvalue;
+  uint8_t *smalllcpvalues;
+  const GtUword buffersize = MIN(numoflcpvalues,GT_PLCPBUFFERSIZE);
+
+  gt_assert(outlcpinfo != NULL && outlcpinfo->lcpsubtab.lcp2file != NULL);
+  lcpsubtab = &outlcpinfo->lcpsubtab;
+  lcp2file = lcpsubtab->lcp2file;
+  smalllcpvalues = gt_malloc(sizeof (*smalllcpvalues) * buffersize);
+  lcp2file->largelcpvalues.nextfreeLargelcpvalue = 0;
+  for (idx = 0; idx < numoflcpvalues; idx++)
+  {
+    lcpvalue = (GtUword) plcptab[suftab[idx]];
+    if (lcp2file->maxbranchdepth < lcpvalue)
+    {
+      lcp2file->maxbranchdepth = lcpvalue;
+    }
+    if (lcpvalue < (GtUword) LCPOVERFLOW)
+    {
+      smalllcpvalues[bufferidx] = (uint8_t) lcpvalue;
+    } else
+    {
+      Largelcpvalue *largelcpvalueptr;
+
+      GT_GETNEXTFREEINARRAY(largelcpvalueptr,&lcp2file->largelcpvalues,
+                            Largelcpvalue,256);
+      largelcpvalueptr->position = idx;
+      largelcpvalueptr->value = lcpvalue;
+      smalllcpvalues[bufferidx] = LCPOVERFLOW;
+    }
+    lcpsubtab->lcptabsum += (double) lcpvalue;
+    if (lcpsubtab->distlcpvalues != NULL)
+    {
+      gt_disc_distri_add(lcpsubtab->distlcpvalues, lcpvalue);
+    }
+    if (++bufferidx == buffersize || idx + 1 == numoflcpvalues)
+    {
+      lcp2file->smalllcpvalues = smalllcpvalues;
+      outsmalllcpvalues(lcp2file,bufferidx);
+      outlargelcpvalues(lcp2file);
+      lcp2file->largelcpvalues.nextfreeLargelcpvalue = 0;
+      bufferidx = 0;
+    }
   }
+  lcp2file->smalllcpvalues = NULL;
+  gt_free(smalllcpvalues);
 }
 
 static GtUword outmany0lcpvalues(GtUword many,
@@ -579,6 +638,12 @@ void gt_Outlcpinfo_numsuffixes2output_set(GtOutlcpinfo *outlcpinfo,
   outlcpinfo->numsuffixes2output = numsuffixes2output;
 }
 
+bool gt_Outlcpinfo_lcptab2file(const GtOutlcpinfo *outlcpinfo)
+{
+  gt_assert(outlcpinfo != NULL);
+  return outlcpinfo->lcpsubtab.lcp2file != NULL ? true : false;
+}
+
 GtUword gt_Outlcpinfo_maxbranchdepth(const GtOutlcpinfo *outlcpinfo)
 {
   if (outlcpinfo->lcpsubtab.lcp2file != NULL)
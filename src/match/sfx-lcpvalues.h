@@ -126,6 +126,16 @@ void gt_Outlcpinfo_numsuffixes2output_set(GtOutlcpinfo *outlcpinfo,
 
 GtUword gt_Outlcpinfo_maxbranchdepth(const GtOutlcpinfo *outlcpinfo);
 
+bool gt_Outlcpinfo_lcptab2file(const GtOutlcpinfo *outlcpinfo);
+
+/* Writes the lcp-values of the first <numoflcpvalues> suffixes in <suftab>
+   to the lcp table files of <outlcpinfo>, looking them up in the table
+   <plcptab> of PLCP-values, which is indexed by suffix positions. */
+void gt_Outlcpinfo_plcptab2file(GtOutlcpinfo *outlcpinfo,
+                                const unsigned int *suftab,
+                                const unsigned int *plcptab,
+                                GtUword numoflcpvalues);
+
 void gt_Outlcpinfo_prebucket(GtOutlcpinfo *outlcpinfo,
                              GtCodetype code,
                              GtUword lcptaboffset);
@@ -24,10 +24,17 @@
 #include "core/logger.h"
 #include "core/minmax.h"
 #include "core/compact_ulong_store.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#endif
+#include "core/unused_api.h"
 #include "esa-seqread.h"
 #include "sarr-def.h"
 #include "sfx-linlcp.h"
 
+#define GT_PLCP_PARALLEL_MINLENGTH (1UL << 16)
+
 GtUword *gt_ENCSEQ_lcp13_kasai(const GtEncseq *encseq,
                                GtReadmode readmode,
                                GtUword partwidth,
@@ -207,6 +214,196 @@ unsigned int *gt_plain_lcp_phialgorithm(bool onlyplcp,
   }
 }
 
+#define GT_PLCP_UNDEF UINT_MAX
+
+typedef struct
+{
+  const GtEncseq *encseq;
+  GtReadmode readmode;
+  bool cmpcharbychar;
+  GtUword totallength,
+          *maxlcp;
+  const unsigned int *suftab;
+  unsigned int *phitab;
+} GtPlcpinfo;
+
+static void gt_plcp_undefphi_range(GtUword start,GtUword end,
+                                   GT_UNUSED unsigned int workerid,void *data)
+{
+  GtPlcpinfo *plcpinfo = (GtPlcpinfo *) data;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+  {
+    plcpinfo->phitab[idx] = GT_PLCP_UNDEF;
+  }
+}
+
+static void gt_plcp_setphi_range(GtUword start,GtUword end,
+                                 GT_UNUSED unsigned int workerid,void *data)
+{
+  GtPlcpinfo *plcpinfo = (GtPlcpinfo *) data;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+  {
+    plcpinfo->phitab[plcpinfo->suftab[idx]] = plcpinfo->suftab[idx-1];
+  }
+}
+
+/* Computes the PLCP-values of the positions from <start> to <end> - 1 by
+   the Phi-algorithm. As the positions are processed from left to right, the
+   lcp-value of a position minus one is a lower bound for the lcp-value of
+   the next position, but no such bound is known at the start of a range.
+   Hence the ranges can be processed independently. */
+static void gt_plcp_phialgorithm_range(GtUword start,GtUword end,
+                                       unsigned int workerid,void *data)
+{
+  GtPlcpinfo *plcpinfo = (GtPlcpinfo *) data;
+  GtEncseqReader *esr1 = NULL, *esr2 = NULL;
+  GtCommonunits commonunits;
+  GtUword pos, lcpvalue = 0;
+
+  if (!plcpinfo->cmpcharbychar)
+  {
+    esr1 = gt_encseq_create_reader_with_readmode(plcpinfo->encseq,
+                                                 plcpinfo->readmode,0);
+    esr2 = gt_encseq_create_reader_with_readmode(plcpinfo->encseq,
+                                                 plcpinfo->readmode,0);
+  }
+  for (pos = start; pos < end; pos++)
+  {
+    const unsigned int currentphitab = plcpinfo->phitab[pos];
+
+    if (currentphitab != GT_PLCP_UNDEF)
+    {
+      if (plcpinfo->cmpcharbychar)
+      {
+        const GtUword lastoffset
+          = plcpinfo->totallength - MAX(pos,(GtUword) currentphitab);
+
+        while (lcpvalue < lastoffset)
+        {
+          GtUchar cc1, cc2;
+
+          cc1 = gt_encseq_get_encoded_char(plcpinfo->encseq,pos+lcpvalue,
+                                           plcpinfo->readmode);
+          cc2 = gt_encseq_get_encoded_char(plcpinfo->encseq,
+                                           currentphitab+lcpvalue,
+                                           plcpinfo->readmode);
+          if (cc1 == cc2 && ISNOTSPECIAL(cc1))
+          {
+            lcpvalue++;
+          } else
+          {
+            break;
+          }
+        }
+      } else
+      {
+        (void) gt_encseq_compare_viatwobitencoding(&commonunits,
+                                                   plcpinfo->encseq,
+                                                   plcpinfo->encseq,
+                                                   plcpinfo->readmode,
+                                                   esr1,
+                                                   esr2,
+                                                   pos,
+                                                   (GtUword) currentphitab,
+                                                   lcpvalue,
+                                                   0);
+        lcpvalue = commonunits.finaldepth;
+      }
+      gt_assert(lcpvalue < (GtUword) GT_PLCP_UNDEF);
+      plcpinfo->phitab[pos] = (unsigned int) lcpvalue;
+      if (lcpvalue > 0)
+      {
+        if (plcpinfo->maxlcp[workerid] < lcpvalue)
+        {
+          plcpinfo->maxlcp[workerid] = lcpvalue;
+        }
+        lcpvalue--;
+      }
+    } else
+    {
+      plcpinfo->phitab[pos] = 0;
+      lcpvalue = 0;
+    }
+  }
+  gt_encseq_reader_delete(esr1);
+  gt_encseq_reader_delete(esr2);
+}
+
+unsigned int *gt_encseq_plcp_phialgorithm(GtUword *maxlcp,
+                                          const GtEncseq *encseq,
+                                          GtReadmode readmode,
+                                          bool cmpcharbychar,
+                                          GtUword partwidth,
+                                          GtUword totallength,
+                                          const unsigned int *suftab)
+{
+  GtPlcpinfo plcpinfo;
+  GtUword workerid, numofworkers = 1UL;
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool = NULL;
+
+  if (gt_jobs > 1U && totallength >= GT_PLCP_PARALLEL_MINLENGTH)
+  {
+    pool = gt_thread_pool_get(NULL);
+  }
+  if (pool != NULL)
+  {
+    numofworkers = (GtUword) gt_thread_pool_size(pool);
+  }
+#endif
+  gt_assert(totallength < (GtUword) GT_PLCP_UNDEF);
+  plcpinfo.encseq = encseq;
+  plcpinfo.readmode = readmode;
+  plcpinfo.cmpcharbychar = cmpcharbychar;
+  plcpinfo.totallength = totallength;
+  plcpinfo.suftab = suftab;
+  plcpinfo.phitab = gt_malloc(sizeof (*plcpinfo.phitab) * (totallength+1));
+  plcpinfo.maxlcp = gt_calloc((size_t) numofworkers,
+                              sizeof (*plcpinfo.maxlcp));
+#ifdef GT_THREADS_ENABLED
+  if (pool != NULL)
+  {
+    /* the ranges of text positions compared are of the same length, but
+       the time to compare them is not. So use smaller ranges than there
+       are workers to balance the load. */
+    const GtUword grainsize = totallength/(4 * numofworkers) + 1;
+
+    gt_thread_pool_parallel_for(pool,0,totallength+1,0,
+                                gt_plcp_undefphi_range,&plcpinfo);
+    if (partwidth > 1UL)
+    {
+      gt_thread_pool_parallel_for(pool,1UL,partwidth,0,
+                                  gt_plcp_setphi_range,&plcpinfo);
+    }
+    gt_thread_pool_parallel_for(pool,0,totallength,grainsize,
+                                gt_plcp_phialgorithm_range,&plcpinfo);
+  } else
+#endif
+  {
+    gt_plcp_undefphi_range(0,totallength+1,0,&plcpinfo);
+    if (partwidth > 1UL)
+    {
+      gt_plcp_setphi_range(1UL,partwidth,0,&plcpinfo);
+    }
+    gt_plcp_phialgorithm_range(0,totallength,0,&plcpinfo);
+  }
+  plcpinfo.phitab[totallength] = 0;
+  *maxlcp = 0;
+  for (workerid = 0; workerid < numofworkers; workerid++)
+  {
+    if (*maxlcp < plcpinfo.maxlcp[workerid])
+    {
+      *maxlcp = plcpinfo.maxlcp[workerid];
+    }
+  }
+  gt_free(plcpinfo.maxlcp);
+  return plcpinfo.phitab; /* overlaid by the PLCP-values */
+}
+
 static GtUword *gt_ENCSEQ_compute_occless_tab(const GtEncseq *encseq,
                                               GtReadmode readmode)
 {
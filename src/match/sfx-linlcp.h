@@ -44,6 +44,20 @@ unsigned int *gt_plain_lcp_phialgorithm(bool onlyplcp,
                                         GtUword totallength,
                                         const unsigned int *suftab);
 
+/* Returns the table of the PLCP-values of all positions of <encseq>, i.e.
+   the lcp-value of the suffix at position <pos> is stored at index <pos>.
+   The positions are processed in parallel ranges, using <gt_jobs> threads.
+   Only the first <partwidth> entries of <suftab> are used. If
+   <cmpcharbychar> is false, suffixes are compared via the twobit encoding.
+   The maximum lcp-value is stored in <maxlcp>. */
+unsigned int *gt_encseq_plcp_phialgorithm(GtUword *maxlcp,
+                                          const GtEncseq *encseq,
+                                          GtReadmode readmode,
+                                          bool cmpcharbychar,
+                                          GtUword partwidth,
+                                          GtUword totallength,
+                                          const unsigned int *suftab);
+
 int gt_lcptab_lightweightcheck(const char *esaindexname,
                                const GtEncseq *encseq,
                                GtReadmode readmode,
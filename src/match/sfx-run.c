@@ -417,6 +417,7 @@ static int run_packedindexconstruction(GtLogger *logger,
       haserr = true;
     } else
     {
+      gt_BWTSeqLogLocateTradeoff(bwtSeq, logger);
       gt_deleteBWTSeq(bwtSeq); /**< the actual object is not * used here */
     }
     gt_deleteSfxInterface(si);
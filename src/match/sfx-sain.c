@@ -20,6 +20,10 @@
 #include "core/unused_api.h"
 #include "core/timer_api.h"
 #include "core/mathsupport.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#endif
 #include "sfx-lwcheck.h"
 #include "bare-encseq.h"
 #include "sfx-sain.h"
@@ -39,6 +43,14 @@
         ((int) (RM)) % 2 == 0 ? (GtReadmode) ((int) (RM) + 1)\
                               : (GtReadmode) ((int) (RM) - 1)
 
+/* Sequences and suffix arrays with fewer entries than this are processed
+   single-threaded, even if more than one job is requested. */
+#define GT_SAIN_PARALLEL_MINENTRIES  (1UL << 16)
+
+/* Number of suftab entries prefetched in parallel at once by the final
+   induction steps. */
+#define GT_SAIN_INDUCE_BLOCKSIZE     (1UL << 16)
+
 typedef enum
 {
   GT_SAIN_PLAINSEQ,
@@ -109,6 +121,81 @@ static void gt_sain_allocate_tmpspace(GtSainseq *sainseq,
   sainseq->roundtablepoints2suftab = false;
 }
 
+#ifdef GT_THREADS_ENABLED
+typedef struct
+{
+  const GtSainseq *sainseq;
+  GtUsainindextype *counts;
+} GtSainCountinfo;
+
+static void gt_sain_count_range(GtUword start,GtUword end,
+                                unsigned int workerid,void *data)
+{
+  GtSainCountinfo *countinfo = (GtSainCountinfo *) data;
+  const GtSainseq *sainseq = countinfo->sainseq;
+  GtUsainindextype *counts = countinfo->counts +
+                             (GtUword) workerid * sainseq->numofchars;
+  GtUword idx;
+
+  if (sainseq->seqtype == GT_SAIN_PLAINSEQ)
+  {
+    for (idx = start; idx < end; idx++)
+    {
+      counts[sainseq->seq.plainseq[idx]]++;
+    }
+  } else
+  {
+    gt_assert(sainseq->seqtype == GT_SAIN_INTSEQ);
+    for (idx = start; idx < end; idx++)
+    {
+      counts[sainseq->seq.array[idx]]++;
+    }
+  }
+}
+
+/* Counts the characters of a plain or an integer sequence with one table
+   of counters per worker thread and adds them to the bucket sizes.
+   Returns false if the sequence is too short or the alphabet too large
+   for this to pay off; then the bucket sizes are unchanged. */
+static bool gt_sain_parallel_countchars(GtSainseq *sainseq)
+{
+  GtThreadPool *pool;
+  GtSainCountinfo countinfo;
+  GtUword numofworkers, charidx, workerid;
+
+  if (gt_jobs <= 1U || sainseq->totallength < GT_SAIN_PARALLEL_MINENTRIES ||
+      sainseq->numofchars * gt_jobs * 8 > sainseq->totallength ||
+      (pool = gt_thread_pool_get(NULL)) == NULL)
+  {
+    return false;
+  }
+  numofworkers = (GtUword) gt_thread_pool_size(pool);
+  countinfo.sainseq = sainseq;
+  countinfo.counts = (GtUsainindextype *)
+                     gt_calloc((size_t) (numofworkers * sainseq->numofchars),
+                               sizeof (*countinfo.counts));
+  gt_thread_pool_parallel_for(pool,0,sainseq->totallength,0,
+                              gt_sain_count_range,&countinfo);
+  for (workerid = 0; workerid < numofworkers; workerid++)
+  {
+    const GtUsainindextype *counts
+      = countinfo.counts + workerid * sainseq->numofchars;
+
+    for (charidx = 0; charidx < sainseq->numofchars; charidx++)
+    {
+      sainseq->bucketsize[charidx] += counts[charidx];
+    }
+  }
+  gt_free(countinfo.counts);
+  return true;
+}
+#else
+static bool gt_sain_parallel_countchars(GT_UNUSED GtSainseq *sainseq)
+{
+  return false;
+}
+#endif
+
 static GtSainseq *gt_sainseq_new_from_encseq(const GtEncseq *encseq,
                                              GtReadmode readmode)
 {
@@ -153,9 +240,13 @@ static GtSainseq *gt_sainseq_new_from_plainseq(const GtUchar *plainseq,
   sainseq->bare_encseq = NULL;
   sainseq->readmode = GT_READMODE_FORWARD;
   gt_sain_allocate_tmpspace(sainseq,len+1,len);
-  for (cptr = sainseq->seq.plainseq; cptr < sainseq->seq.plainseq + len; cptr++)
+  if (!gt_sain_parallel_countchars(sainseq))
   {
-    sainseq->bucketsize[*cptr]++;
+    for (cptr = sainseq->seq.plainseq; cptr < sainseq->seq.plainseq + len;
+         cptr++)
+    {
+      sainseq->bucketsize[*cptr]++;
+    }
   }
   return sainseq;
 }
@@ -268,10 +359,13 @@ static GtSainseq *gt_sainseq_new_from_array(GtUsainindextype *arr,
   {
     sainseq->bucketsize[charidx] = 0;
   }
-  for (cptr = arr; cptr < arr + sainseq->totallength; cptr++)
+  if (!gt_sain_parallel_countchars(sainseq))
   {
-    gt_assert((GtUword) *cptr < numofchars);
-    sainseq->bucketsize[*cptr]++;
+    for (cptr = arr; cptr < arr + sainseq->totallength; cptr++)
+    {
+      gt_assert((GtUword) *cptr < numofchars);
+      sainseq->bucketsize[*cptr]++;
+    }
   }
   return sainseq;
 }
@@ -928,10 +1022,251 @@ static void gt_sain_fast_assignSstarnames(GtUword totallength,
   }
 }
 
+#ifdef GT_THREADS_ENABLED
+/* In the final induction steps, most of the time is spent on the random
+   accesses to the sequence at the two positions preceding each suffix.
+   These accesses are independent of each other, so for a block of suftab
+   entries they are done in parallel before the block is scanned
+   sequentially. The sequential scan uses a prefetched entry only if the
+   suftab entry has not been changed since by an induction into the same
+   block. */
+
+typedef struct
+{
+  GtSsainindextype position;
+  GtUword currentcc;
+  bool leftcontext;
+} GtSainInducecache;
+
+typedef struct
+{
+  const GtSainseq *sainseq;
+  const GtSsainindextype *suftab;
+  GtSainInducecache *cache;
+  GtUword offset;
+  bool ltype;
+} GtSainInduceblock;
+
+static GtUword gt_sainseq_getrawchar(const GtSainseq *sainseq,
+                                     GtUword position)
+{
+  switch (sainseq->seqtype)
+  {
+    case GT_SAIN_PLAINSEQ:
+    case GT_SAIN_BARE_ENCSEQ:
+      return (GtUword) sainseq->seq.plainseq[position];
+    case GT_SAIN_INTSEQ:
+      return (GtUword) sainseq->seq.array[position];
+    case GT_SAIN_ENCSEQ:
+      return (GtUword) gt_encseq_get_encoded_char(sainseq->seq.encseq,
+                                                  position,
+                                                  sainseq->readmode);
+  }
+#ifndef S_SPLINT_S
+  return 0;
+#endif
+}
+
+/* Determines the character preceding suffix <position> > 0 and whether
+   this character is itself preceded by a smaller (L-type induction,
+   <ltype> is true) or a larger character (S-type induction). The latter
+   decides whether the induced suffix is marked. */
+static bool gt_sain_inducecontext(GtUword *currentcc,
+                                  const GtSainseq *sainseq,
+                                  bool ltype,
+                                  GtSsainindextype position)
+{
+  GtUword cc;
+
+  gt_assert(position > 0);
+  cc = gt_sainseq_getrawchar(sainseq,(GtUword) --position);
+  *currentcc = cc;
+  if (cc >= sainseq->numofchars)
+  {
+    return false;
+  }
+  if (ltype)
+  {
+    return (position > 0 &&
+            gt_sainseq_getrawchar(sainseq,(GtUword) (position-1)) < cc)
+           ? true : false;
+  }
+  return (position == 0 ||
+          gt_sainseq_getrawchar(sainseq,(GtUword) (position-1)) > cc)
+         ? true : false;
+}
+
+static void gt_sain_induce_prefetch(GtUword start,GtUword end,
+                                    GT_UNUSED unsigned int workerid,
+                                    void *data)
+{
+  const GtSainInduceblock *block = (const GtSainInduceblock *) data;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+  {
+    GtSainInducecache *cache = block->cache + idx;
+
+    cache->position = block->suftab[block->offset + idx];
+    if (cache->position > 0)
+    {
+      cache->leftcontext = gt_sain_inducecontext(&cache->currentcc,
+                                                 block->sainseq,
+                                                 block->ltype,
+                                                 cache->position);
+    }
+  }
+}
+
+static void gt_sain_parallel_induceLtypesuffixes2(const GtSainseq *sainseq,
+                                                  GtSsainindextype *suftab,
+                                                  GtUword nonspecialentries,
+                                                  GtThreadPool *pool)
+{
+  GtUword lastupdatecc = 0, blockstart;
+  GtUsainindextype *fillptr = sainseq->bucketfillptr;
+  GtSsainindextype *bucketptr = NULL;
+  GtSainInduceblock block;
+
+  block.sainseq = sainseq;
+  block.suftab = suftab;
+  block.ltype = true;
+  block.cache = gt_malloc(sizeof (*block.cache) * GT_SAIN_INDUCE_BLOCKSIZE);
+  for (blockstart = 0; blockstart < nonspecialentries;
+       blockstart += GT_SAIN_INDUCE_BLOCKSIZE)
+  {
+    GtUword idx, width = MIN(GT_SAIN_INDUCE_BLOCKSIZE,
+                             nonspecialentries - blockstart);
+
+    block.offset = blockstart;
+    gt_thread_pool_parallel_for(pool,0,width,0,gt_sain_induce_prefetch,
+                                &block);
+    for (idx = 0; idx < width; idx++)
+    {
+      GtSsainindextype *suftabptr = suftab + blockstart + idx,
+                       position = *suftabptr;
+
+      *suftabptr = ~position;
+      if (position > 0)
+      {
+        GtUword currentcc;
+        bool leftcontext;
+
+        if (block.cache[idx].position == position)
+        {
+          currentcc = block.cache[idx].currentcc;
+          leftcontext = block.cache[idx].leftcontext;
+        } else
+        {
+          leftcontext = gt_sain_inducecontext(&currentcc,sainseq,true,
+                                              position);
+        }
+        position--;
+        if (currentcc < sainseq->numofchars)
+        {
+          gt_assert(currentcc > 0);
+          GT_SAINUPDATEBUCKETPTR(currentcc);
+          gt_assert(bucketptr != NULL && suftabptr < bucketptr);
+          *bucketptr++ = leftcontext ? ~position : position;
+        }
+      }
+    }
+  }
+  gt_free(block.cache);
+}
+
+static void gt_sain_parallel_induceStypesuffixes2(const GtSainseq *sainseq,
+                                                  GtSsainindextype *suftab,
+                                                  GtUword nonspecialentries,
+                                                  GtThreadPool *pool)
+{
+  GtUword lastupdatecc = 0, blockend, width;
+  GtUsainindextype *fillptr = sainseq->bucketfillptr;
+  GtSsainindextype *bucketptr = NULL;
+  GtSainInduceblock block;
+
+  gt_sain_special_singleSinduction2(sainseq,
+                                    suftab,
+                                    (GtSsainindextype) sainseq->totallength,
+                                    nonspecialentries);
+  if (sainseq->seqtype == GT_SAIN_ENCSEQ ||
+      sainseq->seqtype == GT_SAIN_BARE_ENCSEQ)
+  {
+    gt_sain_induceStypes2fromspecialranges(sainseq,suftab,nonspecialentries);
+  }
+  block.sainseq = sainseq;
+  block.suftab = suftab;
+  block.ltype = false;
+  block.cache = gt_malloc(sizeof (*block.cache) * GT_SAIN_INDUCE_BLOCKSIZE);
+  for (blockend = nonspecialentries; blockend > 0; blockend -= width)
+  {
+    GtUword idx;
+
+    width = MIN(GT_SAIN_INDUCE_BLOCKSIZE,blockend);
+    block.offset = blockend - width;
+    gt_thread_pool_parallel_for(pool,0,width,0,gt_sain_induce_prefetch,
+                                &block);
+    for (idx = width; idx > 0; idx--)
+    {
+      GtSsainindextype *suftabptr = suftab + block.offset + idx - 1,
+                       position = *suftabptr;
+
+      if (position > 0)
+      {
+        GtUword currentcc;
+        bool leftcontext;
+
+        if (block.cache[idx-1].position == position)
+        {
+          currentcc = block.cache[idx-1].currentcc;
+          leftcontext = block.cache[idx-1].leftcontext;
+        } else
+        {
+          leftcontext = gt_sain_inducecontext(&currentcc,sainseq,false,
+                                              position);
+        }
+        position--;
+        if (currentcc < sainseq->numofchars)
+        {
+          GT_SAINUPDATEBUCKETPTR(currentcc);
+          gt_assert(bucketptr != NULL && bucketptr - 1 < suftabptr);
+          *(--bucketptr) = leftcontext ? ~position : position;
+        }
+      } else
+      {
+        *suftabptr = ~position;
+      }
+    }
+  }
+  gt_free(block.cache);
+}
+
+/* Returns the thread pool if the final induction steps for
+   <nonspecialentries> suffixes are to be run in parallel, otherwise NULL. */
+static GtThreadPool *gt_sain_induce_pool(GtUword nonspecialentries)
+{
+  if (gt_jobs > 1U && nonspecialentries >= GT_SAIN_PARALLEL_MINENTRIES)
+  {
+    return gt_thread_pool_get(NULL);
+  }
+  return NULL;
+}
+#endif
+
 static void gt_sain_induceLtypesuffixes2(const GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool = gt_sain_induce_pool(nonspecialentries);
+
+  if (pool != NULL)
+  {
+    gt_sain_parallel_induceLtypesuffixes2(sainseq,suftab,nonspecialentries,
+                                          pool);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -954,6 +1289,16 @@ static void gt_sain_induceStypesuffixes2(const GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool = gt_sain_induce_pool(nonspecialentries);
+
+  if (pool != NULL)
+  {
+    gt_sain_parallel_induceStypesuffixes2(sainseq,suftab,nonspecialentries,
+                                          pool);
+    return;
+  }
+#endif
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -47,7 +47,9 @@ typedef struct
        noshortreadsort,
        outsuftabonfile,
        compressedoutput,
-       withradixsort;
+       withradixsort,
+       withsain; /* sort all suffixes with the induced suffix sorting
+                    algorithm SA-IS instead of sorting the buckets */
 } Sfxstrategy;
 
  /*@unused@*/ static inline void defaultsfxstrategy(Sfxstrategy *sfxstrategy,
@@ -71,6 +73,7 @@ typedef struct
   sfxstrategy->noshortreadsort = false;
   sfxstrategy->compressedoutput = false;
   sfxstrategy->withradixsort = false;
+  sfxstrategy->withsain = false;
   sfxstrategy->userdefinedsortmaxdepth = 0;
 }
 
@@ -58,6 +58,8 @@
 #include "sfx-bentsedg.h"
 #include "sfx-suffixgetset.h"
 #include "sfx-maprange.h"
+#include "sfx-linlcp.h"
+#include "sfx-sain.h"
 
 struct Sfxiterator
 {
@@ -69,7 +71,10 @@ struct Sfxiterator
   unsigned int numofchars,
                prefixlength;
   Sfxstrategy sfxstrategy;
-  bool withprogressbar;
+  bool withprogressbar,
+       withbuckets; /* false if SA-IS sorts the suffixes and no bucket table
+                       is written, then the suffixes are neither counted nor
+                       inserted into buckets */
 
   /* invariant for each part */
   GtSuftabparts *suftabparts;
@@ -1410,13 +1415,42 @@ Sfxiterator *gt_Sfxiterator_new_withadditionalvalues(
         haserr = true;
       }
     }
+    if (!haserr && sfxstrategy->withsain)
+    {
+      if (voidoutlcpinfo != NULL &&
+          !gt_Outlcpinfo_lcptab2file((const GtOutlcpinfo *) voidoutlcpinfo))
+      {
+        gt_error_set(err,"option -sain cannot be used to compute the "
+                         "shulen distribution for genomediff");
+        haserr = true;
+      } else
+      {
+        if (numofparts > 1U || maximumspace > 0 ||
+            sfxstrategy->differencecover > 0 ||
+            sfxstrategy->spmopt_minlength > 0)
+        {
+          gt_error_set(err,"option -sain cannot be combined with options "
+                           "-parts, -memlimit, -dc, or -spmopt");
+          haserr = true;
+        } else
+        {
+          if (gt_sain_checkmaxsequencelength(gt_encseq_total_length(encseq),
+                                             true,err) != 0)
+          {
+            haserr = true;
+          }
+        }
+      }
+    }
   }
   if (!haserr)
   {
     sfi = gt_malloc(sizeof (*sfi));
     estimatedspace += sizeof (*sfi);
+    sfi->withbuckets = (sfxstrategy == NULL || !sfxstrategy->withsain ||
+                        outfpbcktab != NULL) ? true : false;
     if (sfxstrategy != NULL && sfxstrategy->storespecialcodes &&
-        sfxstrategy->spmopt_minlength == 0)
+        sfxstrategy->spmopt_minlength == 0 && sfi->withbuckets)
     {
       sfi->spaceCodeatposition
         = gt_malloc(sizeof (*sfi->spaceCodeatposition) * (realspecialranges+1));
@@ -1676,78 +1710,86 @@ Sfxiterator *gt_Sfxiterator_new_withadditionalvalues(
     GtUword largestbucketsize, saved_bucketswithoutwholeleaf;
     gt_assert(sfi != NULL);
     sfi->storespecials = true;
-    if (sfxprogress != NULL)
+    if (sfxprogress != NULL && sfi->withbuckets)
     {
       gt_timer_show_progress(sfxprogress,"counting prefix distribution",stdout);
     }
-    if (prefixlength == 1U)
+    if (!sfi->withbuckets)
     {
-      unsigned int charidx;
-
-      for (charidx=0; charidx<sfi->numofchars; charidx++)
-      {
-        unsigned int updateindex = GT_ISDIRCOMPLEMENT(readmode)
-                                     ? GT_COMPLEMENTBASE(charidx)
-                                     : charidx;
-        gt_bcktab_leftborder_assign(sfi->leftborder,(GtCodetype) updateindex,
-                                    gt_encseq_charcount(encseq,
-                                                        (GtUchar) charidx));
-      }
+      /* all non-special suffixes form the only bucket of the only part */
+      gt_bcktab_leftborder_assign(sfi->leftborder,0,
+                                  sfi->totallength - specialcharacters);
     } else
     {
-      if (gt_encseq_has_twobitencoding(encseq) &&
-          !sfi->sfxstrategy.kmerswithencseqreader)
+      if (prefixlength == 1U)
       {
-        if (sfi->sfxstrategy.spmopt_minlength == 0)
-        {
-          updateleftborder_getencseqkmers_twobitencoding(encseq,
-                                                         readmode,
-                                                         prefixlength,
-                                                         prefixlength,
-                                                         sfi,
-                                                         sfi);
-        } else
+        unsigned int charidx;
+
+        for (charidx=0; charidx<sfi->numofchars; charidx++)
         {
-          gt_assert(sfi->spmopt_kmerscansize > prefixlength);
-          spmopt_updateleftborder_getencseqkmers_twobitencoding(
-                                            encseq,
-                                            readmode,
-                                            sfi->spmopt_kmerscansize,
-                                            sfi->sfxstrategy.spmopt_minlength,
-                                            sfi,
-                                            NULL);
+          unsigned int updateindex = GT_ISDIRCOMPLEMENT(readmode)
+                                       ? GT_COMPLEMENTBASE(charidx)
+                                       : charidx;
+          gt_bcktab_leftborder_assign(sfi->leftborder,(GtCodetype) updateindex,
+                                      gt_encseq_charcount(encseq,
+                                                          (GtUchar) charidx));
         }
       } else
       {
-        if (sfi->sfxstrategy.iteratorbasedkmerscanning)
+        if (gt_encseq_has_twobitencoding(encseq) &&
+            !sfi->sfxstrategy.kmerswithencseqreader)
         {
-          getencseqkmersupdatekmercount(encseq, readmode, prefixlength, sfi);
+          if (sfi->sfxstrategy.spmopt_minlength == 0)
+          {
+            updateleftborder_getencseqkmers_twobitencoding(encseq,
+                                                           readmode,
+                                                           prefixlength,
+                                                           prefixlength,
+                                                           sfi,
+                                                           sfi);
+          } else
+          {
+            gt_assert(sfi->spmopt_kmerscansize > prefixlength);
+            spmopt_updateleftborder_getencseqkmers_twobitencoding(
+                                              encseq,
+                                              readmode,
+                                              sfi->spmopt_kmerscansize,
+                                              sfi->sfxstrategy.spmopt_minlength,
+                                              sfi,
+                                              NULL);
+          }
         } else
         {
-          getencseqkmers(encseq,readmode,prefixlength,updatekmercount,sfi);
+          if (sfi->sfxstrategy.iteratorbasedkmerscanning)
+          {
+            getencseqkmersupdatekmercount(encseq, readmode, prefixlength, sfi);
+          } else
+          {
+            getencseqkmers(encseq,readmode,prefixlength,updatekmercount,sfi);
+          }
         }
-      }
-      if (sfi->sfxstrategy.storespecialcodes &&
-          sfi->sfxstrategy.spmopt_minlength == 0)
-      {
-        size_t size_codeatposition = sizeof (*sfi->spaceCodeatposition) *
-                                     sfi->nextfreeCodeatposition;
-        gt_assert(realspecialranges+1 >= sfi->nextfreeCodeatposition);
-        gt_logger_log(sfi->logger, "size for Codeatposition: %.2f MB=%.2f "
-                                   "bytes/special suffix",
-                 GT_MEGABYTES(size_codeatposition),
-                 (double) size_codeatposition/specialcharacters);
-        gt_reversespecialcodes(sfi->spaceCodeatposition,
-                               sfi->nextfreeCodeatposition);
+        if (sfi->sfxstrategy.storespecialcodes &&
+            sfi->sfxstrategy.spmopt_minlength == 0)
+        {
+          size_t size_codeatposition = sizeof (*sfi->spaceCodeatposition) *
+                                       sfi->nextfreeCodeatposition;
+          gt_assert(realspecialranges+1 >= sfi->nextfreeCodeatposition);
+          gt_logger_log(sfi->logger, "size for Codeatposition: %.2f MB=%.2f "
+                                     "bytes/special suffix",
+                   GT_MEGABYTES(size_codeatposition),
+                   (double) size_codeatposition/specialcharacters);
+          gt_reversespecialcodes(sfi->spaceCodeatposition,
+                                 sfi->nextfreeCodeatposition);
 #ifdef SKDEBUG
-        verifycodelistcomputation(encseq,
-                                  readmode,
-                                  realspecialranges,
-                                  prefixlength,
-                                  sfi->numofchars,
-                                  sfi->nextfreeCodeatposition,
-                                  sfi->spaceCodeatposition);
+          verifycodelistcomputation(encseq,
+                                    readmode,
+                                    realspecialranges,
+                                    prefixlength,
+                                    sfi->numofchars,
+                                    sfi->nextfreeCodeatposition,
+                                    sfi->spaceCodeatposition);
 #endif
+        }
       }
     }
 #ifdef SKDEBUG
@@ -1944,6 +1986,54 @@ static void gt_suffixer_sort_with_dcov(void *voidsfi,
                                         sfi->dcov, blisbl, width,depth);
 }
 
+/* Overwrites the suffixes of the only part, which have been inserted into
+   their buckets, by the suffix array computed with SA-IS. If required, the
+   lcp table is derived from the suffix array by the Phi-algorithm. */
+static void gt_sfxiterator_sain_sortpart(Sfxiterator *sfi)
+{
+  GtUword idx;
+  GtUsainindextype *suftab;
+  GtSuffixsortspace_exportptr *exportptr;
+
+  gt_assert(gt_suftabparts_numofparts(sfi->suftabparts) == 1U);
+  suftab = gt_sain_encseq_sortsuffixes(sfi->encseq,
+                                       sfi->readmode,
+                                       false,
+                                       false,
+                                       sfi->logger,
+                                       NULL);
+  exportptr = gt_suffixsortspace_exportptr(sfi->suffixsortspace, 0);
+  for (idx = 0; idx < sfi->widthofpart; idx++)
+  {
+    GT_SUFFIXSORTSPACE_EXPORT_SET(sfi->suffixsortspace,exportptr,idx,
+                                  (GtUword) suftab[idx]);
+  }
+  gt_suffixsortspace_export_done(sfi->suffixsortspace);
+  if (sfi->outlcpinfo != NULL)
+  {
+    GtUword maxlcp;
+    unsigned int *plcptab;
+
+    if (sfi->sfxprogress != NULL)
+    {
+      gt_timer_show_progress(sfi->sfxprogress,
+                             "computing the lcp table", stdout);
+    }
+    plcptab = gt_encseq_plcp_phialgorithm(&maxlcp,
+                                          sfi->encseq,
+                                          sfi->readmode,
+                                          sfi->sfxstrategy.cmpcharbychar,
+                                          sfi->widthofpart,
+                                          sfi->totallength,
+                                          suftab);
+    gt_logger_log(sfi->logger,"maximum lcp value: "GT_WU"",maxlcp);
+    gt_Outlcpinfo_plcptab2file(sfi->outlcpinfo,suftab,plcptab,
+                               sfi->widthofpart);
+    gt_free(plcptab);
+  }
+  gt_free(suftab);
+}
+
 static void gt_sfxiterator_preparethispart(Sfxiterator *sfi)
 {
   GtUword sumofwidthforpart;
@@ -1959,7 +2049,7 @@ static void gt_sfxiterator_preparethispart(Sfxiterator *sfi)
   sfi->currentmincode = gt_suftabparts_minindex(sfi->part,sfi->suftabparts);
   sfi->currentmaxcode = gt_suftabparts_maxindex(sfi->part,sfi->suftabparts);
   sfi->widthofpart = gt_suftabparts_widthofpart(sfi->part,sfi->suftabparts);
-  if (sfi->sfxprogress != NULL)
+  if (sfi->sfxprogress != NULL && sfi->withbuckets)
   {
     gt_timer_show_progress(sfi->sfxprogress, "inserting suffixes into buckets",
                            stdout);
@@ -1990,55 +2080,63 @@ static void gt_sfxiterator_preparethispart(Sfxiterator *sfi)
   gt_suffixsortspace_partoffset_set(sfi->suffixsortspace,
                                     gt_suftabparts_offset(sfi->part,
                                                           sfi->suftabparts));
-  if (sfi->sfxstrategy.spmopt_minlength == 0)
+  /* SA-IS overwrites the inserted suffixes, so they are only inserted if the
+     bucket table is written */
+  if (sfi->withbuckets)
   {
-    if (sfi->sfxstrategy.storespecialcodes)
-    {
-      sfx_derivespecialcodesfromtable(sfi,
-                          gt_suftabparts_numofparts(sfi->suftabparts) == 1U
-                            ? true
-                            : false);
-    } else
+    if (sfi->sfxstrategy.spmopt_minlength == 0)
     {
-      sfx_derivespecialcodesonthefly(sfi);
+      if (sfi->sfxstrategy.storespecialcodes)
+      {
+        sfx_derivespecialcodesfromtable(sfi,
+                            gt_suftabparts_numofparts(sfi->suftabparts) == 1U
+                              ? true
+                              : false);
+      } else
+      {
+        sfx_derivespecialcodesonthefly(sfi);
+      }
     }
-  }
-  SHOWACTUALSPACE;
-  sfi->exportptr = gt_suffixsortspace_exportptr(sfi->suffixsortspace, 0);
-  if (sfi->prefixlength > 1U
-      && gt_encseq_has_twobitencoding(sfi->encseq)
-      && !sfi->sfxstrategy.kmerswithencseqreader)
-  {
-    insertsuffix_getencseqkmers_twobitencoding(
-                                     sfi->encseq,
-                                     sfi->readmode,
-                                     sfi->sfxstrategy.spmopt_minlength == 0
-                                       ? sfi->prefixlength
-                                       : sfi->spmopt_kmerscansize,
-                                     sfi->sfxstrategy.spmopt_minlength == 0
-                                       ? sfi->prefixlength
-                                       : sfi->sfxstrategy.spmopt_minlength,
-                                     sfi,
-                                     NULL);
-  } else
-  {
-    if (sfi->sfxstrategy.iteratorbasedkmerscanning)
+    SHOWACTUALSPACE;
+    sfi->exportptr = gt_suffixsortspace_exportptr(sfi->suffixsortspace, 0);
+    if (sfi->prefixlength > 1U
+        && gt_encseq_has_twobitencoding(sfi->encseq)
+        && !sfi->sfxstrategy.kmerswithencseqreader)
     {
-      getencseqkmersinsertkmerwithoutspecial(sfi->encseq,
-                                             sfi->readmode,
-                                             sfi->prefixlength,
-                                             sfi);
+      insertsuffix_getencseqkmers_twobitencoding(
+                                       sfi->encseq,
+                                       sfi->readmode,
+                                       sfi->sfxstrategy.spmopt_minlength == 0
+                                         ? sfi->prefixlength
+                                         : sfi->spmopt_kmerscansize,
+                                       sfi->sfxstrategy.spmopt_minlength == 0
+                                         ? sfi->prefixlength
+                                         : sfi->sfxstrategy.spmopt_minlength,
+                                       sfi,
+                                       NULL);
     } else
     {
-      getencseqkmers(sfi->encseq,sfi->readmode,sfi->prefixlength,
-                     gt_insertkmerwithoutspecial,sfi);
+      if (sfi->sfxstrategy.iteratorbasedkmerscanning)
+      {
+        getencseqkmersinsertkmerwithoutspecial(sfi->encseq,
+                                               sfi->readmode,
+                                               sfi->prefixlength,
+                                               sfi);
+      } else
+      {
+        getencseqkmers(sfi->encseq,sfi->readmode,sfi->prefixlength,
+                       gt_insertkmerwithoutspecial,sfi);
+      }
     }
+    SHOWACTUALSPACE;
+    gt_suffixsortspace_export_done(sfi->suffixsortspace);
   }
-  SHOWACTUALSPACE;
-  gt_suffixsortspace_export_done(sfi->suffixsortspace);
   if (sfi->sfxprogress != NULL)
   {
-    gt_timer_show_progress(sfi->sfxprogress, "sorting the buckets", stdout);
+    gt_timer_show_progress(sfi->sfxprogress,
+                           sfi->sfxstrategy.withsain
+                             ? "sorting the suffixes with SA-IS"
+                             : "sorting the buckets", stdout);
   }
   /* exit(0); just for testing */
   sumofwidthforpart = gt_suftabparts_sumofwidth(sfi->part,sfi->suftabparts);
@@ -2047,6 +2145,7 @@ static void gt_sfxiterator_preparethispart(Sfxiterator *sfi)
       sfi->outlcpinfo == NULL &&
       sfi->prefixlength >= 2U &&
       sfi->sfxstrategy.spmopt_minlength == 0 &&
+      !sfi->sfxstrategy.withsain &&
       GT_SFX_THREADS_JOBS == 1U)
   {
     bucketspec2 = gt_copysort_new(sfi->bcktab,sfi->encseq,sfi->readmode,
@@ -2058,7 +2157,11 @@ static void gt_sfxiterator_preparethispart(Sfxiterator *sfi)
     gt_logger_log(sfi->logger,"used workspace for sorting: %.2f MB",
                   GT_MEGABYTES(gt_size_of_sort_workspace (&sfi->sfxstrategy)));
   }
-  if (!sfi->sfxstrategy.onlybucketinsertion)
+  if (sfi->sfxstrategy.withsain)
+  {
+    gt_sfxiterator_sain_sortpart(sfi);
+  }
+  if (!sfi->sfxstrategy.onlybucketinsertion && !sfi->sfxstrategy.withsain)
   {
     unsigned int sortmaxdepth;
     GtProcessunsortedsuffixrange processunsortedsuffixrange;
@@ -535,9 +535,122 @@ static void searchoverstrands(const TageratorOptions *tageratoroptions,
   }
 }
 
+static void showtagheader(const TageratorOptions *tageratoroptions,
+                          const GtAlphabet *alpha,
+                          uint64_t tagnumber,
+                          const TgrTagwithlength *twl)
+{
+  bool firstitem = true;
+
+  printf("#");
+  if (tageratoroptions->outputmode & TAGOUT_TAGNUM)
+  {
+    printf("\t" Formatuint64_t,PRINTuint64_tcast(tagnumber));
+    firstitem = false;
+  }
+  if (tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
+  {
+    ADDTABULATOR;
+    printf(""GT_WU"",twl->taglen);
+  }
+  if (tageratoroptions->outputmode & TAGOUT_TAGSEQ)
+  {
+    ADDTABULATOR;
+    gt_alphabet_decode_seq_to_fp(alpha,stdout,twl->transformedtag,
+                                 twl->taglen);
+  }
+  printf("\n");
+}
+
+/* tags collected for a lock-step search of their exact matches */
+typedef struct
+{
+  TgrTagwithlength *tags;
+  uint64_t firsttagnumber;
+  GtUword numoftags,
+          *patternlengths;
+  const GtUchar **patterns;
+  Mbtab *bounds;
+} TgrTagbatch;
+
+static void tgr_tagbatch_init(TgrTagbatch *batch,GtUword batchsize)
+{
+  batch->tags = gt_malloc(sizeof (*batch->tags) * batchsize);
+  batch->patterns = gt_malloc(sizeof (*batch->patterns) * 2 * batchsize);
+  batch->patternlengths = gt_malloc(sizeof (*batch->patternlengths) * 2 *
+                                    batchsize);
+  batch->bounds = gt_malloc(sizeof (*batch->bounds) * 2 * batchsize);
+  batch->numoftags = 0;
+  batch->firsttagnumber = 0;
+}
+
+static void tgr_tagbatch_delete(TgrTagbatch *batch)
+{
+  gt_free(batch->tags);
+  gt_free(batch->patterns);
+  gt_free(batch->patternlengths);
+  gt_free(batch->bounds);
+}
+
+/* Computes the match intervals of all tags in <batch> on the strands to be
+   searched at once and then reports the tags and their matches in the same
+   order as searchoverstrands does for each single tag. */
+static void searchtagbatch(const TageratorOptions *tageratoroptions,
+                           TgrTagbatch *batch,
+                           TgrTagwithlength *twl,
+                           const GtAlphabet *alpha,
+                           Limdfsresources *limdfsresources,
+                           TgrShowmatchinfo *showmatchinfo)
+{
+  GtUword idx, numofpatterns = 0;
+  int try;
+
+  gt_assert(tageratoroptions->userdefinedmaxdistance == 0);
+  for (idx = 0; idx < batch->numoftags; idx++)
+  {
+    if (!tageratoroptions->nofwdmatch)
+    {
+      batch->patterns[numofpatterns] = batch->tags[idx].transformedtag;
+      batch->patternlengths[numofpatterns++] = batch->tags[idx].taglen;
+    }
+    if (!tageratoroptions->norcmatch)
+    {
+      batch->patterns[numofpatterns] = batch->tags[idx].rctransformedtag;
+      batch->patternlengths[numofpatterns++] = batch->tags[idx].taglen;
+    }
+  }
+  gt_indexbasedexactpatternmatching_bounds(limdfsresources,
+                                           batch->patterns,
+                                           batch->patternlengths,
+                                           numofpatterns,
+                                           batch->bounds);
+  numofpatterns = 0;
+  for (idx = 0; idx < batch->numoftags; idx++)
+  {
+    *twl = batch->tags[idx];
+    showtagheader(tageratoroptions,alpha,batch->firsttagnumber + idx,twl);
+    for (try=0 ; try < 2; try++)
+    {
+      if ((try == 0 && !tageratoroptions->nofwdmatch) ||
+          (try == 1 && !tageratoroptions->norcmatch))
+      {
+        showmatchinfo->tagptr = twl->tagptr
+                              = (try == 0) ? twl->transformedtag
+                                           : twl->rctransformedtag;
+        (void) gt_indexbasedexactpatternmatching_report(limdfsresources,
+                                                 batch->bounds + numofpatterns,
+                                                 twl->taglen);
+        numofpatterns++;
+      }
+    }
+  }
+  batch->firsttagnumber += batch->numoftags;
+  batch->numoftags = 0;
+}
+
 int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
 {
-  bool haserr = false, firstitem;
+  bool haserr = false;
   int retval;
   Myersonlineresources *mor = NULL;
   Genericindex *genericindex = NULL;
@@ -584,6 +697,7 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
   if (!haserr)
   {
     TgrTagwithlength twl;
+    TgrTagbatch batch;
     uint64_t tagnumber;
     unsigned int numofchars;
     const GtUchar *symbolmap, *currenttag;
@@ -675,7 +789,50 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
     {
       haserr = true;
     }
-    if (!haserr)
+    if (!haserr && tageratoroptions->batchsize > 0)
+    {
+      gt_assert(limdfsresources != NULL);
+      tgr_tagbatch_init(&batch,tageratoroptions->batchsize);
+      for (tagnumber = 0; /* Nothing */; tagnumber++)
+      {
+        TgrTagwithlength *nexttag = batch.tags + batch.numoftags;
+
+        retval = gt_seq_iterator_next(seqit, &currenttag, &nexttag->taglen,
+                                      &desc, err);
+        if (retval != 1)
+        {
+          if (retval < 0)
+          {
+            haserr = true;
+          }
+          break;
+        }
+        if (dotransformtag(nexttag->transformedtag,
+                           symbolmap,
+                           currenttag,
+                           nexttag->taglen,
+                           tagnumber,
+                           tageratoroptions->replacewildcard,
+                           err) != 0)
+        {
+          haserr = true;
+          break;
+        }
+        gt_copy_reverse_complement(nexttag->rctransformedtag,
+                                   nexttag->transformedtag,
+                                   nexttag->taglen);
+        if (++batch.numoftags == tageratoroptions->batchsize)
+        {
+          searchtagbatch(tageratoroptions,&batch,&twl,alpha,limdfsresources,
+                         &showmatchinfo);
+        }
+      }
+      /* the tags before an erroneous tag are reported as without batches */
+      searchtagbatch(tageratoroptions,&batch,&twl,alpha,limdfsresources,
+                     &showmatchinfo);
+      tgr_tagbatch_delete(&batch);
+      gt_seq_iterator_delete(seqit);
+    } else if (!haserr)
     {
       for (tagnumber = 0; !haserr; tagnumber++)
       {
@@ -699,25 +856,7 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
         gt_copy_reverse_complement(twl.rctransformedtag,twl.transformedtag,
                                    twl.taglen);
         twl.tagptr = twl.transformedtag;
-        firstitem = true;
-        printf("#");
-        if (tageratoroptions->outputmode & TAGOUT_TAGNUM)
-        {
-          printf("\t" Formatuint64_t,PRINTuint64_tcast(tagnumber));
-          firstitem = false;
-        }
-        if (tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
-        {
-          ADDTABULATOR;
-          printf(""GT_WU"",twl.taglen);
-        }
-        if (tageratoroptions->outputmode & TAGOUT_TAGSEQ)
-        {
-          ADDTABULATOR;
-          gt_alphabet_decode_seq_to_fp(alpha,stdout,twl.transformedtag,
-                                       twl.taglen);
-        }
-        printf("\n");
+        showtagheader(tageratoroptions,alpha,tagnumber,&twl);
         storeoffline.nextfreeTgrSimplematch = 0;
         storeonline.nextfreeTgrSimplematch = 0;
         if (tageratoroptions->userdefinedmaxdistance > 0 &&
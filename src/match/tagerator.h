@@ -57,6 +57,7 @@ typedef struct
   int userdefinedmaxdepth;   /* use pckbuckets only up to this depth */
   unsigned int outputmode;  /* mode of output of tag matches */
   GtUword maxintervalwidth; /* max width of interval */
+  GtUword batchsize; /* number of tags searched together, 0 for no batches */
   size_t numberofmodedescentries;
 } TageratorOptions;
 
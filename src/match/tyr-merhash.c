@@ -0,0 +1,331 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <inttypes.h>
+#include <string.h>
+#include "core/divmodmul.h"
+#include "core/fa.h"
+#include "core/ma_api.h"
+#include "core/minmax.h"
+#include "core/unused_api.h"
+#include "core/xansi_api.h"
+#include "tyr-map.h"
+#include "tyr-merhash.h"
+
+#define MERHASHSUFFIX              ".mhs"
+/* average number of mers per bucket */
+#define GT_TYR_MERHASH_BUCKETLOAD  4UL
+#define GT_TYR_MERHASH_HEADERSIZE  2UL
+#define GT_TYR_MERHASH_FPBITS      8
+#define GT_TYR_MERHASH_FPMASK      ((uint64_t) 0xFF)
+
+#ifdef __GNUC__
+#define GT_TYR_MERHASH_PREFETCH(ADDR) __builtin_prefetch(ADDR, 0, 1)
+#else
+#define GT_TYR_MERHASH_PREFETCH(ADDR) /* Nothing */
+#endif
+
+/* The .mhs file consists of 64 bit integers: the number of buckets
+   (a power of 2) and the number of mers, followed by the start of each
+   bucket in the entry table (plus its end) and the entry table. An entry
+   stores the number of a mer in the upper 56 bits and 8 further bits of
+   the hash value of the mer as a fingerprint in the lower 8 bits, so that
+   most mers in a bucket are skipped without accessing the mer table. */
+struct Tyrhashinfo
+{
+  void *mappedmhsfileptr;
+  uint64_t numofbuckets,
+           *bucketstart,
+           *entries;
+};
+
+static uint64_t gt_merhash_mix(uint64_t value)
+{
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+static uint64_t gt_merhash_code(const GtUchar *bytecode,GtUword merbytes)
+{
+  uint64_t value = 0, hashvalue = 0;
+  GtUword idx;
+
+  for (idx = 0; idx < merbytes; idx++)
+  {
+    value = (value << 8) | (uint64_t) bytecode[idx];
+    if (GT_MOD8(idx+1) == 0 || idx + 1 == merbytes)
+    {
+      hashvalue = gt_merhash_mix(hashvalue ^ value);
+      value = 0;
+    }
+  }
+  return hashvalue;
+}
+
+#define GT_TYR_MERHASH_BUCKET(INFO,HASHVALUE)\
+        ((HASHVALUE) & ((INFO)->numofbuckets - 1))
+
+#define GT_TYR_MERHASH_FINGERPRINT(HASHVALUE)\
+        ((HASHVALUE) >> (64 - GT_TYR_MERHASH_FPBITS))
+
+static GtUword gt_merhash_numofmers(const Tyrindex *tyrindex)
+{
+  if (gt_tyrindex_isempty(tyrindex))
+  {
+    return 0;
+  }
+  return gt_tyrindex_ptr2number(tyrindex,gt_tyrindex_lastmer(tyrindex)) + 1;
+}
+
+int gt_constructmerhash(const char *inputindex,GtError *err)
+{
+  Tyrindex *tyrindex;
+  FILE *hashfp = NULL;
+  uint64_t header[GT_TYR_MERHASH_HEADERSIZE], *bucketstart = NULL,
+           *entries = NULL, hashvalue, bucket;
+  const GtUchar *mertable = NULL;
+  GtUword numofmers = 0, mernumber, merbytes = 0;
+  bool haserr = false;
+
+  gt_error_check(err);
+  header[0] = 1ULL;
+  tyrindex = gt_tyrindex_new(inputindex,err);
+  if (tyrindex == NULL)
+  {
+    haserr = true;
+  } else
+  {
+    numofmers = gt_merhash_numofmers(tyrindex);
+    mertable = gt_tyrindex_mertable(tyrindex);
+    merbytes = gt_tyrindex_merbytes(tyrindex);
+    while (header[0] * GT_TYR_MERHASH_BUCKETLOAD < (uint64_t) numofmers)
+    {
+      header[0] <<= 1;
+    }
+    header[1] = (uint64_t) numofmers;
+    gt_assert((uint64_t) numofmers < (1ULL << (64 - GT_TYR_MERHASH_FPBITS)));
+    printf("# construct mer hash table with "GT_WU" buckets\n",
+           (GtUword) header[0]);
+    bucketstart = gt_calloc((size_t) (header[0] + 1),sizeof *bucketstart);
+    entries = gt_malloc(sizeof *entries * MAX(numofmers,1UL));
+    /* count the mers of each bucket, then accumulate the counts to the
+       end of each bucket and fill the buckets from their ends, so that
+       the mers of a bucket are ordered and the ends become the starts */
+    for (mernumber = 0; mernumber < numofmers; mernumber++)
+    {
+      hashvalue = gt_merhash_code(mertable + mernumber * merbytes,merbytes);
+      bucketstart[hashvalue & (header[0] - 1)]++;
+    }
+    for (bucket = 1ULL; bucket <= header[0]; bucket++)
+    {
+      bucketstart[bucket] += bucketstart[bucket-1];
+    }
+    for (mernumber = numofmers; mernumber > 0; mernumber--)
+    {
+      hashvalue = gt_merhash_code(mertable + (mernumber-1) * merbytes,
+                                  merbytes);
+      bucket = hashvalue & (header[0] - 1);
+      entries[--bucketstart[bucket]]
+        = ((uint64_t) (mernumber-1) << GT_TYR_MERHASH_FPBITS) |
+          GT_TYR_MERHASH_FINGERPRINT(hashvalue);
+    }
+    hashfp = gt_fa_fopen_with_suffix(inputindex,MERHASHSUFFIX,"wb",err);
+    if (hashfp == NULL)
+    {
+      haserr = true;
+    }
+  }
+  if (!haserr)
+  {
+    gt_xfwrite(header,sizeof *header,(size_t) GT_TYR_MERHASH_HEADERSIZE,
+               hashfp);
+    gt_xfwrite(bucketstart,sizeof *bucketstart,(size_t) (header[0]+1),
+               hashfp);
+    if (numofmers > 0)
+    {
+      gt_xfwrite(entries,sizeof *entries,(size_t) numofmers,hashfp);
+    }
+  }
+  gt_fa_xfclose(hashfp);
+  gt_free(bucketstart);
+  gt_free(entries);
+  if (tyrindex != NULL)
+  {
+    gt_tyrindex_delete(&tyrindex);
+  }
+  return haserr ? -1 : 0;
+}
+
+Tyrhashinfo *gt_tyrhashinfo_new(const Tyrindex *tyrindex,
+                                const char *tyrindexname,
+                                GtError *err)
+{
+  size_t numofbytes;
+  uint64_t *header;
+  Tyrhashinfo *tyrhashinfo;
+  bool haserr = false;
+
+  gt_error_check(err);
+  tyrhashinfo = gt_malloc(sizeof *tyrhashinfo);
+  tyrhashinfo->mappedmhsfileptr
+    = gt_fa_mmap_read_with_suffix(tyrindexname,MERHASHSUFFIX,&numofbytes,err);
+  if (tyrhashinfo->mappedmhsfileptr == NULL)
+  {
+    haserr = true;
+  }
+  if (!haserr && numofbytes < sizeof *header * GT_TYR_MERHASH_HEADERSIZE)
+  {
+    gt_error_set(err,"file \"%s%s\" is too small",tyrindexname,
+                 MERHASHSUFFIX);
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    header = (uint64_t *) tyrhashinfo->mappedmhsfileptr;
+    tyrhashinfo->numofbuckets = header[0];
+    if (header[1] != (uint64_t) gt_merhash_numofmers(tyrindex) ||
+        tyrhashinfo->numofbuckets == 0 ||
+        (tyrhashinfo->numofbuckets & (tyrhashinfo->numofbuckets - 1)) != 0 ||
+        numofbytes != sizeof *header * (GT_TYR_MERHASH_HEADERSIZE +
+                                        tyrhashinfo->numofbuckets + 1 +
+                                        header[1]))
+    {
+      gt_error_set(err,"file \"%s%s\" does not fit to the mer table",
+                   tyrindexname,MERHASHSUFFIX);
+      haserr = true;
+    } else
+    {
+      tyrhashinfo->bucketstart = header + GT_TYR_MERHASH_HEADERSIZE;
+      tyrhashinfo->entries
+        = tyrhashinfo->bucketstart + tyrhashinfo->numofbuckets + 1;
+    }
+  }
+  if (haserr)
+  {
+    if (tyrhashinfo->mappedmhsfileptr != NULL)
+    {
+      gt_fa_xmunmap(tyrhashinfo->mappedmhsfileptr);
+    }
+    gt_free(tyrhashinfo);
+    return NULL;
+  }
+  return tyrhashinfo;
+}
+
+void gt_tyrhashinfo_delete(Tyrhashinfo **tyrhashinfoptr)
+{
+  Tyrhashinfo *tyrhashinfo = *tyrhashinfoptr;
+
+  gt_fa_xmunmap(tyrhashinfo->mappedmhsfileptr);
+  tyrhashinfo->mappedmhsfileptr = NULL;
+  gt_free(tyrhashinfo);
+  *tyrhashinfoptr = NULL;
+}
+
+static const GtUchar *gt_merhash_findinbucket(const Tyrindex *tyrindex,
+                                              const Tyrhashinfo *tyrhashinfo,
+                                              const GtUchar *bytecode,
+                                              uint64_t hashvalue)
+{
+  const GtUchar *merptr, *mertable = gt_tyrindex_mertable(tyrindex);
+  GtUword merbytes = gt_tyrindex_merbytes(tyrindex);
+  uint64_t idx, bucket = GT_TYR_MERHASH_BUCKET(tyrhashinfo,hashvalue),
+           fingerprint = GT_TYR_MERHASH_FINGERPRINT(hashvalue);
+
+  for (idx = tyrhashinfo->bucketstart[bucket];
+       idx < tyrhashinfo->bucketstart[bucket+1]; idx++)
+  {
+    if ((tyrhashinfo->entries[idx] & GT_TYR_MERHASH_FPMASK) == fingerprint)
+    {
+      merptr = mertable + (GtUword) (tyrhashinfo->entries[idx] >>
+                                     GT_TYR_MERHASH_FPBITS) * merbytes;
+      if (memcmp(merptr,bytecode,(size_t) merbytes) == 0)
+      {
+        return merptr;
+      }
+    }
+  }
+  return NULL;
+}
+
+const GtUchar *gt_searchinmerhash(const Tyrindex *tyrindex,
+                                  const Tyrhashinfo *tyrhashinfo,
+                                  const GtUchar *bytecode)
+{
+  gt_assert(tyrhashinfo != NULL);
+  return gt_merhash_findinbucket(tyrindex,tyrhashinfo,bytecode,
+                                 gt_merhash_code(bytecode,
+                                           gt_tyrindex_merbytes(tyrindex)));
+}
+
+void gt_searchinmerhash_multi(const Tyrindex *tyrindex,
+                              const Tyrhashinfo *tyrhashinfo,
+                              const GtUchar *bytecodes,
+                              GtUword numofmers,
+                              const GtUchar **results)
+{
+  uint64_t hashvalues[GT_TYR_MERHASH_BATCHSIZE], bucket;
+  GtUword idx, merbytes = gt_tyrindex_merbytes(tyrindex);
+
+  gt_assert(tyrhashinfo != NULL && numofmers <= GT_TYR_MERHASH_BATCHSIZE);
+  /* each phase touches one level of the table for all mers, so that the
+     cache misses of different mers overlap */
+  for (idx = 0; idx < numofmers; idx++)
+  {
+    hashvalues[idx] = gt_merhash_code(bytecodes + idx * merbytes,merbytes);
+    bucket = GT_TYR_MERHASH_BUCKET(tyrhashinfo,hashvalues[idx]);
+    GT_TYR_MERHASH_PREFETCH(tyrhashinfo->bucketstart + bucket);
+  }
+  for (idx = 0; idx < numofmers; idx++)
+  {
+    bucket = GT_TYR_MERHASH_BUCKET(tyrhashinfo,hashvalues[idx]);
+    GT_TYR_MERHASH_PREFETCH(tyrhashinfo->entries +
+                            tyrhashinfo->bucketstart[bucket]);
+  }
+  for (idx = 0; idx < numofmers; idx++)
+  {
+    results[idx] = gt_merhash_findinbucket(tyrindex,tyrhashinfo,
+                                           bytecodes + idx * merbytes,
+                                           hashvalues[idx]);
+  }
+}
+
+void gt_tyrhashinfo_check(GT_UNUSED const Tyrindex *tyrindex,
+                          GT_UNUSED const Tyrhashinfo *tyrhashinfo)
+{
+#ifndef NDEBUG
+  const GtUchar *mercodeptr, *result;
+  GtUword merbytes = gt_tyrindex_merbytes(tyrindex);
+
+  for (mercodeptr = gt_tyrindex_mertable(tyrindex);
+       mercodeptr <= gt_tyrindex_lastmer(tyrindex);
+       mercodeptr += merbytes)
+  {
+    result = gt_searchinmerhash(tyrindex,tyrhashinfo,mercodeptr);
+    if (result != mercodeptr)
+    {
+      fprintf(stderr,"mer number "GT_WU" is not found in the hash table\n",
+              gt_tyrindex_ptr2number(tyrindex,mercodeptr));
+      exit(GT_EXIT_PROGRAMMING_ERROR);
+    }
+  }
+#endif
+}
@@ -0,0 +1,61 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef TYR_MERHASH_H
+#define TYR_MERHASH_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "tyr-map.h"
+
+/* maximal number of mers looked up by one call of
+   <gt_searchinmerhash_multi()> */
+#define GT_TYR_MERHASH_BATCHSIZE 64UL
+
+typedef struct Tyrhashinfo Tyrhashinfo;
+
+/* Construct a bucketed hash table over the mers of the index <inputindex>
+   and store it in the file with suffix .mhs. A mer is then found in
+   constant expected time instead of by binary search. */
+int gt_constructmerhash(const char *inputindex,GtError *err);
+
+Tyrhashinfo *gt_tyrhashinfo_new(const Tyrindex *tyrindex,
+                                const char *tyrindexname,
+                                GtError *err);
+
+void gt_tyrhashinfo_delete(Tyrhashinfo **tyrhashinfoptr);
+
+/* Return a pointer to the mer <bytecode> in the mer table of <tyrindex> or
+   NULL, if it does not occur. */
+/*@null@*/ const GtUchar *gt_searchinmerhash(const Tyrindex *tyrindex,
+                                             const Tyrhashinfo *tyrhashinfo,
+                                             const GtUchar *bytecode);
+
+/* Look up the <numofmers> mers stored one after the other in <bytecodes>
+   and store the result for the i-th mer in <results>[i]. The memory
+   accessed for later mers is prefetched while the earlier ones are
+   processed. <numofmers> must not exceed <GT_TYR_MERHASH_BATCHSIZE>. */
+void gt_searchinmerhash_multi(const Tyrindex *tyrindex,
+                              const Tyrhashinfo *tyrhashinfo,
+                              const GtUchar *bytecodes,
+                              GtUword numofmers,
+                              const GtUchar **results);
+
+void gt_tyrhashinfo_check(const Tyrindex *tyrindex,
+                          const Tyrhashinfo *tyrhashinfo);
+
+#endif
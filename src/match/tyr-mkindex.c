@@ -16,18 +16,29 @@
 */
 
 #include <errno.h>
+#include <string.h>
 #include "core/alphabet.h"
+#include "core/codetype.h"
 #include "core/divmodmul.h"
+#include "core/encseq.h"
 #include "core/fa.h"
 #include "core/format64.h"
 #include "core/logger.h"
+#include "core/minmax.h"
+#include "core/radix_sort.h"
 #include "core/spacecalc.h"
 #include "core/str.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "core/ma_api.h"
+#ifdef GT_THREADS_ENABLED
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#endif
 #include "esa-seqread.h"
 #include "esa-mmsearch.h"
+#include "initbasepower.h"
+#include "sfx-mappedstr.h"
 #include "tyr-basic.h"
 #include "tyr-mkindex.h"
 #include "echoseq.h"
@@ -78,6 +89,8 @@ typedef struct /* global information */
   GtUword sizeofbuffer;
   GtArrayLargecount largecounts;
   GtUword countoutputmers;
+  bool fromcodes; /* the mers are given by their integer codes instead of
+                     by a position in the sequence */
   const ESASuffixptr *suftab; /* only necessary for performtest */
   GtUchar *currentmer;    /* only necessary for performtest */
 } TyrDfsstate;
@@ -180,15 +193,39 @@ static void wrapListUlong(ListUlong *node)
   }
 }
 
+static void tyr_fprintfcode(FILE *fpout,
+                            const GtEncseq *encseq,
+                            GtCodetype code,
+                            GtUword mersize)
+{
+  GtUword idx;
+  const GtAlphabet *alpha = gt_encseq_alphabet(encseq);
+
+  for (idx = 0; idx < mersize; idx++)
+  {
+    gt_alphabet_echo_pretty_symbol(alpha,fpout,
+                                   (GtUchar) ((code >>
+                                               GT_MULT2(mersize - 1 - idx))
+                                              & 3));
+  }
+}
+
 static void showListUlong(const GtEncseq *encseq,
                           GtUword mersize,
+                          bool fromcodes,
                           const ListUlong *node)
 {
   const ListUlong *tmp;
 
   for (tmp = node; tmp != NULL; tmp = tmp->nextptr)
   {
-    gt_fprintfencseq(stdout,encseq,tmp->position,mersize);
+    if (fromcodes)
+    {
+      tyr_fprintfcode(stdout,encseq,(GtCodetype) tmp->position,mersize);
+    } else
+    {
+      gt_fprintfencseq(stdout,encseq,tmp->position,mersize);
+    }
     (void) putchar((int) '\n');
   }
 }
@@ -256,6 +293,7 @@ static void showmerdistribution(const TyrDfsstate *state)
       {
         showListUlong(state->encseq,
                       state->mersize,
+                      state->fromcodes,
                       state->occdistribution.spaceCountwithpositions[countocc].
                                              positionlist);
         wrapListUlong(state->occdistribution.spaceCountwithpositions[countocc].
@@ -335,7 +373,7 @@ static int adddistpos2distribution(GtUword countocc,
                                spaceCountwithpositions[countocc].positionlist,
                          position);
   }
-  if (state->performtest)
+  if (state->performtest && state->suftab != NULL)
   {
     checknumberofoccurrences(state,countocc,position);
   }
@@ -344,19 +382,30 @@ static int adddistpos2distribution(GtUword countocc,
 
 #define MAXSMALLMERCOUNT UCHAR_MAX
 
-static int outputsortedstring2indexviafileptr(const GtEncseq *encseq,
-                                              GtUword mersize,
-                                              GtUchar *bytebuffer,
+static void tyr_code2bytecode(GtUchar *bytecode,
+                              GtCodetype code,
+                              GtUword mersize)
+{
+  GtUword idx;
+
+  memset(bytecode,0,sizeof (*bytecode) * MERBYTES(mersize));
+  for (idx = 0; idx < mersize; idx++)
+  {
+    bytecode[GT_DIV4(idx)]
+      |= (GtUchar) (((code >> GT_MULT2(mersize - 1 - idx)) & 3)
+                    << (6 - GT_MULT2(GT_MOD4(idx))));
+  }
+}
+
+static int outputsortedstring2indexviafileptr(const GtUchar *bytebuffer,
                                               GtUword sizeofbuffer,
                                               FILE *merindexfpout,
                                               FILE *countsfilefpout,
-                                              GtUword position,
                                               GtUword countocc,
                                               GtArrayLargecount *largecounts,
                                               GtUword countoutputmers,
                                               GT_UNUSED GtError *err)
 {
-  gt_encseq_sequence2bytecode(bytebuffer,encseq,position,mersize);
   gt_xfwrite(bytebuffer, sizeof (*bytebuffer), (size_t) sizeofbuffer,
              merindexfpout);
   if (countsfilefpout != NULL)
@@ -389,13 +438,19 @@ static int outputsortedstring2index(GtUword countocc,
 
   if (decideifocc(state,countocc))
   {
-    if (outputsortedstring2indexviafileptr(state->encseq,
-                                           state->mersize,
-                                           state->bytebuffer,
+    if (state->fromcodes)
+    {
+      tyr_code2bytecode(state->bytebuffer,(GtCodetype) position,
+                        state->mersize);
+    } else
+    {
+      gt_encseq_sequence2bytecode(state->bytebuffer,state->encseq,position,
+                                  state->mersize);
+    }
+    if (outputsortedstring2indexviafileptr(state->bytebuffer,
                                            state->sizeofbuffer,
                                            state->merindexfpout,
                                            state->countsfilefpout,
-                                           position,
                                            countocc,
                                            &state->largecounts,
                                            state->countoutputmers,
@@ -511,8 +566,131 @@ static void outputbytewiseUlongvalue(FILE *fpout,GtUword value)
   }
 }
 
+/* The k-mers starting at the positions of the encoded sequence are collected
+   in chunks of this size. Each chunk is processed by one thread. */
+#define TYR_COUNTCHUNKSIZE (1UL << 16)
+
+typedef struct
+{
+  const GtEncseq *encseq;
+  unsigned int mersize;
+  GtUword numofstartpositions;
+  GtCodetype *codes;
+  GtUword *chunkcount;
+} TyrCountinfo;
+
+/* Store the codes of all mers not containing a special character which
+   start in the chunks <start> to <end> - 1 at the beginning of the
+   part of the code array belonging to the chunk and record their number. */
+static void tyr_collectcodes_range(GtUword start,GtUword end,
+                                   GT_UNUSED unsigned int workerid,
+                                   void *data)
+{
+  TyrCountinfo *info = (TyrCountinfo *) data;
+  GtUword chunk;
+
+  for (chunk = start; chunk < end; chunk++)
+  {
+    GtKmercodeiterator *kmercodeiterator;
+    const GtKmercode *kmercode;
+    GtUword pos, count = 0,
+            chunkstart = chunk * TYR_COUNTCHUNKSIZE,
+            chunkend = MIN(chunkstart + TYR_COUNTCHUNKSIZE,
+                           info->numofstartpositions);
+    GtCodetype *chunkcodes = info->codes + chunkstart;
+
+    kmercodeiterator = gt_kmercodeiterator_encseq_new(info->encseq,
+                                                      GT_READMODE_FORWARD,
+                                                      info->mersize,
+                                                      chunkstart);
+    for (pos = chunkstart; pos < chunkend; pos++)
+    {
+      kmercode = gt_kmercodeiterator_encseq_next(kmercodeiterator);
+      gt_assert(kmercode != NULL);
+      if (!kmercode->definedspecialposition)
+      {
+        chunkcodes[count++] = kmercode->code;
+      }
+    }
+    info->chunkcount[chunk] = count;
+    gt_kmercodeiterator_delete(kmercodeiterator);
+  }
+}
+
+/* Count the mers by sorting their integer codes. The codes are collected
+   in chunks of the sequence by <gt_jobs> threads and sorted by the
+   multithreaded most significant digit radixsort, which splits the codes
+   into buckets of equal prefixes. Runs of equal codes in the sorted array
+   then deliver the mers and their number of occurrences in the same
+   lexicographic order as the depth first traversal of the enhanced
+   suffix array. */
+static int tyr_enumeratecodes(TyrDfsstate *state,GtLogger *logger,
+                              GtError *err)
+{
+  TyrCountinfo info;
+  GtUword chunk, numofchunks, numofmers, idx, nextidx;
+  bool haserr = false;
+#ifdef GT_THREADS_ENABLED
+  GtThreadPool *pool = NULL;
+#endif
+
+  info.encseq = state->encseq;
+  info.mersize = (unsigned int) state->mersize;
+  info.numofstartpositions = state->totallength - state->mersize + 1;
+  numofchunks = (info.numofstartpositions + TYR_COUNTCHUNKSIZE - 1)/
+                TYR_COUNTCHUNKSIZE;
+  info.codes = gt_malloc(sizeof *info.codes * info.numofstartpositions);
+  info.chunkcount = gt_malloc(sizeof *info.chunkcount * numofchunks);
+  gt_logger_log(logger,"collect codes of "GT_WU"-mers in "GT_WU" chunks",
+                state->mersize,numofchunks);
+#ifdef GT_THREADS_ENABLED
+  if (gt_jobs > 1U && numofchunks > 1UL)
+  {
+    pool = gt_thread_pool_get(NULL);
+  }
+  if (pool != NULL)
+  {
+    gt_thread_pool_parallel_for(pool,0,numofchunks,1UL,
+                                tyr_collectcodes_range,&info);
+  } else
+#endif
+  {
+    tyr_collectcodes_range(0,numofchunks,0,&info);
+  }
+  numofmers = info.chunkcount[0];
+  for (chunk = 1UL; chunk < numofchunks; chunk++)
+  {
+    memmove(info.codes + numofmers,info.codes + chunk * TYR_COUNTCHUNKSIZE,
+            sizeof *info.codes * info.chunkcount[chunk]);
+    numofmers += info.chunkcount[chunk];
+  }
+  gt_free(info.chunkcount);
+  gt_logger_log(logger,"sort codes of "GT_WU" "GT_WU"-mers",
+                numofmers,state->mersize);
+  gt_radixsort_inplace_ulong(info.codes,numofmers);
+  for (idx = 0; !haserr && idx < numofmers; idx = nextidx)
+  {
+    for (nextidx = idx + 1;
+         nextidx < numofmers && info.codes[nextidx] == info.codes[idx];
+         nextidx++)
+      /* Nothing */ ;
+    if (state->processoccurrencecount(nextidx - idx,(GtUword) info.codes[idx],
+                                      state,err) != 0)
+    {
+      haserr = true;
+    }
+  }
+  gt_free(info.codes);
+  return haserr ? -1 : 0;
+}
+
+/* Enumerate the mers and their number of occurrences, either by a depth
+   first traversal of the enhanced suffix array <ssar> or, if <ssar> is
+   <NULL>, by counting the codes of the mers in <encseq>. */
 static int enumeratelcpintervals(const char *inputindex,
                                  Sequentialsuffixarrayreader *ssar,
+                                 const GtEncseq *encseq,
+                                 GtReadmode readmode,
                                  const char *storeindex,
                                  bool storecounts,
                                  GtUword mersize,
@@ -529,14 +707,12 @@ static int enumeratelcpintervals(const char *inputindex,
   gt_error_check(err);
   state = gt_malloc(sizeof (*state));
   GT_INITARRAY(&state->occdistribution,Countwithpositions);
-  state->esrspace = gt_encseq_create_reader_with_readmode(
-                                   gt_encseqSequentialsuffixarrayreader(ssar),
-                                   gt_readmodeSequentialsuffixarrayreader(ssar),
-                                   0);
+  state->esrspace = gt_encseq_create_reader_with_readmode(encseq,readmode,0);
   state->mersize = (GtUword) mersize;
-  state->encseq = gt_encseqSequentialsuffixarrayreader(ssar);
+  state->encseq = encseq;
   alphasize = gt_alphabet_num_of_chars(gt_encseq_alphabet(state->encseq));
-  state->readmode = gt_readmodeSequentialsuffixarrayreader(ssar);
+  state->readmode = readmode;
+  state->fromcodes = (ssar == NULL) ? true : false;
   state->storecounts = storecounts;
   state->minocc = minocc;
   state->maxocc = maxocc;
@@ -556,7 +732,7 @@ static int enumeratelcpintervals(const char *inputindex,
     state->bytebuffer = gt_malloc(sizeof *state->bytebuffer
                                   * state->sizeofbuffer);
   }
-  if (performtest)
+  if (performtest && ssar != NULL)
   {
     state->currentmer = gt_malloc(sizeof *state->currentmer
                                   * state->mersize);
@@ -573,6 +749,19 @@ static int enumeratelcpintervals(const char *inputindex,
                  state->totallength);
     haserr = true;
   } else
+  {
+    /* the integer codes of the mers must not overflow */
+    if (state->fromcodes &&
+        (alphasize != GT_DNAALPHASIZE ||
+         state->mersize >= (GtUword) gt_maxbasepower(alphasize)))
+    {
+      gt_error_set(err,"counting mers without enhanced suffix array requires "
+                       "DNA sequences and mersize <= %u",
+                   gt_maxbasepower(GT_DNAALPHASIZE) - 1);
+      haserr = true;
+    }
+  }
+  if (!haserr)
   {
     if (strlen(storeindex) == 0)
     {
@@ -600,19 +789,28 @@ static int enumeratelcpintervals(const char *inputindex,
     }
     if (!haserr)
     {
-      if (gt_depthfirstesa(ssar,
-                          tyr_allocateDfsinfo,
-                          tyr_freeDfsinfo,
-                          tyr_processleafedge,
-                          NULL,
-                          tyr_processcompletenode,
-                          tyr_assignleftmostleaf,
-                          tyr_assignrightmostleaf,
-                          (Dfsstate*) state,
-                          logger,
-                          err) != 0)
+      if (state->fromcodes)
       {
-        haserr = true;
+        if (tyr_enumeratecodes(state,logger,err) != 0)
+        {
+          haserr = true;
+        }
+      } else
+      {
+        if (gt_depthfirstesa(ssar,
+                             tyr_allocateDfsinfo,
+                             tyr_freeDfsinfo,
+                             tyr_processleafedge,
+                             NULL,
+                             tyr_processcompletenode,
+                             tyr_assignleftmostleaf,
+                             tyr_assignrightmostleaf,
+                             (Dfsstate*) state,
+                             logger,
+                             err) != 0)
+        {
+          haserr = true;
+        }
       }
       if (strlen(storeindex) == 0)
       {
@@ -693,6 +891,8 @@ int gt_merstatistics(const char *inputindex,
   {
     if (enumeratelcpintervals(inputindex,
                               ssar,
+                              gt_encseqSequentialsuffixarrayreader(ssar),
+                              gt_readmodeSequentialsuffixarrayreader(ssar),
                               storeindex,
                               storecounts,
                               mersize,
@@ -711,3 +911,49 @@ int gt_merstatistics(const char *inputindex,
   }
   return haserr ? -1 : 0;
 }
+
+int gt_merstatistics_encseq(const char *inputindex,
+                            GtUword mersize,
+                            GtUword minocc,
+                            GtUword maxocc,
+                            const char *storeindex,
+                            bool storecounts,
+                            bool performtest,
+                            GtLogger *logger,
+                            GtError *err)
+{
+  bool haserr = false;
+  GtEncseqLoader *el;
+  GtEncseq *encseq;
+
+  gt_error_check(err);
+  el = gt_encseq_loader_new();
+  gt_encseq_loader_drop_description_support(el);
+  gt_encseq_loader_set_logger(el,logger);
+  encseq = gt_encseq_loader_load(el,inputindex,err);
+  if (encseq == NULL)
+  {
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    if (enumeratelcpintervals(inputindex,
+                              NULL,
+                              encseq,
+                              GT_READMODE_FORWARD,
+                              storeindex,
+                              storecounts,
+                              mersize,
+                              minocc,
+                              maxocc,
+                              performtest,
+                              logger,
+                              err) != 0)
+    {
+      haserr = true;
+    }
+  }
+  gt_encseq_delete(encseq);
+  gt_encseq_loader_delete(el);
+  return haserr ? -1 : 0;
+}
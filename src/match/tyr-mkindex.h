@@ -34,4 +34,19 @@ int gt_merstatistics(const char *inputindex,
                      GtLogger *logger,
                      GtError *err);
 
+/* Like <gt_merstatistics>, but count the mers directly in the encoded
+   sequence <inputindex> by sorting their integer codes, so that no enhanced
+   suffix array is required. The codes are collected and sorted by
+   <gt_jobs> threads. This requires a DNA sequence and a <mersize> of at most
+   30 (14 on 32-bit platforms). */
+int gt_merstatistics_encseq(const char *inputindex,
+                            GtUword mersize,
+                            GtUword minocc,
+                            GtUword maxocc,
+                            const char *storeindex,
+                            bool storecounts,
+                            bool performtest,
+                            GtLogger *logger,
+                            GtError *err);
+
 #endif
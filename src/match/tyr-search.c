@@ -28,6 +28,7 @@
 #include "tyr-search.h"
 #include "tyr-show.h"
 #include "tyr-mersplit.h"
+#include "tyr-merhash.h"
 
 typedef struct
 {
@@ -40,6 +41,17 @@ typedef struct
   GtAlphabet *dnaalpha;
 } Tyrsearchinfo;
 
+/* mers of a query collected to be looked up together in the hash table */
+typedef struct
+{
+  const Tyrhashinfo *tyrhashinfo;
+  GtUchar *bytecodes;
+  const GtUchar **results;
+  GtUword *qpositions,
+          nextfree;
+  bool *forward;
+} Tyrsearchbatch;
+
 static void gt_tyrsearchinfo_init(Tyrsearchinfo *tyrsearchinfo,
                                const Tyrindex *tyrindex,
                                unsigned int showmode,
@@ -91,6 +103,31 @@ static void gt_tyrsearchinfo_delete(Tyrsearchinfo *tyrsearchinfo)
   return result;
 }
 
+static void gt_tyrsearchbatch_init(Tyrsearchbatch *tyrsearchbatch,
+                                   const Tyrindex *tyrindex,
+                                   const Tyrhashinfo *tyrhashinfo)
+{
+  tyrsearchbatch->tyrhashinfo = tyrhashinfo;
+  tyrsearchbatch->bytecodes
+    = gt_malloc(sizeof *tyrsearchbatch->bytecodes *
+                GT_TYR_MERHASH_BATCHSIZE * gt_tyrindex_merbytes(tyrindex));
+  tyrsearchbatch->results = gt_malloc(sizeof *tyrsearchbatch->results *
+                                      GT_TYR_MERHASH_BATCHSIZE);
+  tyrsearchbatch->qpositions = gt_malloc(sizeof *tyrsearchbatch->qpositions *
+                                         GT_TYR_MERHASH_BATCHSIZE);
+  tyrsearchbatch->forward = gt_malloc(sizeof *tyrsearchbatch->forward *
+                                      GT_TYR_MERHASH_BATCHSIZE);
+  tyrsearchbatch->nextfree = 0;
+}
+
+static void gt_tyrsearchbatch_delete(Tyrsearchbatch *tyrsearchbatch)
+{
+  gt_free(tyrsearchbatch->bytecodes);
+  gt_free(tyrsearchbatch->results);
+  gt_free(tyrsearchbatch->qpositions);
+  gt_free(tyrsearchbatch->forward);
+}
+
 #define ADDTABULATOR\
         if (firstitem)\
         {\
@@ -143,10 +180,67 @@ static void mermatchoutput(const Tyrindex *tyrindex,
   }
 }
 
+static void tyrsearchbatch_flush(const Tyrindex *tyrindex,
+                                 const Tyrcountinfo *tyrcountinfo,
+                                 const Tyrsearchinfo *tyrsearchinfo,
+                                 Tyrsearchbatch *tyrsearchbatch,
+                                 const GtUchar *query,
+                                 uint64_t unitnum)
+{
+  GtUword idx;
+
+  gt_searchinmerhash_multi(tyrindex,
+                           tyrsearchbatch->tyrhashinfo,
+                           tyrsearchbatch->bytecodes,
+                           tyrsearchbatch->nextfree,
+                           tyrsearchbatch->results);
+  for (idx = 0; idx < tyrsearchbatch->nextfree; idx++)
+  {
+    if (tyrsearchbatch->results[idx] != NULL)
+    {
+      mermatchoutput(tyrindex,
+                     tyrcountinfo,
+                     tyrsearchinfo,
+                     tyrsearchbatch->results[idx],
+                     query,
+                     query + tyrsearchbatch->qpositions[idx],
+                     unitnum,
+                     tyrsearchbatch->forward[idx]);
+    }
+  }
+  tyrsearchbatch->nextfree = 0;
+}
+
+static void tyrsearchbatch_add(const Tyrindex *tyrindex,
+                               const Tyrcountinfo *tyrcountinfo,
+                               const Tyrsearchinfo *tyrsearchinfo,
+                               Tyrsearchbatch *tyrsearchbatch,
+                               const GtUchar *mer,
+                               const GtUchar *query,
+                               const GtUchar *qptr,
+                               uint64_t unitnum,
+                               bool forward)
+{
+  gt_encseq_plainseq2bytecode(tyrsearchbatch->bytecodes +
+                              tyrsearchbatch->nextfree *
+                              gt_tyrindex_merbytes(tyrindex),
+                              mer,
+                              tyrsearchinfo->mersize);
+  tyrsearchbatch->qpositions[tyrsearchbatch->nextfree]
+    = (GtUword) (qptr - query);
+  tyrsearchbatch->forward[tyrsearchbatch->nextfree] = forward;
+  if (++tyrsearchbatch->nextfree == GT_TYR_MERHASH_BATCHSIZE)
+  {
+    tyrsearchbatch_flush(tyrindex,tyrcountinfo,tyrsearchinfo,tyrsearchbatch,
+                         query,unitnum);
+  }
+}
+
 static void singleseqtyrsearch(const Tyrindex *tyrindex,
                                const Tyrcountinfo *tyrcountinfo,
                                const Tyrsearchinfo *tyrsearchinfo,
                                const Tyrbckinfo *tyrbckinfo,
+                               Tyrsearchbatch *tyrsearchbatch,
                                uint64_t unitnum,
                                const GtUchar *query,
                                GtUword querylen,
@@ -169,17 +263,25 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
       offset = tyrsearchinfo->mersize-1;
       if (tyrsearchinfo->searchstrand & STRAND_FORWARD)
       {
-        result = gt_searchsinglemer(qptr,tyrindex,tyrsearchinfo,tyrbckinfo);
-        if (result != NULL)
+        if (tyrsearchbatch != NULL)
         {
-          mermatchoutput(tyrindex,
-                         tyrcountinfo,
-                         tyrsearchinfo,
-                         result,
-                         query,
-                         qptr,
-                         unitnum,
-                         true);
+          tyrsearchbatch_add(tyrindex,tyrcountinfo,tyrsearchinfo,
+                             tyrsearchbatch,qptr,query,qptr,unitnum,true);
+        } else
+        {
+          result = gt_searchsinglemer(qptr,tyrindex,tyrsearchinfo,
+                                      tyrbckinfo);
+          if (result != NULL)
+          {
+            mermatchoutput(tyrindex,
+                           tyrcountinfo,
+                           tyrsearchinfo,
+                           result,
+                           query,
+                           qptr,
+                           unitnum,
+                           true);
+          }
         }
       }
       if (tyrsearchinfo->searchstrand & STRAND_REVERSE)
@@ -187,18 +289,26 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
         gt_assert(tyrsearchinfo->rcbuf != NULL);
         gt_copy_reverse_complement(tyrsearchinfo->rcbuf,qptr,
                                    tyrsearchinfo->mersize);
-        result = gt_searchsinglemer(tyrsearchinfo->rcbuf,tyrindex,
-                                    tyrsearchinfo,tyrbckinfo);
-        if (result != NULL)
+        if (tyrsearchbatch != NULL)
         {
-          mermatchoutput(tyrindex,
-                         tyrcountinfo,
-                         tyrsearchinfo,
-                         result,
-                         query,
-                         qptr,
-                         unitnum,
-                         false);
+          tyrsearchbatch_add(tyrindex,tyrcountinfo,tyrsearchinfo,
+                             tyrsearchbatch,tyrsearchinfo->rcbuf,query,qptr,
+                             unitnum,false);
+        } else
+        {
+          result = gt_searchsinglemer(tyrsearchinfo->rcbuf,tyrindex,
+                                      tyrsearchinfo,tyrbckinfo);
+          if (result != NULL)
+          {
+            mermatchoutput(tyrindex,
+                           tyrcountinfo,
+                           tyrsearchinfo,
+                           result,
+                           query,
+                           qptr,
+                           unitnum,
+                           false);
+          }
         }
       }
       qptr++;
@@ -208,12 +318,18 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
       qptr += (skipvalue+1);
     }
   }
+  if (tyrsearchbatch != NULL && tyrsearchbatch->nextfree > 0)
+  {
+    tyrsearchbatch_flush(tyrindex,tyrcountinfo,tyrsearchinfo,tyrsearchbatch,
+                         query,unitnum);
+  }
 }
 
 int gt_tyrsearch(const char *tyrindexname,
                  const GtStrArray *queryfilenames,
                  unsigned int showmode,
                  unsigned int searchstrand,
+                 bool usehash,
                  bool verbose,
                  bool performtest,
                  GtError *err)
@@ -221,6 +337,7 @@ int gt_tyrsearch(const char *tyrindexname,
   Tyrindex *tyrindex;
   Tyrcountinfo *tyrcountinfo = NULL;
   Tyrbckinfo *tyrbckinfo = NULL;
+  Tyrhashinfo *tyrhashinfo = NULL;
   bool haserr = false;
 
   gt_error_check(err);
@@ -256,12 +373,28 @@ int gt_tyrsearch(const char *tyrindexname,
     gt_assert(tyrindex != NULL);
     if (!gt_tyrindex_isempty(tyrindex))
     {
-      tyrbckinfo = gt_tyrbckinfo_new(tyrindexname,
-                                     gt_tyrindex_alphasize(tyrindex),
-                                     err);
-      if (tyrbckinfo == NULL)
+      if (usehash)
       {
-        haserr = true;
+        tyrhashinfo = gt_tyrhashinfo_new(tyrindex,tyrindexname,err);
+        if (tyrhashinfo == NULL)
+        {
+          haserr = true;
+        } else
+        {
+          if (performtest)
+          {
+            gt_tyrhashinfo_check(tyrindex,tyrhashinfo);
+          }
+        }
+      } else
+      {
+        tyrbckinfo = gt_tyrbckinfo_new(tyrindexname,
+                                       gt_tyrindex_alphasize(tyrindex),
+                                       err);
+        if (tyrbckinfo == NULL)
+        {
+          haserr = true;
+        }
       }
     }
   }
@@ -273,10 +406,15 @@ int gt_tyrsearch(const char *tyrindexname,
     uint64_t unitnum;
     int retval;
     Tyrsearchinfo tyrsearchinfo;
+    Tyrsearchbatch tyrsearchbatch;
     GtSeqIterator *seqit;
 
     gt_assert(tyrindex != NULL);
     gt_tyrsearchinfo_init(&tyrsearchinfo,tyrindex,showmode,searchstrand);
+    if (tyrhashinfo != NULL)
+    {
+      gt_tyrsearchbatch_init(&tyrsearchbatch,tyrindex,tyrhashinfo);
+    }
     seqit = gt_seq_iterator_sequence_buffer_new(queryfilenames, err);
     if (!seqit)
       haserr = true;
@@ -304,6 +442,7 @@ int gt_tyrsearch(const char *tyrindexname,
                            tyrcountinfo,
                            &tyrsearchinfo,
                            tyrbckinfo,
+                           tyrhashinfo != NULL ? &tyrsearchbatch : NULL,
                            unitnum,
                            query,
                            querylen,
@@ -311,12 +450,20 @@ int gt_tyrsearch(const char *tyrindexname,
       }
       gt_seq_iterator_delete(seqit);
     }
+    if (tyrhashinfo != NULL)
+    {
+      gt_tyrsearchbatch_delete(&tyrsearchbatch);
+    }
     gt_tyrsearchinfo_delete(&tyrsearchinfo);
   }
   if (tyrbckinfo != NULL)
   {
     gt_tyrbckinfo_delete(&tyrbckinfo);
   }
+  if (tyrhashinfo != NULL)
+  {
+    gt_tyrhashinfo_delete(&tyrhashinfo);
+  }
   if (tyrcountinfo != NULL)
   {
     gt_tyrcountinfo_delete(&tyrcountinfo);
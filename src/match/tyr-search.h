@@ -27,6 +27,7 @@ int gt_tyrsearch(const char *tyrindexname,
                  const GtStrArray *queryfilenames,
                  unsigned int showmode,
                  unsigned int searchstrand,
+                 bool usehash,
                  bool verbose,
                  bool performtest,
                  GtError *err);
@@ -0,0 +1,402 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/chardef.h"
+#include "core/divmodmul.h"
+#include "core/ensure.h"
+#include "core/ma_api.h"
+#include "core/minmax.h"
+#include "match/wordwise-lcp.h"
+
+#if defined (_LP64) || defined (_WIN64)
+#define GT_TWOBIT_LCP_PAIRMASK   ((GtTwobitencoding) 0x3333333333333333ULL)
+#define GT_TWOBIT_LCP_NIBBLEMASK ((GtTwobitencoding) 0x0F0F0F0F0F0F0F0FULL)
+#else
+#define GT_TWOBIT_LCP_PAIRMASK   ((GtTwobitencoding) 0x33333333UL)
+#define GT_TWOBIT_LCP_NIBBLEMASK ((GtTwobitencoding) 0x0F0F0F0FUL)
+#endif
+
+/* Returns the <numofunits> characters beginning at position <pos> in the
+   leftmost bits of the result. The remaining bits are undefined. */
+static inline GtTwobitencoding gt_twobit_lcp_fwd_word(
+                                                  const GtTwobitencoding *tbe,
+                                                  GtUword pos,
+                                                  unsigned int numofunits)
+{
+  const GtUword unit = GT_DIVBYUNITSIN2BITENC(pos),
+                unitoffset = GT_MODBYUNITSIN2BITENC(pos);
+  GtTwobitencoding word = tbe[unit] << GT_MULT2(unitoffset);
+
+  if (unitoffset > 0 && unitoffset + numofunits > GT_UNITSIN2BITENC)
+  {
+    word |= tbe[unit + 1] >> (GT_INTWORDSIZE - GT_MULT2(unitoffset));
+  }
+  return word;
+}
+
+/* Reverses the order of the <GT_UNITSIN2BITENC> characters in <word>. */
+static inline GtTwobitencoding gt_twobit_lcp_reverse_units(
+                                                        GtTwobitencoding word)
+{
+  word = ((word >> 2) & GT_TWOBIT_LCP_PAIRMASK) |
+         ((word & GT_TWOBIT_LCP_PAIRMASK) << 2);
+  word = ((word >> 4) & GT_TWOBIT_LCP_NIBBLEMASK) |
+         ((word & GT_TWOBIT_LCP_NIBBLEMASK) << 4);
+#if defined (__GNUC__) && (defined (_LP64) || defined (_WIN64))
+  return (GtTwobitencoding) __builtin_bswap64((uint64_t) word);
+#elif defined (__GNUC__)
+  return (GtTwobitencoding) __builtin_bswap32((uint32_t) word);
+#else
+  {
+    GtTwobitencoding reversed = 0;
+    size_t idx;
+
+    for (idx = 0; idx < sizeof (GtTwobitencoding); idx++)
+    {
+      reversed = (reversed << 8) | (word & 0xFF);
+      word >>= 8;
+    }
+    return reversed;
+  }
+#endif
+}
+
+/* Returns the <numofunits> characters beginning at position <pos> and read
+   from right to left in the leftmost bits of the result. */
+static inline GtTwobitencoding gt_twobit_lcp_rev_word(
+                                                  const GtTwobitencoding *tbe,
+                                                  GtUword pos,
+                                                  unsigned int numofunits)
+{
+  GtTwobitencoding word;
+
+  gt_assert(pos + 1 >= (GtUword) numofunits);
+  word = gt_twobit_lcp_fwd_word(tbe, pos + 1 - numofunits, numofunits);
+  return gt_twobit_lcp_reverse_units(word)
+           << GT_MULT2(GT_UNITSIN2BITENC - numofunits);
+}
+
+static inline unsigned int gt_twobit_lcp_leading_zeros(GtTwobitencoding word)
+{
+  gt_assert(word != 0);
+#if defined (__GNUC__) && (defined (_LP64) || defined (_WIN64))
+  return (unsigned int) __builtin_clzll((unsigned long long) word);
+#elif defined (__GNUC__)
+  return (unsigned int) __builtin_clz((unsigned int) word);
+#else
+  {
+    unsigned int zeros = 0;
+
+    while ((word & GT_FIRSTBIT) == 0)
+    {
+      word <<= 1;
+      zeros++;
+    }
+    return zeros;
+  }
+#endif
+}
+
+GtUword gt_twobitencoding_lcp(const GtTwobitencoding *utbe,
+                              GtUword upos,
+                              bool u_left2right,
+                              const GtTwobitencoding *vtbe,
+                              GtUword vpos,
+                              bool v_left2right,
+                              bool complement,
+                              GtUword maxlen)
+{
+  /* the complement of a character <c> is <c> ^ 3 */
+  const GtTwobitencoding flip = complement ? ~((GtTwobitencoding) 0) : 0;
+  GtUword lcp = 0;
+
+  gt_assert(utbe != NULL && vtbe != NULL);
+  while (lcp < maxlen)
+  {
+    const unsigned int numofunits
+      = (unsigned int) MIN(maxlen - lcp, (GtUword) GT_UNITSIN2BITENC);
+    GtTwobitencoding uword, vword, diff;
+
+    uword = u_left2right
+              ? gt_twobit_lcp_fwd_word(utbe, upos + lcp, numofunits)
+              : gt_twobit_lcp_rev_word(utbe, upos - lcp, numofunits);
+    vword = v_left2right
+              ? gt_twobit_lcp_fwd_word(vtbe, vpos + lcp, numofunits)
+              : gt_twobit_lcp_rev_word(vtbe, vpos - lcp, numofunits);
+    diff = uword ^ vword ^ flip;
+    if (numofunits < (unsigned int) GT_UNITSIN2BITENC)
+    {
+      diff &= ~(~((GtTwobitencoding) 0) >> GT_MULT2(numofunits));
+    }
+    if (diff != 0)
+    {
+      return lcp + GT_DIV2(gt_twobit_lcp_leading_zeros(diff));
+    }
+    lcp += numofunits;
+  }
+  return lcp;
+}
+
+#if defined (__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define GT_BYTES_LCP_WORDWISE
+#define GT_BYTES_LCP_LOW7BITS  ((uint64_t) 0x7F7F7F7F7F7F7F7FULL)
+#define GT_BYTES_LCP_HIGHBITS  ((uint64_t) 0x8080808080808080ULL)
+#define GT_BYTES_LCP_NOLOWBIT  ((uint64_t) 0xFEFEFEFEFEFEFEFEULL)
+
+/* Sets the highest bit of each byte of <word> which is not zero and clears
+   all other bits. */
+static inline uint64_t gt_bytes_lcp_nonzero_bytes(uint64_t word)
+{
+  return (((word & GT_BYTES_LCP_LOW7BITS) + GT_BYTES_LCP_LOW7BITS) | word)
+         & GT_BYTES_LCP_HIGHBITS;
+}
+
+/* Sets the highest bit of each byte of <word> which is a special character,
+   i.e. <WILDCARD> or <SEPARATOR>, and clears all other bits. */
+static inline uint64_t gt_bytes_lcp_special_bytes(uint64_t word)
+{
+  return ~gt_bytes_lcp_nonzero_bytes(~word & GT_BYTES_LCP_NOLOWBIT)
+         & GT_BYTES_LCP_HIGHBITS;
+}
+#endif
+
+GtUword gt_bytes_lcp(const GtUchar *useq,
+                     const GtUchar *vseq,
+                     bool left2right,
+                     bool stop_at_special,
+                     GtUword maxlen)
+{
+  GtUword lcp = 0;
+
+  gt_assert(useq != NULL && vseq != NULL);
+#ifdef GT_BYTES_LCP_WORDWISE
+  /* on little endian machines, the character at the lowest address is the
+     least significant byte of a word */
+  while (lcp + sizeof (uint64_t) <= maxlen)
+  {
+    uint64_t uword, vword, stop;
+
+    if (left2right)
+    {
+      memcpy(&uword, useq + lcp, sizeof uword);
+      memcpy(&vword, vseq + lcp, sizeof vword);
+    } else
+    {
+      memcpy(&uword, useq - lcp - (sizeof uword - 1), sizeof uword);
+      memcpy(&vword, vseq - lcp - (sizeof vword - 1), sizeof vword);
+    }
+    stop = gt_bytes_lcp_nonzero_bytes(uword ^ vword);
+    if (stop_at_special)
+    {
+      stop |= gt_bytes_lcp_special_bytes(uword);
+    }
+    if (stop != 0)
+    {
+      return lcp + (left2right ? (GtUword) __builtin_ctzll(stop)
+                               : (GtUword) __builtin_clzll(stop)) / CHAR_BIT;
+    }
+    lcp += sizeof (uint64_t);
+  }
+#endif
+  if (left2right)
+  {
+    for (/* Nothing */; lcp < maxlen; lcp++)
+    {
+      if (useq[lcp] != vseq[lcp] || (stop_at_special && ISSPECIAL(useq[lcp])))
+      {
+        break;
+      }
+    }
+  } else
+  {
+    for (/* Nothing */; lcp < maxlen; lcp++)
+    {
+      if (*(useq - lcp) != *(vseq - lcp) ||
+          (stop_at_special && ISSPECIAL(*(useq - lcp))))
+      {
+        break;
+      }
+    }
+  }
+  return lcp;
+}
+
+#define GT_TWOBIT_LCP_TEST_UNITS    16
+#define GT_TWOBIT_LCP_TEST_QUERIES  10000
+
+static unsigned int gt_twobit_lcp_test_char(const GtTwobitencoding *tbe,
+                                            GtUword pos)
+{
+  return (unsigned int) (tbe[GT_DIVBYUNITSIN2BITENC(pos)] >>
+                         GT_MULT2(GT_UNITSIN2BITENC - 1 -
+                                  GT_MODBYUNITSIN2BITENC(pos))) & 3;
+}
+
+static GtUword gt_twobit_lcp_test_charwise(const GtTwobitencoding *utbe,
+                                           GtUword upos,
+                                           bool u_left2right,
+                                           const GtTwobitencoding *vtbe,
+                                           GtUword vpos,
+                                           bool v_left2right,
+                                           bool complement,
+                                           GtUword maxlen)
+{
+  GtUword lcp;
+
+  for (lcp = 0; lcp < maxlen; lcp++)
+  {
+    unsigned int cu, cv;
+
+    cu = gt_twobit_lcp_test_char(utbe, u_left2right ? upos + lcp
+                                                    : upos - lcp);
+    cv = gt_twobit_lcp_test_char(vtbe, v_left2right ? vpos + lcp
+                                                    : vpos - lcp);
+    if (cu != (complement ? cv ^ 3 : cv))
+    {
+      break;
+    }
+  }
+  return lcp;
+}
+
+static GtUword gt_bytes_lcp_test_charwise(const GtUchar *useq,
+                                          const GtUchar *vseq,
+                                          bool left2right,
+                                          bool stop_at_special,
+                                          GtUword maxlen)
+{
+  GtUword lcp;
+
+  for (lcp = 0; lcp < maxlen; lcp++)
+  {
+    const GtUchar cu = left2right ? useq[lcp] : *(useq - lcp),
+                  cv = left2right ? vseq[lcp] : *(vseq - lcp);
+
+    if ((stop_at_special && ISSPECIAL(cu)) || cu != cv)
+    {
+      break;
+    }
+  }
+  return lcp;
+}
+
+#define GT_BYTES_LCP_TEST_LENGTH  256
+
+static int gt_bytes_lcp_unit_test(GtError *err)
+{
+  int had_err = 0;
+  GtUchar useq[GT_BYTES_LCP_TEST_LENGTH], vseq[GT_BYTES_LCP_TEST_LENGTH];
+  GtUword idx, query;
+  gt_error_check(err);
+
+  for (idx = 0; idx < (GtUword) GT_BYTES_LCP_TEST_LENGTH; idx++)
+  {
+    useq[idx] = vseq[idx] = (GtUchar) (random() % 4);
+  }
+  /* few mismatches and special characters */
+  for (idx = 0; idx < (GtUword) GT_BYTES_LCP_TEST_LENGTH/32; idx++)
+  {
+    vseq[random() % GT_BYTES_LCP_TEST_LENGTH] = (GtUchar) (random() % 4);
+    useq[random() % GT_BYTES_LCP_TEST_LENGTH] = (random() % 2) ? WILDCARD
+                                                               : SEPARATOR;
+  }
+  for (query = 0; !had_err && query < GT_TWOBIT_LCP_TEST_QUERIES; query++)
+  {
+    const bool left2right = (random() % 2) ? true : false,
+               stop_at_special = (random() % 2) ? true : false;
+    const GtUchar *vptr = (random() % 2) ? vseq : useq;
+    const GtUword upos = random() % GT_BYTES_LCP_TEST_LENGTH,
+                  vpos = (random() % 2) ? upos
+                                        : random() % GT_BYTES_LCP_TEST_LENGTH,
+                  ulen = left2right ? GT_BYTES_LCP_TEST_LENGTH - upos
+                                    : upos + 1,
+                  vlen = left2right ? GT_BYTES_LCP_TEST_LENGTH - vpos
+                                    : vpos + 1,
+                  maxlen = random() % (MIN(ulen, vlen) + 1);
+
+    gt_ensure(gt_bytes_lcp(useq + upos, vptr + vpos, left2right,
+                           stop_at_special, maxlen) ==
+              gt_bytes_lcp_test_charwise(useq + upos, vptr + vpos, left2right,
+                                         stop_at_special, maxlen));
+  }
+  return had_err;
+}
+
+static int gt_twobitencoding_lcp_unit_test(GtError *err)
+{
+  int had_err = 0;
+  GtTwobitencoding utbe[GT_TWOBIT_LCP_TEST_UNITS],
+                   vtbe[GT_TWOBIT_LCP_TEST_UNITS];
+  const GtUword totallength
+    = (GtUword) GT_TWOBIT_LCP_TEST_UNITS * GT_UNITSIN2BITENC;
+  GtUword idx, query;
+  gt_error_check(err);
+
+  /* <vtbe> is a copy of <utbe> with few mutations, so that long common
+     prefixes occur */
+  for (idx = 0; idx < (GtUword) GT_TWOBIT_LCP_TEST_UNITS; idx++)
+  {
+    utbe[idx] = (GtTwobitencoding) random();
+    utbe[idx] = (utbe[idx] << 31) ^ (GtTwobitencoding) random();
+    vtbe[idx] = utbe[idx];
+  }
+  for (idx = 0; idx < (GtUword) GT_TWOBIT_LCP_TEST_UNITS; idx++)
+  {
+    GtUword pos = random() % totallength;
+
+    vtbe[GT_DIVBYUNITSIN2BITENC(pos)]
+      ^= ((GtTwobitencoding) 1) << GT_MULT2(GT_MODBYUNITSIN2BITENC(pos));
+  }
+  for (query = 0; !had_err && query < GT_TWOBIT_LCP_TEST_QUERIES; query++)
+  {
+    const bool u_left2right = (random() % 2) ? true : false,
+               v_left2right = (random() % 2) ? true : false,
+               complement = (random() % 4) == 0 ? true : false,
+               sameseq = (random() % 2) ? true : false;
+    const GtTwobitencoding *vseq = (random() % 2) ? vtbe : utbe;
+    GtUword upos = random() % totallength, vpos, maxlen, ulen, vlen;
+
+    /* often start at the same position, as the seeds do */
+    vpos = sameseq ? upos : random() % totallength;
+    ulen = u_left2right ? totallength - upos : upos + 1;
+    vlen = v_left2right ? totallength - vpos : vpos + 1;
+    maxlen = random() % (MIN(ulen, vlen) + 1);
+    gt_ensure(gt_twobitencoding_lcp(utbe, upos, u_left2right, vseq, vpos,
+                                    v_left2right, complement, maxlen) ==
+              gt_twobit_lcp_test_charwise(utbe, upos, u_left2right, vseq,
+                                          vpos, v_left2right, complement,
+                                          maxlen));
+  }
+  return had_err;
+}
+
+int gt_wordwise_lcp_unit_test(GtError *err)
+{
+  int had_err;
+  gt_error_check(err);
+
+  had_err = gt_twobitencoding_lcp_unit_test(err);
+  if (!had_err)
+  {
+    had_err = gt_bytes_lcp_unit_test(err);
+  }
+  return had_err;
+}
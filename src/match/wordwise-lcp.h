@@ -0,0 +1,62 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef WORDWISE_LCP_H
+#define WORDWISE_LCP_H
+
+#include <stdbool.h>
+#include "core/error_api.h"
+#include "core/intbits.h"
+#include "core/types_api.h"
+
+/* Longest common prefix computations which compare a machine word of
+   characters at a time instead of single characters. They are used by the
+   X-drop and the greedy extension. */
+
+/* Returns the length of the longest common prefix of the two strings read
+   from the two bit encodings <utbe> and <vtbe>, starting at positions <upos>
+   and <vpos>, respectively. Each string is read from left to right if
+   <u_left2right> resp. <v_left2right> is true and from right to left
+   otherwise. If <complement> is true, each character of the first string is
+   compared with the complement of the character in the second string.
+   At most <maxlen> characters are compared; all of them must be valid
+   positions of the encodings. The comparison proceeds by
+   <GT_UNITSIN2BITENC> characters at a time. */
+GtUword gt_twobitencoding_lcp(const GtTwobitencoding *utbe,
+                              GtUword upos,
+                              bool u_left2right,
+                              const GtTwobitencoding *vtbe,
+                              GtUword vpos,
+                              bool v_left2right,
+                              bool complement,
+                              GtUword maxlen);
+
+/* Returns the length of the longest common prefix of the encoded byte strings
+   beginning at <useq> and <vseq>. Both strings are read from left to right
+   if <left2right> is true and from right to left otherwise, i.e. the
+   characters compared in the second step are at <useq>[-1] and <vseq>[-1].
+   If <stop_at_special> is true, the comparison also stops at the first
+   special character in <useq>. At most <maxlen> characters are compared. */
+GtUword gt_bytes_lcp(const GtUchar *useq,
+                     const GtUchar *vseq,
+                     bool left2right,
+                     bool stop_at_special,
+                     GtUword maxlen);
+
+int     gt_wordwise_lcp_unit_test(GtError *err);
+
+#endif
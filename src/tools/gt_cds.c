@@ -18,12 +18,16 @@
 #include "core/ma.h"
 #include "core/option_api.h"
 #include "core/output_file_api.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "extended/cds_stream_api.h"
+#include "extended/cds_visitor.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_in_stream.h"
 #include "extended/gff3_out_stream_api.h"
 #include "extended/gtdatahelp.h"
+#include "extended/parallel_visitor_stream.h"
+#include "extended/region_mapping.h"
 #include "extended/seqid2file.h"
 #include "tools/gt_cds.h"
 
@@ -110,6 +114,32 @@ static GtOptionParser* gt_cds_option_parser_new(void *tool_arguments)
   return op;
 }
 
+/* every worker thread needs its own region mapping, as the sequence
+   collections fill caches on access. The factory is called on the calling
+   thread, which loads the sequences here, so only the first call creates
+   missing index files and the workers never write any. */
+static GtNodeVisitor* gt_cds_visitor_factory(void *data, GtError *err)
+{
+  CDSArguments *arguments = data;
+  GtRegionMapping *region_mapping;
+  GtNodeVisitor *nv;
+  GtStr *source_str;
+  gt_error_check(err);
+  region_mapping = gt_seqid2file_region_mapping_new(arguments->s2fi, err);
+  if (!region_mapping)
+    return NULL;
+  if (gt_region_mapping_load_sequences(region_mapping, err)) {
+    gt_region_mapping_delete(region_mapping);
+    return NULL;
+  }
+  source_str = gt_str_new_cstr(GT_CDS_SOURCE_TAG);
+  nv = gt_cds_visitor_new(region_mapping, arguments->minorflen, source_str,
+                          arguments->start_codon, arguments->final_stop_codon,
+                          arguments->generic_start_codons);
+  gt_str_delete(source_str);
+  return nv;
+}
+
 static int gt_cds_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
                          void *tool_arguments, GtError *err)
 {
@@ -126,19 +156,30 @@ static int gt_cds_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
   if (arguments->verbose && arguments->outfp)
     gt_gff3_in_stream_show_progress_bar((GtGFF3InStream*) gff3_in_stream);
 
-  /* create region mapping */
-  region_mapping = gt_seqid2file_region_mapping_new(arguments->s2fi, err);
-  if (!region_mapping)
-    had_err = -1;
+  if (gt_jobs > 1U && !gt_seqid2file_mapping_used(arguments->s2fi)) {
+    /* the genes are independent, add their CDS features in parallel (not
+       with a mapping file, which loads the sequence files on access) */
+    cds_stream = gt_parallel_visitor_stream_new(gff3_in_stream,
+                                                gt_cds_visitor_factory,
+                                                arguments);
+  }
+  else {
+    /* create region mapping */
+    region_mapping = gt_seqid2file_region_mapping_new(arguments->s2fi, err);
+    if (!region_mapping)
+      had_err = -1;
+
+    if (!had_err) {
+      /* create CDS stream */
+      cds_stream = gt_cds_stream_new(gff3_in_stream, region_mapping,
+                                     arguments->minorflen, GT_CDS_SOURCE_TAG,
+                                     arguments->start_codon,
+                                     arguments->final_stop_codon,
+                                     arguments->generic_start_codons);
+    }
+  }
 
   if (!had_err) {
-    /* create CDS stream */
-    cds_stream = gt_cds_stream_new(gff3_in_stream, region_mapping,
-                                   arguments->minorflen, GT_CDS_SOURCE_TAG,
-                                   arguments->start_codon,
-                                   arguments->final_stop_codon,
-                                   arguments->generic_start_codons);
-
     /* create gff3 output stream */
     gff3_out_stream = gt_gff3_out_stream_new(cds_stream, arguments->outfp);
 
@@ -33,6 +33,8 @@
 typedef struct {
   bool sort,
        verbose;
+  GtStr *memlimitarg;
+  GtUword memlimit;
   GtOutputFileInfo *ofi;
   GtFile *outfp;
 } ChseqidsArguments;
@@ -40,6 +42,7 @@ typedef struct {
 static void* gt_chseqids_arguments_new(void)
 {
   ChseqidsArguments *arguments = gt_calloc(1, sizeof *arguments);
+  arguments->memlimitarg = gt_str_new();
   arguments->ofi = gt_output_file_info_new();
   return arguments;
 }
@@ -49,6 +52,7 @@ static void gt_chseqids_arguments_delete(void *tool_arguments)
   ChseqidsArguments *arguments = tool_arguments;
   if (!arguments) return;
   gt_file_delete(arguments->outfp);
+  gt_str_delete(arguments->memlimitarg);
   gt_output_file_info_delete(arguments->ofi);
   gt_free(arguments);
 }
@@ -57,7 +61,7 @@ static GtOptionParser* gt_chseqids_option_parser_new(void *tool_arguments)
 {
   ChseqidsArguments *arguments = tool_arguments;
   GtOptionParser *op;
-  GtOption *option;
+  GtOption *sort_option, *option;
   gt_assert(arguments);
 
   /* init */
@@ -66,11 +70,21 @@ static GtOptionParser* gt_chseqids_option_parser_new(void *tool_arguments)
                          "mapping file.");
 
   /* -sort */
-  option = gt_option_new_bool("sort",
-                              "sort the GFF3 features after changing the "
-                              "sequence ids\n(memory consumption is "
-                              "proportional to the input file size)",
-                              &arguments->sort, false);
+  sort_option = gt_option_new_bool("sort",
+                                   "sort the GFF3 features after changing the "
+                                   "sequence ids\n(memory consumption is "
+                                   "proportional to the input file size, see "
+                                   "-memlimit)",
+                                   &arguments->sort, false);
+  gt_option_parser_add_option(op, sort_option);
+
+  /* -memlimit */
+  option = gt_option_new_string("memlimit", "limit the memory used for "
+                                "sorting (the keywords 'MB' and 'GB' are "
+                                "allowed), features exceeding the limit are "
+                                "sorted in temporary files",
+                                arguments->memlimitarg, NULL);
+  gt_option_imply(option, sort_option);
   gt_option_parser_add_option(op, option);
 
   /* -v */
@@ -87,6 +101,20 @@ static GtOptionParser* gt_chseqids_option_parser_new(void *tool_arguments)
   return op;
 }
 
+static int gt_chseqids_arguments_check(GT_UNUSED int rest_argc,
+                                       void *tool_arguments, GtError *err)
+{
+  ChseqidsArguments *arguments = tool_arguments;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(arguments);
+  if (gt_str_length(arguments->memlimitarg)) {
+    had_err = gt_option_parse_spacespec(&arguments->memlimit, "memlimit",
+                                        arguments->memlimitarg, err);
+  }
+  return had_err;
+}
+
 static int gt_chseqids_runnter(GT_UNUSED int argc, const char **argv,
                                int parsed_args, void *tool_arguments,
                                GtError *err)
@@ -112,6 +140,10 @@ static int gt_chseqids_runnter(GT_UNUSED int argc, const char **argv,
   if (!had_err) {
     if (arguments->sort) {
       sort_stream = gt_sort_stream_new(chseqids_stream);
+      if (arguments->memlimit) {
+        gt_sort_stream_set_memlimit((GtSortStream*) sort_stream,
+                                    arguments->memlimit);
+      }
       gff3_out_stream = gt_gff3_out_stream_new(sort_stream, arguments->outfp);
     }
     else {
@@ -138,6 +170,6 @@ GtTool* gt_chseqids(void)
   return gt_tool_new(gt_chseqids_arguments_new,
                      gt_chseqids_arguments_delete,
                      gt_chseqids_option_parser_new,
-                     NULL,
+                     gt_chseqids_arguments_check,
                      gt_chseqids_runnter);
 }
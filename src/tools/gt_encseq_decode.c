@@ -331,6 +331,12 @@ static int decode_sequence_file(const char *seqfile,
   if (!had_err && gt_encseq_options_lossless_value(args->eopts)) {
     gt_encseq_loader_require_lossless_support(encseq_loader);
   }
+  if (gt_encseq_options_prefault_value(args->eopts))
+    gt_encseq_loader_enable_prefault(encseq_loader);
+  if (gt_encseq_options_hugepages_value(args->eopts))
+    gt_encseq_loader_enable_hugepages(encseq_loader);
+  if (gt_encseq_options_interleave_value(args->eopts))
+    gt_encseq_loader_enable_numa_interleave(encseq_loader);
   if (!(encseq = gt_encseq_loader_load(encseq_loader, seqfile, err)))
     had_err = -1;
   if (!had_err && gt_encseq_options_mirrored_value(args->eopts)) {
@@ -35,9 +35,11 @@ typedef struct {
        target,
        verbose,
        showcoords,
-       retainids;
+       retainids,
+       streaming;
   unsigned int gcode;
-  GtStr *type;
+  GtStr *type,
+        *memlimitarg;
   GtSeqid2FileInfo *s2fi;
   GtUword width;
   GtOutputFileInfo *ofi;
@@ -48,6 +50,7 @@ static void* gt_extractfeat_arguments_new(void)
 {
   GtExtractFeatArguments *arguments = gt_calloc(1, sizeof *arguments);
   arguments->type = gt_str_new();
+  arguments->memlimitarg = gt_str_new();
   arguments->s2fi = gt_seqid2file_info_new();
   arguments->ofi = gt_output_file_info_new();
   return arguments;
@@ -60,6 +63,7 @@ static void gt_extractfeat_arguments_delete(void *tool_arguments)
   gt_file_delete(arguments->outfp);
   gt_output_file_info_delete(arguments->ofi);
   gt_seqid2file_info_delete(arguments->s2fi);
+  gt_str_delete(arguments->memlimitarg);
   gt_str_delete(arguments->type);
   gt_free(arguments);
 }
@@ -81,7 +85,7 @@ static GtOptionParser* gt_extractfeat_option_parser_new(void *tool_arguments)
 {
   GtExtractFeatArguments *arguments = tool_arguments;
   GtOptionParser *op;
-  GtOption *option;
+  GtOption *option, *streaming_option;
   gt_assert(arguments);
 
   op = gt_option_parser_new("[option ...] [GFF3_file]",
@@ -136,6 +140,23 @@ static GtOptionParser* gt_extractfeat_option_parser_new(void *tool_arguments)
                                   GT_STANDARD_TRANSLATION_SCHEME, 1U);
   gt_option_parser_add_option(op, option);
 
+  /* -streaming */
+  streaming_option = gt_option_new_bool("streaming", "count the IDs of the "
+                                        "GFF3 file before parsing it to keep "
+                                        "only incomplete features in memory "
+                                        "(not for stdin)",
+                                        &arguments->streaming, false);
+  gt_option_parser_add_option(op, streaming_option);
+
+  /* -memlimit */
+  option = gt_option_new_string("memlimit", "limit the memory used for "
+                                "streaming (the keywords 'MB' and 'GB' are "
+                                "allowed), complete features exceeding the "
+                                "limit are kept in temporary files",
+                                arguments->memlimitarg, NULL);
+  gt_option_imply(option, streaming_option);
+  gt_option_parser_add_option(op, option);
+
   /* -seqfile, -matchdesc, -usedesc and -regionmapping */
   gt_seqid2file_register_options(op, arguments->s2fi);
 
@@ -164,16 +185,26 @@ static int gt_extractfeat_runner(GT_UNUSED int argc, const char **argv,
   GtExtractFeatArguments *arguments = tool_arguments;
   GtRegionMapping *region_mapping;
   GtTransTable *ttable = NULL;
+  GtUword memlimit = 0;
   int had_err = 0;
 
   gt_error_check(err);
   gt_assert(arguments);
 
+  if (gt_str_length(arguments->memlimitarg)) {
+    had_err = gt_option_parse_spacespec(&memlimit, "memlimit",
+                                        arguments->memlimitarg, err);
+  }
+
   if (!had_err) {
     /* create gff3 input stream */
     gff3_in_stream = gt_gff3_in_stream_new_sorted(argv[parsed_args]);
     if (arguments->verbose)
       gt_gff3_in_stream_show_progress_bar((GtGFF3InStream*) gff3_in_stream);
+    if (arguments->streaming) {
+      gt_gff3_in_stream_enable_streaming((GtGFF3InStream*) gff3_in_stream,
+                                         memlimit);
+    }
 
     /* create region mapping */
     region_mapping = gt_seqid2file_region_mapping_new(arguments->s2fi, err);
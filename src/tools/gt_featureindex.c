@@ -24,6 +24,7 @@
 #include "extended/anno_db_gfflike_api.h"
 #include "extended/anno_db_schema_api.h"
 #include "extended/feature_index_api.h"
+#include "extended/feature_index_mapped_api.h"
 #include "extended/feature_node.h"
 #include "extended/feature_stream_api.h"
 #include "extended/gff3_visitor.h"
@@ -38,6 +39,7 @@
 
 #define GT_SQLITE_BACKEND_STRING "sqlite"
 #define GT_MYSQL_BACKEND_STRING  "mysql"
+#define GT_MAPPED_BACKEND_STRING "mapped"
 
 typedef struct {
   GtRange qry_rng;
@@ -95,6 +97,7 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
 #ifdef HAVE_MYSQL
     GT_MYSQL_BACKEND_STRING,
 #endif
+    GT_MAPPED_BACKEND_STRING,
     NULL
   };
   gt_assert(arguments);
@@ -121,12 +124,12 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
   backend_option = gt_option_new_choice("backend", "database backend to use\n"
                                         "choose from ["
 #ifdef HAVE_SQLITE
-                                         GT_SQLITE_BACKEND_STRING
+                                        GT_SQLITE_BACKEND_STRING "|"
 #endif
 #ifdef HAVE_MYSQL
-                                        "|" GT_MYSQL_BACKEND_STRING
+                                        GT_MYSQL_BACKEND_STRING "|"
 #endif
-                                        "]",
+                                        GT_MAPPED_BACKEND_STRING "]",
                                         arguments->backend, backends[0],
                                         backends);
   gt_option_parser_add_option(op, backend_option);
@@ -134,7 +137,7 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
   /* -filename */
   filenameoption = gt_option_new_string("filename",
                                         "filename for feature database "
-                                        "(sqlite backend only)",
+                                        "(sqlite and mapped backends only)",
                                         arguments->filename, NULL);
   gt_option_parser_add_option(op, filenameoption);
 
@@ -209,6 +212,7 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
   GtNodeVisitor *gff3visitor = NULL;
   GtGenomeNode *regn = NULL;
   GtUword i = 0;
+  bool mapped;
   int had_err = 0;
 
   gt_error_check(err);
@@ -247,15 +251,23 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
     }
   }
 #endif
-  if (!had_err)
-    adbs = gt_anno_db_gfflike_new();
+  mapped = (strcmp(gt_str_get(arguments->backend),
+                  GT_MAPPED_BACKEND_STRING) == 0);
+  if (!had_err && mapped) {
+    fi = gt_feature_index_mapped_new(gt_str_get(arguments->filename), err);
+    had_err = fi ? 0 : -1;
+  }
+  else {
+    if (!had_err)
+      adbs = gt_anno_db_gfflike_new();
 
-  if (!had_err && !adbs)
-    had_err = -1;
+    if (!had_err && !adbs)
+      had_err = -1;
 
-  if (!had_err) {
-    fi = gt_anno_db_schema_get_feature_index(adbs, rdb, err);
-    had_err = fi ? 0 : -1;
+    if (!had_err) {
+      fi = gt_anno_db_schema_get_feature_index(adbs, rdb, err);
+      had_err = fi ? 0 : -1;
+    }
   }
 
   if (!had_err && gt_str_length(arguments->seqid) == 0) {
@@ -316,7 +328,9 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
         }
       }
       gt_genome_node_accept(gn, gff3visitor, err);
-      gt_genome_node_delete(gn);
+      /* the nodes of a mapped index belong to the index */
+      if (!mapped)
+        gt_genome_node_delete(gn);
     }
   }
 
@@ -376,9 +376,11 @@ static int gt_genomediff_runner(int argc, const char **argv,
       gd_info.unit_info = unit_info;
       had_err = gt_runsuffixerator(doesa, &sopts, &gd_info, logger, err);
     }
-    if (!had_err && shusums != NULL) {
-      had_err = gt_genomediff_kr_calc(shusums, arguments, unit_info,
-                                      arguments->with_pck, logger, timer, err);
+    if (shusums != NULL) {
+      if (!had_err)
+        had_err = gt_genomediff_kr_calc(shusums, arguments, unit_info,
+                                        arguments->with_pck, logger, timer,
+                                        err);
       gt_array2dim_delete(shusums);
     }
   }
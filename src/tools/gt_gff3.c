@@ -19,7 +19,9 @@
 #include "core/ma.h"
 #include "core/option_api.h"
 #include "core/output_file_api.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
+#include "core/unused_api.h"
 #include "core/versionfunc.h"
 #include "extended/add_introns_stream_api.h"
 #include "extended/genome_node.h"
@@ -43,6 +45,7 @@ typedef struct {
   bool sort,
        sortlines,
        sortnum,
+       streaming,
        load,
        retainids,
        checkids,
@@ -55,8 +58,8 @@ typedef struct {
        show,
        fixboundaries;
   GtWord offset;
-  GtStr *offsetfile, *newsource;
-  GtUword width;
+  GtStr *offsetfile, *newsource, *memlimitarg;
+  GtUword width, memlimit;
   GtTypecheckInfo *tci;
   GtXRFCheckInfo *xci;
   GtOutputFileInfo *ofi;
@@ -68,6 +71,7 @@ static void* gt_gff3_arguments_new(void)
   GFF3Arguments *arguments = gt_calloc(1, sizeof *arguments);
   arguments->newsource = gt_str_new();
   arguments->offsetfile = gt_str_new();
+  arguments->memlimitarg = gt_str_new();
   arguments->tci = gt_typecheck_info_new();
   arguments->xci = gt_xrfcheck_info_new();
   arguments->ofi = gt_output_file_info_new();
@@ -84,6 +88,7 @@ static void gt_gff3_arguments_delete(void *tool_arguments)
   gt_typecheck_info_delete(arguments->tci);
   gt_xrfcheck_info_delete(arguments->xci);
   gt_str_delete(arguments->offsetfile);
+  gt_str_delete(arguments->memlimitarg);
   gt_free(arguments);
 }
 
@@ -94,7 +99,7 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   GtOption *sort_option, *load_option, *strict_option, *tidy_option,
            *mergefeat_option, *addintrons_option, *offset_option,
            *offsetfile_option, *setsource_option, *sortlines_option,
-           *sortnum_option, *option;
+           *sortnum_option, *streaming_option, *memlimit_option, *option;
   gt_assert(arguments);
 
   /* init */
@@ -104,7 +109,7 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   /* -sort */
   sort_option = gt_option_new_bool("sort", "sort the GFF3 features (memory "
                                    "consumption is proportional to the input "
-                                   "file size(s))",
+                                   "file size(s), see -memlimit)",
                                    &arguments->sort, false);
   gt_option_parser_add_option(op, sort_option);
 
@@ -123,6 +128,27 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, sortnum_option);
   gt_option_exclude(sortlines_option, sortnum_option);
 
+  /* -streaming */
+  streaming_option = gt_option_new_bool("streaming", "count the IDs of each "
+                                        "GFF3 file before parsing it to output "
+                                        "features as soon as they are "
+                                        "complete, even if the file contains "
+                                        "no '"GT_GFF_TERMINATOR"' lines (not "
+                                        "for stdin, see -memlimit)",
+                                        &arguments->streaming, false);
+  gt_option_parser_add_option(op, streaming_option);
+
+  /* -memlimit */
+  memlimit_option = gt_option_new_string("memlimit", "limit the memory used "
+                                         "for sorting or streaming (the "
+                                         "keywords 'MB' and 'GB' are "
+                                         "allowed), features exceeding the "
+                                         "limit are kept in temporary files",
+                                         arguments->memlimitarg, NULL);
+  gt_option_imply_either_4(memlimit_option, sort_option, sortlines_option,
+                           sortnum_option, streaming_option);
+  gt_option_parser_add_option(op, memlimit_option);
+
   /* -strict */
   strict_option = gt_option_new_bool("strict", "be very strict during GFF3 "
                                      "parsing (stricter than the specification "
@@ -243,6 +269,20 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   return op;
 }
 
+static int gt_gff3_arguments_check(GT_UNUSED int rest_argc,
+                                   void *tool_arguments, GtError *err)
+{
+  GFF3Arguments *arguments = tool_arguments;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(arguments);
+  if (gt_str_length(arguments->memlimitarg)) {
+    had_err = gt_option_parse_spacespec(&arguments->memlimit, "memlimit",
+                                        arguments->memlimitarg, err);
+  }
+  return had_err;
+}
+
 static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
                           void *tool_arguments, GtError *err)
 {
@@ -271,6 +311,14 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
     gt_gff3_in_stream_check_id_attributes((GtGFF3InStream*) gff3_in_stream);
   if (!arguments->addids)
     gt_gff3_in_stream_disable_add_ids(gff3_in_stream);
+  if (arguments->streaming) {
+    gt_gff3_in_stream_enable_streaming((GtGFF3InStream*) gff3_in_stream,
+                                       arguments->memlimit);
+  }
+  if (gt_jobs > 1U) {
+    gt_gff3_in_stream_enable_parallel_parsing((GtGFF3InStream*)
+                                              gff3_in_stream);
+  }
 
   last_stream = gff3_in_stream;
 
@@ -322,6 +370,10 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
   if (!had_err && (arguments->sort || arguments->sortlines ||
                    arguments->sortnum)) {
     sort_stream = gt_sort_stream_new(last_stream);
+    if (arguments->memlimit) {
+      gt_sort_stream_set_memlimit((GtSortStream*) sort_stream,
+                                  arguments->memlimit);
+    }
     last_stream = sort_stream;
   }
 
@@ -402,6 +454,6 @@ GtTool* gt_gff3(void)
   return gt_tool_new(gt_gff3_arguments_new,
                      gt_gff3_arguments_delete,
                      gt_gff3_option_parser_new,
-                     NULL,
+                     gt_gff3_arguments_check,
                      gt_gff3_runner);
 }
@@ -19,11 +19,14 @@
 #include "core/fileutils_api.h"
 #include "core/ma.h"
 #include "core/str_array_api.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "core/xposix.h"
 #include "extended/anno_db_gfflike_api.h"
 #include "extended/bed_in_stream.h"
 #include "extended/feature_index_api.h"
+#include "extended/feature_index_mapped_api.h"
+#include "extended/feature_index_memory_api.h"
 #include "extended/feature_stream_api.h"
 #include "extended/gff3_in_stream.h"
 #include "extended/gtf_in_stream.h"
@@ -37,6 +40,7 @@
 
 #define GT_SQLITE_BACKEND_STRING "sqlite"
 #define GT_MYSQL_BACKEND_STRING  "mysql"
+#define GT_MAPPED_BACKEND_STRING "mapped"
 
 typedef struct {
   GtStr *backend,
@@ -84,10 +88,13 @@ static GtOptionParser* gt_mkfeatureindex_option_parser_new(void *tool_arguments)
   GtOptionParser *op;
   GtOption *option, *backend_option, *filenameoption;
   static const char *backends[] = {
+#ifdef HAVE_SQLITE
     GT_SQLITE_BACKEND_STRING,
+#endif
 #ifdef HAVE_MYSQL
     GT_MYSQL_BACKEND_STRING,
 #endif
+    GT_MAPPED_BACKEND_STRING,
     NULL
   };
   static const char *inputs[] = {
@@ -111,12 +118,12 @@ static GtOptionParser* gt_mkfeatureindex_option_parser_new(void *tool_arguments)
   backend_option = gt_option_new_choice("backend", "database backend to use\n"
                                         "choose from ["
 #ifdef HAVE_SQLITE
-                                        GT_SQLITE_BACKEND_STRING
+                                        GT_SQLITE_BACKEND_STRING "|"
 #endif
 #ifdef HAVE_MYSQL
-                                        "|" GT_MYSQL_BACKEND_STRING
+                                        GT_MYSQL_BACKEND_STRING "|"
 #endif
-                                        "]",
+                                        GT_MAPPED_BACKEND_STRING "]",
                                         arguments->backend, backends[0],
                                         backends);
   gt_option_parser_add_option(op, backend_option);
@@ -130,7 +137,7 @@ static GtOptionParser* gt_mkfeatureindex_option_parser_new(void *tool_arguments)
   /* -filename */
   filenameoption = gt_option_new_string("filename",
                                         "filename for feature database "
-                                        "(sqlite backend only)",
+                                        "(sqlite and mapped backends only)",
                                         arguments->filename, NULL);
   gt_option_parser_add_option(op, filenameoption);
 
@@ -190,14 +197,19 @@ static int gt_mkfeatureindex_runner(int argc,
   GtRDB *rdb = NULL;
   GtAnnoDBSchema *adb = NULL;
   GtFeatureIndex *fis = NULL;
+  bool mapped;
   int had_err = 0;
 
   gt_error_check(err);
   gt_assert(arguments);
 
+  mapped = (strcmp(gt_str_get(arguments->backend),
+                  GT_MAPPED_BACKEND_STRING) == 0);
+  if (mapped
 #ifdef HAVE_SQLITE
-  if (strcmp(gt_str_get(arguments->backend),
-             GT_SQLITE_BACKEND_STRING) == 0) {
+      || strcmp(gt_str_get(arguments->backend), GT_SQLITE_BACKEND_STRING) == 0
+#endif
+     ) {
     if (gt_file_exists(gt_str_get(arguments->filename))) {
       if (arguments->force) {
         gt_xunlink(gt_str_get(arguments->filename));
@@ -207,11 +219,13 @@ static int gt_mkfeatureindex_runner(int argc,
         had_err = -1;
       }
     }
-    if (!had_err) {
-      rdb = gt_rdb_sqlite_new(gt_str_get(arguments->filename), err);
-      if (!rdb)
-        had_err = -1;
-    }
+  }
+#ifdef HAVE_SQLITE
+  if (!had_err && strcmp(gt_str_get(arguments->backend),
+                         GT_SQLITE_BACKEND_STRING) == 0) {
+    rdb = gt_rdb_sqlite_new(gt_str_get(arguments->filename), err);
+    if (!rdb)
+      had_err = -1;
   }
 #endif
 #ifdef HAVE_MYSQL
@@ -229,14 +243,21 @@ static int gt_mkfeatureindex_runner(int argc,
   }
 #endif
 
-  adb = gt_anno_db_gfflike_new();
-  if (!had_err && !adb)
-    had_err = -1;
-
-  if (!had_err) {
-    fis = gt_anno_db_schema_get_feature_index(adb, rdb, err);
-    if (!fis)
+  if (mapped) {
+    /* the mapped index is written from an index built in memory */
+    if (!had_err)
+      fis = gt_feature_index_memory_new();
+  }
+  else {
+    adb = gt_anno_db_gfflike_new();
+    if (!had_err && !adb)
       had_err = -1;
+
+    if (!had_err) {
+      fis = gt_anno_db_schema_get_feature_index(adb, rdb, err);
+      if (!fis)
+        had_err = -1;
+    }
   }
 
   if (!had_err) {
@@ -244,6 +265,10 @@ static int gt_mkfeatureindex_runner(int argc,
     {
       in_stream = gt_gff3_in_stream_new_unsorted(argc - parsed_args,
                                                  argv + parsed_args);
+      if (gt_jobs > 1U) {
+        gt_gff3_in_stream_enable_parallel_parsing((GtGFF3InStream*)
+                                                  in_stream);
+      }
       if (arguments->verbose)
         gt_gff3_in_stream_show_progress_bar((GtGFF3InStream*) in_stream);
     } else if (strcmp(gt_str_get(arguments->input), "bed") == 0)
@@ -262,7 +287,19 @@ static int gt_mkfeatureindex_runner(int argc,
     gt_assert(in_stream);
 
     feature_stream = gt_feature_stream_new(in_stream, fis);
-    had_err = gt_node_stream_pull(feature_stream, err);
+    had_err = gt_feature_index_bulk_load_begin(fis, err);
+    if (!had_err) {
+      had_err = gt_node_stream_pull(feature_stream, err);
+      if (!had_err)
+        had_err = gt_feature_index_bulk_load_end(fis, err);
+      else
+        (void) gt_feature_index_bulk_load_end(fis, NULL);
+    }
+  }
+  if (!had_err && mapped) {
+    had_err = gt_feature_index_mapped_write(fis,
+                                            gt_str_get(arguments->filename),
+                                            err);
   }
   gt_node_stream_delete(feature_stream);
   gt_node_stream_delete(in_stream);
@@ -92,6 +92,8 @@ typedef struct {
   bool verbose;
   bool histogram;
   bool use_kmerfile;
+  bool pipeline_parts;
+  bool prefault, hugepages, interleave;
   bool trimstat_on;
   bool use_apos, use_apos_track_all, compute_ani;
   GtUword maxmat;
@@ -604,6 +606,17 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
   gt_option_is_development_option(op_pick);
   gt_option_parser_add_option(op, op_pick);
 
+  /* -pipelineparts */
+  option = gt_option_new_bool("pipelineparts",
+                              "Extract the k-mers of the next part of the "
+                              "1st sequence set while the current part is "
+                              "extended (requires option -parts, more than "
+                              "one thread and -kmerfile no)",
+                              &arguments->pipeline_parts,
+                              false);
+  gt_option_imply(option, op_part);
+  gt_option_parser_add_option(op, option);
+
   /* -histogram */
   option = gt_option_new_bool("histogram",
                               "Calculate histogram to determine size of mlist",
@@ -619,6 +632,30 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
                               true);
   gt_option_parser_add_option(op, option);
 
+  /* -prefault */
+  option = gt_option_new_bool("prefault",
+                              "Read the sequence indexes into memory right "
+                              "after mapping them",
+                              &arguments->prefault,
+                              false);
+  gt_option_parser_add_option(op, option);
+
+  /* -hugepages */
+  option = gt_option_new_bool("hugepages",
+                              "Copy the sequence indexes into memory backed "
+                              "by huge pages",
+                              &arguments->hugepages,
+                              false);
+  gt_option_parser_add_option(op, option);
+
+  /* -interleave */
+  option = gt_option_new_bool("interleave",
+                              "Copy the sequence indexes into memory "
+                              "interleaved across all NUMA nodes",
+                              &arguments->interleave,
+                              false);
+  gt_option_parser_add_option(op, option);
+
   /* -v */
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
@@ -730,6 +767,21 @@ static double gt_seed_extend_ani_evaluate(GtUword sum_of_aligned_len,
              : 0.0;
 }
 
+static GtEncseqLoader *gt_seed_extend_encseq_loader_new(
+                                      const GtSeedExtendArguments *arguments)
+{
+  GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
+
+  gt_encseq_loader_require_multiseq_support(encseq_loader);
+  if (arguments->prefault)
+    gt_encseq_loader_enable_prefault(encseq_loader);
+  if (arguments->hugepages)
+    gt_encseq_loader_enable_hugepages(encseq_loader);
+  if (arguments->interleave)
+    gt_encseq_loader_enable_numa_interleave(encseq_loader);
+  return encseq_loader;
+}
+
 static int gt_seed_extend_runner(int argc,
                                  const char **argv,
                                  GT_UNUSED int parsed_args,
@@ -838,8 +890,8 @@ static int gt_seed_extend_runner(int argc,
     }
   }
   if (!had_err) {
-    GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
-    gt_encseq_loader_require_multiseq_support(encseq_loader);
+    GtEncseqLoader *encseq_loader
+      = gt_seed_extend_encseq_loader_new(arguments);
     gt_encseq_loader_require_ssp_tab(encseq_loader);
     if (out_display_flag != NULL &&
         gt_querymatch_subjectid_display(out_display_flag))
@@ -864,8 +916,8 @@ static int gt_seed_extend_runner(int argc,
       bencseq = gt_encseq_ref(aencseq);
     } else
     {
-      GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
-      gt_encseq_loader_require_multiseq_support(encseq_loader);
+      GtEncseqLoader *encseq_loader
+        = gt_seed_extend_encseq_loader_new(arguments);
       gt_encseq_loader_require_ssp_tab(encseq_loader);
       if (out_display_flag != NULL &&
           gt_querymatch_queryid_display(out_display_flag))
@@ -1164,6 +1216,7 @@ static int gt_seed_extend_runner(int argc,
                                     arguments->dbs_debug_kmer,
                                     arguments->dbs_debug_seedpair,
                                     arguments->use_kmerfile,
+                                    arguments->pipeline_parts,
                                     arguments->trimstat_on,
                                     arguments->maxmat,
                                     arguments->chainarguments,
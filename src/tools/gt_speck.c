@@ -39,7 +39,8 @@
 #include "tools/gt_speck.h"
 
 typedef struct {
-  GtStr *specfile, *format;
+  GtStr *specfile, *format, *memlimitarg;
+  GtUword memlimit;
   bool verbose,
        colored,
        fail_hard,
@@ -56,6 +57,7 @@ static void *gt_speck_arguments_new(void)
   SpeccheckArguments *arguments = gt_calloc(1, sizeof *arguments);
   arguments->specfile = gt_str_new();
   arguments->format = gt_str_new();
+  arguments->memlimitarg = gt_str_new();
   arguments->s2fi = gt_seqid2file_info_new();
   arguments->ofi = gt_output_file_info_new();
   arguments->tci = gt_typecheck_info_new();
@@ -69,6 +71,7 @@ static void gt_speck_arguments_delete(void *tool_arguments)
   if (!arguments) return;
   gt_str_delete(arguments->specfile);
   gt_str_delete(arguments->format);
+  gt_str_delete(arguments->memlimitarg);
   gt_file_delete(arguments->outfp);
   gt_seqid2file_info_delete(arguments->s2fi);
   gt_output_file_info_delete(arguments->ofi);
@@ -79,7 +82,7 @@ static void gt_speck_arguments_delete(void *tool_arguments)
 static GtOptionParser* gt_speck_option_parser_new(void *tool_arguments)
 {
   GtOptionParser *op;
-  GtOption *option;
+  GtOption *option, *sort_option;
   SpeccheckArguments *arguments = tool_arguments;
 
   /* init */
@@ -102,9 +105,18 @@ static GtOptionParser* gt_speck_option_parser_new(void *tool_arguments)
                               &arguments->provideindex, false);
   gt_option_parser_add_option(op, option);
 
-  option = gt_option_new_bool("sort", "sort input before checking (requires "
-                              "O(n) memory for n input features)",
-                              &arguments->sort, false);
+  sort_option = gt_option_new_bool("sort", "sort input before checking "
+                                   "(requires O(n) memory for n input "
+                                   "features, see -memlimit)",
+                                   &arguments->sort, false);
+  gt_option_parser_add_option(op, sort_option);
+
+  option = gt_option_new_string("memlimit", "limit the memory used for "
+                                "sorting (the keywords 'MB' and 'GB' are "
+                                "allowed), features exceeding the limit are "
+                                "kept in temporary files",
+                                arguments->memlimitarg, NULL);
+  gt_option_imply(option, sort_option);
   gt_option_parser_add_option(op, option);
 
   option = gt_option_new_bool("failhard", "stop processing and report runtime "
@@ -130,7 +142,7 @@ static GtOptionParser* gt_speck_option_parser_new(void *tool_arguments)
 
 static int gt_speck_arguments_check(GT_UNUSED int rest_argc,
                                     void *tool_arguments,
-                                    GT_UNUSED GtError *err)
+                                    GtError *err)
 {
   SpeccheckArguments *arguments = tool_arguments;
   int had_err = 0;
@@ -143,7 +155,12 @@ static int gt_speck_arguments_check(GT_UNUSED int rest_argc,
     arguments->colored = false;
   }
 
-  return had_err = 0;
+  if (gt_str_length(arguments->memlimitarg)) {
+    had_err = gt_option_parse_spacespec(&arguments->memlimit, "memlimit",
+                                        arguments->memlimitarg, err);
+  }
+
+  return had_err;
 }
 
 static void gt_speck_record_warning(void *data, const char *format, va_list ap)
@@ -245,6 +262,10 @@ static int gt_speck_runner(int argc, const char **argv, int parsed_args,
     /* insert sort stream if requested */
     if (arguments->sort) {
       last_stream = sort_stream = gt_sort_stream_new(last_stream);
+      if (arguments->memlimit) {
+        gt_sort_stream_set_memlimit((GtSortStream*) sort_stream,
+                                    arguments->memlimit);
+      }
     }
 
     /* if -provideindex is given, collect input features and index them first */
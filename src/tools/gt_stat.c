@@ -34,7 +34,9 @@ typedef struct {
        cds_length_distribution,
        used_sources,
        addintrons,
+       streaming,
        verbose;
+  GtStr *memlimitarg;
   GtOutputFileInfo *ofi;
   GtFile *outfp;
 } StatArguments;
@@ -42,6 +44,7 @@ typedef struct {
 static void* gt_stat_argument_new(void)
 {
   StatArguments *arguments = gt_calloc(1, sizeof *arguments);
+  arguments->memlimitarg = gt_str_new();
   arguments->ofi = gt_output_file_info_new();
   return arguments;
 }
@@ -51,6 +54,7 @@ static void gt_stat_arguments_delete(void *tool_arguments)
   StatArguments *arguments = tool_arguments;
   if (!arguments) return;
   gt_file_delete(arguments->outfp);
+  gt_str_delete(arguments->memlimitarg);
   gt_output_file_info_delete(arguments->ofi);
   gt_free(arguments);
 }
@@ -59,7 +63,7 @@ static GtOptionParser* gt_stat_option_parser_new(void *tool_arguments)
 {
   StatArguments *arguments = tool_arguments;
   GtOptionParser *op;
-  GtOption *option;
+  GtOption *option, *addintrons_option, *streaming_option;
 
   op = gt_option_parser_new("[option ...] [GFF3_file ...]",
                             "Show statistics about features contained in GFF3 "
@@ -107,9 +111,28 @@ static GtOptionParser* gt_stat_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, option);
 
   /* -addintrons */
-  option = gt_option_new_bool("addintrons", "add intron features between "
-                              "existing exon features (before computing stats)",
-                              &arguments->addintrons, false);
+  addintrons_option = gt_option_new_bool("addintrons", "add intron features "
+                                         "between existing exon features "
+                                         "(before computing stats, requires "
+                                         "sorting, see -memlimit)",
+                                         &arguments->addintrons, false);
+  gt_option_parser_add_option(op, addintrons_option);
+
+  /* -streaming */
+  streaming_option = gt_option_new_bool("streaming", "count the IDs of each "
+                                        "GFF3 file before parsing it to keep "
+                                        "only incomplete features in memory "
+                                        "(not for stdin)",
+                                        &arguments->streaming, false);
+  gt_option_parser_add_option(op, streaming_option);
+
+  /* -memlimit */
+  option = gt_option_new_string("memlimit", "limit the memory used for "
+                                "sorting or streaming (the keywords 'MB' and "
+                                "'GB' are allowed), features exceeding the "
+                                "limit are kept in temporary files",
+                                arguments->memlimitarg, NULL);
+  gt_option_imply_either_2(option, addintrons_option, streaming_option);
   gt_option_parser_add_option(op, option);
 
   /* -v */
@@ -126,20 +149,34 @@ static int gt_stat_runner(int argc, const char **argv, int parsed_args,
                           void *tool_arguments, GtError *err)
 {
   StatArguments *arguments = tool_arguments;
-  GtNodeStream *gff3_in_stream, *sort_stream, *add_introns_stream = NULL,
-               *stat_stream;
+  GtNodeStream *gff3_in_stream, *sort_stream = NULL,
+               *add_introns_stream = NULL, *stat_stream;
+  GtUword memlimit = 0;
   int had_err;
   gt_error_check(err);
 
+  if (gt_str_length(arguments->memlimitarg)) {
+    had_err = gt_option_parse_spacespec(&memlimit, "memlimit",
+                                        arguments->memlimitarg, err);
+    if (had_err)
+      return had_err;
+  }
+
   /* create a gff3 input stream */
   gff3_in_stream = gt_gff3_in_stream_new_unsorted(argc - parsed_args,
                                                   argv + parsed_args);
   if (arguments->verbose)
     gt_gff3_in_stream_show_progress_bar((GtGFF3InStream*) gff3_in_stream);
+  if (arguments->streaming) {
+    gt_gff3_in_stream_enable_streaming((GtGFF3InStream*) gff3_in_stream,
+                                       memlimit);
+  }
 
   /* create add introns stream if -addintrons was used */
   if (arguments->addintrons) {
     sort_stream = gt_sort_stream_new(gff3_in_stream);
+    if (memlimit)
+      gt_sort_stream_set_memlimit((GtSortStream*) sort_stream, memlimit);
     add_introns_stream = gt_add_introns_stream_new(sort_stream);
   }
 
@@ -164,6 +201,8 @@ static int gt_stat_runner(int argc, const char **argv, int parsed_args,
 
   /* free */
   gt_node_stream_delete(stat_stream);
+  gt_node_stream_delete(add_introns_stream);
+  gt_node_stream_delete(sort_stream);
   gt_node_stream_delete(gff3_in_stream);
 
   return had_err;
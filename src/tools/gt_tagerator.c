@@ -173,6 +173,13 @@ static GtOptionParser* gt_tagerator_option_parser_new(void *tool_arguments)
                               &arguments->nowildcards, true);
   gt_option_parser_add_option(op, option);
 
+  option = gt_option_new_uword("batch",
+                               "search the tags in batches of the given size "
+                               "and extend their matches in lock-step; only "
+                               "for exact matching (-e 0) with option -pck",
+                               &arguments->batchsize, 0);
+  gt_option_parser_add_option(op, option);
+
   option = gt_option_new_string_array("output",
                                       gt_str_get(arguments->outputhelp),
                                       arguments->outputspec);
@@ -231,6 +238,14 @@ static int gt_tagerator_arguments_check(GT_UNUSED int rest_argc,
       return -1;
     }
   }
+  if (arguments->batchsize > 0 &&
+      (arguments->withesa || arguments->userdefinedmaxdistance != 0 ||
+       arguments->doonline || arguments->docompare))
+  {
+    gt_error_set(err,"option -batch requires options -pck and -e 0 and "
+                     "cannot be combined with options -online and -cmp");
+    return -1;
+  }
   for (idx=0; idx<gt_str_array_size(arguments->outputspec); idx++)
   {
     if (gt_optionargaddbitmask(outputmodedesctable,
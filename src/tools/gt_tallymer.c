@@ -34,6 +34,7 @@
 #include "match/tyr-show.h"
 #include "match/tyr-search.h"
 #include "match/tyr-mersplit.h"
+#include "match/tyr-merhash.h"
 #include "match/tyr-occratio.h"
 #include "tools/gt_tallymer.h"
 
@@ -59,8 +60,10 @@ typedef struct
   Prefixlengthvalue prefixlength;
   GtOption *refoptionpl;
   GtStr *str_storeindex,
-        *str_inputindex;
+        *str_inputindex,
+        *str_inputencseq;
   bool storecounts,
+       storehash,
        performtest,
        verbose,
        scanfile;
@@ -72,6 +75,7 @@ static void *gt_tyr_mkindex_arguments_new(void)
     = gt_malloc(sizeof (Tyr_mkindex_options));
   arguments->str_storeindex = gt_str_new();
   arguments->str_inputindex = gt_str_new();
+  arguments->str_inputencseq = gt_str_new();
   return arguments;
 }
 
@@ -85,6 +89,7 @@ static void gt_tyr_mkindex_arguments_delete(void *tool_arguments)
   }
   gt_str_delete(arguments->str_storeindex);
   gt_str_delete(arguments->str_inputindex);
+  gt_str_delete(arguments->str_inputencseq);
   gt_option_delete(arguments->refoptionpl);
   gt_free(arguments);
 }
@@ -98,22 +103,35 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
            *optionpl,
            *optionstoreindex,
            *optionstorecounts,
+           *optionstorehash,
            *optionscan,
-           *optionesa;
+           *optionesa,
+           *optionii;
   Tyr_mkindex_options *arguments = tool_arguments;
 
-  op = gt_option_parser_new("[options] -esa suffixerator-index [options]",
+  op = gt_option_parser_new("[options] (-esa suffixerator-index | "
+                            "-ii encseq-index) [options]",
                             "Count and index k-mers in the given enhanced "
-                            "suffix array for a fixed value of k.");
+                            "suffix array or encoded sequence for a fixed "
+                            "value of k.");
   gt_option_parser_set_mail_address(op, "<kurtz@zbh.uni-hamburg.de>");
 
-  optionesa = gt_option_new_string("esa","specify suffixerator-index\n"
-                                   "(mandatory option)",
+  optionesa = gt_option_new_string("esa","specify suffixerator-index",
                                    arguments->str_inputindex,
                                    NULL);
-  gt_option_is_mandatory(optionesa);
   gt_option_parser_add_option(op, optionesa);
 
+  optionii = gt_option_new_string("ii","specify encoded sequence index; "
+                                  "the k-mers are counted\n"
+                                  "by sorting their codes with the given "
+                                  "number of threads\n"
+                                  "instead of traversing an enhanced suffix "
+                                  "array\n(requires DNA and mersize <= 30)",
+                                  arguments->str_inputencseq,
+                                  NULL);
+  gt_option_parser_add_option(op, optionii);
+  gt_option_is_mandatory_either(optionesa, optionii);
+
   option = gt_option_new_uword("mersize",
                                "Specify the mer size.",
                                &arguments->mersize,
@@ -157,6 +175,13 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
                                          &arguments->storecounts,false);
   gt_option_parser_add_option(op, optionstorecounts);
 
+  optionstorehash = gt_option_new_bool("hash",
+                                       "store a hash table over the mers for "
+                                       "constant time lookups by\n"
+                                       "gt tallymer search -hash",
+                                       &arguments->storehash,false);
+  gt_option_parser_add_option(op, optionstorehash);
+
   option = gt_option_new_bool("test", "perform tests to verify program "
                                       "correctness", &arguments->performtest,
                                       false);
@@ -173,8 +198,11 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
 
+  gt_option_exclude(optionesa, optionii);
+  gt_option_exclude(optionscan, optionii);
   gt_option_imply(optionpl, optionstoreindex);
   gt_option_imply(optionstorecounts, optionstoreindex);
+  gt_option_imply(optionstorehash, optionstoreindex);
   gt_option_imply_either_2(optionstoreindex,optionminocc,optionmaxocc);
   return op;
 }
@@ -256,20 +284,43 @@ static int gt_tyr_mkindex_runner(GT_UNUSED int argc,
     {
       printf("# storeindex=%s\n",gt_str_get(arguments->str_storeindex));
     }
-    printf("# inputindex=%s\n",gt_str_get(arguments->str_inputindex));
+    if (gt_str_length(arguments->str_inputencseq) > 0)
+    {
+      printf("# inputencseq=%s\n",gt_str_get(arguments->str_inputencseq));
+    } else
+    {
+      printf("# inputindex=%s\n",gt_str_get(arguments->str_inputindex));
+    }
   }
-  if (gt_merstatistics(gt_str_get(arguments->str_inputindex),
-                    arguments->mersize,
-                    arguments->userdefinedminocc,
-                    arguments->userdefinedmaxocc,
-                    gt_str_get(arguments->str_storeindex),
-                    arguments->storecounts,
-                    arguments->scanfile,
-                    arguments->performtest,
-                    logger,
-                    err) != 0)
+  if (gt_str_length(arguments->str_inputencseq) > 0)
   {
-    haserr = true;
+    if (gt_merstatistics_encseq(gt_str_get(arguments->str_inputencseq),
+                                arguments->mersize,
+                                arguments->userdefinedminocc,
+                                arguments->userdefinedmaxocc,
+                                gt_str_get(arguments->str_storeindex),
+                                arguments->storecounts,
+                                arguments->performtest,
+                                logger,
+                                err) != 0)
+    {
+      haserr = true;
+    }
+  } else
+  {
+    if (gt_merstatistics(gt_str_get(arguments->str_inputindex),
+                         arguments->mersize,
+                         arguments->userdefinedminocc,
+                         arguments->userdefinedmaxocc,
+                         gt_str_get(arguments->str_storeindex),
+                         arguments->storecounts,
+                         arguments->scanfile,
+                         arguments->performtest,
+                         logger,
+                         err) != 0)
+    {
+      haserr = true;
+    }
   }
   if (!haserr &&
       gt_str_length(arguments->str_storeindex) > 0 &&
@@ -291,6 +342,13 @@ static int gt_tyr_mkindex_runner(GT_UNUSED int argc,
       haserr = true;
     }
   }
+  if (!haserr && arguments->storehash)
+  {
+    if (gt_constructmerhash(gt_str_get(arguments->str_storeindex),err) != 0)
+    {
+      haserr = true;
+    }
+  }
   gt_logger_delete(logger);
   return haserr ? - 1 : 0;
 }
@@ -796,7 +854,8 @@ typedef struct
   GtStrArray *showmodespec;
   unsigned int strand,
                showmode;
-  bool verbose,
+  bool usehash,
+       verbose,
        performtest;
 } Tyr_search_options;
 
@@ -866,6 +925,13 @@ static GtOptionParser *gt_tyr_search_option_parser_new(void *tool_arguments)
                                       arguments->showmodespec);
   gt_option_parser_add_option(op, option);
 
+  option = gt_option_new_bool("hash",
+                              "look up the mers in the hash table stored by "
+                              "gt tallymer mkindex -hash instead of\n"
+                              "searching them in the mer buckets",
+                              &arguments->usehash,false);
+  gt_option_parser_add_option(op, option);
+
   option = gt_option_new_bool("test", "perform tests to verify program "
                                       "correctness", &arguments->performtest,
                                       false);
@@ -941,6 +1007,7 @@ static int gt_tyr_search_runner(GT_UNUSED int argc,
                    arguments->queryfilenames,
                    arguments->showmode,
                    arguments->strand,
+                   arguments->usehash,
                    arguments->verbose,
                    arguments->performtest,
                    err) != 0)
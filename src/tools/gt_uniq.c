@@ -18,10 +18,11 @@
 #include "core/ma_api.h"
 #include "core/option_api.h"
 #include "core/output_file_api.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "core/versionfunc.h"
 #include "extended/genome_node.h"
-#include "extended/gff3_in_stream_api.h"
+#include "extended/gff3_in_stream.h"
 #include "extended/gff3_out_stream_api.h"
 #include "extended/gtdatahelp.h"
 #include "extended/uniq_stream_api.h"
@@ -87,6 +88,12 @@ static int gt_uniq_runner(GT_UNUSED int argc, const char **argv,
 
   /* create gff3 input stream */
   gff3_in_stream = gt_gff3_in_stream_new_sorted(argv[parsed_args]);
+  if (gt_jobs > 1U) {
+    /* the input is sorted, so it is split into chunks at sequence ID changes
+       as well */
+    gt_gff3_in_stream_enable_parallel_parsing((GtGFF3InStream*)
+                                              gff3_in_stream);
+  }
   if (arguments->verbose && arguments->outfp)
     gt_gff3_in_stream_show_progress_bar((GtGFF3InStream*) gff3_in_stream);
 
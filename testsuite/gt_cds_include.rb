@@ -12,6 +12,18 @@ require 'fileutils'
   end
 end
 
+1.upto(14) do |i|
+  Name "gt cds test #{i} (parallel)"
+  Keywords "gt_cds parallel"
+  Test do
+    FileUtils.copy "#{$testdata}gt_cds_test_#{i}.fas", "."
+    run_test "#{$bin}gt -j 4 cds -minorflen 1 -startcodon yes " \
+             "-seqfile gt_cds_test_#{i}.fas -matchdesc " \
+             "#{$testdata}gt_cds_test_#{i}.in"
+    run "diff #{last_stdout} #{$testdata}gt_cds_test_#{i}.out"
+  end
+end
+
 Name "gt cds error message"
 Keywords "gt_cds"
 Test do
@@ -21,6 +33,16 @@ Test do
   grep last_stderr, "Has the sequence-region to sequence mapping been defined correctly"
 end
 
+Name "gt cds error message (parallel)"
+Keywords "gt_cds parallel"
+Test do
+  FileUtils.copy "#{$testdata}gt_cds_test_1.fas", "."
+  run "#{$bin}gt gff3 -offset 1000 #{$testdata}gt_cds_test_1.in | " \
+      "#{$bin}gt -j 4 cds -matchdesc -seqfile gt_cds_test_1.fas -",
+      :retval => 1
+  grep last_stderr, "Has the sequence-region to sequence mapping been defined correctly"
+end
+
 1.upto(14) do |i|
   Name "gt cds test #{i} (-usedesc)"
   Keywords "gt_cds usedesc"
@@ -114,6 +136,17 @@ Test do
   run "diff #{last_stdout} #{$testdata}nGASP/resIIIcds.gff3"
 end
 
+Name "gt cds test (nGASP, parallel)"
+Keywords "gt_cds nGASP parallel"
+Test do
+  # the sequence file is not indexed yet
+  FileUtils.copy "#{$testdata}nGASP/III.fas", "."
+  run_test "#{$bin}gt -j 4 cds -startcodon yes -finalstopcodon no " \
+           "-minorflen 64 -seqfile III.fas -usedesc " \
+           "#{$testdata}nGASP/resIII.gff3"
+  run "diff #{last_stdout} #{$testdata}nGASP/resIIIcds.gff3"
+end
+
 Name "gt cds test (U89959)"
 Keywords "gt_cds"
 Test do
@@ -123,6 +156,16 @@ Test do
   run      "diff #{last_stdout} #{$testdata}U89959_cds.gff3"
 end
 
+Name "gt cds test (U89959, parallel)"
+Keywords "gt_cds parallel"
+Test do
+  # the sequence file is not indexed yet
+  FileUtils.copy "#{$testdata}U89959_genomic.fas", "."
+  run_test "#{$bin}gt -j 4 cds -seqfile U89959_genomic.fas " \
+           "-matchdesc #{$testdata}U89959_csas.gff3"
+  run      "diff #{last_stdout} #{$testdata}U89959_cds.gff3"
+end
+
 Name "gt cds test (not sorted)"
 Keywords "gt_cds"
 Test do
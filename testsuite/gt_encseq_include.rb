@@ -442,3 +442,39 @@ Test do
     end
   end
 end
+
+Name "gt encseq encode multithreaded"
+Keywords "encseq gt_encseq_encode threads"
+Test do
+  [["Atinsert.fna", "U89959_genomic.fas"], ["fastq_long.fastq"],
+   ["Atinsert.embl"], ["shorten_desc.gbk"]].each do |files|
+    inputs = files.map { |f| "#{$testdata}#{f}" }.join(" ")
+    ["1", "3"].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} encseq encode -des -sds -ssp -md5 " + \
+               "-indexname foo#{jobs} #{inputs}"
+    end
+    ["esq", "des", "sds", "ssp", "md5"].each do |sfx|
+      if File.exist?("foo1.#{sfx}")
+        run "cmp foo1.#{sfx} foo3.#{sfx}"
+      end
+    end
+  end
+  run_test "#{$bin}gt -j 3 encseq encode -indexname foo " + \
+           "#{$testdata}solid_color_reads.fastq", :retval => 1
+  grep last_stderr, /illegal character \'3\'/
+end
+
+Name "gt encseq decode with placement hints"
+Keywords "encseq gt_encseq_decode placement"
+Test do
+  run_test "#{$bin}gt encseq encode -des -sds -ssp -lossless " + \
+           "-indexname foo #{$testdata}Atinsert.fna " + \
+           "#{$testdata}U89959_genomic.fas"
+  run_test "#{$bin}gt encseq decode -lossless foo"
+  run "mv #{last_stdout} default.out"
+  ["-prefault", "-hugepages", "-interleave",
+   "-prefault -hugepages -interleave"].each do |opts|
+    run_test "#{$bin}gt encseq decode -lossless #{opts} foo"
+    run "cmp #{last_stdout} default.out"
+  end
+end
@@ -65,4 +65,58 @@ if not $arguments["nordb"] then
     end
   end
 
+  Name "gt featureindex db vs. parser (bulk load, -j 4)"
+  Keywords "gt_featureindex"
+  Test do
+    file = "#{$testdata}/encode_known_genes_Mar07.gff3"
+    run "#{$bin}gt seqids #{file}"
+    seqids = File.open(last_stdout).readlines
+    run "#{$bin}gt -j 4 mkfeatureindex -filename tmp.db #{file}",
+        :maxtime => 1200
+    seqids.each do |seqid|
+      seqid.chomp!
+      run "#{$bin}gt featureindex -seqid #{seqid} -retain no -filename tmp.db > out.gff3"
+      run "#{$bin}gt gff3 -retainids no #{file} | #{$bin}gt select -seqid #{seqid}"
+      run "diff out.gff3 #{last_stdout}"
+    end
+  end
+
+end
+
+Name "gt featureindex -backend mapped (corrupt file)"
+Keywords "gt_featureindex mapped"
+Test do
+  File.open("corrupt.fi", "w") do |file|
+    file.write("sdfnhsnl")
+  end
+  run "#{$bin}gt featureindex -backend mapped -filename corrupt.fi", :retval => 1
+  grep(last_stderr, /not a mapped feature index/)
+end
+
+Name "gt featureindex -backend mapped (invalid sequence ID)"
+Keywords "gt_featureindex mapped"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.fi #{$testdata}/standard_gene_simple.gff3"
+  run "#{$bin}gt featureindex -backend mapped -seqid foo -filename tmp.fi", :retval => 1
+  grep(last_stderr, /not exist/)
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.fi #{$testdata}/standard_gene_simple.gff3", :retval => 1
+  grep(last_stderr, /exists already/)
+end
+
+["eden.gff3", "standard_gene_simple.gff3", "standard_gene_as_tree.gff3",
+ "standard_gene_with_introns_as_tree.gff3",
+ "encode_known_genes_Mar07.gff3"].each do |file|
+  Name "gt featureindex -backend mapped vs. parser (#{file})"
+  Keywords "gt_featureindex mapped"
+  Test do
+    run "#{$bin}gt seqids #{$testdata}/#{file}"
+    seqids = File.open(last_stdout).readlines
+    run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.fi #{$testdata}/#{file}"
+    seqids.each do |seqid|
+      seqid.chomp!
+      run "#{$bin}gt featureindex -backend mapped -seqid #{seqid} -retain no -filename tmp.fi > out.gff3"
+      run "#{$bin}gt gff3 -retainids no #{$testdata}/#{file} | #{$bin}gt select -seqid #{seqid}"
+      run "diff out.gff3 #{last_stdout}"
+    end
+  end
 end
@@ -1560,6 +1560,117 @@ Test do
   run "#{$bin}gt gff3 #{$testdata}/double_free.gff3", :retval => 1
 end
 
+Name "gt gff3 (parallel parsing)"
+Keywords "gt_gff3 parallel"
+Test do
+  # blank lines after the terminators make every chunk issue warnings
+  run "sed '/^###/G' #{$testdata}encode_known_genes_Mar07.gff3 > in.gff3"
+  run_test "#{$bin}gt gff3 -retainids in.gff3 > 1"
+  run "cp #{last_stderr} 1.err"
+  run_test "#{$bin}gt -j 4 gff3 -retainids in.gff3 > 2"
+  grep last_stderr, /skipping blank line/
+  run "cp #{last_stderr} 2.err"
+  run "diff 1 2"
+  run "diff 1.err 2.err"
+  run_test "#{$bin}gt gff3 #{$testdata}/corrupt_large.gff3", :retval => 1
+  run "cp #{last_stderr} 1.err"
+  run_test "#{$bin}gt -j 4 gff3 #{$testdata}/corrupt_large.gff3", :retval => 1
+  grep last_stderr, /not a valid character/
+  run "diff 1.err #{last_stderr}"
+end
+
+Name "gt uniq (parallel parsing, errors after the first chunk)"
+Keywords "gt_gff3 gt_uniq parallel"
+Test do
+  # a sorted file of several MB without terminators, its chunks are split
+  # at sequence ID changes
+  run 'awk \'BEGIN {print "##gff-version 3"; ' +
+      'for (s = 1; s <= 6; s++) printf("##sequence-region seq%d 1 200000\n", ' +
+      's); for (s = 1; s <= 6; s++) for (i = 1; i <= 12000; i++) ' +
+      'printf("seq%d\t.\tgene\t%d\t%d\t.\t+\t.\tID=gene%d_%d\n", s, ' +
+      '10 * i, 10 * i + 5, s, i)}\' > in.gff3'
+  run_test "#{$bin}gt uniq in.gff3 > 1"
+  run_test "#{$bin}gt -j 4 uniq in.gff3 > 2"
+  run "diff 1 2"
+  # an ID of the first sequence reused on the fifth one
+  run "sed 's/ID=gene5_1$/ID=gene1_5/' in.gff3 > dupid.gff3"
+  run_test "#{$bin}gt uniq dupid.gff3", :retval => 1
+  grep last_stderr, /different sequence id/
+  run "cp #{last_stderr} 1.err"
+  run_test "#{$bin}gt -j 4 uniq dupid.gff3", :retval => 1
+  run "diff 1.err #{last_stderr}"
+  # an invalid strand on the fourth sequence
+  run "sed '/ID=gene4_100$/s/+/x/' in.gff3 > strand.gff3"
+  run_test "#{$bin}gt uniq strand.gff3", :retval => 1
+  grep last_stderr, /not a valid character/
+  run "cp #{last_stderr} 1.err"
+  run_test "#{$bin}gt -j 4 uniq strand.gff3", :retval => 1
+  run "diff 1.err #{last_stderr}"
+end
+
+Name "gt gff3 -sort -memlimit"
+Keywords "gt_gff3 memlimit"
+Test do
+  run_test "#{$bin}gt gff3 -sort -retainids #{$testdata}encode_known_genes_Mar07.gff3 > 1"
+  run_test "#{$bin}gt gff3 -sort -retainids -memlimit 1MB #{$testdata}encode_known_genes_Mar07.gff3 > 2"
+  run "diff 1 2"
+end
+
+Name "gt gff3 -sort -memlimit (multi-pass merge)"
+Keywords "gt_gff3 memlimit"
+Test do
+  # about 75 runs of 1MB each, more than are merged at once
+  run 'awk \'BEGIN {srand(7); print "##gff-version 3"; ' +
+      'for (i = 1; i <= 150000; i++) {s = int(rand() * 5) + 1; ' +
+      'st = int(rand() * 100000) + 1; ' +
+      'printf("seq%d\t.\tgene\t%d\t%d\t.\t+\t.\tName=g%d\n", s, st, ' +
+      'st + 10, i)}}\' > in.gff3'
+  run_test "#{$bin}gt gff3 -sort in.gff3 > 1"
+  run_test "#{$bin}gt gff3 -sort -memlimit 1MB in.gff3 > 2", :maxtime => 120
+  run "diff 1 2"
+end
+
+Name "gt gff3 -streaming"
+Keywords "gt_gff3 streaming"
+Test do
+  ["unsorted_gff3_file.txt", "standard_gene_as_tree.gff3",
+   "addintrons.gff3", "encode_known_genes_Mar07.gff3"].each do |file|
+    run_test "#{$bin}gt gff3 -retainids #{$testdata}#{file} > 1"
+    run_test "#{$bin}gt gff3 -retainids -streaming #{$testdata}#{file} > 2"
+    run "diff 1 2"
+  end
+end
+
+Name "gt gff3 -streaming -memlimit (unsorted)"
+Keywords "gt_gff3 streaming memlimit"
+Test do
+  # move the first child to the end, so that all complete graphs have to wait
+  # for the first one and are spilled to disk
+  run "grep -v '^###' #{$testdata}encode_known_genes_Mar07.gff3 > sorted.gff3"
+  run "awk '!moved && /Parent=/ {last=$0; moved=1; next} {print} " +
+      "END {print last}' sorted.gff3 > unsorted.gff3"
+  run_test "#{$bin}gt gff3 -retainids unsorted.gff3 > 1"
+  run_test "#{$bin}gt gff3 -retainids -streaming -memlimit 1MB " +
+           "unsorted.gff3 > 2"
+  run "diff 1 2"
+end
+
+Name "gt gff3 -streaming (stdin)"
+Keywords "gt_gff3 streaming"
+Test do
+  run_test "#{$bin}gt gff3 #{$testdata}eden.gff3 > 1"
+  run_test "#{$bin}gt gff3 -streaming < #{$testdata}eden.gff3 > 2"
+  grep last_stderr, /cannot be read twice/
+  run "diff 1 2"
+end
+
+Name "gt gff3 -memlimit (wrong argument)"
+Keywords "gt_gff3 memlimit"
+Test do
+  run_test "#{$bin}gt gff3 -sort -memlimit 100 #{$testdata}encode_known_genes_Mar07.gff3", :retval => 1
+  grep last_stderr, /MB and GB/
+end
+
 def large_gff3_test(name, file)
   Name "gt gff3 #{name}"
   Keywords "gt_gff3 large_gff3"
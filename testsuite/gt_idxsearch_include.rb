@@ -49,6 +49,12 @@ def checktagerator(queryfile,ms)
     run_test "#{$bin}gt prebwt -maxdepth 4 -pck pck", :maxtime => 180
     run_test("#{$bin}gt tagerator -rw -cmp -e 0 -pck pck -q patternfile",
              :maxtime => 240)
+    run_test("#{$bin}gt tagerator -rw -e 0 -pck pck -q patternfile",
+             :maxtime => 240)
+    run "mv #{last_stdout} tmp.single"
+    run_test("#{$bin}gt tagerator -rw -e 0 -pck pck -q patternfile " +
+             "-batch 7",:maxtime => 240)
+    run "diff #{last_stdout} tmp.single"
     run_test("#{$bin}gt tagerator -rw -cmp -e 1 -pck pck -q patternfile",
              :maxtime => 240)
     run_test("#{$bin}gt tagerator -rw -cmp -e 2 -pck pck -q patternfile",
@@ -156,6 +156,37 @@ Test do
                          :chkintegrity => 800, :chksearch => 400 })
 end
 
+Name "gt packedindex mkindex multithreaded"
+Keywords "gt_packedindex threads"
+Test do
+  ["at1MB","RandomN.fna"].each do |filename|
+    run_test "#{$bin}gt packedindex mkindex -tis -sprank -bsize 8 " +
+             "-locfreq 16 -indexname seq -db #{$testdata}#{filename}",
+             :maxtime => 400
+    run_test "#{$bin}gt -j 4 packedindex mkindex -tis -sprank -bsize 8 " +
+             "-locfreq 16 -indexname par -db #{$testdata}#{filename}",
+             :maxtime => 400
+    run "cmp seq.bdx par.bdx"
+    run "cmp seq.sds par.sds"
+    run_test "#{$bin}gt suffixerator -tis -bwt -suf -indexname par " +
+             "-db #{$testdata}#{filename}", :maxtime => 400
+    run_test "#{$bin}gt packedindex chkintegrity -ticks 1000 par",
+             :maxtime => 800
+  end
+end
+
+Name "gt packedindex mkindex locate tradeoff"
+Keywords "gt_packedindex"
+Test do
+  run_test "#{$bin}gt packedindex mkindex -tis -locfreq 8 -v " +
+           "-indexname pck -db #{$testdata}Atinsert.fna"
+  grep last_stdout, /every 8-th position sampled/
+  grep last_stdout, /at most 7 LF-mapping steps/
+  run_test "#{$bin}gt packedindex mkindex -tis -locfreq 0 -v " +
+           "-indexname pck -db #{$testdata}Atinsert.fna"
+  grep last_stdout, /no locate information stored/
+end
+
 if $gttestdata then
   Name "gt packedindex check tools for chr01 yeast"
   Keywords "gt_packedindex"
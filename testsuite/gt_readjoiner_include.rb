@@ -1093,6 +1093,39 @@ Test do
   run "diff reads.contigs.fas #$testdata/readjoiner/3_varlen_seq.contigs.fas"
 end
 
+Name "gt readjoiner assembly -redtrans: -j 1 vs -j 2"
+Keywords "gt_readjoiner gt_readjoiner_redtrans"
+Test do
+  run "cp #{$testdata}/U89959_genomic.fas genome.fas"
+  run "#{$bin}gt shredder -coverage 20 -minlength 80 -maxlength 120 " +
+      "genome.fas"
+  run_prefilter(last_stdout)
+  run "#{$bin}gt -j 2 readjoiner overlap -readset reads -l 40 -elimtrans no"
+  run "#{$bin}gt -j 1 readjoiner assembly -readset reads -spmfiles 2 -redtrans"
+  run "mv reads.contigs.fas contigs.j1.fas"
+  run "#{$bin}gt -j 2 readjoiner assembly -readset reads -spmfiles 2 -redtrans"
+  run "diff reads.contigs.fas contigs.j1.fas"
+end
+
+Name "gt readjoiner assembly -errors: -j 1 vs -j 2"
+Keywords "gt_readjoiner gt_readjoiner_errors"
+Test do
+  run "cp #{$testdata}/U89959_genomic.fas genome.fas"
+  run "#{$bin}gt shredder -coverage 20 -minlength 80 -maxlength 120 " +
+      "genome.fas"
+  run "#{$bin}gt seqmutate -rate 1 #{last_stdout}"
+  run_prefilter(last_stdout)
+  run "#{$bin}gt -j 2 readjoiner overlap -readset reads -l 40 -elimtrans no"
+  run "#{$bin}gt -j 1 readjoiner assembly -readset reads -spmfiles 2 " +
+      "-errors -v"
+  run "cp #{last_stdout} log.j1"
+  run "mv reads.contigs.fas contigs.j1.fas"
+  run "#{$bin}gt -j 2 readjoiner assembly -readset reads -spmfiles 2 " +
+      "-errors -v"
+  run "diff #{last_stdout} log.j1"
+  run "diff reads.contigs.fas contigs.j1.fas"
+end
+
 # gfa
 [1, 2].each do |gfa_version|
   %w{30x_long_varlen contained_varlen 30x_800nt 70x_100nt}.each do |fasta|
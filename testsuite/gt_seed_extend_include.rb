@@ -294,6 +294,43 @@ Test do
   end
 end
 
+# the wordwise lcp computations must agree with the characterwise ones
+Name "gt seed_extend: wordwise vs. characterwise extension"
+Keywords "gt_seed_extend cam wordwise"
+Test do
+  run_test build_encseq("U89959", "#{$testdata}U89959_genomic.fas")
+  run_test "#{$bin}gt encseq encode -sat direct -des yes -sds yes -md5 no " +
+           "-indexname U89959-direct #{$testdata}U89959_genomic.fas"
+  ["bytes,bytes", "any,any"].each do |cam|
+    ["", " -cam_generic"].each do |generic|
+      run_test "#{$bin}gt seed_extend -extendgreedy -l 20 -cam #{cam}" +
+               "#{generic} -ii U89959"
+      run "grep -v '^#' #{last_stdout}"
+      run "sort #{last_stdout}"
+      run "mv #{last_stdout} greedy-#{cam}#{generic.tr(' ', '')}.matches"
+    end
+    run "cmp greedy-#{cam}.matches greedy-#{cam}-cam_generic.matches"
+  end
+  # the two bit encoding complements the query on the reverse strand
+  ["", " -cam_generic"].each do |generic|
+    run_test "#{$bin}gt seed_extend -extendgreedy -no-forward#{generic} " +
+             "-ii U89959"
+    run "grep -v '^#' #{last_stdout}"
+    run "sort #{last_stdout}"
+    run "mv #{last_stdout} greedy-rc#{generic.tr(' ', '')}.matches"
+  end
+  run "grep -q ' P ' greedy-rc.matches"
+  run "cmp greedy-rc.matches greedy-rc-cam_generic.matches"
+  # no two bit encoding for direct access, so characters are compared singly
+  ["U89959", "U89959-direct"].each do |indexname|
+    run_test "#{$bin}gt seed_extend -extendxdrop -l 20 -ii #{indexname}"
+    run "grep -v '^#' #{last_stdout}"
+    run "sort #{last_stdout}"
+    run "mv #{last_stdout} xdrop-#{indexname}.matches"
+  end
+  run "cmp xdrop-U89959.matches xdrop-U89959-direct.matches"
+end
+
 if $gttestdata
   Name "gt seed_extend: -splt bytestring for many short and some long seqs"
   Keywords "gt_seed_extend bytestring"
@@ -340,6 +377,10 @@ Test do
         run_test "#{$bin}gt -j 3 seed_extend -ii #{dataset}#{query}"
         run "sort #{last_stdout}"
         run "diff -I '^#' default_run.out #{last_stdout}"
+        run_test "#{$bin}gt -j 3 seed_extend -ii #{dataset}#{query} " +
+                 "-parts 3 -kmerfile no -pipelineparts"
+        run "sort #{last_stdout}"
+        run "diff -I '^#' default_run.out #{last_stdout}"
       end
     end
   end
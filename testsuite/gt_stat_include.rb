@@ -101,3 +101,13 @@ Keywords "gt_stat"
 Test do
   run_test "#{$bin}gt stat #{$testdata}minimal_fasta.gff3"
 end
+
+Name "gt stat (-addintrons -memlimit)"
+Keywords "gt_stat memlimit"
+Test do
+  run_test "#{$bin}gt stat -addintrons -intronlengthdistri " +
+           "#{$testdata}encode_known_genes_Mar07.gff3 > 1"
+  run_test "#{$bin}gt stat -addintrons -intronlengthdistri -memlimit 1MB " +
+           "#{$testdata}encode_known_genes_Mar07.gff3 > 2"
+  run "diff 1 2"
+end
@@ -211,6 +211,44 @@ Test do
   run "cmp u8.reads.esq u8.reads2.esq"
 end
 
+Name "gt suffixerator -sain"
+Keywords "gt_suffixerator sain"
+Test do
+  ["at1MB","Random.fna","RandomN.fna","sw100K1.fsa"].each do |filename|
+    if filename == "sw100K1.fsa"
+      dirlist = ["fwd","rev"]
+    else
+      dirlist = alldir
+    end
+    dirlist.each do |dirarg|
+      ["1","4"].each do |jobs|
+        run_test "#{$bin}gt -j #{jobs} suffixerator -tis -suf -bwt -bck " +
+                 "-lcp -dir #{dirarg} -indexname sfx-sain -sain " +
+                 "-db #{$testdata}#{filename}"
+        run_test "#{$bin}gt suffixerator -tis -suf -bwt -bck -lcp " +
+                 "-dir #{dirarg} -indexname sfx -db #{$testdata}#{filename}"
+        ["suf","bwt","bck","lcp","llv"].each do |suffix|
+          run "cmp sfx.#{suffix} sfx-sain.#{suffix}"
+        end
+        # without -bck no suffixes are counted or inserted into buckets
+        run_test "#{$bin}gt -j #{jobs} suffixerator -tis -suf -bwt " +
+                 "-lcp -dir #{dirarg} -indexname sfx-sain -sain " +
+                 "-db #{$testdata}#{filename}"
+        ["suf","bwt","lcp","llv"].each do |suffix|
+          run "cmp sfx.#{suffix} sfx-sain.#{suffix}"
+        end
+      end
+    end
+  end
+  run_test "#{$bin}gt genomediff -sain -indexname sfx " +
+           "#{$testdata}Atinsert.fna #{$testdata}Random.fna", :retval => 1
+  grep last_stderr, /option -sain cannot be used to compute the shulen/
+  run_test "#{$bin}gt -j 4 dev sain -suf -file #{$testdata}at1MB"
+  run "mv at1MB.suf at1MB-j4.suf"
+  run_test "#{$bin}gt dev sain -suf -file #{$testdata}at1MB"
+  run "cmp at1MB.suf at1MB-j4.suf"
+end
+
 Name "gt suffixerator -dc 64 -dccheck -lcp -parts 1+3"
 Keywords "gt_suffixerator dc"
 Test do
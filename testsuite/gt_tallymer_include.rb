@@ -49,6 +49,53 @@ runtyrmkifail("-mersize 21 -pl")
 runtyrmkifail("-mersize 21 -pl -minocc")
 runtyrmkifail("-pl -minocc 30 -maxocc 40")
 
+Name "gt tallymer search -hash"
+Keywords "gt_tallymer"
+Test do
+  run_test "#{$bin}gt suffixerator -pl -dna -tis -suf -lcp " +
+           "-indexname sfxidx -db #{$testdata}at1MB", :maxtime => 360
+  [12, 20, 40].each do |mersize|
+    run_test "#{$bin}gt tallymer mkindex -counts -pl -hash " +
+             "-mersize #{mersize} -minocc 2 -maxocc 30 " +
+             "-indexname tyr-index -esa sfxidx"
+    searchcall = "#{$bin}gt tallymer search -strand fp -output qseqnum " +
+                 "qpos counts sequence -test -tyr tyr-index " +
+                 "-q #{$testdata}U89959_genomic.fas"
+    run_test searchcall
+    run "mv #{last_stdout} tyrsearch.bck"
+    run_test "#{searchcall} -hash"
+    run "cmp #{last_stdout} tyrsearch.bck"
+  end
+end
+
+Name "gt tallymer mkindex -ii"
+Keywords "gt_tallymer"
+Test do
+  run_test "#{$bin}gt suffixerator -dna -tis -suf -lcp -indexname sfxidx " +
+           "-db #{$testdata}at1MB #{$testdata}U89959_genomic.fas",
+           :maxtime => 360
+  [5, 20, 30].each do |mersize|
+    ["-minocc 2", "-maxocc 3"].each do |occ|
+      run_test "#{$bin}gt tallymer mkindex -counts -pl -mersize #{mersize} " +
+               "#{occ} -indexname tyr-esa -esa sfxidx"
+      [1, 3].each do |jobs|
+        run_test "#{$bin}gt -j #{jobs} tallymer mkindex -counts -pl " +
+                 "-mersize #{mersize} #{occ} -indexname tyr-ii -ii sfxidx"
+        ["mer", "mct", "mbd"].each do |suffix|
+          run "cmp tyr-esa.#{suffix} tyr-ii.#{suffix}"
+        end
+      end
+    end
+  end
+  run_test "#{$bin}gt tallymer mkindex -mersize 14 -maxocc 2 -esa sfxidx"
+  run "mv #{last_stdout} tyrstat.esa"
+  run_test "#{$bin}gt -j 2 tallymer mkindex -mersize 14 -maxocc 2 -test " +
+           "-ii sfxidx"
+  run "cmp #{last_stdout} tyrstat.esa"
+  run_test "#{$bin}gt tallymer mkindex -mersize 31 -maxocc 2 -ii sfxidx",
+           :retval => 1
+end
+
 if $gttestdata then
   tyrfiles.each_pair do |reffile,mersize|
     Name "gt tallymer #{reffile}"